@@ -0,0 +1,71 @@
+/**
+ *  A benchmark executable that compares the throughput (shell quartets per second) of the in-house McMurchie-Davidson two-electron integral engine with the one of the Libint two-electron integral engine, on the same shell quartets of a cyclic water tetramer in a 6-31G basisset.
+ */
+
+#include "Basis/Integrals/IntegralEngine.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Molecule/Molecule.hpp"
+#include "Operator/FirstQuantized/Operator.hpp"
+
+#include <benchmark/benchmark.h>
+
+
+/**
+ *  Calculate all shell quartets with the given engine.
+ */
+template <typename Engine>
+void calculateAllQuartets(benchmark::State& state, Engine& engine, const std::vector<GQCP::GTOShell>& shells) {
+
+    const auto nsh = shells.size();
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        for (size_t i = 0; i < nsh; i++) {
+            for (size_t j = 0; j < nsh; j++) {
+                for (size_t k = 0; k < nsh; k++) {
+                    for (size_t l = 0; l < nsh; l++) {
+                        const auto buffer = engine.calculate(shells[i], shells[j], shells[k], shells[l]);
+
+                        benchmark::DoNotOptimize(buffer);  // Make sure that the variable is not optimized away by compiler.
+                    }
+                }
+            }
+        }
+    }
+
+    state.counters["Shells"] = nsh;
+    state.counters["Quartets"] = benchmark::Counter(nsh * nsh * nsh * nsh, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+
+/**
+ *  Calculate all shell quartets with the Libint engine.
+ */
+static void libint(benchmark::State& state) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_tetramer.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};  // only s- and p-shells, so the Cartesian and spherical shells coincide
+    const auto shell_set = scalar_basis.shellSet();
+
+    auto engine = GQCP::IntegralEngine::Libint(GQCP::Operator::Coulomb(), shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+    calculateAllQuartets(state, engine, shell_set.asVector());
+}
+
+
+/**
+ *  Calculate all shell quartets with the in-house engine.
+ */
+static void in_house(benchmark::State& state) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_tetramer.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};  // only s- and p-shells, so the Cartesian and spherical shells coincide
+    const auto shell_set = scalar_basis.shellSet();
+
+    auto engine = GQCP::IntegralEngine::InHouse(GQCP::Operator::Coulomb(), shell_set.maximumAngularMomentum());
+    calculateAllQuartets(state, engine, shell_set.asVector());
+}
+
+
+BENCHMARK(libint)->Unit(benchmark::kMillisecond);
+BENCHMARK(in_house)->Unit(benchmark::kMillisecond);
+BENCHMARK_MAIN();
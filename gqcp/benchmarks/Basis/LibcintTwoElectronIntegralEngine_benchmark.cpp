@@ -0,0 +1,81 @@
+/**
+ *  A benchmark executable that compares the throughput (shell quartets per second) of the libcint two-electron integral engine for a cyclic water tetramer in a 6-31G basisset, when the shells are passed by value (and have to be looked up in the engine's shell set) and when they are passed by index together with a caller-owned buffer.
+ */
+
+#include "Basis/Integrals/IntegralEngine.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Molecule/Molecule.hpp"
+#include "Operator/FirstQuantized/Operator.hpp"
+
+#include <benchmark/benchmark.h>
+
+
+/**
+ *  Calculate all shell quartets through the shell-based API, which looks up every shell in the engine's shell set.
+ */
+static void quartets_by_shell(benchmark::State& state) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_tetramer.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};  // only s- and p-shells, so the Cartesian and spherical shells coincide
+    const auto shell_set = scalar_basis.shellSet();
+    const auto& shells = shell_set.asVector();
+    const auto nsh = shells.size();
+
+    auto engine = GQCP::IntegralEngine::Libcint(GQCP::Operator::Coulomb(), shell_set);
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        for (size_t i = 0; i < nsh; i++) {
+            for (size_t j = 0; j < nsh; j++) {
+                for (size_t k = 0; k < nsh; k++) {
+                    for (size_t l = 0; l < nsh; l++) {
+                        const auto buffer = engine.calculate(shells[i], shells[j], shells[k], shells[l]);
+
+                        benchmark::DoNotOptimize(buffer);  // Make sure that the variable is not optimized away by compiler.
+                    }
+                }
+            }
+        }
+    }
+
+    state.counters["Shells"] = nsh;
+    state.counters["Quartets"] = benchmark::Counter(nsh * nsh * nsh * nsh, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+
+/**
+ *  Calculate all shell quartets through the index-based API, with a caller-owned buffer.
+ */
+static void quartets_by_index(benchmark::State& state) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_tetramer.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};  // only s- and p-shells, so the Cartesian and spherical shells coincide
+    const auto shell_set = scalar_basis.shellSet();
+    const auto nsh = shell_set.numberOfShells();
+
+    const auto engine = GQCP::IntegralEngine::Libcint(GQCP::Operator::Coulomb(), shell_set);
+    GQCP::LibcintTwoElectronIntegralBuffer<double, 1> buffer {engine.maximumBufferSize()};
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        for (size_t i = 0; i < nsh; i++) {
+            for (size_t j = 0; j < nsh; j++) {
+                for (size_t k = 0; k < nsh; k++) {
+                    for (size_t l = 0; l < nsh; l++) {
+                        engine.calculate(i, j, k, l, buffer);
+
+                        benchmark::DoNotOptimize(buffer.data());  // Make sure that the calculation is not optimized away by compiler.
+                    }
+                }
+            }
+        }
+    }
+
+    state.counters["Shells"] = nsh;
+    state.counters["Quartets"] = benchmark::Counter(nsh * nsh * nsh * nsh, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+
+BENCHMARK(quartets_by_shell)->Unit(benchmark::kMillisecond);
+BENCHMARK(quartets_by_index)->Unit(benchmark::kMillisecond);
+BENCHMARK_MAIN();
@@ -0,0 +1,87 @@
+/**
+ *  A benchmark executable that compares the performance of the calculation of the one- and two-electron integrals of a cyclic water tetramer in a cc-pVDZ basisset (96 basis functions) for an increasing number of threads. The serial calculation over the canonical shell quartets is included as a reference, so that the speedup only reflects the number of threads.
+ */
+
+#include "Basis/Integrals/IntegralCalculator.hpp"
+#include "Basis/Integrals/ParallelIntegralCalculator.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Molecule/Molecule.hpp"
+#include "Operator/FirstQuantized/Operator.hpp"
+
+#include <benchmark/benchmark.h>
+
+
+static void ThreadCounts(benchmark::internal::Benchmark* b) {
+    for (int i = 1; i <= 16; i *= 2) {  // need int instead of size_t
+        b->Args({i});                   // number of threads
+    }
+}
+
+
+/**
+ *  The serial calculation of the two-electron integrals over the canonical shell quartets.
+ */
+static void coulomb_serial(benchmark::State& state) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_tetramer.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "cc-pVDZ"};
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        const auto g = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis);
+
+        benchmark::DoNotOptimize(g);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.counters["Basis functions"] = scalar_basis.numberOfBasisFunctions();
+}
+
+
+/**
+ *  The calculation of the two-electron integrals over the canonical shell quartets, by a number of threads.
+ */
+static void coulomb_parallel(benchmark::State& state) {
+
+    const size_t number_of_threads = state.range(0);
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_tetramer.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "cc-pVDZ"};
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        const auto g = GQCP::ParallelIntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis, number_of_threads);
+
+        benchmark::DoNotOptimize(g);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.counters["Basis functions"] = scalar_basis.numberOfBasisFunctions();
+    state.counters["Threads"] = number_of_threads;
+}
+
+
+/**
+ *  The calculation of the nuclear attraction integrals, by a number of threads.
+ */
+static void nuclear_attraction_parallel(benchmark::State& state) {
+
+    const size_t number_of_threads = state.range(0);
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_tetramer.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "cc-pVDZ"};
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        const auto V = GQCP::ParallelIntegralCalculator::calculateLibintIntegrals(GQCP::Operator::NuclearAttraction(molecule), scalar_basis, number_of_threads);
+
+        benchmark::DoNotOptimize(V);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.counters["Basis functions"] = scalar_basis.numberOfBasisFunctions();
+    state.counters["Threads"] = number_of_threads;
+}
+
+
+BENCHMARK(coulomb_serial)->Unit(benchmark::kMillisecond);
+BENCHMARK(coulomb_parallel)->Unit(benchmark::kMillisecond)->Apply(ThreadCounts)->UseRealTime();
+BENCHMARK(nuclear_attraction_parallel)->Unit(benchmark::kMillisecond)->Apply(ThreadCounts)->UseRealTime();
+BENCHMARK_MAIN();
@@ -1,7 +1,8 @@
 /**
- *  A benchmark executable that times the performance of one FCI matrix-vector product in a full spin-resolved ONV basis with 10 orbitals and 2 to 5 electron pairs.
+ *  A benchmark executable that times the performance of one FCI matrix-vector product in a full spin-resolved ONV basis with 10 orbitals and 2 to 5 electron pairs. The thread scaling of the matrix-vector product is measured for 12 orbitals and 6 electron pairs, using 1 to 32 threads.
  */
 
+#include "ONVBasis/SpinResolvedSigmaEngine.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "QCModel/CI/LinearExpansion.hpp"
 
@@ -15,6 +16,13 @@ static void CustomArguments(benchmark::internal::Benchmark* b) {
 }
 
 
+static void ThreadArguments(benchmark::internal::Benchmark* b) {
+    for (int i = 1; i <= 32; i *= 2) {  // need int instead of size_t
+        b->Args({12, 6, i});             // spatial orbitals, electron pairs, threads
+    }
+}
+
+
 static void matvec(benchmark::State& state) {
 
     const size_t K = state.range(0);    // number of spatial orbitals
@@ -41,5 +49,35 @@ static void matvec(benchmark::State& state) {
 }
 
 
+static void matvec_threads(benchmark::State& state) {
+
+    const size_t K = state.range(0);                  // number of spatial orbitals
+    const size_t N_P = state.range(1);                // number of electron pairs
+    const size_t number_of_threads = state.range(2);  // number of threads
+
+
+    // Prepare the second-quantized Hamiltonian, set up the full spin-resolved ONV basis and prepare a multithreaded sigma engine.
+    // Note that the Hamiltonian is not necessarily expressed in an orthonormal basis, but this doesn't matter here.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::Random(K);
+    const GQCP::SpinResolvedONVBasis onv_basis {K, N_P, N_P};
+    const GQCP::SpinResolvedSigmaEngine sigma_engine {onv_basis, hamiltonian, number_of_threads};
+
+    const auto x = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::Random(onv_basis).coefficients();
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        const auto matvec = sigma_engine.evaluateMatrixVectorProduct(x);
+
+        benchmark::DoNotOptimize(matvec);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.counters["Spatial orbitals"] = K;
+    state.counters["Electron pairs"] = N_P;
+    state.counters["Threads"] = number_of_threads;
+    state.counters["Dimension"] = onv_basis.dimension();
+}
+
+
 BENCHMARK(matvec)->Unit(benchmark::kMillisecond)->Apply(CustomArguments);
+BENCHMARK(matvec_threads)->Unit(benchmark::kMillisecond)->UseRealTime()->Apply(ThreadArguments);
 BENCHMARK_MAIN();
@@ -0,0 +1,181 @@
+/**
+ *  A benchmark executable that compares the performance of one FCI matrix-vector product in a full spin-resolved ONV basis with 10 orbitals and 2 to 5 electron pairs, with and without preparing the operator-dependent intermediates beforehand, and with and without exploiting the symmetry of a singlet coefficient matrix. Furthermore, the matrix-vector products for a block of 6 vectors are compared with 6 separate matrix-vector products.
+ */
+
+#include "ONVBasis/SpinResolvedSigmaEngine.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+#include "QCModel/CI/LinearExpansion.hpp"
+
+#include <benchmark/benchmark.h>
+
+
+static void CustomArguments(benchmark::internal::Benchmark* b) {
+    for (int i = 2; i < 6; ++i) {  // need int instead of size_t
+        b->Args({10, i});          // spatial orbitals, electron pairs
+    }
+}
+
+
+/**
+ *  The matrix-vector product as it was performed in every Davidson iteration: all intermediates are re-calculated in every call.
+ */
+static void matvec_unprepared(benchmark::State& state) {
+
+    const size_t K = state.range(0);    // number of spatial orbitals
+    const size_t N_P = state.range(1);  // number of electron pairs
+
+
+    // Prepare the second-quantized Hamiltonian and set up the full spin-resolved ONV basis.
+    // Note that the Hamiltonian is not necessarily expressed in an orthonormal basis, but this doesn't matter here.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::Random(K);
+    const GQCP::SpinResolvedONVBasis onv_basis {K, N_P, N_P};
+
+    const auto x = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::Random(onv_basis).coefficients();
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        const auto matvec = onv_basis.evaluateOperatorMatrixVectorProduct(hamiltonian, x);
+
+        benchmark::DoNotOptimize(matvec);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.counters["Spatial orbitals"] = K;
+    state.counters["Electron pairs"] = N_P;
+    state.counters["Dimension"] = onv_basis.dimension();
+}
+
+
+/**
+ *  The matrix-vector product through a sigma engine, whose intermediates are prepared once (outside of the measured loop).
+ */
+static void matvec_prepared(benchmark::State& state) {
+
+    const size_t K = state.range(0);    // number of spatial orbitals
+    const size_t N_P = state.range(1);  // number of electron pairs
+
+
+    // Prepare the second-quantized Hamiltonian, set up the full spin-resolved ONV basis and prepare the sigma engine.
+    // Note that the Hamiltonian is not necessarily expressed in an orthonormal basis, but this doesn't matter here.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::Random(K);
+    const GQCP::SpinResolvedONVBasis onv_basis {K, N_P, N_P};
+    const GQCP::SpinResolvedSigmaEngine sigma_engine {onv_basis, hamiltonian};
+
+    const auto x = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::Random(onv_basis).coefficients();
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        const auto matvec = sigma_engine.evaluateMatrixVectorProduct(x);
+
+        benchmark::DoNotOptimize(matvec);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.counters["Spatial orbitals"] = K;
+    state.counters["Electron pairs"] = N_P;
+    state.counters["Dimension"] = onv_basis.dimension();
+}
+
+
+/**
+ *  The matrix-vector product through a prepared sigma engine, for a coefficient vector whose coefficient matrix is symmetric (e.g. a singlet).
+ */
+static void matvec_singlet(benchmark::State& state) {
+
+    const size_t K = state.range(0);    // number of spatial orbitals
+    const size_t N_P = state.range(1);  // number of electron pairs
+
+
+    // Prepare the second-quantized Hamiltonian, set up the full spin-resolved ONV basis and prepare the sigma engine.
+    // Note that the Hamiltonian is not necessarily expressed in an orthonormal basis, but this doesn't matter here.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::Random(K);
+    const GQCP::SpinResolvedONVBasis onv_basis {K, N_P, N_P};
+    const GQCP::SpinResolvedSigmaEngine sigma_engine {onv_basis, hamiltonian};
+
+    const auto dim = onv_basis.alpha().dimension();
+    const GQCP::MatrixX<double> A = GQCP::MatrixX<double>::Random(dim, dim);
+    const GQCP::MatrixX<double> A_symmetric = A + A.transpose();
+    const GQCP::VectorX<double> x = Eigen::Map<const Eigen::VectorXd>(A_symmetric.data(), A_symmetric.size());
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        const auto matvec = sigma_engine.evaluateSingletMatrixVectorProduct(x);
+
+        benchmark::DoNotOptimize(matvec);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.counters["Spatial orbitals"] = K;
+    state.counters["Electron pairs"] = N_P;
+    state.counters["Dimension"] = onv_basis.dimension();
+}
+
+
+/**
+ *  Six separate matrix-vector products through a prepared sigma engine.
+ */
+static void matvec_repeated(benchmark::State& state) {
+
+    const size_t K = state.range(0);    // number of spatial orbitals
+    const size_t N_P = state.range(1);  // number of electron pairs
+    const size_t number_of_vectors = 6;
+
+
+    // Prepare the second-quantized Hamiltonian, set up the full spin-resolved ONV basis and prepare the sigma engine.
+    // Note that the Hamiltonian is not necessarily expressed in an orthonormal basis, but this doesn't matter here.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::Random(K);
+    const GQCP::SpinResolvedONVBasis onv_basis {K, N_P, N_P};
+    const GQCP::SpinResolvedSigmaEngine sigma_engine {onv_basis, hamiltonian};
+
+    const GQCP::MatrixX<double> X = GQCP::MatrixX<double>::Random(onv_basis.dimension(), number_of_vectors);
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        for (size_t k = 0; k < number_of_vectors; k++) {
+            const GQCP::VectorX<double> x = X.col(k);
+            const auto matvec = sigma_engine.evaluateMatrixVectorProduct(x);
+
+            benchmark::DoNotOptimize(matvec);  // Make sure that the variable is not optimized away by compiler.
+        }
+    }
+
+    state.counters["Spatial orbitals"] = K;
+    state.counters["Electron pairs"] = N_P;
+    state.counters["Dimension"] = onv_basis.dimension();
+}
+
+
+/**
+ *  The matrix-vector products for a block of six vectors through a prepared sigma engine.
+ */
+static void matvec_block(benchmark::State& state) {
+
+    const size_t K = state.range(0);    // number of spatial orbitals
+    const size_t N_P = state.range(1);  // number of electron pairs
+    const size_t number_of_vectors = 6;
+
+
+    // Prepare the second-quantized Hamiltonian, set up the full spin-resolved ONV basis and prepare the sigma engine.
+    // Note that the Hamiltonian is not necessarily expressed in an orthonormal basis, but this doesn't matter here.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::Random(K);
+    const GQCP::SpinResolvedONVBasis onv_basis {K, N_P, N_P};
+    const GQCP::SpinResolvedSigmaEngine sigma_engine {onv_basis, hamiltonian};
+
+    const GQCP::MatrixX<double> X = GQCP::MatrixX<double>::Random(onv_basis.dimension(), number_of_vectors);
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        const auto matvecs = sigma_engine.evaluateBlockMatrixVectorProduct(X);
+
+        benchmark::DoNotOptimize(matvecs);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.counters["Spatial orbitals"] = K;
+    state.counters["Electron pairs"] = N_P;
+    state.counters["Dimension"] = onv_basis.dimension();
+}
+
+
+BENCHMARK(matvec_unprepared)->Unit(benchmark::kMillisecond)->Apply(CustomArguments);
+BENCHMARK(matvec_prepared)->Unit(benchmark::kMillisecond)->Apply(CustomArguments);
+BENCHMARK(matvec_singlet)->Unit(benchmark::kMillisecond)->Apply(CustomArguments);
+BENCHMARK(matvec_repeated)->Unit(benchmark::kMillisecond)->Apply(CustomArguments);
+BENCHMARK(matvec_block)->Unit(benchmark::kMillisecond)->Apply(CustomArguments);
+BENCHMARK_MAIN();
@@ -0,0 +1,121 @@
+/**
+ *  A benchmark executable that tests the throughput of the address calculations and of the generation of the one-electron couplings for a full spin-unresolved ONV basis. For the address calculations, the number of spinors is 24 and the number of electrons varies from 3 to 10. For the couplings, the number of spinors is 16 and the number of electrons varies from 3 to 8.
+ */
+
+#include "ONVBasis/SpinUnresolvedONVBasis.hpp"
+
+#include <benchmark/benchmark.h>
+
+
+static void CustomArguments(benchmark::internal::Benchmark* b) {
+    for (int i = 3; i < 11; ++i) {  // Needs an `int` instead of a `size_t`.
+        b->Args({24, i});           // The number of spinors, the number of electrons.
+    }
+}
+
+
+static void CouplingArguments(benchmark::internal::Benchmark* b) {
+    for (int i = 3; i < 9; ++i) {  // Needs an `int` instead of a `size_t`.
+        b->Args({16, i});          // The number of spinors, the number of electrons.
+    }
+}
+
+
+/**
+ *  @param onv_basis        A full spin-unresolved ONV basis.
+ *
+ *  @return The unsigned representations of all the ONVs in the given ONV basis.
+ */
+static std::vector<size_t> allRepresentations(const GQCP::SpinUnresolvedONVBasis& onv_basis) {
+
+    std::vector<size_t> representations;
+    representations.reserve(onv_basis.dimension());
+    onv_basis.forEach([&representations](const GQCP::SpinUnresolvedONV& onv, const size_t I) {
+        representations.push_back(onv.unsignedRepresentation());
+    });
+
+    return representations;
+}
+
+
+/**
+ *  Calculate the addresses of all ONVs through the public interface, which dispatches to the unrolled kernels (and the 32-bit vertex weights) when possible.
+ */
+static void address_dispatched(benchmark::State& state) {
+
+    const size_t M = state.range(0);  // The number of spinors.
+    const size_t N = state.range(1);  // The number of electrons.
+    const GQCP::SpinUnresolvedONVBasis onv_basis {M, N};
+    const auto representations = allRepresentations(onv_basis);
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        size_t checksum = 0;
+        for (const auto& representation : representations) {
+            checksum += onv_basis.addressOf(representation);
+        }
+
+        benchmark::DoNotOptimize(checksum);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.SetItemsProcessed(state.iterations() * representations.size());
+    state.counters["Spinors"] = M;
+    state.counters["Electrons"] = N;
+    state.counters["Dimension"] = onv_basis.dimension();
+}
+
+
+/**
+ *  Calculate the addresses of all ONVs through the generic kernel, which loops over the set bits, using the 64-bit vertex weights.
+ */
+static void address_generic(benchmark::State& state) {
+
+    const size_t M = state.range(0);  // The number of spinors.
+    const size_t N = state.range(1);  // The number of electrons.
+    const GQCP::SpinUnresolvedONVBasis onv_basis {M, N};
+    const auto representations = allRepresentations(onv_basis);
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        size_t checksum = 0;
+        for (const auto& representation : representations) {
+            checksum += GQCP::SpinUnresolvedONVBasis::addressOf(onv_basis.flatVertexWeights(), onv_basis.flatVertexWeightStride(), representation);
+        }
+
+        benchmark::DoNotOptimize(checksum);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.SetItemsProcessed(state.iterations() * representations.size());
+    state.counters["Spinors"] = M;
+    state.counters["Electrons"] = N;
+    state.counters["Dimension"] = onv_basis.dimension();
+}
+
+
+/**
+ *  Generate all the one-electron couplings, which walks over the vertex weights through the shift kernels.
+ */
+static void one_electron_couplings(benchmark::State& state) {
+
+    const size_t M = state.range(0);  // The number of spinors.
+    const size_t N = state.range(1);  // The number of electrons.
+    const GQCP::SpinUnresolvedONVBasis onv_basis {M, N};
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        const auto couplings = onv_basis.calculateOneElectronCouplings();
+
+        benchmark::DoNotOptimize(couplings);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.SetItemsProcessed(state.iterations() * onv_basis.countTotalOneElectronCouplings());
+    state.counters["Spinors"] = M;
+    state.counters["Electrons"] = N;
+    state.counters["Dimension"] = onv_basis.dimension();
+}
+
+
+BENCHMARK(address_dispatched)->Apply(CustomArguments);
+BENCHMARK(address_generic)->Apply(CustomArguments);
+BENCHMARK(one_electron_couplings)->Unit(benchmark::kMillisecond)->Apply(CouplingArguments);
+BENCHMARK_MAIN();
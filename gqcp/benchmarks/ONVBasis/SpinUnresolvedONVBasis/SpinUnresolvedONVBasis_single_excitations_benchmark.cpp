@@ -0,0 +1,73 @@
+/**
+ *  A benchmark executable that compares the single-excitation string table of a full spin-unresolved ONV basis with the sparse one-electron coupling matrices, both in construction time and in memory footprint. The number of spinors is 16, the number of electrons varies from 3 to 8.
+ */
+
+#include "ONVBasis/SpinUnresolvedONVBasis.hpp"
+
+#include <benchmark/benchmark.h>
+
+
+static void CustomArguments(benchmark::internal::Benchmark* b) {
+    for (int i = 3; i < 9; ++i) {  // Needs an `int` instead of a `size_t`.
+        b->Args({16, i});          // The number of spinors, the number of electrons.
+    }
+}
+
+
+/**
+ *  Construct the single-excitation string table.
+ */
+static void single_excitation_list(benchmark::State& state) {
+
+    const size_t M = state.range(0);  // The number of spinors.
+    const size_t N = state.range(1);  // The number of electrons.
+
+    // Code inside this loop is measured repeatedly. Every iteration uses a fresh ONV basis, since the table is only calculated once per ONV basis.
+    size_t memory_footprint = 0;
+    for (auto _ : state) {
+        const GQCP::SpinUnresolvedONVBasis onv_basis {M, N};
+        memory_footprint = onv_basis.singleExcitations().memoryFootprint();
+
+        benchmark::DoNotOptimize(memory_footprint);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.counters["Spinors"] = M;
+    state.counters["Electrons"] = N;
+    state.counters["Dimension"] = GQCP::SpinUnresolvedONVBasis::calculateDimension(M, N);
+    state.counters["Memory (MB)"] = static_cast<double>(memory_footprint) / (1024.0 * 1024.0);
+}
+
+
+/**
+ *  Construct the sparse one-electron coupling matrices sigma(pq).
+ */
+static void one_electron_couplings(benchmark::State& state) {
+
+    const size_t M = state.range(0);  // The number of spinors.
+    const size_t N = state.range(1);  // The number of electrons.
+
+    // Code inside this loop is measured repeatedly. Every iteration uses a fresh ONV basis, so that the single-excitation string table, from which the couplings are assembled, is included in the measurement.
+    size_t memory_footprint = 0;
+    for (auto _ : state) {
+        const GQCP::SpinUnresolvedONVBasis onv_basis {M, N};
+        const auto couplings = onv_basis.calculateOneElectronCouplings();
+
+        // Every non-zero element of a compressed sparse matrix takes a value and an inner index, and every column takes an outer index.
+        memory_footprint = 0;
+        for (const auto& coupling : couplings) {
+            memory_footprint += coupling.nonZeros() * (sizeof(double) + sizeof(int)) + (coupling.outerSize() + 1) * sizeof(int);
+        }
+
+        benchmark::DoNotOptimize(couplings);  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.counters["Spinors"] = M;
+    state.counters["Electrons"] = N;
+    state.counters["Dimension"] = GQCP::SpinUnresolvedONVBasis::calculateDimension(M, N);
+    state.counters["Memory (MB)"] = static_cast<double>(memory_footprint) / (1024.0 * 1024.0);
+}
+
+
+BENCHMARK(single_excitation_list)->Unit(benchmark::kMillisecond)->Apply(CustomArguments);
+BENCHMARK(one_electron_couplings)->Unit(benchmark::kMillisecond)->Apply(CustomArguments);
+BENCHMARK_MAIN();
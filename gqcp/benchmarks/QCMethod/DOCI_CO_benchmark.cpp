@@ -10,10 +10,42 @@
 #include "QCModel/CI/LinearExpansion.hpp"
 
 #include <benchmark/benchmark.h>
+#include <sys/resource.h>
+
+
+/**
+ *  @return the peak resident set size of this process, in megabytes
+ */
+static double peakMemoryInMegabytes() {
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    return static_cast<double>(usage.ru_maxrss) / 1024.0;  // On Linux, `ru_maxrss` is expressed in kilobytes.
+}
+
+
+/**
+ *  @param b            the benchmark that should be configured
+ *
+ *  Register the Davidson variants that are benchmarked: the arguments are the correction scheme (0: diagonal, 1: Olsen), the dimension of the dense-block preconditioner and if thick restarts should be used.
+ */
+static void DavidsonVariants(benchmark::internal::Benchmark* b) {
+    b->Args({0, 0, 0});    // The default diagonal (Davidson-Liu) correction.
+    b->Args({1, 0, 0});    // The Olsen correction.
+    b->Args({0, 100, 0});  // A dense-block preconditioner over the 100 lowest-diagonal ONVs.
+    b->Args({0, 0, 1});    // Thick restarts.
+    b->Args({1, 100, 1});  // All of the above.
+}
 
 
 static void test_case(benchmark::State& state) {
 
+    const auto correction = state.range(0) == 0 ? GQCP::DavidsonCorrection::k_diagonal : GQCP::DavidsonCorrection::k_olsen;
+    const size_t preconditioner_block_dimension = state.range(1);
+    const bool thick_restart = state.range(2) != 0;
+
+
     // Read in the molecular Hamiltonian for the specific test case.
     const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/co_631g_klaas.FCIDUMP");
     const auto K = hamiltonian.numberOfOrbitals();
@@ -27,11 +59,15 @@ static void test_case(benchmark::State& state) {
     // Specify an initial guess for the Davidson solver.
     const auto initial_guess = GQCP::LinearExpansion<GQCP::SeniorityZeroONVBasis>::HartreeFock(onv_basis).coefficients();
     auto environment = GQCP::CIEnvironment::Iterative(hamiltonian, onv_basis, initial_guess);
-    auto solver = GQCP::EigenproblemSolver::Davidson();
+    auto solver = GQCP::EigenproblemSolver::Davidson(1, 15, 1.0e-08, 1.0e-12, 128, 1.0e-03, correction, preconditioner_block_dimension, thick_restart);
 
 
-    // Code inside this loop is measured repeatedly.
+    // Code inside this loop is measured repeatedly. Every iteration starts from a fresh environment, so that the number of matrix-vector products to convergence can be reported.
     for (auto _ : state) {
+        state.PauseTiming();
+        environment = GQCP::CIEnvironment::Iterative(hamiltonian, onv_basis, initial_guess);
+        state.ResumeTiming();
+
         const auto electronic_energy = GQCP::QCMethod::CI<GQCP::SeniorityZeroONVBasis>(onv_basis).optimize(solver, environment).groundStateEnergy();
 
         benchmark::DoNotOptimize(electronic_energy);  // Make sure that the variable is not optimized away by compiler.
@@ -40,8 +76,13 @@ static void test_case(benchmark::State& state) {
     state.counters["Spatial orbitals"] = K;
     state.counters["Electron pairs"] = N_P;
     state.counters["Dimension"] = onv_basis.dimension();
+    state.counters["Matrix-vector products"] = environment.number_of_matrix_vector_products;
+
+    // Report the memory that is used by the Davidson solver: the (preallocated) subspace storage, and the peak memory of the whole process (which includes all previous benchmark runs).
+    state.counters["Subspace storage (MB)"] = static_cast<double>(environment.V.size() + environment.VA.size()) * sizeof(double) / (1024.0 * 1024.0);
+    state.counters["Peak memory (MB)"] = peakMemoryInMegabytes();
 }
 
 
-BENCHMARK(test_case)->Unit(benchmark::kMillisecond);
+BENCHMARK(test_case)->Unit(benchmark::kMillisecond)->Apply(DavidsonVariants);
 BENCHMARK_MAIN();
@@ -17,6 +17,7 @@
 #include "QCModel/CI/LinearExpansion.hpp"
 
 #include <benchmark/benchmark.h>
+#include <sys/resource.h>
 
 
 static void CustomArguments(benchmark::internal::Benchmark* b) {
@@ -26,6 +27,18 @@ static void CustomArguments(benchmark::internal::Benchmark* b) {
 }
 
 
+/**
+ *  @return the peak resident set size of this process, in megabytes
+ */
+static double peakMemoryInMegabytes() {
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    return static_cast<double>(usage.ru_maxrss) / 1024.0;  // On Linux, `ru_maxrss` is expressed in kilobytes.
+}
+
+
 /**
  *  A dense benchmark.
  */
@@ -108,8 +121,12 @@ static void fci_davidson_molecule(benchmark::State& state) {
     auto solver = GQCP::EigenproblemSolver::Davidson();
 
 
-    // Code inside this loop is measured repeatedly.
+    // Code inside this loop is measured repeatedly. Every iteration starts from a fresh environment, so that the number of matrix-vector products to convergence can be reported.
     for (auto _ : state) {
+        state.PauseTiming();
+        environment = GQCP::CIEnvironment::Iterative(hamiltonian, onv_basis, initial_guess);
+        state.ResumeTiming();
+
         const auto electronic_energy = GQCP::QCMethod::CI<GQCP::SpinResolvedONVBasis>(onv_basis).optimize(solver, environment).groundStateEnergy();
 
         benchmark::DoNotOptimize(electronic_energy);  // Make sure that the variable is not optimized away by the compiler.
@@ -118,6 +135,11 @@ static void fci_davidson_molecule(benchmark::State& state) {
     state.counters["Hydrogen nuclei"] = K;
     state.counters["Electrons"] = N;
     state.counters["Dimension"] = onv_basis.dimension();
+    state.counters["Matrix-vector products"] = environment.number_of_matrix_vector_products;
+
+    // Report the memory that is used by the Davidson solver: the (preallocated) subspace storage, and the peak memory of the whole process (which includes all previous benchmark runs).
+    state.counters["Subspace storage (MB)"] = static_cast<double>(environment.V.size() + environment.VA.size()) * sizeof(double) / (1024.0 * 1024.0);
+    state.counters["Peak memory (MB)"] = peakMemoryInMegabytes();
 }
 
 
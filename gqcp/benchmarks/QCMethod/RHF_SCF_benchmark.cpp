@@ -0,0 +1,105 @@
+/**
+ *  A benchmark executable that checks the per-iteration performance of an RHF SCF calculation on a cyclic water tetramer in a cc-pVDZ basisset (96 basis functions). The diagonalization of a Fock matrix through the cached orthogonalizer of the SCF environment is compared to solving the generalized eigenvalue problem in every iteration.
+ */
+
+#include "Basis/SpinorBasis/RSpinOrbitalBasis.hpp"
+#include "Molecule/Molecule.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+#include "QCMethod/HF/RHF/DiagonalRHFFockMatrixObjective.hpp"
+#include "QCMethod/HF/RHF/RHF.hpp"
+#include "QCMethod/HF/RHF/RHFFockMatrixDiagonalization.hpp"
+#include "QCMethod/HF/RHF/RHFSCFSolver.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+
+/**
+ *  The diagonalization of a Fock matrix through the generalized eigensolver, which decomposes the overlap matrix in every iteration.
+ */
+static void rhf_diagonalization_generalized(benchmark::State& state) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_tetramer.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spinor_basis {molecule, "cc-pVDZ"};
+    const auto S = spinor_basis.overlap().parameters();
+    const auto F = GQCP::RSQHamiltonian<double>::Molecular(spinor_basis, molecule).core().parameters();
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        const Eigen::GeneralizedSelfAdjointEigenSolver<Eigen::MatrixXd> generalized_eigensolver {F, S};
+
+        benchmark::DoNotOptimize(generalized_eigensolver.eigenvectors());  // Make sure that the variable is not optimized away by compiler.
+    }
+
+    state.counters["Basis functions"] = spinor_basis.numberOfSpatialOrbitals();
+}
+
+
+/**
+ *  The diagonalization of a Fock matrix through the orthogonalizer that is cached in the SCF environment.
+ */
+static void rhf_diagonalization_orthogonalizer(benchmark::State& state) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_tetramer.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spinor_basis {molecule, "cc-pVDZ"};
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::Molecular(spinor_basis, molecule);  // In an AO basis.
+
+    auto environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(molecule.numberOfElectrons(), sq_hamiltonian, spinor_basis.overlap());
+    environment.fock_matrices.push_back(sq_hamiltonian.core());
+    GQCP::RHFFockMatrixDiagonalization<double> diagonalization_step {};
+
+    // Code inside this loop is measured repeatedly.
+    for (auto _ : state) {
+        diagonalization_step.execute(environment);
+
+        state.PauseTiming();
+        environment.coefficient_matrices.pop_back();
+        environment.orbital_energies.pop_back();
+        state.ResumeTiming();
+    }
+
+    state.counters["Basis functions"] = spinor_basis.numberOfSpatialOrbitals();
+}
+
+
+/**
+ *  A full RHF DIIS SCF calculation, for which the average time per SCF iteration is reported.
+ */
+static void rhf_scf_diis(benchmark::State& state) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_tetramer.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spinor_basis {molecule, "cc-pVDZ"};
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::Molecular(spinor_basis, molecule);  // In an AO basis.
+    const GQCP::DiagonalRHFFockMatrixObjective<double> objective {sq_hamiltonian};
+
+    size_t number_of_iterations = 0;
+    double milliseconds_per_iteration = 0.0;
+
+    // Code inside this loop is measured repeatedly. Every iteration starts from a fresh environment.
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(molecule.numberOfElectrons(), sq_hamiltonian, spinor_basis.overlap());
+        auto solver = GQCP::RHFSCFSolver<double>::DIIS();
+        state.ResumeTiming();
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto electronic_energy = GQCP::QCMethod::RHF<double>().optimize(objective, solver, environment).groundStateEnergy();
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        benchmark::DoNotOptimize(electronic_energy);  // Make sure that the variable is not optimized away by compiler.
+
+        number_of_iterations = solver.numberOfIterations();
+        milliseconds_per_iteration = elapsed.count() / number_of_iterations;
+    }
+
+    state.counters["Basis functions"] = spinor_basis.numberOfSpatialOrbitals();
+    state.counters["SCF iterations"] = number_of_iterations;
+    state.counters["Time per SCF iteration (ms)"] = milliseconds_per_iteration;
+}
+
+
+BENCHMARK(rhf_diagonalization_generalized)->Unit(benchmark::kMillisecond);
+BENCHMARK(rhf_diagonalization_orthogonalizer)->Unit(benchmark::kMillisecond);
+BENCHMARK(rhf_scf_diis)->Unit(benchmark::kMillisecond);
+BENCHMARK_MAIN();
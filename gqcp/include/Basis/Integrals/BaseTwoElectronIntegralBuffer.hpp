@@ -18,6 +18,7 @@
 #pragma once
 
 
+#include "Mathematical/Representation/PackedRankFourTensor.hpp"
 #include "Mathematical/Representation/Tensor.hpp"
 
 #include <array>
@@ -125,6 +126,76 @@ public:
     }
 
 
+    /**
+     *  Place the calculated integrals inside the matrix representation of the integrals, together with their copies under the 8-fold permutational symmetry (ij|kl) = (ji|kl) = (ij|lk) = (ji|lk) = (kl|ij) = (lk|ij) = (kl|ji) = (lk|ji) of real two-electron integrals.
+     *
+     *  @param full_components          the components of the full matrix representation (over all the basis functions) of the operator
+     *  @param bf1                      the total basis function index of the first basis function in the first shell
+     *  @param bf2                      the total basis function index of the first basis function in the second shell
+     *  @param bf3                      the total basis function index of the first basis function in the third shell
+     *  @param bf4                      the total basis function index of the first basis function in the fourth shell
+     *
+     *  @note This method should only be used for real integrals over one set of basis functions.
+     */
+    void emplacePermutations(std::array<Tensor<IntegralScalar, 4>, N>& full_components, const size_t bf1, const size_t bf2, const size_t bf3, const size_t bf4) const {
+
+        for (size_t f1 = 0; f1 != this->nbf1; f1++) {
+            const auto i = bf1 + f1;
+            for (size_t f2 = 0; f2 != this->nbf2; f2++) {
+                const auto j = bf2 + f2;
+                for (size_t f3 = 0; f3 != this->nbf3; f3++) {
+                    const auto k = bf3 + f3;
+                    for (size_t f4 = 0; f4 != this->nbf4; f4++) {
+                        const auto l = bf4 + f4;
+
+                        for (size_t c = 0; c < N; c++) {
+                            const auto value = this->value(c, f1, f2, f3, f4);
+                            auto& component = full_components[c];
+
+                            component(i, j, k, l) = value;  // in chemist's notation
+                            component(j, i, k, l) = value;
+                            component(i, j, l, k) = value;
+                            component(j, i, l, k) = value;
+                            component(k, l, i, j) = value;
+                            component(l, k, i, j) = value;
+                            component(k, l, j, i) = value;
+                            component(l, k, j, i) = value;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+
+    /**
+     *  Place the calculated integrals inside the packed representation of the integrals, which only stores one element for every set of integrals that are related by the 8-fold permutational symmetry of real two-electron integrals.
+     *
+     *  @param packed_components        the components of the packed representation (over all the basis functions) of the operator
+     *  @param bf1                      the total basis function index of the first basis function in the first shell
+     *  @param bf2                      the total basis function index of the first basis function in the second shell
+     *  @param bf3                      the total basis function index of the first basis function in the third shell
+     *  @param bf4                      the total basis function index of the first basis function in the fourth shell
+     *
+     *  @note This method should only be used for real integrals over one set of basis functions.
+     */
+    void emplacePacked(std::array<PackedRankFourTensor<IntegralScalar>, N>& packed_components, const size_t bf1, const size_t bf2, const size_t bf3, const size_t bf4) const {
+
+        for (size_t f1 = 0; f1 != this->nbf1; f1++) {
+            for (size_t f2 = 0; f2 != this->nbf2; f2++) {
+                for (size_t f3 = 0; f3 != this->nbf3; f3++) {
+                    for (size_t f4 = 0; f4 != this->nbf4; f4++) {
+
+                        for (size_t c = 0; c < N; c++) {
+                            packed_components[c](bf1 + f1, bf2 + f2, bf3 + f3, bf4 + f4) = this->value(c, f1, f2, f3, f4);  // in chemist's notation
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+
     /**
      *  @return the number of basis functions that are in the first shell
      */
@@ -20,6 +20,9 @@
 
 #include "Basis/Integrals/BaseTwoElectronIntegralBuffer.hpp"
 
+#include <memory>
+#include <vector>
+
 
 namespace GQCP {
 
@@ -57,9 +60,44 @@ public:
      *  @param shell3          the third shell
      *  @param shell4          the fourth shell
      * 
-     *  @return a buffer containing the calculated integrals
+     *  @return a buffer containing the calculated integrals, which is owned by the caller, i.e. it should not be overwritten by subsequent calls to the engine
      */
     virtual std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculate(const Shell& shell1, const Shell& shell2, const Shell& shell3, const Shell& shell4) = 0;
+
+
+    // PUBLIC METHODS
+
+    /**
+     *  Calculate all the integrals over the shells with the given indices. Engines that know the shells they are used for (e.g. because they have converted them upon construction) can override this method to avoid having to look up the given shells.
+     *  @note This method is not marked const to allow the Engine's internals to be changed
+     *
+     *  @param shells           the shells over which the integrals are calculated, which should be the ones that the engine was constructed for (if any)
+     *  @param index1           the index of the first shell
+     *  @param index2           the index of the second shell
+     *  @param index3           the index of the third shell
+     *  @param index4           the index of the fourth shell
+     *
+     *  @return a buffer containing the calculated integrals, which is owned by the caller, i.e. it should not be overwritten by subsequent calls to the engine
+     */
+    virtual std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculateByIndex(const std::vector<Shell>& shells, const size_t index1, const size_t index2, const size_t index3, const size_t index4) {
+        return this->calculate(shells[index1], shells[index2], shells[index3], shells[index4]);
+    }
+
+
+    /**
+     *  Calculate all the integrals over the shells with the given indices, and let the given buffer point to them. Engines that can write the integrals in an existing buffer can override this method to reuse the given buffer, instead of allocating a new one for every shell quartet.
+     *  @note This method is not marked const to allow the Engine's internals to be changed
+     *
+     *  @param shells           the shells over which the integrals are calculated, which should be the ones that the engine was constructed for (if any)
+     *  @param index1           the index of the first shell
+     *  @param index2           the index of the second shell
+     *  @param index3           the index of the third shell
+     *  @param index4           the index of the fourth shell
+     *  @param buffer           a buffer that was filled in by a previous call to this method (or an empty pointer), which is reused if possible. On return, it contains the calculated integrals, which are overwritten by the next call with the same buffer.
+     */
+    virtual void calculateByIndex(const std::vector<Shell>& shells, const size_t index1, const size_t index2, const size_t index3, const size_t index4, std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>>& buffer) {
+        buffer = this->calculateByIndex(shells, index1, index2, index3, index4);
+    }
 };
 
 
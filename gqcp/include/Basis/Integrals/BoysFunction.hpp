@@ -0,0 +1,95 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <cstddef>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  An implementation of the Boys function F_n(T) = int_0^1 t^{2n} exp(-T t^2) dt, which appears in all integrals over the Coulomb operator.
+ *
+ *  For small arguments, the Boys function is interpolated through a Taylor expansion around the nearest point of a pretabulated grid (using dF_n(T)/dT = -F_{n+1}(T)), after which the lower orders follow from a downward recursion. For large arguments, F_0 is calculated through the error function, after which the higher orders follow from an upward recursion.
+ */
+class BoysFunction {
+private:
+    // The number of terms in the Taylor expansion around a grid point.
+    static constexpr size_t NumberOfTaylorTerms = 7;
+
+    // The spacing between two consecutive grid points.
+    static constexpr double GridSpacing = 0.05;
+
+    // The largest argument for which the Boys function is interpolated on the grid.
+    static constexpr double MaximumGridArgument = 30.0;
+
+    // The maximum order of the Boys function that can be evaluated.
+    size_t max_order;
+
+    // The pretabulated values F_n(T_g), stored grid point by grid point, i.e. F_n(T_g) is at position g * (max_order + NumberOfTaylorTerms) + n.
+    std::vector<double> table;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param max_order            The maximum order of the Boys function that can be evaluated. For two-electron integrals over shells with angular momentum up to l, this should be at least 4l.
+     */
+    BoysFunction(const size_t max_order = 32);
+
+
+    /*
+     *  MARK: Evaluations
+     */
+
+    /**
+     *  Evaluate the Boys function F_n(T) for all orders n = 0, 1, ..., m at once.
+     *
+     *  @param T                    The argument of the Boys function.
+     *  @param m                    The highest order of the Boys function that should be evaluated.
+     *  @param values               A pointer to an array of at least (m + 1) elements, in which F_n(T) is written at position n.
+     */
+    void calculate(const double T, const size_t m, double* values) const;
+
+    /**
+     *  @param n                    The order of the Boys function.
+     *  @param T                    The argument of the Boys function.
+     *
+     *  @return The value F_n(T).
+     */
+    double operator()(const size_t n, const double T) const;
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The maximum order of the Boys function that can be evaluated.
+     */
+    size_t maximumOrder() const { return this->max_order; }
+};
+
+
+}  // namespace GQCP
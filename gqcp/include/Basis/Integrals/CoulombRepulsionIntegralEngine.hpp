@@ -0,0 +1,91 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/BaseTwoElectronIntegralEngine.hpp"
+#include "Basis/Integrals/HermiteCoulombIntegrals.hpp"
+#include "Basis/Integrals/TwoElectronIntegralBuffer.hpp"
+#include "Basis/ScalarBasis/GTOShell.hpp"
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Operator/FirstQuantized/CoulombRepulsionOperator.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  An in-house integral engine that calculates two-electron Coulomb repulsion integrals over shell quartets through the McMurchie-Davidson scheme.
+ *
+ *  The bra and ket shell pairs are expanded in Hermite Gaussians once per shell quartet (see `ShellPairHermiteExpansion`), and the Hermite Coulomb integrals are calculated once per quartet of primitives for all the Hermite Gaussians at once. The contraction with the expansion coefficients of all the basis functions in the quartet is then done through matrix products:
+ *      (ab|cd) = sum_{primitives} 2 pi^{5/2} / (p q sqrt(p + q)) E^{ab} R E^{cd}^T,
+ *  with R_{tuv,t'u'v'} = (-1)^{t'+u'+v'} R_{t+t',u+u',v+v'}(pq / (p + q), P - Q).
+ *
+ *  @note This integral engine can only calculate integrals over Cartesian d-shells.
+ */
+class CoulombRepulsionIntegralEngine:
+    public BaseTwoElectronIntegralEngine<GTOShell, CoulombRepulsionOperator::NumberOfComponents, CoulombRepulsionOperator::Scalar> {
+public:
+    using Shell = GTOShell;
+    using IntegralScalar = CoulombRepulsionOperator::Scalar;
+    static constexpr auto N = CoulombRepulsionOperator::NumberOfComponents;
+
+
+private:
+    // The Hermite Coulomb integrals, which are recalculated for every quartet of primitives.
+    HermiteCoulombIntegrals hermite_coulomb_integrals;
+
+    // The (sign- and prefactor-adjusted) Hermite Coulomb integrals for one quartet of primitives, as a matrix whose rows and columns correspond to the Hermite Gaussians of the bra and ket shell pair.
+    MatrixX<double> R;
+
+    // The contraction of the Hermite Coulomb integrals with the ket expansion coefficients, accumulated over all ket primitive pairs.
+    MatrixX<double> W;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param max_l                the maximum angular momentum of the shells over which integrals will be calculated
+     */
+    CoulombRepulsionIntegralEngine(const size_t max_l = 8);
+
+
+    /*
+     *  MARK: Conforming to `BaseTwoElectronIntegralEngine`
+     */
+
+    /**
+     *  Calculate all the Coulomb repulsion integrals over the given shells.
+     *
+     *  @param shell1           the first shell
+     *  @param shell2           the second shell
+     *  @param shell3           the third shell
+     *  @param shell4           the fourth shell
+     *
+     *  @note This method is not marked const to allow the Engine's internals to be changed
+     *
+     *  @return a buffer containing the calculated integrals
+     */
+    std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculate(const Shell& shell1, const Shell& shell2, const Shell& shell3, const Shell& shell4) override;
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,350 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/IntegralCalculator.hpp"
+#include "Basis/Integrals/IntegralEngine.hpp"
+#include "Basis/ScalarBasis/GTOShell.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+#include "Operator/FirstQuantized/Operator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A calculator for the direct (Coulomb) and exchange matrices
+ *      J[D](mu nu) = (mu nu|rho lambda) D(rho lambda),
+ *      K[D](mu nu) = (mu lambda|rho nu) D(rho lambda)
+ *  of one or more (not necessarily symmetric or Hermitian) density matrices, without ever storing the two-electron integrals. Complex density matrices are contracted as given, i.e. without complex conjugation, which matches `JKCalculator` and the einsum contractions in `QCModel`. In every call, the canonical shell quartets are recalculated and immediately contracted with all the given density matrices.
+ *
+ *  A shell quartet (PQ|RS) is skipped if its contribution, bounded by the Cauchy-Schwarz bounds Q(P,Q) Q(R,S) multiplied by the largest density matrix element that it is contracted with, lies below the screening threshold.
+ *
+ *  Since J and K are linear in the density matrix, an SCF iteration can contract the integrals with the change of the density matrices since the previous iteration only, see `calculateIncremental()`. As the SCF converges, this change becomes small and the density-weighted screening removes ever more shell quartets.
+ *
+ *  @tparam _Scalar         The scalar type of the density matrices: real or complex. The two-electron integrals themselves are real.
+ */
+template <typename _Scalar>
+class DirectJKCalculator {
+public:
+    // The scalar type of the density matrices: real or complex.
+    using Scalar = _Scalar;
+
+    // The type of 'this'.
+    using Self = DirectJKCalculator<Scalar>;
+
+
+private:
+    // The shells of the scalar basis.
+    ShellSet<GTOShell> shell_set;
+
+    // The basis function index of the first basis function in every shell.
+    std::vector<size_t> bf_indices;
+
+    // The Cauchy-Schwarz bounds over the pairs of shells.
+    SquareMatrix<double> schwarz_bounds;
+
+    // The threshold below which the (density-weighted) contribution of a shell quartet is considered to be negligible.
+    double threshold;
+
+    // The number of worker threads.
+    size_t number_of_threads;
+
+    // The number of incremental builds after which the direct and exchange matrices are rebuilt from the full density matrices, in order to remove the accumulated screening errors.
+    size_t rebuild_frequency;
+
+
+    // The density matrices of the previous (incremental) calculation.
+    std::vector<SquareMatrix<Scalar>> previous_densities;
+
+    // The direct matrices of the previous (incremental) calculation.
+    std::vector<SquareMatrix<Scalar>> previous_Js;
+
+    // The exchange matrices of the previous (incremental) calculation.
+    std::vector<SquareMatrix<Scalar>> previous_Ks;
+
+    // The number of incremental builds since the last full build.
+    size_t number_of_incremental_builds = 0;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param scalar_basis             The scalar basis in which the density matrices and the resulting direct and exchange matrices are expressed.
+     *  @param threshold                The threshold below which the (density-weighted) contribution of a shell quartet is considered to be negligible.
+     *  @param rebuild_frequency        The number of incremental builds after which the direct and exchange matrices are rebuilt from the full density matrices.
+     *  @param number_of_threads        The number of worker threads.
+     */
+    DirectJKCalculator(const ScalarBasis<GTOShell>& scalar_basis, const double threshold = 1.0e-12, const size_t rebuild_frequency = 10, const size_t number_of_threads = 1) :
+        shell_set {scalar_basis.shellSet()},
+        threshold {threshold},
+        number_of_threads {std::max<size_t>(number_of_threads, 1)},
+        rebuild_frequency {rebuild_frequency} {
+
+        const auto nsh = this->shell_set.numberOfShells();
+        this->bf_indices.resize(nsh);
+        for (size_t i = 0; i < nsh; i++) {
+            this->bf_indices[i] = this->shell_set.basisFunctionIndex(i);
+        }
+
+        auto engine = IntegralEngine::Libint(Operator::Coulomb(), this->shell_set.maximumNumberOfPrimitives(), this->shell_set.maximumAngularMomentum());
+        this->schwarz_bounds = IntegralCalculator::calculateSchwarzBounds(engine, this->shell_set);
+    }
+
+
+    /*
+     *  MARK: Calculations
+     */
+
+    /**
+     *  Calculate the direct and exchange matrices of the given density matrices.
+     *
+     *  @param densities            The density matrices, expressed in the scalar basis.
+     *
+     *  @return The direct matrices J[D] and the exchange matrices K[D] of the given density matrices, in the same order.
+     */
+    std::pair<std::vector<SquareMatrix<Scalar>>, std::vector<SquareMatrix<Scalar>>> calculate(const std::vector<SquareMatrix<Scalar>>& densities) const {
+
+        const auto K = this->shell_set.numberOfBasisFunctions();
+        for (const auto& D : densities) {
+            if (D.dimension() != K) {
+                throw std::invalid_argument("DirectJKCalculator::calculate(const std::vector<SquareMatrix<Scalar>>&): The dimension of a density matrix is incompatible with the scalar basis.");
+            }
+        }
+
+
+        // Determine the largest density matrix element over every pair of shells, for all density matrices together.
+        const auto nsh = this->shell_set.numberOfShells();
+        const auto& shells = this->shell_set.asVector();
+
+        SquareMatrix<double> D_max = SquareMatrix<double>::Zero(nsh);
+        for (size_t P = 0; P < nsh; P++) {
+            for (size_t R = 0; R < nsh; R++) {
+                double value = 0.0;
+                for (const auto& D : densities) {
+                    value = std::max(value, static_cast<double>(D.block(this->bf_indices[P], this->bf_indices[R], shells[P].numberOfBasisFunctions(), shells[R].numberOfBasisFunctions()).cwiseAbs().maxCoeff()));
+                }
+                D_max(P, R) = value;
+            }
+        }
+
+        // The contraction reads D(r,s) as well as D(s,r), so the bound of a pair of shells has to hold for both orderings if the density matrices aren't symmetric.
+        D_max = D_max.cwiseMax(D_max.transpose()).eval();
+        const auto D_max_overall = (nsh > 0) ? D_max.maxCoeff() : 0.0;
+        const auto Q_max_overall = (nsh > 0) ? this->schwarz_bounds.maxCoeff() : 0.0;
+
+
+        // Every task is one canonical pair of shells (PQ), together with all its canonical partners (RS) <= (PQ). Since the number of partners grows with the compound index, the last pairs are handed out first.
+        std::vector<std::pair<size_t, size_t>> tasks;
+        tasks.reserve(nsh * (nsh + 1) / 2);
+        for (size_t P = nsh; P-- > 0;) {
+            for (size_t Q = P + 1; Q-- > 0;) {
+                tasks.emplace_back(P, Q);
+            }
+        }
+
+
+        // Every worker accumulates into its own direct and exchange matrices, which are summed afterwards.
+        const auto number_of_workers = std::max<size_t>(std::min(this->number_of_threads, tasks.size()), 1);
+        std::vector<std::vector<SquareMatrix<Scalar>>> Js(number_of_workers, std::vector<SquareMatrix<Scalar>>(densities.size(), SquareMatrix<Scalar>::Zero(K)));
+        std::vector<std::vector<SquareMatrix<Scalar>>> Ks(number_of_workers, std::vector<SquareMatrix<Scalar>>(densities.size(), SquareMatrix<Scalar>::Zero(K)));
+
+        std::atomic<size_t> next_task {0};
+        const auto work = [&](const size_t worker) {
+            auto engine = IntegralEngine::Libint(Operator::Coulomb(), this->shell_set.maximumNumberOfPrimitives(), this->shell_set.maximumAngularMomentum());
+            auto& J_worker = Js[worker];
+            auto& K_worker = Ks[worker];
+            std::shared_ptr<BaseTwoElectronIntegralBuffer<double, 1>> buffer;  // reused for all shell quartets of this worker
+
+            for (auto task = next_task++; task < tasks.size(); task = next_task++) {
+                const auto P = tasks[task].first;
+                const auto Q = tasks[task].second;
+                const auto Q_PQ = this->schwarz_bounds(P, Q);
+                if (Q_PQ * Q_max_overall * D_max_overall < this->threshold) {
+                    continue;
+                }
+
+                for (size_t R = 0; R <= P; R++) {
+                    const auto S_max = (R == P) ? Q : R;  // makes sure that (PQ) >= (RS)
+
+                    for (size_t S = 0; S <= S_max; S++) {
+                        const auto D_bound = std::max({D_max(P, Q), D_max(R, S), D_max(P, R), D_max(P, S), D_max(Q, R), D_max(Q, S)});
+                        if (Q_PQ * this->schwarz_bounds(R, S) * D_bound < this->threshold) {
+                            continue;
+                        }
+
+                        engine.calculateByIndex(shells, P, Q, R, S, buffer);
+                        if (buffer->areIntegralsAllZero()) {
+                            continue;
+                        }
+
+                        // Every integral of this shell quartet is scattered to all 8 of its permutations, which is compensated for by the degeneracy of the shell quartet.
+                        const double degeneracy = ((P == Q) ? 1.0 : 2.0) * ((R == S) ? 1.0 : 2.0) * (((P == R) && (Q == S)) ? 1.0 : 2.0);
+                        Self::digest(*buffer, degeneracy / 8.0, this->bf_indices[P], this->bf_indices[Q], this->bf_indices[R], this->bf_indices[S], densities, J_worker, K_worker);
+                    }
+                }
+            }
+        };
+
+        if (number_of_workers == 1) {
+            work(0);
+        } else {
+            std::vector<std::thread> threads;
+            threads.reserve(number_of_workers);
+            for (size_t worker = 0; worker < number_of_workers; worker++) {
+                threads.emplace_back(work, worker);
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+
+
+        // Sum the contributions of all workers.
+        for (size_t worker = 1; worker < number_of_workers; worker++) {
+            for (size_t d = 0; d < densities.size(); d++) {
+                Js[0][d] += Js[worker][d];
+                Ks[0][d] += Ks[worker][d];
+            }
+        }
+
+        return {Js[0], Ks[0]};
+    }
+
+
+    /**
+     *  Calculate the direct and exchange matrices of the given density matrices, by only contracting the integrals with the change of the density matrices since the previous call, and adding the result to the previous direct and exchange matrices. Every `rebuild_frequency` calls, or when the number or dimension of the density matrices has changed, the matrices are rebuilt from the full density matrices.
+     *
+     *  @param densities            The density matrices, expressed in the scalar basis.
+     *
+     *  @return The direct matrices J[D] and the exchange matrices K[D] of the given density matrices, in the same order.
+     */
+    std::pair<std::vector<SquareMatrix<Scalar>>, std::vector<SquareMatrix<Scalar>>> calculateIncremental(const std::vector<SquareMatrix<Scalar>>& densities) {
+
+        // Check if the previous calculation can serve as a reference for this one.
+        bool is_compatible = (this->previous_densities.size() == densities.size()) && (this->number_of_incremental_builds < this->rebuild_frequency);
+        for (size_t d = 0; is_compatible && (d < densities.size()); d++) {
+            is_compatible = (this->previous_densities[d].dimension() == densities[d].dimension());
+        }
+
+        if (!is_compatible) {
+            const auto JK = this->calculate(densities);
+            this->previous_Js = JK.first;
+            this->previous_Ks = JK.second;
+            this->number_of_incremental_builds = 0;
+        } else {
+            std::vector<SquareMatrix<Scalar>> delta_densities;
+            delta_densities.reserve(densities.size());
+            for (size_t d = 0; d < densities.size(); d++) {
+                delta_densities.push_back(densities[d] - this->previous_densities[d]);
+            }
+
+            const auto delta_JK = this->calculate(delta_densities);
+            for (size_t d = 0; d < densities.size(); d++) {
+                this->previous_Js[d] += delta_JK.first[d];
+                this->previous_Ks[d] += delta_JK.second[d];
+            }
+            this->number_of_incremental_builds++;
+        }
+
+        this->previous_densities = densities;
+        return {this->previous_Js, this->previous_Ks};
+    }
+
+
+    /**
+     *  Forget the previous calculation, such that the next call to `calculateIncremental()` rebuilds the direct and exchange matrices from the full density matrices.
+     */
+    void reset() {
+        this->previous_densities.clear();
+        this->previous_Js.clear();
+        this->previous_Ks.clear();
+        this->number_of_incremental_builds = 0;
+    }
+
+
+private:
+    /**
+     *  Contract the integrals of one shell quartet with the given density matrices, for all 8 permutations of every integral (mu nu|rho lambda).
+     *
+     *  @param buffer           The buffer that contains the integrals of the shell quartet.
+     *  @param scaling          The factor with which every integral is multiplied.
+     *  @param bf1              The total basis function index of the first basis function in the first shell.
+     *  @param bf2              The total basis function index of the first basis function in the second shell.
+     *  @param bf3              The total basis function index of the first basis function in the third shell.
+     *  @param bf4              The total basis function index of the first basis function in the fourth shell.
+     *  @param densities        The density matrices.
+     *  @param Js               The direct matrices to which the contributions are added.
+     *  @param Ks               The exchange matrices to which the contributions are added.
+     */
+    template <typename Buffer>
+    static void digest(const Buffer& buffer, const double scaling, const size_t bf1, const size_t bf2, const size_t bf3, const size_t bf4, const std::vector<SquareMatrix<Scalar>>& densities, std::vector<SquareMatrix<Scalar>>& Js, std::vector<SquareMatrix<Scalar>>& Ks) {
+
+        for (size_t f1 = 0; f1 < buffer.numberOfBasisFunctionsInShell1(); f1++) {
+            const auto p = bf1 + f1;
+            for (size_t f2 = 0; f2 < buffer.numberOfBasisFunctionsInShell2(); f2++) {
+                const auto q = bf2 + f2;
+                for (size_t f3 = 0; f3 < buffer.numberOfBasisFunctionsInShell3(); f3++) {
+                    const auto r = bf3 + f3;
+                    for (size_t f4 = 0; f4 < buffer.numberOfBasisFunctionsInShell4(); f4++) {
+                        const auto s = bf4 + f4;
+                        const double v = scaling * buffer.value(0, f1, f2, f3, f4);
+
+                        for (size_t d = 0; d < densities.size(); d++) {
+                            const auto& D = densities[d];
+                            auto& J = Js[d];
+                            auto& K = Ks[d];
+
+                            // An integral g(a,b,c,d) contributes J(a,b) += g(a,b,c,d) D(c,d) and K(a,d) += g(a,b,c,d) D(c,b).
+                            J(p, q) += v * (D(r, s) + D(s, r));
+                            J(q, p) += v * (D(r, s) + D(s, r));
+                            J(r, s) += v * (D(p, q) + D(q, p));
+                            J(s, r) += v * (D(p, q) + D(q, p));
+
+                            K(p, s) += v * D(r, q);
+                            K(q, s) += v * D(r, p);
+                            K(p, r) += v * D(s, q);
+                            K(q, r) += v * D(s, p);
+                            K(r, q) += v * D(p, s);
+                            K(s, q) += v * D(p, r);
+                            K(r, p) += v * D(q, s);
+                            K(s, p) += v * D(q, r);
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,92 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/BoysFunction.hpp"
+#include "Mathematical/Representation/Matrix.hpp"
+
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  The McMurchie-Davidson Hermite Coulomb integrals R_{tuv}(p, R_PC), i.e. the derivatives of the Boys function F_0(p R_PC^2) with respect to the Cartesian components of R_PC, which are calculated through the recurrence relations
+ *      R^n_{t+1,u,v} = t R^{n+1}_{t-1,u,v} + X_PC R^{n+1}_{t,u,v}
+ *  (and analogously for u and v), starting from R^n_{000} = (-2p)^n F_n(p R_PC^2).
+ *
+ *  All the integrals up to a total degree L are calculated at once, so that they can be reused for all Hermite Gaussians that appear in a shell pair or a shell quartet. The internal storage only grows, so that repeated calculations do not allocate.
+ */
+class HermiteCoulombIntegrals {
+private:
+    // The Boys function that provides the base recurrence cases.
+    BoysFunction boys_function;
+
+    // The total degree up to which the integrals have been calculated.
+    size_t L;
+
+    // The values R^n_{tuv} of all auxiliary integrals, stored at position ((n * (L + 1) + t) * (L + 1) + u) * (L + 1) + v.
+    std::vector<double> values;
+
+    // The values F_n(p R_PC^2) of the Boys function.
+    std::vector<double> boys_values;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param max_degree           The maximum total degree t + u + v of the Hermite Coulomb integrals that can be calculated. For two-electron integrals over shells with angular momentum up to l, this should be at least 4l.
+     */
+    HermiteCoulombIntegrals(const size_t max_degree = 32);
+
+
+    /*
+     *  MARK: Calculations
+     */
+
+    /**
+     *  Calculate all Hermite Coulomb integrals R_{tuv} with t + u + v <= L.
+     *
+     *  @param L                    The total degree up to which the Hermite Coulomb integrals should be calculated.
+     *  @param p                    The exponent of the Hermite Gaussian distribution, or the reduced exponent for a product of two Hermite Gaussian distributions.
+     *  @param R_PC                 The distance vector between the center of the Hermite Gaussian distribution and the Coulomb center, or between the centers of two Hermite Gaussian distributions.
+     */
+    void calculate(const size_t L, const double p, const Vector<double, 3>& R_PC);
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @param t                    The degree of the Hermite Gaussian in the x-direction.
+     *  @param u                    The degree of the Hermite Gaussian in the y-direction.
+     *  @param v                    The degree of the Hermite Gaussian in the z-direction.
+     *
+     *  @return The Hermite Coulomb integral R_{tuv}, as calculated by the last call to `calculate`.
+     */
+    double operator()(const size_t t, const size_t u, const size_t v) const { return this->values[(t * (this->L + 1) + u) * (this->L + 1) + v]; }
+};
+
+
+}  // namespace GQCP
@@ -25,6 +25,8 @@
 #include "Basis/Integrals/Interfaces/LibintInterfacer.hpp"
 #include "Basis/ScalarBasis/ScalarBasis.hpp"
 #include "Basis/ScalarBasis/ShellSet.hpp"
+#include "Basis/Transformations/FourIndexTransformation.hpp"
+#include "Mathematical/Representation/PackedRankFourTensor.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 #include "Mathematical/Representation/SquareRankFourTensor.hpp"
 #include "Operator/FirstQuantized/Operator.hpp"
@@ -32,7 +34,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 
 namespace GQCP {
@@ -163,6 +169,473 @@ public:
     }
 
 
+    /*
+     *  PUBLIC METHODS - PERMUTATIONAL SYMMETRY AND SCREENING
+     */
+
+    /**
+     *  Calculate the Cauchy-Schwarz bounds Q(i,j) = sqrt(max |(ab|ab)|), with basis function a in shell i and b in shell j, for all pairs of shells in the given shell set. Any integral (ab|cd) over the shell quartet (ij|kl) is then bounded by |(ab|cd)| <= Q(i,j) Q(k,l).
+     *
+     *  @param engine                       the engine that can calculate two-electron integrals over shells
+     *  @param shell_set                    the set of shells
+     *
+     *  @tparam Shell                       the type of shell the integral engine is able to handle
+     *  @tparam N                           the number of components the operator has
+     *  @tparam IntegralScalar              the scalar representation of an integral
+     *
+     *  @return the (symmetric) matrix of Cauchy-Schwarz bounds over the pairs of shells
+     *
+     *  @note The bounds are only valid for positive definite two-electron operators, such as the Coulomb repulsion operator.
+     */
+    template <typename Shell, size_t N, typename IntegralScalar>
+    static SquareMatrix<double> calculateSchwarzBounds(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& shell_set) {
+
+        const auto nsh = shell_set.numberOfShells();
+        const auto& shells = shell_set.asVector();
+
+        SquareMatrix<double> Q = SquareMatrix<double>::Zero(nsh);
+        std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> buffer;  // reused for all shell quartets, see BaseTwoElectronIntegralEngine::calculateByIndex()
+        for (size_t i = 0; i < nsh; i++) {
+            for (size_t j = 0; j <= i; j++) {
+                engine.calculateByIndex(shells, i, j, i, j, buffer);
+                if (buffer->areIntegralsAllZero()) {
+                    continue;
+                }
+
+                // Only the diagonal integrals (ab|ab) of the diagonal shell quartet (ij|ij) are needed.
+                double max_diagonal = 0.0;
+                for (size_t f1 = 0; f1 < buffer->numberOfBasisFunctionsInShell1(); f1++) {
+                    for (size_t f2 = 0; f2 < buffer->numberOfBasisFunctionsInShell2(); f2++) {
+                        for (size_t c = 0; c < N; c++) {
+                            max_diagonal = std::max(max_diagonal, static_cast<double>(std::abs(buffer->value(c, f1, f2, f1, f2))));
+                        }
+                    }
+                }
+
+                Q(i, j) = std::sqrt(max_diagonal);
+                Q(j, i) = Q(i, j);
+            }
+        }
+
+        return Q;
+    }
+
+
+    /**
+     *  Let the given engine calculate the integrals over every canonical shell quartet (ij|kl), i.e. with i >= j, k >= l and (ij) >= (kl), of the given shell set, and pass the resulting buffer to the given visitor. Shell quartets whose Cauchy-Schwarz bound Q(i,j) Q(k,l) lies below the given threshold are skipped.
+     *
+     *  @param engine                       the engine that can calculate two-electron integrals over shells
+     *  @param shell_set                    the set of shells
+     *  @param schwarz_bounds               the Cauchy-Schwarz bounds over the pairs of shells, see calculateSchwarzBounds()
+     *  @param threshold                    the threshold below which the integrals over a shell quartet are considered to be negligible
+     *  @param visitor                      a callable that is called as visitor(buffer, bf1, bf2, bf3, bf4) for every canonical shell quartet that is not screened away, in which bf1, bf2, bf3, bf4 are the total basis function indices of the first basis functions in the four shells
+     *
+     *  @tparam Shell                       the type of shell the integral engine is able to handle
+     *  @tparam N                           the number of components the operator has
+     *  @tparam IntegralScalar              the scalar representation of an integral
+     *  @tparam Visitor                     the type of the visitor
+     */
+    template <typename Shell, size_t N, typename IntegralScalar, typename Visitor>
+    static void forEachCanonicalShellQuartet(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& shell_set, const SquareMatrix<double>& schwarz_bounds, const double threshold, const Visitor& visitor) {
+
+        const auto nsh = shell_set.numberOfShells();
+        const auto& shells = shell_set.asVector();
+
+        // Look up the basis function index of every shell once, instead of for every shell quartet.
+        std::vector<size_t> bf_indices(nsh);
+        for (size_t i = 0; i < nsh; i++) {
+            bf_indices[i] = shell_set.basisFunctionIndex(i);
+        }
+
+
+        std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> buffer;  // reused for all shell quartets, see BaseTwoElectronIntegralEngine::calculateByIndex()
+        for (size_t i = 0; i < nsh; i++) {
+            for (size_t j = 0; j <= i; j++) {
+                const auto Q_ij = schwarz_bounds(i, j);
+
+                for (size_t k = 0; k <= i; k++) {
+                    const auto l_max = (k == i) ? j : k;  // makes sure that (ij) >= (kl)
+
+                    for (size_t l = 0; l <= l_max; l++) {
+                        if (Q_ij * schwarz_bounds(k, l) < threshold) {
+                            continue;
+                        }
+
+                        engine.calculateByIndex(shells, i, j, k, l, buffer);
+                        if (buffer->areIntegralsAllZero()) {
+                            continue;
+                        }
+                        visitor(*buffer, bf_indices[i], bf_indices[j], bf_indices[k], bf_indices[l]);
+                    }  // l
+                }      // k
+            }          // j
+        }              // i
+    }
+
+
+    /**
+     *  Calculate all two-electron integrals over the basis functions inside the given shell set, by only calculating the canonical shell quartets and skipping the ones that are negligible according to their Cauchy-Schwarz bound. The full tensors are then filled in using the 8-fold permutational symmetry of real two-electron integrals.
+     *
+     *  @param engine                       the engine that can calculate two-electron integrals over shells
+     *  @param shell_set                    the set of shells that should appear on both sides of the operator
+     *  @param threshold                    the threshold below which the integrals over a shell quartet are considered to be negligible, and are not calculated
+     *
+     *  @tparam Shell                       the type of shell the integral engine is able to handle
+     *  @tparam N                           the number of components the operator has
+     *  @tparam IntegralScalar              the scalar representation of an integral
+     *
+     *  @note This method should only be used for real, positive definite two-electron operators, such as the Coulomb repulsion operator.
+     */
+    template <typename Shell, size_t N, typename IntegralScalar>
+    static auto calculateSymmetric(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& shell_set, const double threshold = 1.0e-12) -> std::array<Tensor<IntegralScalar, 4>, N> {
+
+        // Initialize the N components of the matrix representations of the operator.
+        const auto nbf = shell_set.numberOfBasisFunctions();
+
+        std::array<Tensor<IntegralScalar, 4>, N> components;
+        for (auto& component : components) {
+            component = Tensor<IntegralScalar, 4>(nbf, nbf, nbf, nbf);
+            component.setZero();
+        }
+
+
+        // Calculate the canonical shell quartets that survive the screening, and place their symmetric copies inside the full tensors.
+        const auto Q = IntegralCalculator::calculateSchwarzBounds(engine, shell_set);
+        IntegralCalculator::forEachCanonicalShellQuartet(engine, shell_set, Q, threshold,
+                                                         [&components](const BaseTwoElectronIntegralBuffer<IntegralScalar, N>& buffer, const size_t bf1, const size_t bf2, const size_t bf3, const size_t bf4) {
+                                                             buffer.emplacePermutations(components, bf1, bf2, bf3, bf4);
+                                                         });
+
+        return components;
+    }
+
+
+    /**
+     *  Calculate the unique two-electron integrals over the basis functions inside the given shell set, by only calculating the canonical shell quartets and skipping the ones that are negligible according to their Cauchy-Schwarz bound. As opposed to `calculateSymmetric()`, the integrals are stored in a packed representation that only holds about 1/8 of the elements of the full tensors.
+     *
+     *  @param engine                       the engine that can calculate two-electron integrals over shells
+     *  @param shell_set                    the set of shells that should appear on both sides of the operator
+     *  @param threshold                    the threshold below which the integrals over a shell quartet are considered to be negligible, and are not calculated
+     *
+     *  @tparam Shell                       the type of shell the integral engine is able to handle
+     *  @tparam N                           the number of components the operator has
+     *  @tparam IntegralScalar              the scalar representation of an integral
+     *
+     *  @note This method should only be used for real, positive definite two-electron operators, such as the Coulomb repulsion operator.
+     */
+    template <typename Shell, size_t N, typename IntegralScalar>
+    static auto calculatePacked(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& shell_set, const double threshold = 1.0e-12) -> std::array<PackedRankFourTensor<IntegralScalar>, N> {
+
+        // Initialize the N components of the packed representations of the operator.
+        const auto nbf = shell_set.numberOfBasisFunctions();
+
+        std::array<PackedRankFourTensor<IntegralScalar>, N> components;
+        for (auto& component : components) {
+            component = PackedRankFourTensor<IntegralScalar>(nbf);
+        }
+
+
+        // Calculate the canonical shell quartets that survive the screening. Every unique integral belongs to exactly one of them.
+        const auto Q = IntegralCalculator::calculateSchwarzBounds(engine, shell_set);
+        IntegralCalculator::forEachCanonicalShellQuartet(engine, shell_set, Q, threshold,
+                                                         [&components](const BaseTwoElectronIntegralBuffer<IntegralScalar, N>& buffer, const size_t bf1, const size_t bf2, const size_t bf3, const size_t bf4) {
+                                                             buffer.emplacePacked(components, bf1, bf2, bf3, bf4);
+                                                         });
+
+        return components;
+    }
+
+
+    /**
+     *  Calculate a pivoted incomplete Cholesky decomposition (pq|rs) ~ sum_J L^J_pq L^J_rs of the two-electron integrals over the basis functions inside the given shell set, without ever calculating all the integrals.
+     *
+     *  Starting from the diagonal (pq|pq), the columns of the two-electron integral matrix are calculated one shell pair at a time: every time the largest remaining diagonal element is selected, the columns for all the function pairs in its shell pair are calculated and several Cholesky vectors are extracted from them. The decomposition stops when the largest remaining diagonal element, which bounds the error on every integral, drops below the given tolerance.
+     *
+     *  @param engine                       the engine that can calculate two-electron integrals over shells
+     *  @param shell_set                    the set of shells that should appear on both sides of the operator
+     *  @param tolerance                    the largest remaining diagonal element that is accepted, which controls the accuracy of the decomposition
+     *
+     *  @tparam Shell                       the type of shell the integral engine is able to handle
+     *  @tparam N                           the number of components the operator has
+     *  @tparam IntegralScalar              the scalar representation of an integral
+     *
+     *  @return the Cholesky vectors as a (K^2 x M)-matrix, in which every column is the column-major (K x K)-matrix L^J
+     *
+     *  @note This method should only be used for real, positive definite two-electron operators, such as the Coulomb repulsion operator. Only the first component of the operator is decomposed.
+     */
+    template <typename Shell, size_t N, typename IntegralScalar>
+    static MatrixX<double> calculateCholeskyVectors(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& shell_set, const double tolerance = 1.0e-06) {
+
+        const auto nsh = shell_set.numberOfShells();
+        const auto& shells = shell_set.asVector();
+        const auto K = shell_set.numberOfBasisFunctions();
+
+        // Look up the basis function index of every shell, and the shell of every basis function, once.
+        std::vector<size_t> bf_indices(nsh);
+        std::vector<size_t> shell_indices(K);
+        for (size_t i = 0; i < nsh; i++) {
+            bf_indices[i] = shell_set.basisFunctionIndex(i);
+            for (size_t f = 0; f < shells[i].numberOfBasisFunctions(); f++) {
+                shell_indices[bf_indices[i] + f] = i;
+            }
+        }
+
+
+        // Calculate the diagonal (pq|pq) of the two-electron integral matrix, from the diagonal shell quartets.
+        VectorX<double> diagonal = VectorX<double>::Zero(K * K);
+        std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> buffer;  // reused for all shell quartets, see BaseTwoElectronIntegralEngine::calculateByIndex()
+        for (size_t i = 0; i < nsh; i++) {
+            for (size_t j = 0; j <= i; j++) {
+                engine.calculateByIndex(shells, i, j, i, j, buffer);
+                if (buffer->areIntegralsAllZero()) {
+                    continue;
+                }
+
+                for (size_t f1 = 0; f1 < buffer->numberOfBasisFunctionsInShell1(); f1++) {
+                    const auto p = bf_indices[i] + f1;
+                    for (size_t f2 = 0; f2 < buffer->numberOfBasisFunctionsInShell2(); f2++) {
+                        const auto q = bf_indices[j] + f2;
+                        diagonal(p + K * q) = buffer->value(0, f1, f2, f1, f2);
+                        diagonal(q + K * p) = diagonal(p + K * q);
+                    }
+                }
+            }
+        }
+
+
+        // Only pivots whose diagonal element is comparable to the largest one are taken from the columns of one shell pair, which keeps the decomposition numerically stable.
+        const double span_factor = 1.0e-02;
+
+        MatrixX<double> L = MatrixX<double>::Zero(K * K, std::min<size_t>(K * K, 4 * K));  // the Cholesky vectors, whose number of columns is doubled whenever they are all in use
+        size_t M = 0;                                                                          // the number of Cholesky vectors
+
+        Eigen::Index pivot;
+        double D_max = diagonal.maxCoeff(&pivot);
+        while ((D_max > tolerance) && (M < K * K)) {
+
+            // Calculate the columns (pq|rs) for all the function pairs rs in the shell pair (RS) of the pivot.
+            const auto R = shell_indices[pivot % K];
+            const auto S = shell_indices[pivot / K];
+            const auto nbf_R = shells[R].numberOfBasisFunctions();
+            const auto nbf_S = shells[S].numberOfBasisFunctions();
+
+            std::vector<size_t> columns(nbf_R * nbf_S);  // the compound indices rs of the calculated columns
+            for (size_t f3 = 0; f3 < nbf_R; f3++) {
+                for (size_t f4 = 0; f4 < nbf_S; f4++) {
+                    columns[f3 + nbf_R * f4] = (bf_indices[R] + f3) + K * (bf_indices[S] + f4);
+                }
+            }
+
+            MatrixX<double> G = MatrixX<double>::Zero(K * K, columns.size());
+            for (size_t i = 0; i < nsh; i++) {
+                for (size_t j = 0; j <= i; j++) {
+                    engine.calculateByIndex(shells, i, j, R, S, buffer);
+                    if (buffer->areIntegralsAllZero()) {
+                        continue;
+                    }
+
+                    for (size_t f1 = 0; f1 < buffer->numberOfBasisFunctionsInShell1(); f1++) {
+                        const auto p = bf_indices[i] + f1;
+                        for (size_t f2 = 0; f2 < buffer->numberOfBasisFunctionsInShell2(); f2++) {
+                            const auto q = bf_indices[j] + f2;
+                            for (size_t c = 0; c < columns.size(); c++) {
+                                const auto value = buffer->value(0, f1, f2, c % nbf_R, c / nbf_R);
+                                G(p + K * q, c) = value;
+                                G(q + K * p, c) = value;
+                            }
+                        }
+                    }
+                }
+            }
+
+
+            // Remove the contributions of the Cholesky vectors that have already been found.
+            if (M > 0) {
+                MatrixX<double> L_columns {columns.size(), M};
+                for (size_t c = 0; c < columns.size(); c++) {
+                    L_columns.row(c) = L.block(columns[c], 0, 1, M);
+                }
+                G.noalias() -= L.leftCols(M) * L_columns.transpose();
+            }
+
+
+            // Extract Cholesky vectors from the calculated columns, as long as their remaining diagonal elements are significant.
+            const auto D_min = std::max(tolerance, span_factor * D_max);
+            while (M < K * K) {
+                size_t c_max = 0;
+                for (size_t c = 1; c < columns.size(); c++) {
+                    if (diagonal(columns[c]) > diagonal(columns[c_max])) {
+                        c_max = c;
+                    }
+                }
+
+                const auto D_c = diagonal(columns[c_max]);
+                if (D_c <= D_min) {
+                    break;
+                }
+
+                if (M == static_cast<size_t>(L.cols())) {
+                    L.conservativeResize(Eigen::NoChange, std::min<size_t>(K * K, 2 * L.cols()));
+                }
+
+                L.col(M) = G.col(c_max) / std::sqrt(D_c);
+                diagonal -= L.col(M).cwiseAbs2();
+
+                // Update the remaining calculated columns with the new Cholesky vector.
+                VectorX<double> L_new_columns {columns.size()};
+                for (size_t c = 0; c < columns.size(); c++) {
+                    L_new_columns(c) = L(columns[c], M);
+                }
+                G.noalias() -= L.col(M) * L_new_columns.transpose();
+
+                diagonal(columns[c_max]) = 0.0;  // prevent round-off errors from selecting the same pivot again
+                M++;
+            }
+
+            D_max = diagonal.maxCoeff(&pivot);
+        }
+
+        return L.leftCols(M);
+    }
+
+
+    /**
+     *  Calculate the two-electron integrals over the basis functions inside the given shell set, transformed to the orbitals that are given by the columns of the transformation matrices
+     *      (pq|rs) = sum_{tuvw} C1^*(t p) C2(u q) C3^*(v r) C4(w s) (tu|vw),
+     *  without ever storing all the integrals over the scalar basis functions.
+     *
+     *  The ket shell pairs (kl) with k >= l are handled one at a time: the integrals (tu|vw) over all bra functions and the functions v, w of the ket shell pair are calculated, and are immediately transformed to the half-transformed integrals (pq|vw). Only the bra shell pairs (ij) with i >= j are calculated, and shell quartets whose Cauchy-Schwarz bound lies below the threshold are skipped. The ket indices are transformed once all half-transformed integrals are available.
+     *
+     *  Since every ket shell pair needs the integrals over all bra shell pairs, the bra-ket symmetry (tu|vw) = (vw|tu) isn't used: every shell quartet (ij|kl) with i >= j and k >= l is calculated, which is about twice the number of symmetry-unique quartets. Using the bra-ket symmetry would require keeping the integrals over all ket shell pairs, i.e. K^4 elements, which this method avoids.
+     *
+     *  @param engine                       the engine that can calculate two-electron integrals over shells
+     *  @param shell_set                    the set of shells that should appear on both sides of the operator
+     *  @param C1                           the transformation matrix for the first index, e.g. the expansion coefficients of the occupied orbitals
+     *  @param C2                           the transformation matrix for the second index
+     *  @param C3                           the transformation matrix for the third index
+     *  @param C4                           the transformation matrix for the fourth index
+     *  @param threshold                    the threshold below which the integrals over a shell quartet are considered to be negligible, and are not calculated
+     *
+     *  @tparam Shell                       the type of shell the integral engine is able to handle
+     *  @tparam N                           the number of components the operator has
+     *  @tparam IntegralScalar              the scalar representation of an integral
+     *  @tparam Scalar                      the scalar type of the transformation matrices
+     *
+     *  @return the transformed integrals (pq|rs) as a tensor with dimensions (C1.cols(), C2.cols(), C3.cols(), C4.cols())
+     *
+     *  @note This method should only be used for real, positive definite two-electron operators, such as the Coulomb repulsion operator. Only the first component of the operator is transformed.
+     *  @note Next to the result, the memory requirement is dominated by the half-transformed integrals, i.e. C1.cols() C2.cols() K^2 instead of K^4 elements.
+     */
+    template <typename Shell, size_t N, typename IntegralScalar, typename Scalar>
+    static Tensor<Scalar, 4> calculateTransformed(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& shell_set, const MatrixX<Scalar>& C1, const MatrixX<Scalar>& C2, const MatrixX<Scalar>& C3, const MatrixX<Scalar>& C4, const double threshold = 1.0e-12) {
+
+        using MatrixMap = Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>;
+
+        const auto nsh = shell_set.numberOfShells();
+        const auto& shells = shell_set.asVector();
+        const auto K = static_cast<long>(shell_set.numberOfBasisFunctions());
+
+        if ((C1.rows() != K) || (C2.rows() != K) || (C3.rows() != K) || (C4.rows() != K)) {
+            throw std::invalid_argument("IntegralCalculator::calculateTransformed(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>&, const ShellSet<Shell>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&, const double): The number of rows of the transformation matrices should be equal to the number of basis functions.");
+        }
+
+        const auto n1 = C1.cols();
+        const auto n2 = C2.cols();
+
+        // Look up the basis function index of every shell once, instead of for every shell quartet.
+        std::vector<size_t> bf_indices(nsh);
+        for (size_t i = 0; i < nsh; i++) {
+            bf_indices[i] = shell_set.basisFunctionIndex(i);
+        }
+
+        const auto Q = IntegralCalculator::calculateSchwarzBounds(engine, shell_set);
+
+
+        // The half-transformed integrals (pq|vw) are the only intermediate that is kept for all ket functions.
+        Tensor<Scalar, 4> half_transformed {n1, n2, K, K};
+        half_transformed.setZero();
+
+        std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> buffer;  // reused for all shell quartets, see BaseTwoElectronIntegralEngine::calculateByIndex()
+
+        // The integrals over one ket shell pair are gathered in a scratch matrix that is allocated once, for the largest ket shell pair.
+        size_t max_nbf = 0;
+        for (const auto& shell : shells) {
+            max_nbf = std::max(max_nbf, shell.numberOfBasisFunctions());
+        }
+        MatrixX<Scalar> G_scratch(K, K * static_cast<long>(max_nbf * max_nbf));
+
+        for (size_t k = 0; k < nsh; k++) {
+            for (size_t l = 0; l <= k; l++) {
+                const auto nbf3 = shells[k].numberOfBasisFunctions();
+                const auto nbf4 = shells[l].numberOfBasisFunctions();
+
+
+                // Gather the integrals (tu|vw) over all bra functions t, u and the functions v, w of this ket shell pair as a (K x K nbf3 nbf4)-matrix, in which the columns are ordered as (u, v, w).
+                auto G = G_scratch.leftCols(K * nbf3 * nbf4);
+                G.setZero();  // The screened shell quartets aren't written.
+                bool are_integrals_all_zero = true;
+
+                for (size_t i = 0; i < nsh; i++) {
+                    for (size_t j = 0; j <= i; j++) {
+                        if (Q(i, j) * Q(k, l) < threshold) {
+                            continue;
+                        }
+
+                        engine.calculateByIndex(shells, i, j, k, l, buffer);
+                        if (buffer->areIntegralsAllZero()) {
+                            continue;
+                        }
+                        are_integrals_all_zero = false;
+
+                        for (size_t f3 = 0; f3 < nbf3; f3++) {
+                            for (size_t f4 = 0; f4 < nbf4; f4++) {
+                                const auto column_offset = (f3 + nbf3 * f4) * K;
+
+                                for (size_t f1 = 0; f1 < buffer->numberOfBasisFunctionsInShell1(); f1++) {
+                                    for (size_t f2 = 0; f2 < buffer->numberOfBasisFunctionsInShell2(); f2++) {
+                                        const auto t = bf_indices[i] + f1;
+                                        const auto u = bf_indices[j] + f2;
+                                        const auto value = buffer->value(0, f1, f2, f3, f4);
+
+                                        // The bra shell pairs (ji) are not calculated, since (ut|vw) = (tu|vw).
+                                        G(t, column_offset + u) = value;
+                                        G(u, column_offset + t) = value;
+                                    }
+                                }
+                            }
+                        }
+                    }  // j
+                }      // i
+
+                if (are_integrals_all_zero) {
+                    continue;
+                }
+
+
+                // Transform the bra indices: one product for the first index, and one product for the second index for every ket function pair (v, w). Since (tu|wv) = (tu|vw), the result also fills in the ket shell pair (lk).
+                const MatrixX<Scalar> first = C1.adjoint() * G;
+                for (size_t f3 = 0; f3 < nbf3; f3++) {
+                    for (size_t f4 = 0; f4 < nbf4; f4++) {
+                        const auto v = static_cast<long>(bf_indices[k] + f3);
+                        const auto w = static_cast<long>(bf_indices[l] + f4);
+
+                        MatrixMap block {half_transformed.data() + (v + K * w) * n1 * n2, n1, n2};
+                        block.noalias() = first.middleCols((f3 + nbf3 * f4) * K, K) * C2;
+
+                        if (k != l) {
+                            MatrixMap(half_transformed.data() + (w + K * v) * n1 * n2, n1, n2) = block;
+                        }
+                    }
+                }
+            }  // l
+        }      // k
+
+
+        // Transform the ket indices of the half-transformed integrals, which are symmetric in their ket indices since both ket shell pairs (kl) and (lk) have been filled in.
+        return transformKetIndices(half_transformed, C3, C4, true);
+    }
+
+
     /*
      *  PUBLIC METHODS - LIBINT2 INTEGRALS
      */
@@ -270,7 +743,194 @@ public:
      */
     static SquareRankFourTensor<double> calculateLibintIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& scalar_basis) {
 
-        return SquareRankFourTensor<double>(IntegralCalculator::calculateLibintIntegrals(fq_two_op, scalar_basis, scalar_basis));  // the same scalar basis appear on the left and right of the operator
+        const auto shell_set = scalar_basis.shellSet();
+
+        // Construct the libint engine
+        const auto max_nprim = shell_set.maximumNumberOfPrimitives();
+        const auto max_l = shell_set.maximumAngularMomentum();
+        auto engine = IntegralEngine::Libint(fq_two_op, max_nprim, max_l);
+
+
+        // Since the same scalar basis appears on the left and right of the operator, we can make use of the permutational symmetry of the integrals
+        const auto integrals = IntegralCalculator::calculateSymmetric(engine, shell_set);
+        return SquareRankFourTensor<double>(integrals[0]);
+    }
+
+
+    /**
+     *  Calculate the unique integrals over the Coulomb repulsion operator, within a given scalar basis, using Libint2.
+     * 
+     *  @param fq_two_op                    the first-quantized operator
+     *  @param scalar_basis                 the scalar basis that contains the shells over which the integrals should be calculated
+     * 
+     *  @return the packed representation of the integrals of the Coulomb repulsion operator in this scalar basis
+     */
+    static PackedRankFourTensor<double> calculatePackedLibintIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& scalar_basis) {
+
+        const auto shell_set = scalar_basis.shellSet();
+
+        // Construct the libint engine
+        const auto max_nprim = shell_set.maximumNumberOfPrimitives();
+        const auto max_l = shell_set.maximumAngularMomentum();
+        auto engine = IntegralEngine::Libint(fq_two_op, max_nprim, max_l);
+
+        auto integrals = IntegralCalculator::calculatePacked(engine, shell_set);
+        return std::move(integrals[0]);
+    }
+
+
+    /**
+     *  Calculate the Cholesky vectors of the Coulomb integrals, within a given scalar basis, using Libint2.
+     *
+     *  @param fq_two_op                    the first-quantized operator
+     *  @param scalar_basis                 the scalar basis that contains the shells over which the integrals should be calculated
+     *  @param tolerance                    the largest remaining diagonal element that is accepted, which controls the accuracy of the decomposition
+     *
+     *  @return the Cholesky vectors as a (K^2 x M)-matrix, in which every column is the column-major (K x K)-matrix L^J, see calculateCholeskyVectors()
+     */
+    static MatrixX<double> calculateLibintCholeskyVectors(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& scalar_basis, const double tolerance = 1.0e-06) {
+
+        const auto shell_set = scalar_basis.shellSet();
+
+        // Construct the libint engine
+        const auto max_nprim = shell_set.maximumNumberOfPrimitives();
+        const auto max_l = shell_set.maximumAngularMomentum();
+        auto engine = IntegralEngine::Libint(fq_two_op, max_nprim, max_l);
+
+        return IntegralCalculator::calculateCholeskyVectors(engine, shell_set, tolerance);
+    }
+
+
+    /**
+     *  Calculate the Coulomb integrals within a given scalar basis using Libint2, transformed to the orbitals that are given by the columns of the transformation matrices, see calculateTransformed().
+     *
+     *  @param fq_two_op                    the first-quantized operator
+     *  @param scalar_basis                 the scalar basis that contains the shells over which the integrals should be calculated
+     *  @param C1                           the transformation matrix for the first index, e.g. the expansion coefficients of the occupied orbitals
+     *  @param C2                           the transformation matrix for the second index
+     *  @param C3                           the transformation matrix for the third index
+     *  @param C4                           the transformation matrix for the fourth index
+     *
+     *  @tparam Scalar                      the scalar type of the transformation matrices
+     *
+     *  @return the transformed integrals (pq|rs) as a tensor with dimensions (C1.cols(), C2.cols(), C3.cols(), C4.cols())
+     */
+    template <typename Scalar>
+    static Tensor<Scalar, 4> calculateLibintTransformedIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& scalar_basis, const MatrixX<Scalar>& C1, const MatrixX<Scalar>& C2, const MatrixX<Scalar>& C3, const MatrixX<Scalar>& C4) {
+
+        const auto shell_set = scalar_basis.shellSet();
+
+        // Construct the libint engine
+        const auto max_nprim = shell_set.maximumNumberOfPrimitives();
+        const auto max_l = shell_set.maximumAngularMomentum();
+        auto engine = IntegralEngine::Libint(fq_two_op, max_nprim, max_l);
+
+        return IntegralCalculator::calculateTransformed(engine, shell_set, C1, C2, C3, C4);
+    }
+
+
+    /**
+     *  Calculate the two-center Coulomb integrals (P|Q), i.e. the Coulomb metric, over the functions of an auxiliary scalar basis, using Libint2.
+     *
+     *  @param fq_two_op                    the first-quantized operator
+     *  @param auxiliary_scalar_basis       the (auxiliary) scalar basis that contains the shells over which the integrals should be calculated
+     *
+     *  @return the Coulomb metric in the auxiliary scalar basis
+     */
+    static SquareMatrix<double> calculateLibintTwoCenterIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& auxiliary_scalar_basis) {
+
+        const auto shell_set = auxiliary_scalar_basis.shellSet();
+        const auto& shells = shell_set.asVector();
+        const auto nsh = shell_set.numberOfShells();
+
+        // Construct the libint engine
+        auto engine = IntegralEngine::Libint(fq_two_op, shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+
+
+        // The Coulomb metric is symmetric, so only the shell pairs with sh1 >= sh2 have to be calculated.
+        SquareMatrix<double> V = SquareMatrix<double>::Zero(shell_set.numberOfBasisFunctions());
+        for (size_t sh1 = 0; sh1 < nsh; sh1++) {
+            const auto bf1 = shell_set.basisFunctionIndex(sh1);
+
+            for (size_t sh2 = 0; sh2 <= sh1; sh2++) {
+                const auto bf2 = shell_set.basisFunctionIndex(sh2);
+
+                const auto buffer = engine.calculateTwoCenter(shells[sh1], shells[sh2]);
+                if (buffer->areIntegralsAllZero()) {
+                    continue;
+                }
+
+                for (size_t f1 = 0; f1 < buffer->numberOfBasisFunctionsInShell1(); f1++) {
+                    for (size_t f2 = 0; f2 < buffer->numberOfBasisFunctionsInShell3(); f2++) {
+                        const auto value = buffer->value(0, f1, 0, f2, 0);
+                        V(bf1 + f1, bf2 + f2) = value;
+                        V(bf2 + f2, bf1 + f1) = value;
+                    }
+                }
+            }
+        }
+
+        return V;
+    }
+
+
+    /**
+     *  Calculate the three-center Coulomb integrals (P|rs) between the functions of an auxiliary scalar basis and the pairs of functions of a scalar basis, using Libint2.
+     *
+     *  @param fq_two_op                    the first-quantized operator
+     *  @param scalar_basis                 the scalar basis whose pairs of basis functions appear in the ket
+     *  @param auxiliary_scalar_basis       the (auxiliary) scalar basis whose functions appear in the bra
+     *
+     *  @return the three-center integrals as a (K, K, N_aux)-tensor with elements (r, s, P). Since tensors are stored column-major, the integrals for one auxiliary function P form a contiguous (K x K)-matrix.
+     */
+    static Tensor<double, 3> calculateLibintThreeCenterIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& scalar_basis, const ScalarBasis<GTOShell>& auxiliary_scalar_basis) {
+
+        const auto shell_set = scalar_basis.shellSet();
+        const auto auxiliary_shell_set = auxiliary_scalar_basis.shellSet();
+        const auto& shells = shell_set.asVector();
+        const auto& auxiliary_shells = auxiliary_shell_set.asVector();
+
+        // Construct the libint engine
+        const auto max_nprim = std::max(shell_set.maximumNumberOfPrimitives(), auxiliary_shell_set.maximumNumberOfPrimitives());
+        const auto max_l = std::max(shell_set.maximumAngularMomentum(), auxiliary_shell_set.maximumAngularMomentum());
+        auto engine = IntegralEngine::Libint(fq_two_op, max_nprim, max_l);
+
+
+        // The integrals are symmetric in the ket, so only the shell pairs with sh3 >= sh4 have to be calculated.
+        const auto K = static_cast<long>(shell_set.numberOfBasisFunctions());
+        const auto N_aux = static_cast<long>(auxiliary_shell_set.numberOfBasisFunctions());
+
+        Tensor<double, 3> integrals {K, K, N_aux};
+        integrals.setZero();
+
+        for (size_t sh1 = 0; sh1 < auxiliary_shell_set.numberOfShells(); sh1++) {
+            const auto bf1 = auxiliary_shell_set.basisFunctionIndex(sh1);
+
+            for (size_t sh3 = 0; sh3 < shell_set.numberOfShells(); sh3++) {
+                const auto bf3 = shell_set.basisFunctionIndex(sh3);
+
+                for (size_t sh4 = 0; sh4 <= sh3; sh4++) {
+                    const auto bf4 = shell_set.basisFunctionIndex(sh4);
+
+                    const auto buffer = engine.calculateThreeCenter(auxiliary_shells[sh1], shells[sh3], shells[sh4]);
+                    if (buffer->areIntegralsAllZero()) {
+                        continue;
+                    }
+
+                    for (size_t f1 = 0; f1 < buffer->numberOfBasisFunctionsInShell1(); f1++) {
+                        for (size_t f3 = 0; f3 < buffer->numberOfBasisFunctionsInShell3(); f3++) {
+                            for (size_t f4 = 0; f4 < buffer->numberOfBasisFunctionsInShell4(); f4++) {
+                                const auto value = buffer->value(0, f1, 0, f3, f4);
+                                integrals(bf3 + f3, bf4 + f4, bf1 + f1) = value;
+                                integrals(bf4 + f4, bf3 + f3, bf1 + f1) = value;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        return integrals;
     }
 
 
@@ -363,7 +1023,7 @@ public:
         const auto shell_set = scalar_basis.shellSet();
 
         auto engine = IntegralEngine::Libcint(fq_op, shell_set);
-        const auto integrals = IntegralCalculator::calculate(engine, shell_set, shell_set);
+        const auto integrals = IntegralCalculator::calculateSymmetric(engine, shell_set);
         return integrals[0];
     }
 };
@@ -18,10 +18,12 @@
 #pragma once
 
 
+#include "Basis/Integrals/CoulombRepulsionIntegralEngine.hpp"
 #include "Basis/Integrals/Interfaces/LibcintOneElectronIntegralEngine.hpp"
 #include "Basis/Integrals/Interfaces/LibcintTwoElectronIntegralEngine.hpp"
 #include "Basis/Integrals/Interfaces/LibintOneElectronIntegralEngine.hpp"
 #include "Basis/Integrals/Interfaces/LibintTwoElectronIntegralEngine.hpp"
+#include "Basis/Integrals/NuclearAttractionIntegralEngine.hpp"
 #include "Basis/Integrals/OneElectronIntegralEngine.hpp"
 #include "Basis/Integrals/PrimitiveAngularMomentumIntegralEngine.hpp"
 #include "Basis/Integrals/PrimitiveDipoleIntegralEngine.hpp"
@@ -55,6 +57,16 @@ public:
      */
     static OneElectronIntegralEngine<PrimitiveAngularMomentumIntegralEngine> InHouse(const AngularMomentumOperator& op);
 
+    /**
+     *  @param op               the Coulomb repulsion operator
+     *  @param max_l            the maximum angular momentum of Gaussian shell
+     * 
+     *  @return a two-electron integral engine that can calculate integrals over the Coulomb repulsion operator
+     * 
+     *  @note Shells with angular momentum l >= 2 must be Cartesian.
+     */
+    static CoulombRepulsionIntegralEngine InHouse(const CoulombRepulsionOperator& op, const size_t max_l = 8);
+
     /**
      *  @param op               the electronic dipole operator
      * 
@@ -82,6 +94,16 @@ public:
      */
     static OneElectronIntegralEngine<PrimitiveLinearMomentumIntegralEngine> InHouse(const LinearMomentumOperator& op);
 
+    /**
+     *  @param op               the nuclear attraction operator
+     *  @param max_l            the maximum angular momentum of Gaussian shell
+     * 
+     *  @return a one-electron integral engine that can calculate integrals over the nuclear attraction operator
+     * 
+     *  @note Shells with angular momentum l >= 2 must be Cartesian.
+     */
+    static NuclearAttractionIntegralEngine InHouse(const NuclearAttractionOperator& op, const size_t max_l = 8);
+
     /**
      *  @param op               the overlap operator
      * 
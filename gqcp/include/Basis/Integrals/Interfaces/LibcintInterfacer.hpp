@@ -197,6 +197,31 @@ public:
         libcint_env {new double[10000]} {}
 
 
+    /**
+     *  Since this container owns its raw arrays, it can't be copied: a copy would deallocate them a second time.
+     */
+    RawContainer(const RawContainer&) = delete;
+    RawContainer& operator=(const RawContainer&) = delete;
+
+    /**
+     *  Take over the raw arrays of another container, leaving it empty.
+     *
+     *  @param other        the container whose raw arrays are taken over
+     */
+    RawContainer(RawContainer&& other) :
+        natm {other.natm},
+        nbf {other.nbf},
+        nsh {other.nsh},
+        libcint_atm {other.libcint_atm},
+        libcint_bas {other.libcint_bas},
+        libcint_env {other.libcint_env} {
+
+        other.libcint_atm = nullptr;
+        other.libcint_bas = nullptr;
+        other.libcint_env = nullptr;
+    }
+
+
     /*
      *  DESTRUCTOR
      */
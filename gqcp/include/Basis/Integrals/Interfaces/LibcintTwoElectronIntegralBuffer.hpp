@@ -20,6 +20,8 @@
 
 #include "Basis/Integrals/BaseTwoElectronIntegralBuffer.hpp"
 
+#include <vector>
+
 
 namespace GQCP {
 
@@ -62,6 +64,50 @@ public:
         BaseTwoElectronIntegralBuffer<IntegralScalar, N>(nbf1, nbf2, nbf3, nbf4) {}
 
 
+    /**
+     *  Allocate an (empty) buffer that can be filled in repeatedly by a libcint engine, see LibcintTwoElectronIntegralEngine::calculate(size_t, size_t, size_t, size_t, LibcintTwoElectronIntegralBuffer&).
+     *
+     *  @param capacity             the number of integrals that the buffer can hold, which should be at least the number of integrals over the largest shell quartet
+     */
+    explicit LibcintTwoElectronIntegralBuffer(const size_t capacity) :
+        buffer(capacity),
+        result {0},
+        BaseTwoElectronIntegralBuffer<IntegralScalar, N>(0, 0, 0, 0) {}
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  @return the number of integrals that this buffer can hold
+     */
+    size_t capacity() const { return this->buffer.size(); }
+
+    /**
+     *  @return a pointer to the raw data of this buffer, in which libcint can write the integrals
+     */
+    IntegralScalar* data() { return this->buffer.data(); }
+
+    /**
+     *  Update the dimensions of this buffer after libcint has written the integrals over a new shell quartet in it.
+     *
+     *  @param nbf1                 the number of basis functions in the first shell
+     *  @param nbf2                 the number of basis functions in the second shell
+     *  @param nbf3                 the number of basis functions in the third shell
+     *  @param nbf4                 the number of basis functions in the fourth shell
+     *  @param result               the result of the libcint_function call
+     */
+    void update(const size_t nbf1, const size_t nbf2, const size_t nbf3, const size_t nbf4, const int result) {
+
+        this->nbf1 = nbf1;
+        this->nbf2 = nbf2;
+        this->nbf3 = nbf3;
+        this->nbf4 = nbf4;
+        this->result = result;
+    }
+
+
     /*
      *  PUBLIC OVERRIDDEN METHODS
      */
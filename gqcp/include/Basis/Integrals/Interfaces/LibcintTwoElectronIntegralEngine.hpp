@@ -23,6 +23,12 @@
 #include "Basis/Integrals/Interfaces/LibcintTwoElectronIntegralBuffer.hpp"
 #include "Utilities/miscellaneous.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 
 namespace GQCP {
 
@@ -37,6 +43,7 @@ namespace GQCP {
  *  @note _Shell is a template parameter because that enables compile-time checking of correct arguments.
  *  See also the notes in LibcintOneElectronIntegralEngine.
  *  The libcint optimizer struct should also be kept in the engine during the shell-quartet loop, because it should only be initialized once, having access to all the data inside the libcint RawContainer.
+ *  Since the engine owns the optimizer struct, it can be moved but not copied.
  */
 template <typename _Shell, size_t _N, typename _IntegralScalar>
 class LibcintTwoElectronIntegralEngine: public BaseTwoElectronIntegralEngine<_Shell, _N, _IntegralScalar> {
@@ -45,6 +52,8 @@ public:
     using IntegralScalar = _IntegralScalar;  // the scalar representation of an integral
     static constexpr auto N = _N;            // the number of components the operator has
 
+    using Buffer = LibcintTwoElectronIntegralBuffer<IntegralScalar, N>;  // the type of buffer in which the integrals are stored
+
 
 private:
     Libcint2eFunction libcint_function;                     // the libcint two-electron integral function
@@ -53,6 +62,9 @@ private:
     // Data that has to be kept as a member (see the class note)
     libcint::RawContainer libcint_raw_container;  // the raw libcint data
     ShellSet<Shell> shell_set;                    // the corresponding shell set
+    CINTOpt* libcint_optimizer;                   // the libcint optimizer struct, which is built once for the shell set
+
+    std::vector<size_t> shell_sizes;  // the number of basis functions in every shell of the shell set
 
 
 public:
@@ -68,7 +80,49 @@ public:
         libcint_function {LibcintInterfacer().twoElectronFunction(op)},
         libcint_optimizer_function {LibcintInterfacer().twoElectronOptimizerFunction(op)},
         libcint_raw_container {LibcintInterfacer().convert(shell_set)},
-        shell_set {shell_set} {}
+        shell_set {shell_set},
+        libcint_optimizer {nullptr} {
+
+        // Build the optimizer struct once, for all shell quartets of the shell set.
+        this->libcint_optimizer_function(&this->libcint_optimizer, this->libcint_raw_container.atmData(), this->libcint_raw_container.numberOfAtoms(), this->libcint_raw_container.basData(), this->libcint_raw_container.numberOfBasisFunctions(), this->libcint_raw_container.envData());
+
+        // Look up the size of every shell once.
+        for (const auto& shell : shell_set.asVector()) {
+            this->shell_sizes.push_back(shell.numberOfBasisFunctions());
+        }
+    }
+
+
+    /**
+     *  @param other            the engine whose libcint data and optimizer struct are taken over
+     */
+    LibcintTwoElectronIntegralEngine(LibcintTwoElectronIntegralEngine&& other) :
+        libcint_function {std::move(other.libcint_function)},
+        libcint_optimizer_function {std::move(other.libcint_optimizer_function)},
+        libcint_raw_container {std::move(other.libcint_raw_container)},
+        shell_set {std::move(other.shell_set)},
+        libcint_optimizer {other.libcint_optimizer},
+        shell_sizes {std::move(other.shell_sizes)} {
+
+        other.libcint_optimizer = nullptr;
+    }
+
+    LibcintTwoElectronIntegralEngine(const LibcintTwoElectronIntegralEngine&) = delete;
+    LibcintTwoElectronIntegralEngine& operator=(const LibcintTwoElectronIntegralEngine&) = delete;
+
+
+    /*
+     *  DESTRUCTOR
+     */
+
+    /**
+     *  Deallocate the libcint optimizer struct
+     */
+    ~LibcintTwoElectronIntegralEngine() {
+        if (this->libcint_optimizer != nullptr) {
+            CINTdel_optimizer(&this->libcint_optimizer);
+        }
+    }
 
 
     /*
@@ -82,31 +136,155 @@ public:
      *  @param shell4          the fourth shell
      * 
      *  This method is not marked const to allow the Engine's internals to be changed
+     *
+     *  @note The given shells have to be looked up in the shell set of this engine, so prefer calculateByIndex() or the index-based calculate() in loops over shell quartets.
+     *
+     *  @return a newly allocated buffer containing the calculated integrals
      */
     std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculate(const Shell& shell1, const Shell& shell2, const Shell& shell3, const Shell& shell4) override {
 
         // Find to which indices in the RawContainer the given shells correspond
-        int shell_indices[4];
-        shell_indices[0] = static_cast<int>(findElementIndex(this->shell_set.asVector(), shell1));
-        shell_indices[1] = static_cast<int>(findElementIndex(this->shell_set.asVector(), shell2));
-        shell_indices[2] = static_cast<int>(findElementIndex(this->shell_set.asVector(), shell3));
-        shell_indices[3] = static_cast<int>(findElementIndex(this->shell_set.asVector(), shell4));
+        const auto& shells = this->shell_set.asVector();
+        return this->calculateNewBuffer(findElementIndex(shells, shell1), findElementIndex(shells, shell2), findElementIndex(shells, shell3), findElementIndex(shells, shell4));
+    }
 
 
-        // Pre-allocate a raw buffer, because libcint functions expect a data pointer
-        const size_t nbf1 = shell1.numberOfBasisFunctions();
-        const size_t nbf2 = shell2.numberOfBasisFunctions();
-        const size_t nbf3 = shell3.numberOfBasisFunctions();
-        const size_t nbf4 = shell4.numberOfBasisFunctions();
-        double libcint_buffer[N * nbf1 * nbf2 * nbf3 * nbf4];
+    /**
+     *  @param shells           the shells over which the integrals are calculated
+     *  @param index1           the index of the first shell
+     *  @param index2           the index of the second shell
+     *  @param index3           the index of the third shell
+     *  @param index4           the index of the fourth shell
+     *
+     *  This method is not marked const to allow the Engine's internals to be changed
+     *
+     *  @note If the given shells coincide with the ones at the same indices in the shell set of this engine (which is the case in the shell quartet loops of IntegralCalculator), the shell lookup is skipped. Otherwise, the shells are looked up as in the shell-based calculate().
+     *
+     *  @return a newly allocated buffer containing the calculated integrals
+     */
+    std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculateByIndex(const std::vector<Shell>& shells, const size_t index1, const size_t index2, const size_t index3, const size_t index4) override {
+
+        if (this->coincidesWithShellSet(shells, index1, index2, index3, index4)) {
+            return this->calculateNewBuffer(index1, index2, index3, index4);
+        } else {
+            return this->calculate(shells[index1], shells[index2], shells[index3], shells[index4]);
+        }
+    }
 
 
-        // Let libcint compute the integrals and return the corresponding buffer
-        const auto result = this->libcint_function(libcint_buffer, shell_indices, this->libcint_raw_container.atmData(), this->libcint_raw_container.numberOfAtoms(), this->libcint_raw_container.basData(), this->libcint_raw_container.numberOfBasisFunctions(), this->libcint_raw_container.envData(), nullptr);  // no optimizer struct
+    /**
+     *  @param shells           the shells over which the integrals are calculated
+     *  @param index1           the index of the first shell
+     *  @param index2           the index of the second shell
+     *  @param index3           the index of the third shell
+     *  @param index4           the index of the fourth shell
+     *  @param buffer           a buffer that was filled in by a previous call to this method (or an empty pointer), which is reused if possible
+     *
+     *  This method is not marked const to allow the Engine's internals to be changed
+     *
+     *  @note The given buffer is reused through the index-based calculate() if it is a libcint buffer of at least maximumBufferSize() that isn't shared with anyone else. Otherwise, such a buffer is allocated once and subsequent calls reuse it.
+     */
+    void calculateByIndex(const std::vector<Shell>& shells, const size_t index1, const size_t index2, const size_t index3, const size_t index4, std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>>& buffer) override {
+
+        if (!this->coincidesWithShellSet(shells, index1, index2, index3, index4)) {
+            buffer = this->calculate(shells[index1], shells[index2], shells[index3], shells[index4]);
+            return;
+        }
+
+        auto* libcint_buffer = dynamic_cast<Buffer*>(buffer.get());
+        if ((libcint_buffer == nullptr) || (buffer.use_count() > 1) || (libcint_buffer->capacity() < this->maximumBufferSize())) {
+            auto new_buffer = std::make_shared<Buffer>(this->maximumBufferSize());
+            libcint_buffer = new_buffer.get();
+            buffer = std::move(new_buffer);
+        }
+
+        this->calculate(index1, index2, index3, index4, *libcint_buffer);
+    }
+
 
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  Calculate the integrals over the shells with the given indices in the shell set of this engine, and write them in the given (caller-owned) buffer.
+     *
+     *  @param index1           the index of the first shell
+     *  @param index2           the index of the second shell
+     *  @param index3           the index of the third shell
+     *  @param index4           the index of the fourth shell
+     *  @param buffer           the buffer in which the integrals are written, which should have a capacity of at least maximumBufferSize()
+     *
+     *  @note Re-using one buffer across calls avoids an allocation per shell quartet. The integrals that were previously stored in the buffer are overwritten.
+     */
+    void calculate(const size_t index1, const size_t index2, const size_t index3, const size_t index4, Buffer& buffer) const {
+
+        if (buffer.capacity() < N * this->shell_sizes[index1] * this->shell_sizes[index2] * this->shell_sizes[index3] * this->shell_sizes[index4]) {
+            throw std::invalid_argument("LibcintTwoElectronIntegralEngine::calculate(const size_t, const size_t, const size_t, const size_t, Buffer&): The given buffer is too small to hold the integrals over the given shell quartet.");
+        }
+
+        const int shell_indices[4] = {static_cast<int>(index1), static_cast<int>(index2), static_cast<int>(index3), static_cast<int>(index4)};
+
+        // Let libcint compute the integrals directly inside the buffer
+        const auto result = this->libcint_function(buffer.data(), shell_indices, this->libcint_raw_container.atmData(), this->libcint_raw_container.numberOfAtoms(), this->libcint_raw_container.basData(), this->libcint_raw_container.numberOfBasisFunctions(), this->libcint_raw_container.envData(), this->libcint_optimizer);
+        buffer.update(this->shell_sizes[index1], this->shell_sizes[index2], this->shell_sizes[index3], this->shell_sizes[index4], result);
+    }
+
+
+    /**
+     *  @return the number of integrals over the largest shell quartet, i.e. the capacity that a buffer should have
+     */
+    size_t maximumBufferSize() const {
+
+        const auto max_nbf = this->shell_sizes.empty() ? 0 : *std::max_element(this->shell_sizes.begin(), this->shell_sizes.end());
+        return N * max_nbf * max_nbf * max_nbf * max_nbf;
+    }
+
+
+    /**
+     *  @return the shell set that this engine was constructed for
+     */
+    const ShellSet<Shell>& shellSet() const { return this->shell_set; }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  @param shells           the shells over which the integrals are calculated
+     *  @param index1           the index of the first shell
+     *  @param index2           the index of the second shell
+     *  @param index3           the index of the third shell
+     *  @param index4           the index of the fourth shell
+     *
+     *  @return if the given shells coincide with the ones at the same indices in the shell set of this engine, i.e. if the shell lookup can be skipped
+     */
+    bool coincidesWithShellSet(const std::vector<Shell>& shells, const size_t index1, const size_t index2, const size_t index3, const size_t index4) const {
+
+        const auto& own_shells = this->shell_set.asVector();
+        const auto coincides = [&shells, &own_shells](const size_t index) {
+            return (index < own_shells.size()) && (shells[index] == own_shells[index]);
+        };
+
+        return coincides(index1) && coincides(index2) && coincides(index3) && coincides(index4);
+    }
+
+
+    /**
+     *  @param index1           the index of the first shell
+     *  @param index2           the index of the second shell
+     *  @param index3           the index of the third shell
+     *  @param index4           the index of the fourth shell
+     *
+     *  @return a newly allocated buffer, owned by the caller, containing the integrals over the shells with the given indices
+     */
+    std::shared_ptr<Buffer> calculateNewBuffer(const size_t index1, const size_t index2, const size_t index3, const size_t index4) const {
 
-        std::vector<double> buffer_converted {libcint_buffer, libcint_buffer + N * nbf1 * nbf2 * nbf3 * nbf4};  // std::vector constructor from .begin() and .end()
-        return std::make_shared<LibcintTwoElectronIntegralBuffer<IntegralScalar, N>>(buffer_converted, nbf1, nbf2, nbf3, nbf4, result);
+        auto buffer = std::make_shared<Buffer>(N * this->shell_sizes[index1] * this->shell_sizes[index2] * this->shell_sizes[index3] * this->shell_sizes[index4]);
+        this->calculate(index1, index2, index3, index4, *buffer);
+        return buffer;
     }
 };
 
@@ -20,6 +20,9 @@
 
 #include "Basis/Integrals/BaseOneElectronIntegralBuffer.hpp"
 
+#include <algorithm>
+#include <vector>
+
 
 namespace GQCP {
 
@@ -27,6 +30,8 @@ namespace GQCP {
 /**
  *  A buffer for storing libint two-electron integrals
  * 
+ *  @note The libint2 engine overwrites its results upon every calculation, so this buffer stores a copy of them. This way, the buffer is owned by the caller, as `BaseTwoElectronIntegralEngine` requires.
+ * 
  *  @tparam _N              the number of components the operator has
  */
 template <size_t _N>
@@ -38,7 +43,9 @@ public:
 
 private:
     using libint2_buffer_t = LibintInterfacer::libint_target_ptr_vec;  // t for type
-    libint2_buffer_t libint2_buffer;
+
+    bool all_zero;                  // if libint2 has screened out all the integrals
+    std::vector<double> integrals;  // the calculated integrals, packed component after component (each in row-major form)
 
 
 public:
@@ -47,15 +54,28 @@ public:
      */
 
     /**
-     *  @param libint2_buffer       the libint2 buffer that contains the calculated integrals
+     *  @param libint2_buffer       the libint2 buffer that contains the calculated integrals, which are copied
      *  @param nbf1                 the number of basis functions in the first shell
      *  @param nbf2                 the number of basis functions in the second shell
      *  @param nbf3                 the number of basis functions in the third shell
      *  @param nbf4                 the number of basis functions in the fourth shell
      */
     LibintTwoElectronIntegralBuffer(const libint2_buffer_t& libint2_buffer, const size_t nbf1, const size_t nbf2, const size_t nbf3, const size_t nbf4) :
-        libint2_buffer {libint2_buffer},
-        BaseTwoElectronIntegralBuffer<IntegralScalar, N>(nbf1, nbf2, nbf3, nbf4) {}
+        BaseTwoElectronIntegralBuffer<IntegralScalar, N>(nbf1, nbf2, nbf3, nbf4),
+        all_zero {libint2_buffer[0] == nullptr} {
+
+        if (this->all_zero) {
+            return;
+        }
+
+        const auto number_of_integrals = nbf1 * nbf2 * nbf3 * nbf4;
+        this->integrals.resize(N * number_of_integrals, 0.0);
+        for (size_t i = 0; i < N; i++) {
+            if (libint2_buffer[i] != nullptr) {
+                std::copy(libint2_buffer[i], libint2_buffer[i] + number_of_integrals, this->integrals.begin() + i * number_of_integrals);
+            }
+        }
+    }
 
 
     /**
@@ -65,7 +85,7 @@ public:
     /**
      *  @return if all the values of the calculated integrals are zero
      */
-    bool areIntegralsAllZero() const override { return (this->libint2_buffer[0] == nullptr); }
+    bool areIntegralsAllZero() const override { return this->all_zero; }
 
     /**
      *  @param i            the index of the component of the operator
@@ -78,7 +98,7 @@ public:
      */
     IntegralScalar value(const size_t i, const size_t f1, const size_t f2, const size_t f3, const size_t f4) const override {
 
-        return this->libint2_buffer[i][f4 + this->nbf4 * (f3 + this->nbf3 * (f2 + this->nbf2 * (f1)))];  // integrals are packed in row-major form
+        return this->integrals[f4 + this->nbf4 * (f3 + this->nbf3 * (f2 + this->nbf2 * (f1 + this->nbf1 * i)))];  // integrals are packed in row-major form
     }
 };
 
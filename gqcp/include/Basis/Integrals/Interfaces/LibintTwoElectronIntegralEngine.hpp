@@ -41,6 +41,26 @@ public:
 private:
     libint2::Engine libint2_engine;
 
+    libint2::BraKet braket = libint2::BraKet::xx_xx;  // the type of bra-ket the libint2 engine is currently set up for
+
+
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Set up the libint2 engine for the given type of bra-ket, if it isn't already.
+     *
+     *  @param new_braket           the type of bra-ket that the libint2 engine should handle
+     */
+    void useBraKet(const libint2::BraKet new_braket) {
+
+        if (this->braket != new_braket) {
+            this->libint2_engine.set(new_braket);
+            this->braket = new_braket;
+        }
+    }
+
 
 public:
     /*
@@ -75,10 +95,57 @@ public:
         const auto libint_shell3 = LibintInterfacer::get().interface(shell3);
         const auto libint_shell4 = LibintInterfacer::get().interface(shell4);
 
+        this->useBraKet(libint2::BraKet::xx_xx);
         const auto& libint2_buffer = this->libint2_engine.results();
         this->libint2_engine.compute(libint_shell1, libint_shell2, libint_shell3, libint_shell4);
         return std::make_shared<LibintTwoElectronIntegralBuffer<N>>(libint2_buffer, shell1.numberOfBasisFunctions(), shell2.numberOfBasisFunctions(), shell3.numberOfBasisFunctions(), shell4.numberOfBasisFunctions());
     }
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  Calculate the two-center integrals (P|Q) over two (auxiliary) shells.
+     *
+     *  @param shell1           the first shell
+     *  @param shell3           the second shell, which appears in the ket
+     *
+     *  @return a buffer whose second and fourth shells contain one (unit) basis function, i.e. value(i, f1, 0, f3, 0) = (f1|f3)
+     */
+    std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculateTwoCenter(const GTOShell& shell1, const GTOShell& shell3) {
+
+        const auto libint_shell1 = LibintInterfacer::get().interface(shell1);
+        const auto libint_shell3 = LibintInterfacer::get().interface(shell3);
+
+        this->useBraKet(libint2::BraKet::xs_xs);
+        const auto& libint2_buffer = this->libint2_engine.results();
+        this->libint2_engine.compute(libint_shell1, libint2::Shell::unit(), libint_shell3, libint2::Shell::unit());
+        return std::make_shared<LibintTwoElectronIntegralBuffer<N>>(libint2_buffer, shell1.numberOfBasisFunctions(), 1, shell3.numberOfBasisFunctions(), 1);
+    }
+
+
+    /**
+     *  Calculate the three-center integrals (P|rs) over an (auxiliary) shell in the bra and two shells in the ket.
+     *
+     *  @param shell1           the shell in the bra
+     *  @param shell3           the first shell in the ket
+     *  @param shell4           the second shell in the ket
+     *
+     *  @return a buffer whose second shell contains one (unit) basis function, i.e. value(i, f1, 0, f3, f4) = (f1|f3 f4)
+     */
+    std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculateThreeCenter(const GTOShell& shell1, const GTOShell& shell3, const GTOShell& shell4) {
+
+        const auto libint_shell1 = LibintInterfacer::get().interface(shell1);
+        const auto libint_shell3 = LibintInterfacer::get().interface(shell3);
+        const auto libint_shell4 = LibintInterfacer::get().interface(shell4);
+
+        this->useBraKet(libint2::BraKet::xs_xx);
+        const auto& libint2_buffer = this->libint2_engine.results();
+        this->libint2_engine.compute(libint_shell1, libint2::Shell::unit(), libint_shell3, libint_shell4);
+        return std::make_shared<LibintTwoElectronIntegralBuffer<N>>(libint2_buffer, shell1.numberOfBasisFunctions(), 1, shell3.numberOfBasisFunctions(), shell4.numberOfBasisFunctions());
+    }
 };
 
 
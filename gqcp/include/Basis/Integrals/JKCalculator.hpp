@@ -0,0 +1,143 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/SquareMatrix.hpp"
+#include "Mathematical/Representation/Tensor.hpp"
+#include "Utilities/threading.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A calculator for the direct (Coulomb) and exchange matrices
+ *      J[D](mu nu) = (mu nu|rho lambda) D(rho lambda),
+ *      K[D](mu nu) = (mu lambda|rho nu) D(rho lambda)
+ *  of one or more (not necessarily symmetric) density matrices, from two-electron integrals that are stored as a full rank-four tensor. See `DirectJKCalculator` for the integral-direct counterpart.
+ *
+ *  The tensor is traversed only once for all density matrices together: for every pair (rho lambda), the (mu nu)-slice of the integrals is contiguous in memory and contributes to both the direct matrices (as a scaled addition) and the lambda-th column of the exchange matrices (as a matrix-vector product), while it is still in cache. The pairs can be divided over worker threads by their index lambda, so that every worker writes to its own columns of the exchange matrices.
+ *
+ *  @tparam _Scalar         The scalar type of the integrals and the density matrices: real or complex.
+ */
+template <typename _Scalar>
+class JKCalculator {
+public:
+    // The scalar type of the integrals and the density matrices: real or complex.
+    using Scalar = _Scalar;
+
+
+public:
+    /*
+     *  MARK: Calculations
+     */
+
+    /**
+     *  Calculate the direct and exchange matrices of the given density matrices.
+     *
+     *  @param g                        The two-electron integrals, in chemist's notation.
+     *  @param densities                The density matrices, expressed in the same basis as the two-electron integrals.
+     *  @param number_of_threads        The number of worker threads. These are spawned on every call, so callers that calculate J and K repeatedly (e.g. in every SCF iteration) should pass the thread count they were configured with.
+     *
+     *  @return The direct matrices J[D] and the exchange matrices K[D] of the given density matrices, in the same order.
+     */
+    static std::pair<std::vector<SquareMatrix<Scalar>>, std::vector<SquareMatrix<Scalar>>> calculate(const Tensor<Scalar, 4>& g, const std::vector<SquareMatrix<Scalar>>& densities, const size_t number_of_threads = 1) {
+
+        using ConstMatrixMap = Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>;
+
+        const auto dim = static_cast<size_t>(g.dimension(0));
+        if ((g.dimension(1) != g.dimension(0)) || (g.dimension(2) != g.dimension(0)) || (g.dimension(3) != g.dimension(0))) {
+            throw std::invalid_argument("JKCalculator::calculate(const Tensor<Scalar, 4>&, const std::vector<SquareMatrix<Scalar>>&, const size_t): The two-electron integrals should have equal dimensions along every axis.");
+        }
+        for (const auto& D : densities) {
+            if (D.dimension() != dim) {
+                throw std::invalid_argument("JKCalculator::calculate(const Tensor<Scalar, 4>&, const std::vector<SquareMatrix<Scalar>>&, const size_t): The dimension of a density matrix is incompatible with the two-electron integrals.");
+            }
+        }
+
+
+        // The exchange contribution of a (mu nu)-slice needs a row of a density matrix, which is a contiguous column of its transpose.
+        std::vector<SquareMatrix<Scalar>> densities_transposed;
+        densities_transposed.reserve(densities.size());
+        for (const auto& D : densities) {
+            densities_transposed.push_back(D.transpose());
+        }
+
+        std::vector<SquareMatrix<Scalar>> Ks(densities.size(), SquareMatrix<Scalar>::Zero(dim));
+
+
+        // Every worker accumulates into its own direct matrices, which are summed afterwards. The exchange matrices are shared, since every worker writes to different columns.
+        const auto number_of_workers = std::max<size_t>(std::min(number_of_threads, dim), 1);
+        std::vector<std::vector<SquareMatrix<Scalar>>> Js(number_of_workers, std::vector<SquareMatrix<Scalar>>(densities.size(), SquareMatrix<Scalar>::Zero(dim)));
+
+        std::atomic<size_t> next_lambda {0};
+        const auto work = [&](const size_t worker) {
+            auto& J_worker = Js[worker];
+
+            for (auto lambda = next_lambda++; lambda < dim; lambda = next_lambda++) {
+                for (size_t rho = 0; rho < dim; rho++) {
+
+                    // The integrals (mu nu|rho lambda) for all (mu nu), as a (dim x dim)-matrix.
+                    const ConstMatrixMap g_slice {g.data() + (rho + dim * lambda) * dim * dim, static_cast<long>(dim), static_cast<long>(dim)};
+
+                    for (size_t d = 0; d < densities.size(); d++) {
+                        J_worker[d] += densities[d](rho, lambda) * g_slice;
+                        Ks[d].col(lambda).noalias() += g_slice * densities_transposed[d].col(rho);  // sum_nu (mu nu|rho lambda) D(rho nu)
+                    }
+                }
+            }
+        };
+
+        if (number_of_workers == 1) {
+            work(0);
+        } else {
+            std::vector<std::thread> threads;
+            threads.reserve(number_of_workers);
+            for (size_t worker = 0; worker < number_of_workers; worker++) {
+                threads.emplace_back([&work, worker]() {
+                    const SingleThreadedMKLScope mkl_scope {};  // The workers already divide the work, so they shouldn't spawn MKL threads of their own.
+                    work(worker);
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+
+
+        // Sum the contributions of all workers.
+        for (size_t worker = 1; worker < number_of_workers; worker++) {
+            for (size_t d = 0; d < densities.size(); d++) {
+                Js[0][d] += Js[worker][d];
+            }
+        }
+
+        return {Js[0], Ks};
+    }
+};
+
+
+}  // namespace GQCP
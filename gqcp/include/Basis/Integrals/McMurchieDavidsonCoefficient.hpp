@@ -20,6 +20,8 @@
 
 #include "Mathematical/Representation/Matrix.hpp"
 
+#include <vector>
+
 
 namespace GQCP {
 
@@ -69,6 +71,15 @@ public:
      */
     double operator()(const int i, const int j, const int t) const;
 
+    /**
+     *  Calculate all McMurchie-Davidson expansion coefficients up to the given Cartesian exponents at once, through an iterative application of the recurrence relations. Contrary to repeated calls to `operator()`, every coefficient is calculated only once.
+     *
+     *  @param i_max            The maximum Cartesian exponent of the left Cartesian GTO.
+     *  @param j_max            The maximum Cartesian exponent of the right Cartesian GTO.
+     *  @param table            The table that is (re)filled, in which E^{i,j}_t is stored at position (i * (j_max + 1) + j) * (i_max + j_max + 1) + t.
+     */
+    void tabulate(const int i_max, const int j_max, std::vector<double>& table) const;
+
 
     /*
      *  MARK: Gaussian overlap behavior
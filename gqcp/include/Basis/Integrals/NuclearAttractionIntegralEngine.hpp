@@ -0,0 +1,89 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/BaseOneElectronIntegralEngine.hpp"
+#include "Basis/Integrals/HermiteCoulombIntegrals.hpp"
+#include "Basis/Integrals/OneElectronIntegralBuffer.hpp"
+#include "Basis/ScalarBasis/GTOShell.hpp"
+#include "Molecule/Nucleus.hpp"
+#include "Operator/FirstQuantized/NuclearAttractionOperator.hpp"
+
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  An in-house integral engine that calculates nuclear attraction integrals over shell pairs through the McMurchie-Davidson scheme.
+ *
+ *  The shell pair is expanded in Hermite Gaussians once (see `ShellPairHermiteExpansion`), and the Hermite Coulomb integrals are calculated once per pair of primitives and nucleus for all the Hermite Gaussians at once. The contraction with the expansion coefficients of all the basis functions in the shell pair is then done through a matrix-vector product:
+ *      V_ab = sum_{primitives} 2 pi / p E^{ab} w,
+ *  with w_{tuv} = - sum_C Z_C R_{tuv}(p, P - C).
+ *
+ *  @note This integral engine can only calculate integrals over Cartesian d-shells.
+ */
+class NuclearAttractionIntegralEngine:
+    public BaseOneElectronIntegralEngine<GTOShell, NuclearAttractionOperator::NumberOfComponents, NuclearAttractionOperator::Scalar> {
+public:
+    using Shell = GTOShell;
+    using IntegralScalar = NuclearAttractionOperator::Scalar;
+    static constexpr auto N = NuclearAttractionOperator::NumberOfComponents;
+
+
+private:
+    // The nuclei that attract the electrons.
+    std::vector<Nucleus> nuclei;
+
+    // The Hermite Coulomb integrals, which are recalculated for every pair of primitives and nucleus.
+    HermiteCoulombIntegrals hermite_coulomb_integrals;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param op                   the nuclear attraction operator over which this engine should calculate integrals
+     *  @param max_l                the maximum angular momentum of the shells over which integrals will be calculated
+     */
+    NuclearAttractionIntegralEngine(const NuclearAttractionOperator& op, const size_t max_l = 8);
+
+
+    /*
+     *  MARK: Conforming to `BaseOneElectronIntegralEngine`
+     */
+
+    /**
+     *  Calculate all the nuclear attraction integrals over the given shells.
+     *
+     *  @param shell1           the first shell
+     *  @param shell2           the second shell
+     *
+     *  @note This method is not marked const to allow the Engine's internals to be changed
+     *
+     *  @return a buffer containing the calculated integrals
+     */
+    std::shared_ptr<BaseOneElectronIntegralBuffer<IntegralScalar, N>> calculate(const Shell& shell1, const Shell& shell2) override;
+};
+
+
+}  // namespace GQCP
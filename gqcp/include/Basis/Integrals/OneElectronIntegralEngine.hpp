@@ -19,6 +19,7 @@
 
 #include "Basis/Integrals/BaseOneElectronIntegralEngine.hpp"
 #include "Basis/Integrals/OneElectronIntegralBuffer.hpp"
+#include "Basis/Integrals/PrimitivePairBatch.hpp"
 #include "Basis/ScalarBasis/GTOShell.hpp"
 
 
@@ -28,6 +29,8 @@ namespace GQCP {
 /**
  *  An integral engine that can calculate one-electron integrals over shells.
  * 
+ *  The primitive integral engine should be able to calculate contracted integrals over all primitive pairs of a shell pair at once, through `calculate(const PrimitivePairBatch&, const CartesianExponents&, const CartesianExponents&)`.
+ * 
  *  @tparam _PrimitiveIntegralEngine            the type of integral engine that is used for calculating integrals over primitives
  */
 template <typename _PrimitiveIntegralEngine>
@@ -73,46 +76,22 @@ public:
      */
     std::shared_ptr<BaseOneElectronIntegralBuffer<IntegralScalar, N>> calculate(const Shell& shell1, const Shell& shell2) override {
 
-        // Prepare some variables.
-        const auto K = shell1.nucleus().position();
-        const auto L = shell2.nucleus().position();
-
-        const auto& gaussian_exponents1 = shell1.gaussianExponents();
-        const auto& gaussian_exponents2 = shell2.gaussianExponents();
+        // Gather all primitive pairs of the shell pair. Their McMurchie-Davidson expansion coefficients are calculated only once and are shared among all Cartesian functions and all components of the operator.
+        const PrimitivePairBatch primitive_pairs {shell1, shell2};
 
-        const auto& contraction_coefficients1 = shell1.contractionCoefficients();
-        const auto& contraction_coefficients2 = shell2.contractionCoefficients();
 
-
-        // Loop over all basis functions that are contained in the shell. Since they are contracted GTOs, we will have to generate all the primitives.
+        // Loop over all basis functions that are contained in the shell. The contraction over the primitive pairs is done inside the primitive engine, in one (vectorizable) sweep over all primitive pairs.
         const auto all_cartesian_exponents1 = shell1.generateCartesianExponents();
         const auto all_cartesian_exponents2 = shell2.generateCartesianExponents();
         std::array<std::vector<IntegralScalar>, N> integrals;  // a "buffer" that stores the calculated integrals
 
         for (size_t i = 0; i < N; i++) {  // loop over all components of the operator
             this->primitive_engine.prepareStateForComponent(i);
+            integrals[i].reserve(all_cartesian_exponents1.size() * all_cartesian_exponents2.size());
 
-            for (const auto cartesian_exponents1 : all_cartesian_exponents1) {
-                for (const auto cartesian_exponents2 : all_cartesian_exponents2) {
-
-                    // Calculate the contracted integral as a contraction over the contraction coefficients and the primitive integrals.
-                    IntegralScalar integral = 0.0;
-                    for (size_t c1 = 0; c1 < shell1.contractionSize(); c1++) {
-                        const auto alpha = gaussian_exponents1[c1];
-                        const CartesianGTO primitive1 {alpha, cartesian_exponents1, K};
-                        const auto d1 = contraction_coefficients1[c1];
-
-                        for (size_t c2 = 0; c2 < shell2.contractionSize(); c2++) {
-                            const auto beta = gaussian_exponents2[c2];
-                            const CartesianGTO primitive2 {beta, cartesian_exponents2, L};
-                            const auto d2 = contraction_coefficients2[c2];
-
-                            const auto primitive_integral = this->primitive_engine.calculate(primitive1, primitive2);
-                            integral += d1 * d2 * primitive_integral;
-                        }
-                    }
-
-                    integrals[i].push_back(integral);
+            for (const auto& cartesian_exponents1 : all_cartesian_exponents1) {
+                for (const auto& cartesian_exponents2 : all_cartesian_exponents2) {
+                    integrals[i].push_back(this->primitive_engine.calculate(primitive_pairs, cartesian_exponents1, cartesian_exponents2));
                 }
             }
         }
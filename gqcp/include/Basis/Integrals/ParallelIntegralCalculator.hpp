@@ -0,0 +1,408 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/IntegralCalculator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A class that calculates integrals over ShellSets using multiple threads.
+ *
+ *  Since integral engines keep internal state, they can't be shared between threads. Instead, every worker thread creates its own engine through a given engine factory, i.e. a callable without arguments that returns a new engine. The work is distributed dynamically: every worker picks the next shell (pair) from a list in which the most expensive tasks come first, and writes the resulting integrals into a block of the result that no other worker writes to, so that no locks are required.
+ */
+class ParallelIntegralCalculator {
+private:
+    /**
+     *  Let a number of worker threads, each with their own engine, execute the given tasks. Every worker repeatedly takes the next task that hasn't been taken yet.
+     *
+     *  @param create_engine            a callable that creates a new engine (or a new engine together with other per-worker state, such as a buffer)
+     *  @param number_of_tasks          the number of tasks
+     *  @param number_of_threads        the number of worker threads
+     *  @param execute                  a callable that is called as execute(engine, task) in order to execute a task with the engine of the worker
+     */
+    template <typename EngineFactory, typename Executor>
+    static void distribute(const EngineFactory& create_engine, const size_t number_of_tasks, const size_t number_of_threads, const Executor& execute) {
+
+        std::atomic<size_t> next_task {0};
+        const auto work = [&create_engine, &execute, &next_task, number_of_tasks]() {
+            auto engine = create_engine();
+            for (auto task = next_task++; task < number_of_tasks; task = next_task++) {
+                execute(engine, task);
+            }
+        };
+
+        const auto number_of_workers = std::min(number_of_threads, number_of_tasks);
+        if (number_of_workers <= 1) {
+            work();
+            return;
+        }
+
+        std::vector<std::thread> threads;
+        threads.reserve(number_of_workers);
+        for (size_t worker = 0; worker < number_of_workers; worker++) {
+            threads.emplace_back(work);
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+
+    /**
+     *  @param shell            a shell
+     *
+     *  @return an estimate for the relative cost of the integrals that involve the given shell, i.e. the number of its primitive basis functions
+     */
+    template <typename Shell>
+    static size_t costEstimate(const Shell& shell) { return shell.numberOfBasisFunctions() * shell.contractionSize(); }
+
+
+public:
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  Calculate all one-electron integrals over the basis functions inside the given shell sets. Every task consists of the integrals of one left shell with all right shells.
+     *
+     *  @param create_engine            a callable that creates a new engine that can calculate one-electron integrals over shells
+     *  @param left_shell_set           the set of shells that should appear on the left of the operator
+     *  @param right_shell_set          the set of shells that should appear on the right of the operator
+     *  @param number_of_threads        the number of worker threads
+     *
+     *  @tparam EngineFactory           the type of the engine factory
+     *  @tparam Shell                   the type of shell the integral engine is able to handle
+     */
+    template <typename EngineFactory, typename Shell>
+    static auto calculateOneElectron(const EngineFactory& create_engine, const ShellSet<Shell>& left_shell_set, const ShellSet<Shell>& right_shell_set, const size_t number_of_threads = std::thread::hardware_concurrency()) {
+
+        using Engine = decltype(create_engine());
+        using IntegralScalar = typename Engine::IntegralScalar;
+        constexpr auto N = Engine::N;
+
+        // Initialize the N components of the matrix representations of the operator.
+        std::array<MatrixX<IntegralScalar>, N> components;
+        for (auto& component : components) {
+            component = MatrixX<IntegralScalar>::Zero(left_shell_set.numberOfBasisFunctions(), right_shell_set.numberOfBasisFunctions());
+        }
+
+
+        // Every task is one left shell, and the left shells are handed out in order of decreasing cost.
+        const auto& left_shells = left_shell_set.asVector();
+        const auto& right_shells = right_shell_set.asVector();
+
+        std::vector<size_t> left_bf_indices(left_shells.size());
+        std::vector<size_t> right_bf_indices(right_shells.size());
+        for (size_t i = 0; i < left_shells.size(); i++) {
+            left_bf_indices[i] = left_shell_set.basisFunctionIndex(i);
+        }
+        for (size_t j = 0; j < right_shells.size(); j++) {
+            right_bf_indices[j] = right_shell_set.basisFunctionIndex(j);
+        }
+
+        std::vector<size_t> tasks(left_shells.size());
+        for (size_t i = 0; i < tasks.size(); i++) {
+            tasks[i] = i;
+        }
+        std::stable_sort(tasks.begin(), tasks.end(), [&left_shells](const size_t i, const size_t j) { return costEstimate(left_shells[i]) > costEstimate(left_shells[j]); });
+
+
+        // Every task writes to its own rows of the result.
+        const auto execute = [&](Engine& engine, const size_t task) {
+            const auto i = tasks[task];
+
+            for (size_t j = 0; j < right_shells.size(); j++) {
+                const auto buffer = engine.calculate(left_shells[i], right_shells[j]);
+                if (buffer->areIntegralsAllZero()) {
+                    continue;
+                }
+                buffer->emplace(components, left_bf_indices[i], right_bf_indices[j]);
+            }
+        };
+        ParallelIntegralCalculator::distribute(create_engine, tasks.size(), number_of_threads, execute);
+
+        return components;
+    }
+
+
+    /**
+     *  Calculate all two-electron integrals over the basis functions inside the given shell sets. Every task consists of the integrals of one pair of left shells with all pairs of right shells.
+     *
+     *  @param create_engine            a callable that creates a new engine that can calculate two-electron integrals over shells
+     *  @param left_shell_set           the set of shells that should appear on the left of the operator
+     *  @param right_shell_set          the set of shells that should appear on the right of the operator
+     *  @param number_of_threads        the number of worker threads
+     *
+     *  @tparam EngineFactory           the type of the engine factory
+     *  @tparam Shell                   the type of shell the integral engine is able to handle
+     */
+    template <typename EngineFactory, typename Shell>
+    static auto calculateTwoElectron(const EngineFactory& create_engine, const ShellSet<Shell>& left_shell_set, const ShellSet<Shell>& right_shell_set, const size_t number_of_threads = std::thread::hardware_concurrency()) {
+
+        using Engine = decltype(create_engine());
+        using IntegralScalar = typename Engine::IntegralScalar;
+        constexpr auto N = Engine::N;
+
+        // Initialize the N components of the matrix representations of the operator.
+        const auto nbf_left = left_shell_set.numberOfBasisFunctions();
+        const auto nbf_right = right_shell_set.numberOfBasisFunctions();
+
+        std::array<Tensor<IntegralScalar, 4>, N> components;
+        for (auto& component : components) {
+            component = Tensor<IntegralScalar, 4>(nbf_left, nbf_left, nbf_right, nbf_right);
+            component.setZero();
+        }
+
+
+        // Every task is one pair of left shells, and the pairs are handed out in order of decreasing cost.
+        const auto& left_shells = left_shell_set.asVector();
+        const auto& right_shells = right_shell_set.asVector();
+        const auto nsh_left = left_shells.size();
+
+        std::vector<size_t> left_bf_indices(nsh_left);
+        std::vector<size_t> right_bf_indices(right_shells.size());
+        for (size_t i = 0; i < nsh_left; i++) {
+            left_bf_indices[i] = left_shell_set.basisFunctionIndex(i);
+        }
+        for (size_t k = 0; k < right_shells.size(); k++) {
+            right_bf_indices[k] = right_shell_set.basisFunctionIndex(k);
+        }
+
+        std::vector<std::pair<size_t, size_t>> tasks;
+        tasks.reserve(nsh_left * nsh_left);
+        for (size_t i = 0; i < nsh_left; i++) {
+            for (size_t j = 0; j < nsh_left; j++) {
+                tasks.emplace_back(i, j);
+            }
+        }
+        std::stable_sort(tasks.begin(), tasks.end(), [&left_shells](const std::pair<size_t, size_t>& ij, const std::pair<size_t, size_t>& kl) {
+            return costEstimate(left_shells[ij.first]) * costEstimate(left_shells[ij.second]) > costEstimate(left_shells[kl.first]) * costEstimate(left_shells[kl.second]);
+        });
+
+
+        // Every task writes to its own block (ij|..) of the result.
+        const auto execute = [&](Engine& engine, const size_t task) {
+            const auto i = tasks[task].first;
+            const auto j = tasks[task].second;
+
+            for (size_t k = 0; k < right_shells.size(); k++) {
+                for (size_t l = 0; l < right_shells.size(); l++) {
+                    const auto buffer = engine.calculate(left_shells[i], left_shells[j], right_shells[k], right_shells[l]);
+                    if (buffer->areIntegralsAllZero()) {
+                        continue;
+                    }
+                    buffer->emplace(components, left_bf_indices[i], left_bf_indices[j], right_bf_indices[k], right_bf_indices[l]);
+                }
+            }
+        };
+        ParallelIntegralCalculator::distribute(create_engine, tasks.size(), number_of_threads, execute);
+
+        return components;
+    }
+
+
+    /**
+     *  Calculate all two-electron integrals over the basis functions inside the given shell set, by only calculating the canonical shell quartets (ij|kl) (i.e. with i >= j, k >= l and (ij) >= (kl)) and skipping the ones that are negligible according to their Cauchy-Schwarz bound. Every task consists of one canonical pair of shells (ij), together with all its canonical partners (kl) <= (ij).
+     *
+     *  Every element of the full tensors belongs to exactly one canonical shell quartet, so the workers can scatter the 8-fold symmetric copies of their integrals without ever writing to the same element.
+     *
+     *  @param create_engine            a callable that creates a new engine that can calculate two-electron integrals over shells
+     *  @param shell_set                the set of shells that should appear on both sides of the operator
+     *  @param number_of_threads        the number of worker threads
+     *  @param threshold                the threshold below which the integrals over a shell quartet are considered to be negligible, and are not calculated
+     *
+     *  @tparam EngineFactory           the type of the engine factory
+     *  @tparam Shell                   the type of shell the integral engine is able to handle
+     *
+     *  @note This method should only be used for real, positive definite two-electron operators, such as the Coulomb repulsion operator.
+     */
+    template <typename EngineFactory, typename Shell>
+    static auto calculateSymmetric(const EngineFactory& create_engine, const ShellSet<Shell>& shell_set, const size_t number_of_threads = std::thread::hardware_concurrency(), const double threshold = 1.0e-12) {
+
+        using Engine = decltype(create_engine());
+        using IntegralScalar = typename Engine::IntegralScalar;
+        constexpr auto N = Engine::N;
+
+        // Initialize the N components of the matrix representations of the operator.
+        const auto nbf = shell_set.numberOfBasisFunctions();
+
+        std::array<Tensor<IntegralScalar, 4>, N> components;
+        for (auto& component : components) {
+            component = Tensor<IntegralScalar, 4>(nbf, nbf, nbf, nbf);
+            component.setZero();
+        }
+
+
+        // The Cauchy-Schwarz bounds only require the diagonal shell quartets, so they are calculated up front.
+        const auto& shells = shell_set.asVector();
+        const auto nsh = shells.size();
+
+        auto bounds_engine = create_engine();
+        const auto Q = IntegralCalculator::calculateSchwarzBounds(bounds_engine, shell_set);
+
+        std::vector<size_t> bf_indices(nsh);
+        for (size_t i = 0; i < nsh; i++) {
+            bf_indices[i] = shell_set.basisFunctionIndex(i);
+        }
+
+
+        // Every task is one canonical pair of shells (ij). Since the pair (ij) is combined with all (kl) <= (ij), its cost is proportional to its compound index.
+        std::vector<std::pair<size_t, size_t>> tasks;
+        tasks.reserve(nsh * (nsh + 1) / 2);
+        for (size_t i = 0; i < nsh; i++) {
+            for (size_t j = 0; j <= i; j++) {
+                tasks.emplace_back(i, j);
+            }
+        }
+        const auto cost = [&shells](const std::pair<size_t, size_t>& ij) {
+            const auto compound_index = ij.first * (ij.first + 1) / 2 + ij.second;
+            return (compound_index + 1) * costEstimate(shells[ij.first]) * costEstimate(shells[ij.second]);
+        };
+        std::stable_sort(tasks.begin(), tasks.end(), [&cost](const std::pair<size_t, size_t>& ij, const std::pair<size_t, size_t>& kl) { return cost(ij) > cost(kl); });
+
+
+        // Every worker keeps a buffer next to its engine, which is reused for all the shell quartets that the worker calculates.
+        using BufferPointer = std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>>;
+        const auto create_worker = [&create_engine]() { return std::make_pair(create_engine(), BufferPointer {}); };
+
+        const auto execute = [&](std::pair<Engine, BufferPointer>& worker, const size_t task) {
+            auto& engine = worker.first;
+            auto& buffer = worker.second;
+
+            const auto i = tasks[task].first;
+            const auto j = tasks[task].second;
+            const auto Q_ij = Q(i, j);
+
+            for (size_t k = 0; k <= i; k++) {
+                const auto l_max = (k == i) ? j : k;  // makes sure that (ij) >= (kl)
+
+                for (size_t l = 0; l <= l_max; l++) {
+                    if (Q_ij * Q(k, l) < threshold) {
+                        continue;
+                    }
+
+                    engine.calculateByIndex(shells, i, j, k, l, buffer);
+                    if (buffer->areIntegralsAllZero()) {
+                        continue;
+                    }
+                    buffer->emplacePermutations(components, bf_indices[i], bf_indices[j], bf_indices[k], bf_indices[l]);
+                }
+            }
+        };
+        ParallelIntegralCalculator::distribute(create_worker, tasks.size(), number_of_threads, execute);
+
+        return components;
+    }
+
+
+    /*
+     *  PUBLIC METHODS - LIBINT2 INTEGRALS
+     */
+
+    /**
+     *  Calculate the integrals over the given (first-quantized) one-electron operator, within a given scalar basis, using Libint2.
+     *
+     *  @param fq_one_op                            the first-quantized one-electron operator
+     *  @param scalar_basis                         the scalar basis that contains the shells over which the integrals should be calculated
+     *  @param number_of_threads                    the number of worker threads
+     *
+     *  @tparam FQOneElectronOperator               the type of the first-quantized one-electron operator
+     *
+     *  @return the matrix representation (integrals) of the given first-quantized operator in this scalar basis
+     */
+    template <typename FQOneElectronOperator>
+    static SquareMatrix<double> calculateLibintIntegrals(const FQOneElectronOperator& fq_one_op, const ScalarBasis<GTOShell>& scalar_basis, const size_t number_of_threads = std::thread::hardware_concurrency()) {
+
+        const auto shell_set = scalar_basis.shellSet();
+
+        // Every worker constructs its own libint engine.
+        const auto max_nprim = shell_set.maximumNumberOfPrimitives();
+        const auto max_l = shell_set.maximumAngularMomentum();
+        const auto create_engine = [&fq_one_op, max_nprim, max_l]() { return IntegralEngine::Libint(fq_one_op, max_nprim, max_l); };
+
+        const auto integrals = ParallelIntegralCalculator::calculateOneElectron(create_engine, shell_set, shell_set, number_of_threads);
+        return SquareMatrix<double>(integrals[0]);
+    }
+
+
+    /**
+     *  Calculate the integrals over the given (first-quantized) two-electron operator, within a given scalar basis, using Libint2.
+     *
+     *  @param fq_two_op                            the first-quantized operator
+     *  @param scalar_basis                         the scalar basis that contains the shells over which the integrals should be calculated
+     *  @param number_of_threads                    the number of worker threads
+     *
+     *  @return the matrix representation (integrals) of the given first-quantized operator in this scalar basis
+     */
+    static SquareRankFourTensor<double> calculateLibintIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& scalar_basis, const size_t number_of_threads = std::thread::hardware_concurrency()) {
+
+        const auto shell_set = scalar_basis.shellSet();
+
+        // Every worker constructs its own libint engine.
+        const auto max_nprim = shell_set.maximumNumberOfPrimitives();
+        const auto max_l = shell_set.maximumAngularMomentum();
+        const auto create_engine = [&fq_two_op, max_nprim, max_l]() { return IntegralEngine::Libint(fq_two_op, max_nprim, max_l); };
+
+        const auto integrals = ParallelIntegralCalculator::calculateSymmetric(create_engine, shell_set, number_of_threads);
+        return SquareRankFourTensor<double>(integrals[0]);
+    }
+
+
+    /*
+     *  PUBLIC METHODS - LIBCINT INTEGRALS
+     *  Note that the Libcint integrals should only be used for Cartesian ShellSets
+     */
+
+    /**
+     *  Calculate the Coulomb repulsion energy integrals, within a given scalar basis, using libcint.
+     *
+     *  @param fq_two_op                            the first-quantized operator
+     *  @param scalar_basis                         the scalar basis that contains the shells over which the integrals should be calculated
+     *  @param number_of_threads                    the number of worker threads
+     *
+     *  @note Only use this function for all-Cartesian ShellSets.
+     *
+     *  @return the matrix representation of the Coulomb repulsion operator in this AO basis, using the libcint integral engine
+     */
+    static SquareRankFourTensor<double> calculateLibcintIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& scalar_basis, const size_t number_of_threads = std::thread::hardware_concurrency()) {
+
+        const auto shell_set = scalar_basis.shellSet();
+
+        // Every worker constructs its own libcint engine, with its own copy of the libcint data.
+        const auto create_engine = [&fq_two_op, &shell_set]() { return IntegralEngine::Libcint(fq_two_op, shell_set); };
+
+        const auto integrals = ParallelIntegralCalculator::calculateSymmetric(create_engine, shell_set, number_of_threads);
+        return integrals[0];
+    }
+};
+
+
+}  // namespace GQCP
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "Basis/Integrals/PrimitiveCartesianOperatorIntegralEngine.hpp"
+#include "Basis/Integrals/PrimitivePairBatch.hpp"
 #include "Mathematical/Functions/CartesianGTO.hpp"
 #include "Operator/FirstQuantized/LinearMomentumOperator.hpp"
 
@@ -50,6 +51,17 @@ public:
      */
     IntegralScalar calculate(const CartesianGTO& left, const CartesianGTO& right);
 
+    /**
+     *  Calculate the contracted integral over two Cartesian basis functions of a shell pair by summing over all its primitive pairs at once, reusing the McMurchie-Davidson expansion coefficients that were calculated for the whole shell pair.
+     * 
+     *  @param primitive_pairs          the primitive pairs of the shell pair, with their McMurchie-Davidson expansion coefficients
+     *  @param left                     the Cartesian exponents of the left basis function
+     *  @param right                    the Cartesian exponents of the right basis function
+     * 
+     *  @return the contracted linear momentum integral (of the current component) over the two given basis functions
+     */
+    IntegralScalar calculate(const PrimitivePairBatch& primitive_pairs, const CartesianExponents& left, const CartesianExponents& right);
+
     /**
      *  @param alpha            the Gaussian exponent of the left 1-D primitive
      *  @param K                the (directional coordinate of the) center of the left 1-D primitive
@@ -0,0 +1,114 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/ScalarBasis/GTOShell.hpp"
+#include "Mathematical/Functions/CartesianDirection.hpp"
+
+#include <array>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  All pairs of primitives of two contracted GTO shells, stored in a structure-of-arrays layout, together with their McMurchie-Davidson expansion coefficients.
+ *
+ *  For every quantity, the values for all primitive pairs are stored contiguously, so that loops over the primitive pairs vectorize. The McMurchie-Davidson expansion coefficients E^{i,j}_t are calculated once for the shell pair, and are shared by all Cartesian components of both shells and by all components of an operator.
+ */
+class PrimitivePairBatch {
+private:
+    // The number of primitive pairs.
+    size_t n;
+
+    // The maximum Cartesian exponent of the left primitives for which the expansion coefficients are tabulated.
+    int i_max;
+
+    // The maximum Cartesian exponent of the right primitives for which the expansion coefficients are tabulated.
+    int j_max;
+
+    // The Gaussian exponents of the right primitive of every pair.
+    std::vector<double> right_exponents;
+
+    // The prefactors d_1 d_2 (pi / p)^{3/2} of every pair, i.e. the product of the contraction coefficients and the factor that stems from integrating the Hermite Gaussian.
+    std::vector<double> m_prefactors;
+
+    // The Cartesian components of the center of mass P of every pair.
+    std::array<std::vector<double>, 3> centers_of_mass;
+
+    // The expansion coefficients for every Cartesian direction, in which E^{i,j}_t is stored for all pairs starting at position ((i * (j_max + 1) + j) * (i_max + j_max + 1) + t) * n.
+    std::array<std::vector<double>, 3> coefficients;
+
+    // A zero value for every pair, which represents vanishing expansion coefficients.
+    std::vector<double> zeros;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param shell1               The left shell.
+     *  @param shell2               The right shell.
+     *  @param additional_j         The number by which the Cartesian exponents of the right primitives may be raised when the expansion coefficients are requested, e.g. 2 for kinetic energy integrals.
+     */
+    PrimitivePairBatch(const GTOShell& shell1, const GTOShell& shell2, const int additional_j = 2);
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @param direction            The Cartesian direction.
+     *
+     *  @return The components in the given direction of the center of mass of every pair.
+     */
+    const double* centersOfMass(const CartesianDirection direction) const { return this->centers_of_mass[direction].data(); }
+
+    /**
+     *  @param direction            The Cartesian direction.
+     *  @param i                    The Cartesian exponent of the left primitives.
+     *  @param j                    The Cartesian exponent of the right primitives.
+     *  @param t                    The degree of the Hermite Gaussian.
+     *
+     *  @return The expansion coefficients E^{i,j}_t in the given direction for every pair. Coefficients that vanish (e.g. for negative exponents or t > i + j) are represented by zeros.
+     */
+    const double* expansionCoefficients(const CartesianDirection direction, const int i, const int j, const int t) const;
+
+    /**
+     *  @return The prefactors d_1 d_2 (pi / p)^{3/2} of every pair, i.e. the product of the contraction coefficients and the factor that stems from integrating the Hermite Gaussian. Since every 1-D integral carries a factor (pi / p)^{1/2}, a 3-D integral over a pair is this prefactor times a product of three 1-D factors that only involve the expansion coefficients.
+     */
+    const double* prefactors() const { return this->m_prefactors.data(); }
+
+    /**
+     *  @return The Gaussian exponents of the right primitive of every pair.
+     */
+    const double* rightExponents() const { return this->right_exponents.data(); }
+
+    /**
+     *  @return The number of primitive pairs.
+     */
+    size_t size() const { return this->n; }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,120 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/ScalarBasis/GTOShell.hpp"
+#include "Mathematical/Representation/Matrix.hpp"
+
+#include <array>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  The McMurchie-Davidson expansion of all products of the basis functions of two (Cartesian) GTO shells in Hermite Gaussians.
+ *
+ *  For every pair of primitives, the product of two Cartesian GTOs (with exponents a and b) is a linear combination of Hermite Gaussians Lambda_{tuv} with exponent p = a + b, centered on the center of mass P. The expansion coefficients of all the products of basis functions in the shell pair are collected in one matrix (with the contraction coefficients embedded), so that integrals over all the basis functions in the shell pair follow from matrix products with the integrals over the Hermite Gaussians.
+ */
+class ShellPairHermiteExpansion {
+public:
+    /**
+     *  The Hermite expansion of the products of the basis functions of two shells that stem from one pair of primitives.
+     */
+    struct PrimitivePair {
+        // The total exponent p = a + b of the Hermite Gaussians.
+        double p;
+
+        // The center of mass P of the Hermite Gaussians.
+        Vector<double, 3> P;
+
+        // The expansion coefficients (including the contraction coefficients), as a matrix whose rows correspond to the products of basis functions (f1 * nbf2 + f2) and whose columns correspond to the Hermite Gaussians, in the order of `hermiteDegrees()`.
+        MatrixX<double> E;
+    };
+
+
+private:
+    // The number of Cartesian basis functions in the first shell.
+    size_t nbf1;
+
+    // The number of Cartesian basis functions in the second shell.
+    size_t nbf2;
+
+    // The sum of the angular momenta of both shells, i.e. the maximum total degree of the Hermite Gaussians.
+    size_t L;
+
+    // The degrees (t, u, v) of all the Hermite Gaussians with t + u + v <= L.
+    std::vector<std::array<size_t, 3>> hermite_degrees;
+
+    // The Hermite expansions for every pair of primitives that are not negligible.
+    std::vector<PrimitivePair> primitive_pairs;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param shell1               The first shell.
+     *  @param shell2               The second shell.
+     *
+     *  @note Only Cartesian shells are supported for angular momenta higher than 1, i.e. starting from d-shells.
+     */
+    ShellPairHermiteExpansion(const GTOShell& shell1, const GTOShell& shell2);
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The degrees (t, u, v) of all the Hermite Gaussians with t + u + v <= L.
+     */
+    const std::vector<std::array<size_t, 3>>& hermiteDegrees() const { return this->hermite_degrees; }
+
+    /**
+     *  @return The number of Cartesian basis functions in the first shell.
+     */
+    size_t numberOfBasisFunctionsInShell1() const { return this->nbf1; }
+
+    /**
+     *  @return The number of Cartesian basis functions in the second shell.
+     */
+    size_t numberOfBasisFunctionsInShell2() const { return this->nbf2; }
+
+    /**
+     *  @return The number of Hermite Gaussians in the expansion.
+     */
+    size_t numberOfHermiteGaussians() const { return this->hermite_degrees.size(); }
+
+    /**
+     *  @return The Hermite expansions for every pair of primitives that are not negligible.
+     */
+    const std::vector<PrimitivePair>& primitivePairs() const { return this->primitive_pairs; }
+
+    /**
+     *  @return The sum of the angular momenta of both shells, i.e. the maximum total degree of the Hermite Gaussians.
+     */
+    size_t totalAngularMomentum() const { return this->L; }
+};
+
+
+}  // namespace GQCP
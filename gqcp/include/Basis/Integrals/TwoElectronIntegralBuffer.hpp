@@ -0,0 +1,89 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/BaseTwoElectronIntegralBuffer.hpp"
+
+#include <array>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A buffer for storing two-electron integrals that were calculated by one of GQCP's in-house integral engines.
+ *
+ *  @tparam _IntegralScalar         the scalar representation of an integral
+ *  @tparam _N                      the number of components the corresponding operator has
+ */
+template <typename _IntegralScalar, size_t _N>
+class TwoElectronIntegralBuffer:
+    public BaseTwoElectronIntegralBuffer<_IntegralScalar, _N> {
+public:
+    using IntegralScalar = _IntegralScalar;  // the scalar representation of an integral
+    static constexpr auto N = _N;            // the number of components the operator has
+
+
+protected:
+    std::array<std::vector<IntegralScalar>, N> buffer;  // the calculated integrals
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param nbf1             the number of basis functions in the first shell
+     *  @param nbf2             the number of basis functions in the second shell
+     *  @param nbf3             the number of basis functions in the third shell
+     *  @param nbf4             the number of basis functions in the fourth shell
+     *  @param buffer           the calculated integrals, in row-major ordering of the basis functions of the four shells
+     */
+    TwoElectronIntegralBuffer(const size_t nbf1, const size_t nbf2, const size_t nbf3, const size_t nbf4, const std::array<std::vector<IntegralScalar>, N>& buffer) :
+        BaseTwoElectronIntegralBuffer<IntegralScalar, N>(nbf1, nbf2, nbf3, nbf4),
+        buffer {buffer} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return if all the values of the calculated integrals are zero
+     */
+    bool areIntegralsAllZero() const override { return false; }
+
+    /**
+     *  @param i            the index of the component of the operator
+     *  @param f1           the index of the basis function within shell 1
+     *  @param f2           the index of the basis function within shell 2
+     *  @param f3           the index of the basis function within shell 3
+     *  @param f4           the index of the basis function within shell 4
+     *
+     *  @return a value from this integral buffer
+     */
+    IntegralScalar value(const size_t i, const size_t f1, const size_t f2, const size_t f3, const size_t f4) const override {
+        return this->buffer[i][f4 + this->nbf4 * (f3 + this->nbf3 * (f2 + this->nbf2 * f1))];  // accessing the component first, then row-major ordering of the calculated integrals
+    }
+};
+
+
+}  // namespace GQCP
@@ -20,6 +20,7 @@
 
 #include "Basis/Integrals/IntegralCalculator.hpp"
 #include "Basis/MullikenPartitioning/RMullikenPartitioning.hpp"
+#include "Basis/SpinorBasis/OrbitalSpace.hpp"
 #include "Basis/SpinorBasis/SimpleSpinOrbitalBasis.hpp"
 #include "Basis/SpinorBasis/Spinor.hpp"
 #include "Basis/Transformations/JacobiRotation.hpp"
@@ -27,6 +28,7 @@
 #include "Mathematical/Representation/SquareMatrix.hpp"
 #include "Operator/FirstQuantized/Operator.hpp"
 #include "Operator/SecondQuantized/EvaluatableScalarRSQOneElectronOperator.hpp"
+#include "Operator/SecondQuantized/FactorizedRSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/RSQTwoElectronOperator.hpp"
 #include "Utilities/aliases.hpp"
@@ -136,26 +138,99 @@ public:
         using ResultScalar = product_t<CoulombRepulsionOperator::Scalar, ExpansionScalar>;
         using ResultOperator = RSQTwoElectronOperator<ResultScalar, CoulombRepulsionOperator::Vectorizer>;
 
-        const auto one_op_par = IntegralCalculator::calculateLibintIntegrals(fq_op, this->scalarBasis());  // in AO/scalar basis
+        auto g_par = IntegralCalculator::calculateLibintIntegrals(fq_op, this->scalarBasis());  // 'par' for 'parameters', in AO/scalar basis
 
-        auto g_par = SquareRankFourTensor<ResultScalar>::Zero(one_op_par.dimension(0));  // 'par' for 'parameters'
-
-        for (size_t i = 0; i < one_op_par.dimension(0); i++) {
-            for (size_t j = 0; j < one_op_par.dimension(1); j++) {
-                for (size_t k = 0; k < one_op_par.dimension(2); k++) {
-                    for (size_t l = 0; l < one_op_par.dimension(3); l++) {
-                        g_par(i, j, k, l) = one_op_par(i, j, k, l);
-                    }
-                }
+        // For a real expansion, the integrals are moved into the operator (through the rvalue constructors of `SQOperatorStorageBase` and `StorageArray`), since an intermediate copy of all K^4 integrals would double the peak memory usage. Otherwise, they have to be converted to the scalar type of the expansion.
+        auto op = [&g_par]() {
+            if constexpr (std::is_same<ResultScalar, double>::value) {
+                return ResultOperator {std::move(g_par)};
+            } else {
+                return ResultOperator {SquareRankFourTensor<ResultScalar> {g_par.template cast<ResultScalar>()}};
             }
-        }
+        }();  // op for 'operator'
+
+        op.transform(this->expansion());  // now in spatial/spin-orbital basis
+        return op;
+    }
+
+
+    /**
+     *  Quantize the Coulomb operator in this restricted spin-orbital basis, using density fitting.
+     * 
+     *  @param fq_op                        The first-quantized Coulomb operator.
+     *  @param auxiliary_scalar_basis       The auxiliary scalar basis that is used to fit the products of the underlying scalar basis functions.
+     * 
+     *  @return The density-fitted second-quantized operator corresponding to the Coulomb operator.
+     */
+    auto quantize(const CoulombRepulsionOperator& fq_op, const ScalarBasis<Shell>& auxiliary_scalar_basis) const -> FactorizedRSQTwoElectronOperator<product_t<CoulombRepulsionOperator::Scalar, ExpansionScalar>> {
+
+        using ResultScalar = product_t<CoulombRepulsionOperator::Scalar, ExpansionScalar>;
+        using ResultOperator = FactorizedRSQTwoElectronOperator<ResultScalar>;
+
+        const auto three_center_integrals = IntegralCalculator::calculateLibintThreeCenterIntegrals(fq_op, this->scalarBasis(), auxiliary_scalar_basis);  // in AO/scalar basis
+        const auto metric = IntegralCalculator::calculateLibintTwoCenterIntegrals(fq_op, auxiliary_scalar_basis);
+
+        auto op = ResultOperator::DensityFitted(three_center_integrals, metric);  // op for 'operator'
+        op.transform(this->expansion());                                          // now in spatial/spin-orbital basis
+        return op;
+    }
+
 
-        ResultOperator op {g_par};        // op for 'operator'
+    /**
+     *  Quantize the Coulomb operator in this restricted spin-orbital basis, using a pivoted incomplete Cholesky decomposition of the two-electron integrals.
+     * 
+     *  @param fq_op                        The first-quantized Coulomb operator.
+     *  @param tolerance                    The largest remaining diagonal element (pq|pq) that is accepted, which bounds the error on every reconstructed integral.
+     * 
+     *  @return The Cholesky-decomposed second-quantized operator corresponding to the Coulomb operator.
+     */
+    auto quantizeCholesky(const CoulombRepulsionOperator& fq_op, const double tolerance = 1.0e-06) const -> FactorizedRSQTwoElectronOperator<product_t<CoulombRepulsionOperator::Scalar, ExpansionScalar>> {
+
+        using ResultScalar = product_t<CoulombRepulsionOperator::Scalar, ExpansionScalar>;
+        using ResultOperator = FactorizedRSQTwoElectronOperator<ResultScalar>;
+
+        const auto K = this->scalarBasis().numberOfBasisFunctions();
+        const MatrixX<ResultScalar> L = IntegralCalculator::calculateLibintCholeskyVectors(fq_op, this->scalarBasis(), tolerance).template cast<ResultScalar>();  // in AO/scalar basis
+
+        ResultOperator op {K, L};         // op for 'operator'
         op.transform(this->expansion());  // now in spatial/spin-orbital basis
         return op;
     }
 
 
+    /**
+     *  Quantize the Coulomb operator in this restricted spin-orbital basis, only for the given orbital ranges. The integrals are transformed from the underlying scalar basis one ket shell pair at a time, so all the integrals over the scalar basis functions are never stored.
+     *
+     *  @param fq_op                        The first-quantized Coulomb operator.
+     *  @param orbital_space                The orbital space that divides the spatial orbitals into occupied, active and virtual ones.
+     *  @param axis1_type                   The occupation type of the orbitals for the first axis.
+     *  @param axis2_type                   The occupation type of the orbitals for the second axis.
+     *  @param axis3_type                   The occupation type of the orbitals for the third axis.
+     *  @param axis4_type                   The occupation type of the orbitals for the fourth axis.
+     *
+     *  @return The two-electron integrals g_pqrs (in chemist's notation) over the spatial orbitals of the requested occupation types, e.g. the occupied-virtual-occupied-virtual integrals (ia|jb) for MP2.
+     */
+    auto quantize(const CoulombRepulsionOperator& fq_op, const OrbitalSpace& orbital_space, const OccupationType axis1_type, const OccupationType axis2_type, const OccupationType axis3_type, const OccupationType axis4_type) const -> ImplicitRankFourTensorSlice<product_t<CoulombRepulsionOperator::Scalar, ExpansionScalar>> {
+
+        using ResultScalar = product_t<CoulombRepulsionOperator::Scalar, ExpansionScalar>;
+
+        // Gather the expansion coefficients of the orbitals of every requested occupation type.
+        const auto& C = this->expansion().matrix();
+        const auto coefficients_for = [&C, &orbital_space](const OccupationType type) {
+            const auto& indices = orbital_space.indices(type);
+
+            MatrixX<ResultScalar> C_type(C.rows(), indices.size());
+            for (size_t i = 0; i < indices.size(); i++) {
+                C_type.col(i) = C.col(indices[i]).template cast<ResultScalar>();
+            }
+            return C_type;
+        };
+
+        const auto g = IntegralCalculator::calculateLibintTransformedIntegrals(fq_op, this->scalarBasis(), coefficients_for(axis1_type), coefficients_for(axis2_type), coefficients_for(axis3_type), coefficients_for(axis4_type));
+        return orbital_space.createRepresentableObjectFor(axis1_type, axis2_type, axis3_type, axis4_type, g);
+    }
+
+
     /**
      *  Quantize the (one-electron) electronic density operator.
      * 
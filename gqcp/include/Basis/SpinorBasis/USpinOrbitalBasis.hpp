@@ -25,6 +25,7 @@
 #include "Basis/Transformations/SpinResolvedJacobiRotatable.hpp"
 #include "Basis/Transformations/UTransformation.hpp"
 #include "Operator/FirstQuantized/Operator.hpp"
+#include "Operator/SecondQuantized/FactorizedUSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/USQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/USQTwoElectronOperator.hpp"
 #include "QuantumChemical/SpinResolvedBase.hpp"
@@ -369,6 +370,35 @@ public:
     }
 
 
+    /**
+     *  Quantize the Coulomb operator in this unrestricted spin-orbital basis, using a pivoted incomplete Cholesky decomposition of the two-electron integrals.
+     * 
+     *  @param coulomb_op               The first-quantized Coulomb operator.
+     *  @param tolerance                The largest remaining diagonal element (pq|pq) that is accepted, which bounds the error on every reconstructed integral.
+     * 
+     *  @return The Cholesky-decomposed second-quantized Coulomb operator.
+     * 
+     *  @note The alpha and beta spin-orbitals should be expanded in the same scalar basis, so that the Cholesky vectors only have to be calculated once.
+     */
+    auto quantizeCholesky(const CoulombRepulsionOperator& coulomb_op, const double tolerance = 1.0e-06) const -> FactorizedUSQTwoElectronOperator<product_t<typename CoulombRepulsionOperator::Scalar, ExpansionScalar>> {
+
+        using ResultScalar = product_t<typename CoulombRepulsionOperator::Scalar, ExpansionScalar>;
+        using ResultOperator = FactorizedUSQTwoElectronOperator<ResultScalar>;
+
+        const auto K = this->alpha().scalarBasis().numberOfBasisFunctions();
+        if (this->beta().scalarBasis().numberOfBasisFunctions() != K) {
+            throw std::invalid_argument("USpinOrbitalBasis::quantizeCholesky(const CoulombRepulsionOperator&, const double): The alpha and beta spin-orbitals should be expanded in the same scalar basis.");
+        }
+
+        // The Cholesky vectors are calculated in the scalar basis, and are shared by both spin components.
+        const MatrixX<ResultScalar> L = IntegralCalculator::calculateLibintCholeskyVectors(coulomb_op, this->alpha().scalarBasis(), tolerance).template cast<ResultScalar>();
+        auto g = ResultOperator::FromEqual(FactorizedRSQTwoElectronOperator<ResultScalar> {K, L});
+
+        g.transform(this->expansion());  // Now, g is expressed in the current spin-orbital basis.
+        return g;
+    }
+
+
     /**
      *  MARK: Mulliken partitioning
      */
@@ -0,0 +1,261 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/Tensor.hpp"
+
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace GQCP {
+
+
+/*
+ *  The four-index transformation of two-electron integrals
+ *      g'(p q r s) = sum_{t u v w} C1^*(t p) C2(u q) C3^*(v r) C4(w s) g(t u v w)
+ *  is carried out as a sequence of quarter transformations. Since a column-major rank-four tensor can be viewed as a matrix in many ways without any copying, every quarter transformation is a (blocked) matrix-matrix product, which is handed over to the BLAS that is linked to Eigen.
+ *
+ *  The transformation matrices do not have to be square: passing only some of the columns of the expansion coefficients (e.g. the occupied or virtual orbitals) transforms to the requested orbital ranges only, which reduces the work and the size of the intermediates accordingly.
+ */
+
+
+/**
+ *  Transform the first two indices (the bra) of a rank-four tensor:
+ *      g'(p q r s) = sum_{t u} C1^*(t p) C2(u q) g(t u r s).
+ *
+ *  @param g                the rank-four tensor
+ *  @param C1               the transformation matrix for the first index
+ *  @param C2               the transformation matrix for the second index
+ *
+ *  @tparam Scalar          the scalar type of the elements
+ *
+ *  @return the bra-transformed rank-four tensor, with dimensions (C1.cols(), C2.cols(), g.dimension(2), g.dimension(3))
+ */
+template <typename Scalar>
+Tensor<Scalar, 4> transformBraIndices(const Tensor<Scalar, 4>& g, const MatrixX<Scalar>& C1, const MatrixX<Scalar>& C2) {
+
+    using MatrixMap = Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>;
+    using ConstMatrixMap = Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>;
+
+    const auto K1 = g.dimension(0);
+    const auto K2 = g.dimension(1);
+    const auto M = g.dimension(2) * g.dimension(3);  // the number of (r s) pairs
+
+    if ((C1.rows() != K1) || (C2.rows() != K2)) {
+        throw std::invalid_argument("transformBraIndices(const Tensor<Scalar, 4>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&): The dimensions of the transformation matrices are incompatible with the tensor.");
+    }
+
+    const auto n1 = C1.cols();
+    const auto n2 = C2.cols();
+
+
+    // The first quarter transformation is one product with g viewed as a (K1 x K2 M)-matrix.
+    const MatrixX<Scalar> first = C1.adjoint() * ConstMatrixMap(g.data(), K1, K2 * M);
+
+
+    // The second quarter transformation is a product for every (r s) pair, writing (n1 x n2)-blocks straight into the result.
+    Tensor<Scalar, 4> result {n1, n2, g.dimension(2), g.dimension(3)};
+    for (long rs = 0; rs < M; rs++) {
+        MatrixMap(result.data() + rs * n1 * n2, n1, n2).noalias() = first.middleCols(rs * K2, K2) * C2;
+    }
+
+    return result;
+}
+
+
+/**
+ *  Transform the last two indices (the ket) of a rank-four tensor:
+ *      g'(p q r s) = sum_{v w} C3^*(v r) C4(w s) g(p q v w).
+ *
+ *  @param g                        the rank-four tensor
+ *  @param C3                       the transformation matrix for the third index
+ *  @param C4                       the transformation matrix for the fourth index
+ *  @param is_ket_symmetric         if g(p q v w) = g(p q w v), as for real two-electron integrals over real basis functions. For real scalars with C3 == C4, only the pairs r >= s are then transformed in the last quarter transformation, and the other ones are copied.
+ *
+ *  @tparam Scalar                  the scalar type of the elements
+ *
+ *  @return the ket-transformed rank-four tensor, with dimensions (g.dimension(0), g.dimension(1), C3.cols(), C4.cols())
+ */
+template <typename Scalar>
+Tensor<Scalar, 4> transformKetIndices(const Tensor<Scalar, 4>& g, const MatrixX<Scalar>& C3, const MatrixX<Scalar>& C4, const bool is_ket_symmetric = false) {
+
+    using MatrixMap = Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>;
+    using ConstMatrixMap = Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>;
+
+    const auto M = g.dimension(0) * g.dimension(1);  // the number of (p q) pairs
+    const auto K3 = g.dimension(2);
+    const auto K4 = g.dimension(3);
+
+    if ((C3.rows() != K3) || (C4.rows() != K4)) {
+        throw std::invalid_argument("transformKetIndices(const Tensor<Scalar, 4>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&, const bool): The dimensions of the transformation matrices are incompatible with the tensor.");
+    }
+
+    const auto n3 = C3.cols();
+    const auto n4 = C4.cols();
+
+    // With a symmetric ket and equal (real) transformation matrices, the result is symmetric in (r s) as well.
+    const bool use_ket_symmetry = is_ket_symmetric && std::is_floating_point<Scalar>::value && (C3.rows() == C4.rows()) && (C3.cols() == C4.cols()) && (C3 == C4);
+
+
+    // The first quarter transformation is one product with g viewed as a (M K3 x K4)-matrix.
+    const MatrixX<Scalar> first = ConstMatrixMap(g.data(), M * K3, K4) * C4;
+
+
+    // The second quarter transformation is a product for every s, writing (M x n3)-blocks straight into the result. If the ket symmetry can be used, only the columns r >= s are calculated, and they are copied to the symmetric (s r) pairs.
+    const MatrixX<Scalar> C3_conjugate = C3.conjugate();
+
+    Tensor<Scalar, 4> result {g.dimension(0), g.dimension(1), n3, n4};
+    for (long s = 0; s < n4; s++) {
+        const auto r_start = use_ket_symmetry ? s : 0;
+
+        MatrixMap(result.data() + (s * n3 + r_start) * M, M, n3 - r_start).noalias() = ConstMatrixMap(first.data() + s * M * K3, M, K3) * C3_conjugate.rightCols(n3 - r_start);
+
+        if (use_ket_symmetry) {
+            for (long r = s + 1; r < n3; r++) {
+                MatrixMap(result.data() + (r * n3 + s) * M, M, 1) = MatrixMap(result.data() + (s * n3 + r) * M, M, 1);
+            }
+        }
+    }
+
+    return result;
+}
+
+
+/**
+ *  @param g                the rank-four tensor
+ *  @param tolerance        the tolerance for the difference between g(p q r s) and g(p q s r)
+ *
+ *  @tparam Scalar          the scalar type of the elements
+ *
+ *  @return if the given tensor is symmetric in its last two indices (the ket), i.e. if g(p q r s) = g(p q s r) within the given tolerance
+ */
+template <typename Scalar>
+bool isKetSymmetric(const Tensor<Scalar, 4>& g, const double tolerance = 1.0e-12) {
+
+    using ConstMatrixMap = Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>;
+
+    if (g.dimension(2) != g.dimension(3)) {
+        return false;
+    }
+
+    const auto M = g.dimension(0) * g.dimension(1);  // the number of (p q) pairs
+    const auto K = g.dimension(2);
+
+    // Compare the (p q)-column of every pair (r s) with the one of (s r), and return as soon as a difference is found.
+    for (long s = 0; s < K; s++) {
+        for (long r = s + 1; r < K; r++) {
+            const ConstMatrixMap rs {g.data() + (s * K + r) * M, M, 1};
+            const ConstMatrixMap sr {g.data() + (r * K + s) * M, M, 1};
+
+            if ((rs - sr).cwiseAbs().maxCoeff() > tolerance) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ *  Transform all four indices of a rank-four tensor:
+ *      g'(p q r s) = sum_{t u v w} C1^*(t p) C2(u q) C3^*(v r) C4(w s) g(t u v w).
+ *
+ *  @param g                        the rank-four tensor, in chemist's notation
+ *  @param C1                       the transformation matrix for the first index
+ *  @param C2                       the transformation matrix for the second index
+ *  @param C3                       the transformation matrix for the third index
+ *  @param C4                       the transformation matrix for the fourth index
+ *  @param is_ket_symmetric         if g(t u v w) = g(t u w v), as for real two-electron integrals over real basis functions. For real scalars with C3 == C4, only the pairs r >= s are then transformed, and the other ones are copied.
+ *
+ *  @tparam Scalar                  the scalar type of the elements
+ *
+ *  @return the transformed rank-four tensor, with dimensions (C1.cols(), C2.cols(), C3.cols(), C4.cols())
+ */
+template <typename Scalar>
+Tensor<Scalar, 4> transformFourIndices(const Tensor<Scalar, 4>& g, const MatrixX<Scalar>& C1, const MatrixX<Scalar>& C2, const MatrixX<Scalar>& C3, const MatrixX<Scalar>& C4, const bool is_ket_symmetric = false) {
+
+    using MatrixMap = Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>;
+    using ConstMatrixMap = Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>;
+
+    const auto K1 = g.dimension(0);
+    const auto K2 = g.dimension(1);
+    const auto K3 = g.dimension(2);
+    const auto K4 = g.dimension(3);
+
+    if ((C1.rows() != K1) || (C2.rows() != K2) || (C3.rows() != K3) || (C4.rows() != K4)) {
+        throw std::invalid_argument("transformFourIndices(const Tensor<Scalar, 4>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&, const bool): The dimensions of the transformation matrices are incompatible with the tensor.");
+    }
+
+    const auto n1 = C1.cols();
+    const auto n2 = C2.cols();
+    const auto n3 = C3.cols();
+    const auto n4 = C4.cols();
+
+    // With a symmetric ket and equal (real) transformation matrices, the result is symmetric in (r s) as well.
+    const bool use_ket_symmetry = is_ket_symmetric && std::is_floating_point<Scalar>::value && (C3.rows() == C4.rows()) && (C3.cols() == C4.cols()) && (C3 == C4);
+
+
+    // Transform the fourth index: one product with g viewed as a (K1 K2 K3 x K4)-matrix. This is the only intermediate that scales with the full dimension of all first three indices.
+    const MatrixX<Scalar> first = ConstMatrixMap(g.data(), K1 * K2 * K3, K4) * C4;
+
+
+    // Transform the third index: one product for every s, in which only the columns r >= s are needed if the ket symmetry can be used.
+    const MatrixX<Scalar> C3_conjugate = C3.conjugate();
+
+    MatrixX<Scalar> second = MatrixX<Scalar>::Zero(K1 * K2, n3 * n4);
+    for (long s = 0; s < n4; s++) {
+        const auto r_start = use_ket_symmetry ? s : 0;
+
+        second.middleCols(s * n3 + r_start, n3 - r_start).noalias() = ConstMatrixMap(first.data() + s * K1 * K2 * K3, K1 * K2, K3) * C3_conjugate.rightCols(n3 - r_start);
+    }
+
+
+    // Transform the first index: one product for every s, with the (r s)-columns of the previous intermediate viewed as a (K1 x K2 n3)-matrix.
+    MatrixX<Scalar> third = MatrixX<Scalar>::Zero(n1, K2 * n3 * n4);
+    for (long s = 0; s < n4; s++) {
+        const auto r_start = use_ket_symmetry ? s : 0;
+
+        third.middleCols((s * n3 + r_start) * K2, (n3 - r_start) * K2).noalias() = C1.adjoint() * ConstMatrixMap(second.data() + (s * n3 + r_start) * K1 * K2, K1, K2 * (n3 - r_start));
+    }
+
+
+    // Transform the second index: one product for every (r s) pair, writing (n1 x n2)-blocks straight into the result and copying them to the symmetric (s r) pair if needed.
+    Tensor<Scalar, 4> result {n1, n2, n3, n4};
+    for (long s = 0; s < n4; s++) {
+        const auto r_start = use_ket_symmetry ? s : 0;
+
+        for (long r = r_start; r < n3; r++) {
+            MatrixMap block {result.data() + (s * n3 + r) * n1 * n2, n1, n2};
+            block.noalias() = third.middleCols((s * n3 + r) * K2, K2) * C2;
+
+            if (use_ket_symmetry && (r != s)) {
+                MatrixMap(result.data() + (r * n3 + s) * n1 * n2, n1, n2) = block;
+            }
+        }
+    }
+
+    return result;
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,283 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/**
+ *  @return A new generation of a history (see `History::generation()`), which differs from every generation that has been handed out before, by any history.
+ */
+inline size_t nextHistoryGeneration() {
+    static std::atomic<size_t> last_generation {0};
+    return ++last_generation;
+}
+
+
+/**
+ *  The history of an iterate in an algorithm environment, i.e. a sequence of iterates that grows at its back.
+ *
+ *  A history can be bounded: it then acts as a ring buffer that only keeps the most recent iterates, evicting the oldest one whenever a new iterate would exceed its capacity. This keeps the memory of an environment constant over the number of iterations, as long as its capacity covers what the algorithm needs (e.g. two consecutive iterates for a convergence check, or the subspace of a DIIS accelerator). An unbounded history keeps every iterate, which can be useful for debugging.
+ *
+ *  @tparam _Iterate            The type of the iterates.
+ */
+template <typename _Iterate>
+class History {
+public:
+    // The type of the iterates.
+    using Iterate = _Iterate;
+
+    // The STL-like types that allow a history to be used with STL algorithms and range-based for-loops.
+    using value_type = Iterate;
+    using iterator = typename std::deque<Iterate>::iterator;
+    using const_iterator = typename std::deque<Iterate>::const_iterator;
+
+
+private:
+    // The maximum number of iterates that are kept.
+    size_t m_capacity;
+
+    // The iterates that are kept, from the oldest to the most recent one.
+    std::deque<Iterate> iterates;
+
+    // The generation of the iterates that are kept, which changes whenever an iterate is added or removed.
+    size_t m_generation;
+
+    // The generation before the most recent iterate was added, or zero if the history has been changed otherwise since.
+    size_t m_previous_generation = 0;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Create an empty, unbounded history.
+     */
+    History() :
+        History(History<Iterate>::unboundedCapacity()) {}
+
+
+    /**
+     *  Create an empty, bounded history.
+     *
+     *  @param capacity             The maximum number of iterates that are kept.
+     */
+    explicit History(const size_t capacity) :
+        m_capacity {capacity},
+        m_generation {nextHistoryGeneration()} {
+
+        if (capacity == 0) {
+            throw std::invalid_argument("History(const size_t): The capacity of a history should be at least one.");
+        }
+    }
+
+
+    /*
+     *  MARK: Capacity
+     */
+
+    /**
+     *  @return The capacity of an unbounded history.
+     */
+    static size_t unboundedCapacity() { return std::numeric_limits<size_t>::max(); }
+
+    /**
+     *  @return The maximum number of iterates that are kept.
+     */
+    size_t capacity() const { return this->m_capacity; }
+
+    /**
+     *  @return If this history only keeps a limited number of iterates.
+     */
+    bool isBounded() const { return this->m_capacity != History<Iterate>::unboundedCapacity(); }
+
+    /**
+     *  Change the maximum number of iterates that are kept. If the history holds more iterates than the new capacity, the oldest ones are evicted.
+     *
+     *  @param capacity             The new maximum number of iterates that are kept.
+     */
+    void setCapacity(const size_t capacity) {
+
+        if (capacity == 0) {
+            throw std::invalid_argument("History::setCapacity(const size_t): The capacity of a history should be at least one.");
+        }
+
+        this->m_capacity = capacity;
+        if (this->iterates.size() > this->m_capacity) {
+            while (this->iterates.size() > this->m_capacity) {
+                this->iterates.pop_front();
+            }
+            this->startNewGeneration(false);
+        }
+    }
+
+    /**
+     *  Make sure that this history keeps at least the given number of iterates, by enlarging its capacity if necessary.
+     *
+     *  @param capacity             The minimum number of iterates that should be kept.
+     */
+    void ensureCapacity(const size_t capacity) {
+        if (capacity > this->m_capacity) {
+            this->m_capacity = capacity;
+        }
+    }
+
+    /**
+     *  Keep every iterate that is added from now on.
+     */
+    void makeUnbounded() { this->m_capacity = History<Iterate>::unboundedCapacity(); }
+
+
+    /*
+     *  MARK: Modifiers
+     */
+
+    /**
+     *  Add a new, most recent iterate. If the history is full, its oldest iterate is evicted.
+     *
+     *  @param iterate              The new iterate.
+     */
+    void push_back(const Iterate& iterate) {
+
+        // The oldest iterate is only evicted afterwards, since the given iterate may be (a reference to) one of the iterates in this history.
+        this->iterates.push_back(iterate);
+        if (this->iterates.size() > this->m_capacity) {
+            this->iterates.pop_front();
+        }
+        this->startNewGeneration(true);
+    }
+
+    /**
+     *  Remove the most recent iterate.
+     */
+    void pop_back() {
+        this->iterates.pop_back();
+        this->startNewGeneration(false);
+    }
+
+    /**
+     *  Remove all iterates, while keeping the capacity.
+     */
+    void clear() {
+        this->iterates.clear();
+        this->startNewGeneration(false);
+    }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The most recent iterate.
+     */
+    const Iterate& back() const { return this->iterates.back(); }
+
+    /**
+     *  @return A writable reference to the most recent iterate.
+     */
+    Iterate& back() { return this->iterates.back(); }
+
+    /**
+     *  @return The oldest iterate that is kept.
+     */
+    const Iterate& front() const { return this->iterates.front(); }
+
+    /**
+     *  @param i                    The index of an iterate, counting from the oldest one that is kept.
+     *
+     *  @return A read-only reference to the i-th iterate.
+     */
+    const Iterate& operator[](const size_t i) const { return this->iterates[i]; }
+
+    /**
+     *  @return If no iterates are kept.
+     */
+    bool empty() const { return this->iterates.empty(); }
+
+    /**
+     *  @return The number of iterates that are kept.
+     */
+    size_t size() const { return this->iterates.size(); }
+
+
+    /*
+     *  MARK: Iterators
+     */
+
+    /**
+     *  @return A (random access) iterator to the oldest iterate that is kept.
+     */
+    const_iterator begin() const { return this->iterates.begin(); }
+
+    /**
+     *  @return A (random access) iterator past the most recent iterate.
+     */
+    const_iterator end() const { return this->iterates.end(); }
+
+    /**
+     *  @return A writable (random access) iterator to the oldest iterate that is kept.
+     */
+    iterator begin() { return this->iterates.begin(); }
+
+    /**
+     *  @return A writable (random access) iterator past the most recent iterate.
+     */
+    iterator end() { return this->iterates.end(); }
+
+
+    /*
+     *  MARK: Generations
+     */
+
+    /**
+     *  @return The generation of the iterates that are kept. It changes whenever an iterate is added or removed, and is never shared with another history (except for a copy of this history, as long as neither of them is changed). This allows e.g. an accelerator to check if a history has only grown by one iterate since it last read from it, see `previousGeneration()`.
+     *
+     *  @note Changing an iterate in place, e.g. through `back()`, doesn't change the generation.
+     */
+    size_t generation() const { return this->m_generation; }
+
+    /**
+     *  @return The generation of this history before its most recent iterate was added, or zero if the history has been changed otherwise since (e.g. if an iterate was removed).
+     */
+    size_t previousGeneration() const { return this->m_previous_generation; }
+
+
+private:
+    /**
+     *  Give the iterates that are kept a new generation.
+     *
+     *  @param is_push_back         If the iterates have been changed by adding a new, most recent iterate.
+     */
+    void startNewGeneration(const bool is_push_back) {
+        this->m_previous_generation = is_push_back ? this->m_generation : 0;
+        this->m_generation = nextHistoryGeneration();
+    }
+};
+
+
+}  // namespace GQCP
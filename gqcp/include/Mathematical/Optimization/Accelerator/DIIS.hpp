@@ -21,6 +21,7 @@
 #include "Mathematical/Optimization/LinearEquation/LinearEquationEnvironment.hpp"
 #include "Mathematical/Optimization/LinearEquation/LinearEquationSolver.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
 
 #include <vector>
 
@@ -0,0 +1,245 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/History.hpp"
+#include "Mathematical/Optimization/LinearEquation/LinearEquationEnvironment.hpp"
+#include "Mathematical/Optimization/LinearEquation/LinearEquationSolver.hpp"
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/**
+ *  A stateful accelerator that uses a direct inversion of the iterative subspace (DIIS), which caches the overlaps of the error vectors in its subspace (the so-called B matrix) across iterations.
+ *
+ *  In contrast to `DIIS`, which recalculates every overlap in every iteration, only the overlaps of the most recent error vector are calculated when the subspace is updated: the oldest error vector is evicted in place once the subspace is full. Neither the error vectors nor the subjects are copied: they are read from the (e.g. environment's) sequences they are stored in, and the extrapolated subject is written into a given output, which may be the most recent subject itself.
+ *
+ *  An accelerator keeps track of the generation of the history of error vectors it was last updated with (see `History::generation()`). If the history has changed in any other way than by adding a single error vector since (e.g. because the accelerator is reused for another environment, or because the most recent error vector was replaced), the B matrix is recalculated from scratch.
+ *
+ *  @tparam _Scalar             The scalar type that is used to represent an element of a DIIS error vector.
+ */
+template <typename _Scalar>
+class IncrementalDIIS {
+public:
+    // The scalar type that is used to represent an element of a DIIS error vector.
+    using Scalar = _Scalar;
+
+
+private:
+    // The maximum number of error vectors in the subspace.
+    size_t maximum_subspace_dimension;
+
+    // The current number of error vectors in the subspace.
+    size_t subspace_dimension = 0;
+
+    // The overlaps of the error vectors in the subspace, from the oldest to the most recent one. Only the upper-left (subspace dimension x subspace dimension)-block is in use.
+    SquareMatrix<Scalar> B;
+
+    // The generation of the history of error vectors that the subspace was last updated with, which is used to check if an update continues from the current subspace. Zero if the subspace is empty.
+    size_t generation = 0;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param maximum_subspace_dimension       The maximum number of error vectors in the subspace.
+     */
+    IncrementalDIIS(const size_t maximum_subspace_dimension = 6) :
+        maximum_subspace_dimension {maximum_subspace_dimension},
+        B {SquareMatrix<Scalar>::Zero(maximum_subspace_dimension)} {
+
+        if (maximum_subspace_dimension == 0) {
+            throw std::invalid_argument("IncrementalDIIS(const size_t): The maximum subspace dimension should be at least one.");
+        }
+    }
+
+
+    /*
+     *  MARK: Subspace
+     */
+
+    /**
+     *  @return The maximum number of error vectors in the subspace.
+     */
+    size_t maximumSubspaceDimension() const { return this->maximum_subspace_dimension; }
+
+    /**
+     *  @return The current number of error vectors in the subspace.
+     */
+    size_t subspaceDimension() const { return this->subspace_dimension; }
+
+    /**
+     *  @return The overlaps of the error vectors in the subspace, from the oldest to the most recent one.
+     */
+    MatrixX<Scalar> errorOverlaps() const { return this->B.topLeftCorner(this->subspace_dimension, this->subspace_dimension); }
+
+    /**
+     *  Remove all error vectors from the subspace.
+     */
+    void clear() {
+        this->subspace_dimension = 0;
+        this->generation = 0;
+    }
+
+
+    /**
+     *  Add the most recent error vector to the subspace, evicting the oldest one if the subspace is full.
+     *
+     *  @param errors               The history of error vectors, from the oldest to the most recent one. Usually, this is a history of an environment.
+     *  @param error                A function that returns a (reference to the) error vector of an iterate of the history.
+     */
+    template <typename Iterate, typename ErrorAccessor>
+    void update(const History<Iterate>& errors, const ErrorAccessor& error) {
+
+        const auto number_of_errors = errors.size();
+        if (number_of_errors == 0) {
+            throw std::invalid_argument("IncrementalDIIS::update(const History<Iterate>&, const ErrorAccessor&): The history of error vectors should not be empty.");
+        }
+
+        // Only the overlaps of the most recent error vector have to be calculated if it is the only error vector that has been added since the previous update, and if the history still holds the error vectors that stay in the subspace. Once the subspace is full, its oldest error vector is evicted, so the history only has to hold as many error vectors as the maximum subspace dimension.
+        const auto last = errors.end();
+        const auto number_of_staying_errors = std::min(this->subspace_dimension, this->maximum_subspace_dimension - 1);
+        const bool continues_subspace = (this->subspace_dimension > 0) && (errors.previousGeneration() == this->generation) && (number_of_errors > number_of_staying_errors);
+
+        if (!continues_subspace) {
+            this->subspace_dimension = std::min(number_of_errors, this->maximum_subspace_dimension);
+            const auto subspace_first = std::prev(last, this->subspace_dimension);
+
+            auto it_i = subspace_first;
+            for (size_t i = 0; i < this->subspace_dimension; i++, it_i++) {
+                auto it_j = subspace_first;
+                for (size_t j = 0; j <= i; j++, it_j++) {
+                    this->B(i, j) = error(*it_i).dot(error(*it_j));
+                    this->B(j, i) = Eigen::numext::conj(this->B(i, j));
+                }
+            }
+        } else {
+
+            // Evict the oldest error vector by shifting the overlaps of the remaining ones to the upper-left. The loop order makes sure that no overlap is overwritten before it is moved.
+            if (this->subspace_dimension == this->maximum_subspace_dimension) {
+                for (size_t j = 1; j < this->subspace_dimension; j++) {
+                    for (size_t i = 1; i < this->subspace_dimension; i++) {
+                        this->B(i - 1, j - 1) = this->B(i, j);
+                    }
+                }
+                this->subspace_dimension--;
+            }
+
+            // Append a row and column with the overlaps of the most recent error vector.
+            const auto n = this->subspace_dimension;
+            const auto& e_new = error(*std::prev(last));
+
+            auto it_i = std::prev(last, n + 1);
+            for (size_t i = 0; i < n; i++, it_i++) {
+                this->B(n, i) = e_new.dot(error(*it_i));
+                this->B(i, n) = Eigen::numext::conj(this->B(n, i));
+            }
+            this->B(n, n) = e_new.dot(e_new);
+            this->subspace_dimension++;
+        }
+
+        this->generation = errors.generation();
+    }
+
+
+    /**
+     *  Add the most recent error vector to the subspace, evicting the oldest one if the subspace is full.
+     *
+     *  @param errors               The history of error vectors, from the oldest to the most recent one. Usually, this is a history of an environment.
+     */
+    void update(const History<VectorX<Scalar>>& errors) {
+        this->update(errors, [](const VectorX<Scalar>& error) -> const VectorX<Scalar>& { return error; });
+    }
+
+
+    /*
+     *  MARK: Extrapolation
+     */
+
+    /**
+     *  Find the linear combination of the error vectors in the subspace that minimizes the total error measure in the least squares sense (i.e. according to the DIIS algorithm).
+     *
+     *  @return The DIIS coefficients, from the oldest to the most recent error vector in the subspace.
+     */
+    VectorX<Scalar> coefficients() const {
+
+        const auto n = this->subspace_dimension;
+        if (n == 0) {
+            throw std::logic_error("IncrementalDIIS::coefficients() const: The subspace is empty.");
+        }
+
+        // Set up the augmented B matrix and the right-hand side. The extra row and column correspond to the Lagrange multiplier.
+        SquareMatrix<Scalar> B_augmented = -1 * SquareMatrix<Scalar>::Ones(n + 1, n + 1);
+        B_augmented.topLeftCorner(n, n) = this->B.topLeftCorner(n, n);
+        B_augmented(n, n) = 0;
+
+        VectorX<Scalar> b = VectorX<Scalar>::Zero(n + 1);
+        b(n) = -1;
+
+        // Solve the DIIS linear equations [B x = b].
+        auto environment = LinearEquationEnvironment<Scalar>(B_augmented, b);
+        auto solver = LinearEquationSolver<Scalar>::HouseholderQR();
+        solver.perform(environment);
+
+        return environment.x.col(0).head(n);
+    }
+
+
+    /**
+     *  Write the DIIS-extrapolated subject into the given output, without copying the subjects.
+     *
+     *  @param first                The begin iterator of the sequence of subjects, from the oldest to the most recent one. Its last elements should correspond to the error vectors in the subspace.
+     *  @param last                 The end iterator of the sequence of subjects.
+     *  @param subject              A function that returns a (reference to or view on the) representation of an element of the sequence that supports Eigen-like arithmetic, e.g. the parameters of an operator.
+     *  @param output               The (preallocated) representation that the extrapolated subject is written into. It may be the representation of the most recent subject, which is then overwritten in place.
+     */
+    template <typename SubjectIterator, typename SubjectAccessor, typename Output>
+    void extrapolate(const SubjectIterator first, const SubjectIterator last, const SubjectAccessor& subject, Output&& output) const {
+
+        const auto n = this->subspace_dimension;
+        if (static_cast<size_t>(std::distance(first, last)) < n) {
+            throw std::invalid_argument("IncrementalDIIS::extrapolate(const SubjectIterator, const SubjectIterator, const SubjectAccessor&, Output&&) const: There are fewer subjects than error vectors in the subspace.");
+        }
+
+        const auto c = this->coefficients();
+
+        // The most recent subject is handled first, so that it may be overwritten.
+        output = c(n - 1) * subject(*std::prev(last));
+
+        auto it = std::prev(last, n);
+        for (size_t i = 0; i < n - 1; i++, it++) {
+            output += c(i) * subject(*it);
+        }
+    }
+};
+
+
+}  // namespace GQCP
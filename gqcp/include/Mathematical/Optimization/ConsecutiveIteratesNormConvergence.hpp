@@ -19,8 +19,8 @@
 
 
 #include "Mathematical/Algorithm/ConvergenceCriterion.hpp"
+#include "Mathematical/Algorithm/History.hpp"
 
-#include <deque>
 #include <functional>
 #include <type_traits>
 
@@ -50,7 +50,7 @@ private:
 
     std::string iterate_description;  // the description of the the iterates that are compared
 
-    std::function<std::deque<Iterate>(const Environment&)> extractor;  // a function that can extract the correct iterates from the environment, as it's not mandatory to check convergence on the variables, but any iterate (whose .norm() can be calculated) can in principle be used
+    std::function<const History<Iterate>*(const Environment&)> extractor;  // a function that can extract (a pointer to) the correct iterates from the environment, as it's not mandatory to check convergence on the variables, but any iterate (whose .norm() can be calculated) can in principle be used
 
 
 public:
@@ -60,11 +60,11 @@ public:
 
     /**
      *  @param threshold                    the threshold that is used in comparing the iterates
-     *  @param extractor                    a function that can extract the correct iterates from the environment. The default is to check the environment on a property called 'variables'
+     *  @param extractor                    a function that can extract (a pointer to) the correct iterates from the environment. The default is to check the environment on a property called 'variables'. The iterates are not copied, so the history should be a member of the environment. A pointer is used instead of a reference, so that a function that returns the history by value doesn't compile, instead of leaving a dangling reference
      *  @param iterate_description          the description of the the iterates that are compared
      */
     ConsecutiveIteratesNormConvergence(
-        const double threshold = 1.0e-08, const std::function<std::deque<Iterate>(const Environment&)> extractor = [](const Environment& environment) { return environment.variables; }, const std::string& iterate_description = "a general iterate") :
+        const double threshold = 1.0e-08, const std::function<const History<Iterate>*(const Environment&)> extractor = [](const Environment& environment) -> const History<Iterate>* { return &environment.variables; }, const std::string& iterate_description = "a general iterate") :
         m_threshold {threshold},
         extractor {extractor},
         iterate_description {iterate_description} {}
@@ -89,7 +89,7 @@ public:
      */
     bool isFulfilled(Environment& environment) override {
 
-        const auto iterates = this->extractor(environment);
+        const auto& iterates = *this->extractor(environment);
 
         if (iterates.size() < 2) {
             return false;  // we can't calculate convergence
@@ -98,7 +98,7 @@ public:
         // Get the two most recent density matrices and compare the norm of their difference
         const auto second_to_last_it = iterates.end() - 2;  // 'it' for 'iterator'
         const auto& previous = *second_to_last_it;          // dereference the iterator
-        const auto current = iterates.back();
+        const auto& current = iterates.back();
 
         return ((current - previous).norm() <= this->m_threshold);
     }
@@ -0,0 +1,90 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the matrix-vector products for all (new) guess vectors in one block, i.e. through one call of the environment's block matrix-vector product function.
+ */
+class BlockMatrixVectorProductCalculation:
+    public Step<EigenproblemEnvironment> {
+
+public:
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Calculate the matrix-vector products for all the (new) guess vectors in one block and add them to the environment.";
+    }
+
+
+    /**
+     *  Calculate the matrix-vector products for all the (new) guess vectors in one block and add them to the environment.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void execute(EigenproblemEnvironment& environment) override {
+
+        const auto V = environment.activeV();  // the (active) subspace of guess vectors
+
+        assert((V.transpose() * V).isApprox(MatrixX<double>::Identity(V.cols(), V.cols()), 1.0e-08));  // make sure that the subspace vectors are orthonormal
+
+
+        // Check how many vectors there currently are in V and how many matrix-vector products have already been calculated: only calculate the expensive matrix-vector products for 'new' vectors.
+        // If there are more active vectors in V than in VA, the matrix-vector products of the new vectors should be placed into the (preallocated) columns of VA.
+        // If there are less active vectors in V than in VA, which can only happen if the environment's subspace was modified from the outside, all matrix-vector products should be recalculated.
+        const auto vectors_in_V = environment.subspace_dimension;
+        const auto vectors_in_VA = environment.number_of_subspace_products;
+
+        if (vectors_in_V == vectors_in_VA) {
+            return;
+        }
+
+        environment.reserveSubspace(vectors_in_V);  // only reallocates the first time matrix-vector products are calculated
+        const size_t start_index = (vectors_in_V > vectors_in_VA) ? vectors_in_VA : 0;
+        const size_t number_of_new_vectors = vectors_in_V - start_index;
+
+        const MatrixX<double> V_new = V.middleCols(start_index, number_of_new_vectors);
+        auto VA = environment.subspaceProductStorage();  // the storage for VA = A * V (implicitly calculated through the matrix-vector product)
+
+        if (environment.block_matrix_product_function) {
+            VA.middleCols(start_index, number_of_new_vectors) = environment.block_matrix_product_function(V_new);
+        } else {
+            // Without a block matrix-vector product function, we have to fall back to the matrix-vector product function.
+            for (size_t column_index = 0; column_index < number_of_new_vectors; column_index++) {
+                VA.col(start_index + column_index) = environment.matrix_vector_product_function(V_new.col(column_index));
+            }
+        }
+        environment.number_of_subspace_products = vectors_in_V;
+        environment.number_of_matrix_vector_products += number_of_new_vectors;
+    }
+};
+
+
+}  // namespace GQCP
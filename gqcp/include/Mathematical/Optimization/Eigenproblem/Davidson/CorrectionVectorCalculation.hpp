@@ -19,14 +19,22 @@
 
 
 #include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/DavidsonCorrection.hpp"
 #include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
 
+#include <Eigen/Eigenvalues>
+
+#include <algorithm>
+#include <numeric>
+
 
 namespace GQCP {
 
 
 /**
  *  A step that calculates correction vectors by solving the residual equations.
+ * 
+ *  The residual equations are solved approximately, through a preconditioner: either the diagonal of the matrix, or the diagonal of the matrix in which the block between the basis vectors with the lowest diagonal elements is treated exactly (a dense-block preconditioner).
  */
 class CorrectionVectorCalculation:
     public Step<EigenproblemEnvironment> {
@@ -35,6 +43,9 @@ private:
     size_t number_of_requested_eigenpairs;
     double correction_threshold;
 
+    DavidsonCorrection correction;          // the scheme that is used to calculate the correction vectors
+    size_t preconditioner_block_dimension;  // the number of basis vectors (with the lowest diagonal elements) whose block of the matrix is used exactly in the preconditioner: zero means that only the diagonal is used
+
 
 public:
     /*
@@ -44,10 +55,14 @@ public:
     /**
      *  @param number_of_requestested_eigenpairs            the number of eigenpairs that should be found by the algorithm
      *  @param correction_threshold                         the threshold used in solving the (approximated) residue correction equation
+     *  @param correction                                   the scheme that is used to calculate the correction vectors
+     *  @param preconditioner_block_dimension               the number of basis vectors (with the lowest diagonal elements) whose block of the matrix is used exactly in the preconditioner: zero means that only the diagonal is used
      */
-    CorrectionVectorCalculation(const size_t number_of_requested_eigenpairs = 1, const double correction_threshold = 1.0e-12) :
+    CorrectionVectorCalculation(const size_t number_of_requested_eigenpairs = 1, const double correction_threshold = 1.0e-12, const DavidsonCorrection correction = DavidsonCorrection::k_diagonal, const size_t preconditioner_block_dimension = 0) :
         number_of_requested_eigenpairs {number_of_requested_eigenpairs},
-        correction_threshold {correction_threshold} {}
+        correction_threshold {correction_threshold},
+        correction {correction},
+        preconditioner_block_dimension {preconditioner_block_dimension} {}
 
 
     /*
@@ -74,28 +89,130 @@ public:
         const auto& diagonal = environment.diagonal;  // the diagonal of the matrix
         const auto& Lambda = environment.Lambda;      // the (requested number of) eigenvalues of the subspace matrix S
 
-        const auto& VA = environment.VA;  // VA = A * V (implicitly calculated through the matrix-vector product)
-        const auto& Z = environment.Z;    // the (requested number of) eigenvectors of the subspace matrix S
-        const auto& X = environment.X;    // contains the new guesses for the eigenvectors (as a linear combination of the current subspace V)
-        const auto& R = environment.R;    // the residual vectors
+        const auto& X = environment.X;  // contains the new guesses for the eigenvectors (as a linear combination of the current subspace V)
+        const auto& R = environment.R;  // the residual vectors
 
-        // Solve the residual equations to find the correction vectors.
-        // The implementation of these equations is adapted from Klaas Gunst's DOCI code (https://github.com/klgunst/doci)
         environment.Delta = MatrixX<double>::Zero(dim, this->number_of_requested_eigenpairs);
+
+        // The standard Davidson correction with a diagonal preconditioner.
+        if ((this->correction == DavidsonCorrection::k_diagonal) && (this->preconditioner_block_dimension == 0)) {
+
+            // Solve the residual equations to find the correction vectors.
+            // The implementation of these equations is adapted from Klaas Gunst's DOCI code (https://github.com/klgunst/doci)
+            for (size_t column_index = 0; column_index < this->number_of_requested_eigenpairs; column_index++) {
+
+                VectorX<double> denominator = diagonal - VectorX<double>::Constant(dim, Lambda(column_index));
+
+                // If the denominator is large enough, the correction vector is the residual vector dividided by the denominator.
+                // If it isn't, the correction vector is the residual vector divided by the threshold.
+                // clang-format off
+                environment.Delta.col(column_index) = (denominator.array().abs() > this->correction_threshold).select(
+                    R.col(column_index).array() / denominator.array().abs(),
+                    R.col(column_index) / this->correction_threshold
+                );
+                // clang-format on
+                environment.Delta.col(column_index).normalize();
+            }
+
+            return;
+        }
+
+
+        // Otherwise, we apply the (possibly dense-block) preconditioner M - lambda, in which we don't take the absolute value of the denominators.
+        if (this->preconditioner_block_dimension > 0) {
+            this->prepareDenseBlock(environment);
+        }
+
         for (size_t column_index = 0; column_index < this->number_of_requested_eigenpairs; column_index++) {
+            const auto lambda = Lambda(column_index);
+
+            VectorX<double> delta = this->precondition(environment, lambda, R.col(column_index));
+
+            // Olsen's correction projects the component along the preconditioned eigenvector guess out of the preconditioned residual: delta = (M - lambda)^{-1} (r - epsilon x), with epsilon = (x^T (M - lambda)^{-1} r) / (x^T (M - lambda)^{-1} x).
+            if (this->correction == DavidsonCorrection::k_olsen) {
+                const VectorX<double> preconditioned_x = this->precondition(environment, lambda, X.col(column_index));
+                const double denominator = X.col(column_index).dot(preconditioned_x);
+
+                if (std::abs(denominator) > this->correction_threshold) {
+                    const double epsilon = X.col(column_index).dot(delta) / denominator;
+                    delta -= epsilon * preconditioned_x;
+                }
+            }
+
+            environment.Delta.col(column_index) = delta.normalized();
+        }
+    }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
 
-            VectorX<double> denominator = diagonal - VectorX<double>::Constant(dim, Lambda(column_index));
-
-            // If the denominator is large enough, the correction vector is the residual vector dividided by the denominator.
-            // If it isn't, the correction vector is the residual vector divided by the threshold.
-            // clang-format off
-            environment.Delta.col(column_index) = (denominator.array().abs() > this->correction_threshold).select(
-                R.col(column_index).array() / denominator.array().abs(),
-                R.col(column_index) / this->correction_threshold
-            );
-            // clang-format on
-            environment.Delta.col(column_index).normalize();
+    /**
+     *  Apply the inverse of the shifted preconditioner (M - lambda) to the given vector.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     *  @param lambda                   the shift, i.e. the current guess for the eigenvalue
+     *  @param y                        the vector to which the inverse of the shifted preconditioner should be applied
+     * 
+     *  @return (M - lambda)^{-1} y
+     */
+    VectorX<double> precondition(const EigenproblemEnvironment& environment, const double lambda, const VectorX<double>& y) const {
+
+        const auto threshold = this->correction_threshold;
+        const auto guard = [threshold](const double denominator) { return (std::abs(denominator) > threshold) ? denominator : threshold; };
+
+        // Outside of the dense block, the preconditioner is diagonal.
+        VectorX<double> z = y.array() / (environment.diagonal.array() - lambda).unaryExpr(guard);
+
+        // Inside the dense block, we use its eigendecomposition to invert it: (H_PP - lambda)^{-1} = U (e - lambda)^{-1} U^T.
+        const auto& indices = environment.preconditioner_indices;
+        if (!indices.empty()) {
+            const auto& U = environment.preconditioner_eigenvectors;
+            const auto& e = environment.preconditioner_eigenvalues;
+
+            VectorX<double> y_P = VectorX<double>::Zero(indices.size());
+            for (size_t i = 0; i < indices.size(); i++) {
+                y_P(i) = y(indices[i]);
+            }
+
+            const VectorX<double> c = (U.transpose() * y_P).array() / (e.array() - lambda).unaryExpr(guard);
+            const VectorX<double> z_P = U * c;
+            for (size_t i = 0; i < indices.size(); i++) {
+                z(indices[i]) = z_P(i);
+            }
         }
+
+        return z;
+    }
+
+
+    /**
+     *  Select the basis vectors with the lowest diagonal elements and diagonalize the block of the matrix between them, if that hasn't happened yet for this environment.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void prepareDenseBlock(EigenproblemEnvironment& environment) const {
+
+        const auto block_dimension = std::min(this->preconditioner_block_dimension, environment.dimension);
+        if (environment.preconditioner_indices.size() == block_dimension) {
+            return;  // the dense block has already been prepared
+        }
+
+        // Find the indices of the lowest diagonal elements.
+        const auto& diagonal = environment.diagonal;
+        std::vector<size_t> indices(environment.dimension);
+        std::iota(indices.begin(), indices.end(), 0);
+        std::partial_sort(indices.begin(), indices.begin() + block_dimension, indices.end(), [&diagonal](const size_t i, const size_t j) { return diagonal(i) < diagonal(j); });
+        indices.resize(block_dimension);
+
+        const auto H_PP = environment.matrixBlock(indices);
+        const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {H_PP};
+
+        environment.preconditioner_indices = indices;
+        environment.preconditioner_eigenvalues = eigensolver.eigenvalues();
+        environment.preconditioner_eigenvectors = eigensolver.eigenvectors();
     }
 };
 
@@ -0,0 +1,33 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+namespace GQCP {
+
+
+/**
+ *  The scheme that is used to calculate the correction vectors from the residual vectors in a Davidson algorithm.
+ */
+enum class DavidsonCorrection {
+    k_diagonal,  // the standard Davidson correction: the residual vectors, preconditioned with the (absolute value of the) shifted diagonal
+    k_olsen      // Olsen's correction: the preconditioned residual vectors, from which the component along the preconditioned current eigenvector guess is projected out
+};
+
+
+}  // namespace GQCP
@@ -20,7 +20,9 @@
 
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Algorithm/StepCollection.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/BlockMatrixVectorProductCalculation.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/CorrectionVectorCalculation.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/DavidsonCorrection.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/GuessVectorUpdate.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/MatrixVectorProductCalculation.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/ResidualVectorCalculation.hpp"
@@ -42,10 +44,13 @@ namespace EigenproblemSolver {
  *  @param correction_threshold                 the threshold used in solving the (approximated) residue correction equation
  *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
  *  @param inclusion_threshold                  the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+ *  @param correction                           the scheme that is used to calculate the correction vectors
+ *  @param preconditioner_block_dimension       the number of basis vectors (with the lowest diagonal elements) whose block of the matrix is used exactly in the preconditioner: zero means that only the diagonal is used
+ *  @param thick_restart                        if the previous guesses for the eigenvectors should be kept in the subspace upon a collapse (a thick restart), rather than only the current guesses
  * 
  *  @return an iterative algorithm that can find the lowest n eigenvectors of a matrix using Davidson's algorithm
  */
-IterativeAlgorithm<EigenproblemEnvironment> Davidson(const size_t number_of_requested_eigenpairs = 1, const size_t maximum_subspace_dimension = 15, const double convergence_threshold = 1.0e-08, double correction_threshold = 1.0e-12, const size_t maximum_number_of_iterations = 128, const double inclusion_threshold = 1.0e-03) {
+IterativeAlgorithm<EigenproblemEnvironment> Davidson(const size_t number_of_requested_eigenpairs = 1, const size_t maximum_subspace_dimension = 15, const double convergence_threshold = 1.0e-08, double correction_threshold = 1.0e-12, const size_t maximum_number_of_iterations = 128, const double inclusion_threshold = 1.0e-03, const DavidsonCorrection correction = DavidsonCorrection::k_diagonal, const size_t preconditioner_block_dimension = 0, const bool thick_restart = false) {
 
     // Create the iteration cycle that effectively 'defines' our Davidson solver
     StepCollection<EigenproblemEnvironment> davidson_cycle {};
@@ -56,8 +61,42 @@ IterativeAlgorithm<EigenproblemEnvironment> Davidson(const size_t number_of_requ
         .add(SubspaceMatrixDiagonalization(number_of_requested_eigenpairs))
         .add(GuessVectorUpdate())
         .add(ResidualVectorCalculation(number_of_requested_eigenpairs))
-        .add(CorrectionVectorCalculation(number_of_requested_eigenpairs, correction_threshold))  // this solves the residual equations
-        .add(SubspaceUpdate(maximum_subspace_dimension, inclusion_threshold));
+        .add(CorrectionVectorCalculation(number_of_requested_eigenpairs, correction_threshold, correction, preconditioner_block_dimension))  // this solves the residual equations
+        .add(SubspaceUpdate(maximum_subspace_dimension, inclusion_threshold, thick_restart));
+
+    // Create a convergence criterion on the norm of the residual vectors
+    const ResidualVectorConvergence<EigenproblemEnvironment> convergence_criterion {convergence_threshold};
+
+    return IterativeAlgorithm<EigenproblemEnvironment>(davidson_cycle, convergence_criterion, maximum_number_of_iterations);
+}
+
+
+/**
+ *  @param number_of_requested_eigenpairs       the number of solutions the Davidson solver should find
+ *  @param maximum_subspace_dimension           the maximum dimension of the subspace before collapsing
+ *  @param convergence_threshold                the threshold that is used in determining the norm on the residuals, which determines convergence
+ *  @param correction_threshold                 the threshold used in solving the (approximated) residue correction equation
+ *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
+ *  @param inclusion_threshold                  the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+ *  @param correction                           the scheme that is used to calculate the correction vectors
+ *  @param preconditioner_block_dimension       the number of basis vectors (with the lowest diagonal elements) whose block of the matrix is used exactly in the preconditioner: zero means that only the diagonal is used
+ *  @param thick_restart                        if the previous guesses for the eigenvectors should be kept in the subspace upon a collapse (a thick restart), rather than only the current guesses
+ * 
+ *  @return an iterative algorithm that can find the lowest n eigenvectors of a matrix using a block Davidson algorithm, i.e. one in which the matrix-vector products of all new subspace vectors are calculated in one block (through the environment's block matrix-vector product function)
+ */
+IterativeAlgorithm<EigenproblemEnvironment> BlockDavidson(const size_t number_of_requested_eigenpairs = 1, const size_t maximum_subspace_dimension = 15, const double convergence_threshold = 1.0e-08, double correction_threshold = 1.0e-12, const size_t maximum_number_of_iterations = 128, const double inclusion_threshold = 1.0e-03, const DavidsonCorrection correction = DavidsonCorrection::k_diagonal, const size_t preconditioner_block_dimension = 0, const bool thick_restart = false) {
+
+    // Create the iteration cycle that effectively 'defines' our block Davidson solver. It only differs from the regular Davidson solver in the way the matrix-vector products are calculated: all the correction vectors that are added to the subspace in one iteration form one block.
+    StepCollection<EigenproblemEnvironment> davidson_cycle {};
+
+    davidson_cycle
+        .add(BlockMatrixVectorProductCalculation())
+        .add(SubspaceMatrixCalculation())
+        .add(SubspaceMatrixDiagonalization(number_of_requested_eigenpairs))
+        .add(GuessVectorUpdate())
+        .add(ResidualVectorCalculation(number_of_requested_eigenpairs))
+        .add(CorrectionVectorCalculation(number_of_requested_eigenpairs, correction_threshold, correction, preconditioner_block_dimension))  // this solves the residual equations
+        .add(SubspaceUpdate(maximum_subspace_dimension, inclusion_threshold, thick_restart));
 
     // Create a convergence criterion on the norm of the residual vectors
     const ResidualVectorConvergence<EigenproblemEnvironment> convergence_criterion {convergence_threshold};
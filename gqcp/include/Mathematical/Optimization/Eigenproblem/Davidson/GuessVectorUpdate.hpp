@@ -51,8 +51,18 @@ public:
      */
     void execute(EigenproblemEnvironment& environment) override {
 
-        // X contains the new guesses for the eigenvectors, V is the subspace and Z are the eigenvectors of the subspace matrix
-        environment.X = environment.V * environment.Z;  // X is a linear combination of the current subspace vectors
+        // X contains the new guesses for the eigenvectors, V is the subspace and Z are the eigenvectors of the subspace matrix.
+        // X is a linear combination of the current subspace vectors: we stream over blocks of rows of V, so that only one block of rows of the subspace storage has to be resident in memory at the same time.
+        const auto V = environment.activeV();
+        const auto& Z = environment.Z;
+        const size_t dim = environment.dimension;
+        const size_t block_size = environment.row_block_size;
+
+        environment.X.resize(dim, Z.cols());
+        for (size_t row_index = 0; row_index < dim; row_index += block_size) {
+            const size_t rows = std::min(block_size, dim - row_index);
+            environment.X.middleRows(row_index, rows).noalias() = V.middleRows(row_index, rows) * Z;
+        }
         environment.eigenvectors = environment.X;
     }
 };
@@ -53,39 +53,33 @@ public:
      */
     void execute(EigenproblemEnvironment& environment) override {
 
-        const auto& V = environment.V;  // the subspace of guess vectors
+        const auto V = environment.activeV();  // the (active) subspace of guess vectors
 
         assert((V.transpose() * V).isApprox(MatrixX<double>::Identity(V.cols(), V.cols()), 1.0e-08));  // make sure that the subspace vectors are orthonormal
 
 
-        auto& VA = environment.VA;  // VA = A * V (implicitly calculated through the matrix-vector product)
         const auto& matvec = environment.matrix_vector_product_function;
 
-        // Check how many vectors there currently are in V and in VA: only calculate the expensive matrix-vector product for 'new' vectors.
+        // Check how many vectors there currently are in V and how many matrix-vector products have already been calculated: only calculate the expensive matrix-vector product for 'new' vectors.
         // If there is no difference, no matrix-vector products should be calculated.
-        // If V is larger than VA:
-        //      - VA should be expanded
-        //      - we should calculate the matrix-vector products for the new vectors and place them into the columns of the new VA
-        // If V is smaller than VA, which can only happen after a subspace collapse:
-        //      - VA should shrink
-        //      - we should calculate the matrix-vector products for all the vectors in the collapsed subspace
-        const auto vectors_in_V = V.cols();
-        const auto vectors_in_VA = VA.cols();
-        const auto difference = vectors_in_V - vectors_in_VA;
-
-        if (difference != 0) {
-            VA.conservativeResize(Eigen::NoChange, VA.cols() + difference);  // accounts for both expansion and shrinking
-
-            // Calculate the only the necessary matrix-vector products; find the start_index that accounts for both expansion and shrinking
-            size_t start_index = 0;
-            if ((difference > 0) && (vectors_in_VA > 0)) {
-                start_index = vectors_in_VA - 1;  // -1 because of computers
-            }
-
-            for (size_t column_index = start_index; column_index < vectors_in_V; column_index++) {
-                VA.col(column_index) = matvec(V.col(column_index));
-            }
+        // If there are more active vectors in V than in VA, we should calculate the matrix-vector products for the new vectors and place them into the (preallocated) columns of VA.
+        // If there are less active vectors in V than in VA, which can only happen if the environment's subspace was modified from the outside, we should recalculate the matrix-vector products for all the vectors in the subspace.
+        const auto vectors_in_V = environment.subspace_dimension;
+        const auto vectors_in_VA = environment.number_of_subspace_products;
+
+        if (vectors_in_V == vectors_in_VA) {
+            return;
+        }
+
+        environment.reserveSubspace(vectors_in_V);  // only reallocates the first time matrix-vector products are calculated
+        const size_t start_index = (vectors_in_V > vectors_in_VA) ? vectors_in_VA : 0;
+
+        auto VA = environment.subspaceProductStorage();  // the storage for VA = A * V (implicitly calculated through the matrix-vector product)
+        for (size_t column_index = start_index; column_index < vectors_in_V; column_index++) {
+            VA.col(column_index) = matvec(V.col(column_index));
         }
+        environment.number_of_subspace_products = vectors_in_V;
+        environment.number_of_matrix_vector_products += vectors_in_V - start_index;
     }
 };
 
@@ -68,15 +68,23 @@ public:
 
         const auto dim = environment.dimension;
 
-        const auto& VA = environment.VA;          // VA = A * V (implicitly calculated through the matrix-vector product)
+        const auto VA = environment.activeVA();   // VA = A * V (implicitly calculated through the matrix-vector product)
         const auto& Z = environment.Z;            // the (requested number of) eigenvectors of the subspace matrix S
         const auto& Lambda = environment.Lambda;  // the (requested number of) eigenvalues of the subspace matrix S
         const auto& X = environment.X;            // contains the new guesses for the eigenvectors (as a linear combination of the current subspace V)
 
-        // Calculate the residual vectors: r_i = VA * z_i - Lambda * x_i
-        environment.R = MatrixX<double>::Zero(dim, this->number_of_requested_eigenpairs);
-        for (size_t column_index = 0; column_index < this->number_of_requested_eigenpairs; column_index++) {
-            environment.R.col(column_index) = VA * Z.col(column_index) - Lambda(column_index) * X.col(column_index);
+        // Calculate the residual vectors: r_i = VA * z_i - Lambda * x_i, using one matrix-matrix product for all the residual vectors at once.
+        // We stream over blocks of rows of VA, so that only one block of rows of the subspace storage has to be resident in memory at the same time.
+        const size_t n = this->number_of_requested_eigenpairs;
+        const size_t block_size = environment.row_block_size;
+
+        environment.R.resize(dim, n);
+        for (size_t row_index = 0; row_index < dim; row_index += block_size) {
+            const size_t rows = std::min(block_size, dim - row_index);
+
+            auto R_block = environment.R.middleRows(row_index, rows);
+            R_block.noalias() = VA.middleRows(row_index, rows) * Z.leftCols(n);
+            R_block.noalias() -= X.block(row_index, 0, rows, n) * Lambda.head(n).asDiagonal();
         }
     }
 };
@@ -53,10 +53,21 @@ public:
      */
     void execute(EigenproblemEnvironment& environment) override {
 
-        const auto& V = environment.V;    // the subspace of guess vectors
-        const auto& VA = environment.VA;  // VA = A * V (implicitly calculated through the matrix-vector product)
+        const auto V = environment.activeV();    // the (active) subspace of guess vectors
+        const auto VA = environment.activeVA();  // VA = A * V (implicitly calculated through the matrix-vector product)
 
-        environment.S = V.transpose() * VA;  // the "subspace matrix": the projection of the matrix A onto the subspace spanned by the vectors in V
+        // Calculate the "subspace matrix", i.e. the projection of the matrix A onto the subspace spanned by the vectors in V.
+        // We stream over blocks of rows of V and VA and accumulate their contributions (dot products), so that only one block of rows of the subspace storage has to be resident in memory at the same time. This matters when the subspace is stored out-of-core.
+        const size_t dim = environment.dimension;
+        const size_t block_size = environment.row_block_size;
+
+        MatrixX<double> S = MatrixX<double>::Zero(V.cols(), VA.cols());
+        for (size_t row_index = 0; row_index < dim; row_index += block_size) {
+            const size_t rows = std::min(block_size, dim - row_index);
+            S.noalias() += V.middleRows(row_index, rows).transpose() * VA.middleRows(row_index, rows);
+        }
+
+        environment.S = S;
     }
 };
 
@@ -83,6 +83,7 @@ public:
         environment.Lambda = dense_environment.eigenvalues.head(this->number_of_requested_eigenpairs);  // the (requested number of) eigenvalues of the subspace matrix S
         environment.eigenvalues = environment.Lambda;
 
+        environment.previous_Z = environment.Z;  // keep the previous eigenvectors of the subspace matrix, which can be used in a thick restart
         environment.Z = dense_environment.eigenvectors.topLeftCorner(S.cols(), this->number_of_requested_eigenpairs);  // the (requested number of) eigenvectors of the subspace matrix S
     }
 };
@@ -21,6 +21,8 @@
 #include "Mathematical/Algorithm/Step.hpp"
 #include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
 
+#include <algorithm>
+
 
 namespace GQCP {
 
@@ -34,7 +36,8 @@ class SubspaceUpdate:
 
 private:
     size_t maximum_subspace_dimension;
-    double threshold;  // the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+    double threshold;    // the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+    bool thick_restart;  // if the previous guesses for the eigenvectors should be kept in the subspace upon a collapse
 
 
 public:
@@ -45,10 +48,12 @@ public:
     /**
      *  @param maximum_subspace_dimension           the maximum dimension of the subspace before collapsing
      *  @param threshold                            the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+     *  @param thick_restart                        if the previous guesses for the eigenvectors should be kept in the subspace upon a collapse (a thick restart), rather than only the current guesses
      */
-    SubspaceUpdate(const size_t maximum_subspace_dimension = 15, const double threshold = 1.0e-03) :
+    SubspaceUpdate(const size_t maximum_subspace_dimension = 15, const double threshold = 1.0e-03, const bool thick_restart = false) :
         maximum_subspace_dimension {maximum_subspace_dimension},
-        threshold {threshold} {}
+        threshold {threshold},
+        thick_restart {thick_restart} {}
 
 
     /*
@@ -70,27 +75,131 @@ public:
      */
     void execute(EigenproblemEnvironment& environment) override {
 
-        auto& V = environment.V;
         const auto& Delta = environment.Delta;
+        const size_t number_of_correction_vectors = Delta.cols();
 
         // If the subspace will potentially become too large, collapse it in advance.
-        const auto current_subspace_dimension = V.cols();
-        if (current_subspace_dimension + Delta.cols() > this->maximum_subspace_dimension) {
-            V = environment.X;
+        if (environment.subspace_dimension + number_of_correction_vectors > this->maximum_subspace_dimension) {
+            this->collapse(environment);
         }
 
+        // Make sure that the storage can hold all the correction vectors, so that no reallocations are needed when adding them to the subspace. This only reallocates the first time the subspace is updated.
+        environment.reserveSubspace(std::max(this->maximum_subspace_dimension, environment.subspace_dimension + number_of_correction_vectors));
+
+
         // Update the current subspace V with new vectors: add the normalized orthogonal projection of the correction vectors if their norm is large enough.
-        // Note that we can't add more than one vector simultaneously, as the inclusion of one vector changes the subspace, which in turn changes its orthogonal complement.
-        for (size_t column_index = 0; column_index < Delta.cols(); column_index++) {
-            VectorX<double> v = Delta.col(column_index) - V * (V.transpose() * Delta.col(column_index));  // project the correction vector on the orthogonal complement of V
+        // We use a blocked Gram-Schmidt procedure: the whole block of correction vectors is first projected on the orthogonal complement of the current subspace through matrix-matrix products (twice, for numerical stability), after which the correction vectors only have to be orthogonalized among each other.
+        // The correction vectors are written directly into the free columns of the subspace storage.
+        auto V = environment.subspaceStorage();  // the storage for the subspace: only its first 'subspace_dimension' columns are active
+        const size_t m = environment.subspace_dimension;
+        auto V_current = V.leftCols(m);
+        auto V_new = V.middleCols(m, number_of_correction_vectors);
+
+        V_new = Delta;
+        for (size_t pass = 0; pass < 2; pass++) {
+            const MatrixX<double> overlaps = V_current.transpose() * V_new;  // (m x number_of_correction_vectors): small
+            V_new.noalias() -= V_current * overlaps;
+        }
+
+        // Note that we can't accept more than one vector of the block simultaneously, as the inclusion of one vector changes the subspace, which in turn changes its orthogonal complement.
+        size_t number_of_accepted_vectors = 0;
+        for (size_t column_index = 0; column_index < number_of_correction_vectors; column_index++) {
+            const auto V_accepted = V.middleCols(m, number_of_accepted_vectors);
+
+            VectorX<double> v = V.col(m + column_index);
+            v -= V_accepted * (V_accepted.transpose() * v);  // project the correction vector on the orthogonal complement of the vectors that were already accepted in this block
             const double norm = v.norm();
-            v.normalize();
 
             if (norm > this->threshold) {
-                V.conservativeResize(Eigen::NoChange, V.cols() + 1);  // the number of rows doesn't change
-                V.col(V.cols() - 1) = v;                              // add the new vector to the last column
+                V.col(m + number_of_accepted_vectors) = v / norm;  // add the new vector to the first free column
+                number_of_accepted_vectors++;
             }
         }
+
+        environment.subspace_dimension = m + number_of_accepted_vectors;
+    }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Collapse the subspace onto the current guesses for the eigenvectors (and, for a thick restart, the previous guesses for the eigenvectors), in place.
+     * 
+     *  Since the collapsed subspace vectors are linear combinations of the current subspace vectors, their matrix-vector products are the same linear combinations of the current matrix-vector products and don't have to be recalculated.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void collapse(EigenproblemEnvironment& environment) const {
+
+        const size_t m = environment.subspace_dimension;
+        const auto& Z = environment.Z;  // the current guesses for the eigenvectors, expressed in the current subspace
+        const size_t number_of_requested_eigenpairs = Z.cols();
+
+        // Determine the (orthonormal) coefficients Q of the collapsed subspace vectors in terms of the current subspace vectors. Without a thick restart, the collapsed subspace is spanned by the current guesses for the eigenvectors.
+        MatrixX<double> Q = Z;
+
+        // For a thick restart, we also keep the previous guesses for the eigenvectors. Since the subspace has only been expanded since the previous iteration, we can express them in the current subspace by padding them with zeros. We only keep as many of them as there is room for, leaving space for a new block of correction vectors.
+        const auto& previous_Z = environment.previous_Z;
+        if (this->thick_restart && (this->maximum_subspace_dimension > 2 * number_of_requested_eigenpairs) && (previous_Z.cols() > 0) && (previous_Z.rows() <= m)) {
+            const size_t maximum_number_of_kept_vectors = this->maximum_subspace_dimension - 2 * number_of_requested_eigenpairs;
+
+            MatrixX<double> P = MatrixX<double>::Zero(m, previous_Z.cols());
+            P.topRows(previous_Z.rows()) = previous_Z;
+            for (size_t pass = 0; pass < 2; pass++) {
+                P -= Z * (Z.transpose() * P);  // project on the orthogonal complement of the current guesses
+            }
+
+            for (size_t column_index = 0; (column_index < P.cols()) && (Q.cols() < number_of_requested_eigenpairs + maximum_number_of_kept_vectors); column_index++) {
+                VectorX<double> p = P.col(column_index);
+                p -= Q.rightCols(Q.cols() - number_of_requested_eigenpairs) * (Q.rightCols(Q.cols() - number_of_requested_eigenpairs).transpose() * p);
+                const double norm = p.norm();
+
+                if (norm > this->threshold) {
+                    Q.conservativeResize(Eigen::NoChange, Q.cols() + 1);  // Q is small: (m x number of collapsed vectors)
+                    Q.col(Q.cols() - 1) = p / norm;
+                }
+            }
+        }
+        const size_t number_of_collapsed_vectors = Q.cols();
+
+
+        // Calculate V * Q and VA * Q in place. We only collapse VA if it is up-to-date with V.
+        SubspaceUpdate::transformColumnsInPlace(environment.subspaceStorage(), m, Q, environment.row_block_size);
+
+        if (environment.number_of_subspace_products == m) {
+            SubspaceUpdate::transformColumnsInPlace(environment.subspaceProductStorage(), m, Q, environment.row_block_size);
+            environment.number_of_subspace_products = number_of_collapsed_vectors;
+        } else {
+            environment.number_of_subspace_products = 0;
+        }
+
+        environment.subspace_dimension = number_of_collapsed_vectors;
+        environment.Z = Q.transpose() * Z;  // the current guesses for the eigenvectors, expressed in the collapsed subspace
+    }
+
+
+    /**
+     *  Replace the first columns of the given matrix M by M * Q, in place. This happens in blocks of rows: every block of rows of the result only depends on the same block of rows of M, so only a small temporary is needed.
+     * 
+     *  @param M                        the matrix whose first columns should be transformed
+     *  @param number_of_columns        the number of columns of M that are transformed, i.e. the number of rows of Q
+     *  @param Q                        the transformation matrix
+     *  @param block_size               the number of rows that are handled at once
+     */
+    static void transformColumnsInPlace(Eigen::Map<Eigen::MatrixXd> M, const size_t number_of_columns, const MatrixX<double>& Q, const size_t block_size) {
+
+        const size_t dim = M.rows();
+
+        MatrixX<double> M_block_transformed = MatrixX<double>::Zero(std::min(block_size, dim), Q.cols());
+        for (size_t row_index = 0; row_index < dim; row_index += block_size) {
+            const size_t rows = std::min(block_size, dim - row_index);
+
+            M_block_transformed.topRows(rows).noalias() = M.block(row_index, 0, rows, number_of_columns) * Q;
+            M.block(row_index, 0, rows, Q.cols()) = M_block_transformed.topRows(rows);
+        }
     }
 };
 
@@ -20,8 +20,15 @@
 
 #include "Mathematical/Optimization/Eigenproblem/Eigenpair.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/MemoryMappedMatrix.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
 
 namespace GQCP {
 
@@ -31,7 +38,10 @@ namespace GQCP {
  */
 class EigenproblemEnvironment {
 public:
-    VectorFunction<double> matrix_vector_product_function;  // a vector function that returns the matrix-vector product (i.e. the matrix-vector product representation of the matrix)
+    VectorFunction<double> matrix_vector_product_function;                                  // a vector function that returns the matrix-vector product (i.e. the matrix-vector product representation of the matrix)
+    std::function<MatrixX<double>(const MatrixX<double>&)> block_matrix_product_function;   // a function that returns the matrix-vector products for all the columns of the given matrix at once (optional: if it is empty, the matrix-vector product function is used column by column)
+    std::function<SquareMatrix<double>(const std::vector<size_t>&)> matrix_block_function;  // a function that returns the block of the matrix between the basis vectors with the given indices (optional: if it is empty, the block is calculated through matrix-vector products)
+    size_t number_of_matrix_vector_products;                                                // the number of matrix-vector products that have been calculated in this environment
 
     SquareMatrix<double> A;    // the self-adjoint matrix whose eigenvalue problem should be solved
     VectorX<double> diagonal;  // the diagonal of the matrix
@@ -44,13 +54,26 @@ public:
     VectorX<double> Lambda;  // the (requested number of) eigenvalues of the subspace matrix S
     MatrixX<double> Z;       // the (requested number of) eigenvectors of the subspace matrix S
 
-    MatrixX<double> V;   // the subspace of guess vectors in an iterative diagonalization algorithm
-    MatrixX<double> VA;  // VA = A * V (implicitly calculated through the matrix-vector product)
-    MatrixX<double> X;   // contains the new guesses for the eigenvectors (as a linear combination of the current subspace V)
+    MatrixX<double> previous_Z;  // the eigenvectors of the subspace matrix S of the previous iteration, expressed in the current subspace (used for thick restarts)
+
+    MatrixX<double> V;                   // the storage for the subspace of guess vectors in an iterative diagonalization algorithm: only its first 'subspace_dimension' columns are active
+    MatrixX<double> VA;                  // the storage for VA = A * V (implicitly calculated through the matrix-vector product): only its first 'number_of_subspace_products' columns are active
+    size_t subspace_dimension;           // the number of active columns in V, i.e. the current dimension of the subspace
+    size_t number_of_subspace_products;  // the number of active columns in VA, i.e. the number of subspace vectors whose matrix-vector product has already been calculated
+    size_t row_block_size;               // the number of rows that are handled at once when streaming over the subspace storage
+
+    std::shared_ptr<MemoryMappedMatrix> out_of_core_V;   // the out-of-core storage for V (optional: if it is empty, V itself is used as the storage)
+    std::shared_ptr<MemoryMappedMatrix> out_of_core_VA;  // the out-of-core storage for VA (optional: if it is empty, VA itself is used as the storage)
+
+    MatrixX<double> X;  // contains the new guesses for the eigenvectors (as a linear combination of the current subspace V)
 
     MatrixX<double> R;      // the residual vectors
     MatrixX<double> Delta;  // the correction vectors (solutions to the residual equations)
 
+    std::vector<size_t> preconditioner_indices;   // the indices of the basis vectors (with the lowest diagonal elements) that span the dense block of the preconditioner
+    VectorX<double> preconditioner_eigenvalues;   // the eigenvalues of the dense block of the preconditioner
+    MatrixX<double> preconditioner_eigenvectors;  // the eigenvectors of the dense block of the preconditioner
+
 
 public:
     /*
@@ -61,7 +84,12 @@ public:
      *  @param A                the matrix whose eigenvalue problem should be solved
      */
     EigenproblemEnvironment(const SquareMatrix<double>& A) :
-        A {A} {}
+        number_of_matrix_vector_products {0},
+        A {A},
+        dimension {static_cast<size_t>(A.cols())},
+        subspace_dimension {0},
+        number_of_subspace_products {0},
+        row_block_size {8192} {}
 
     /**
      *  @param matrix_vector_product            a vector function that returns the matrix-vector product (i.e. the matrix-vector product representation of the matrix)
@@ -70,9 +98,13 @@ public:
     EigenproblemEnvironment(const VectorFunction<double>& matrix_vector_product_function, const VectorX<double>& diagonal, const MatrixX<double>& V) :
         dimension {static_cast<size_t>(diagonal.size())},
         matrix_vector_product_function {matrix_vector_product_function},
+        number_of_matrix_vector_products {0},
         diagonal {diagonal},
         V {V},
-        VA {MatrixX<double>::Zero(V.rows(), 0)} {}  // the initial environment should have no columns in VA
+        VA {MatrixX<double>::Zero(V.rows(), 0)},  // the initial environment should have no columns in VA
+        subspace_dimension {static_cast<size_t>(V.cols())},
+        number_of_subspace_products {0},
+        row_block_size {8192} {}
 
 
     /*
@@ -104,7 +136,67 @@ public:
     static EigenproblemEnvironment Iterative(const SquareMatrix<double>& A, const MatrixX<double>& V) {
 
         const auto matrix_vector_product_function = [A](const VectorX<double>& x) { return A * x; };
-        return EigenproblemEnvironment::Iterative(matrix_vector_product_function, A.diagonal(), V);
+
+        auto environment = EigenproblemEnvironment::Iterative(matrix_vector_product_function, A.diagonal(), V);
+        environment.matrix_block_function = [A](const std::vector<size_t>& indices) { return EigenproblemEnvironment::denseMatrixBlock(A, indices); };
+
+        return environment;
+    }
+
+    /**
+     *  @param block_matrix_product_function    a function that returns the matrix-vector products for all the columns of the given matrix at once
+     *  @param diagonal                         the diagonal of the matrix whose eigenvalue problem should be solved
+     *  @param V                                a matrix of initial guess vectors (each column of the matrix is an initial guess vector)
+     * 
+     *  @return an environment that can be used to solve the eigenvalue problem for the matrix that is represented by the given block matrix-vector product, in which several matrix-vector products can be calculated in one pass
+     */
+    static EigenproblemEnvironment BlockIterative(const std::function<MatrixX<double>(const MatrixX<double>&)>& block_matrix_product_function, const VectorX<double>& diagonal, const MatrixX<double>& V) {
+
+        // A single matrix-vector product is just a block matrix-vector product for a block with one column.
+        const auto matrix_vector_product_function = [block_matrix_product_function](const VectorX<double>& x) {
+            const MatrixX<double> X = x;
+            return VectorX<double>(block_matrix_product_function(X).col(0));
+        };
+
+        EigenproblemEnvironment environment {matrix_vector_product_function, diagonal, V};
+        environment.block_matrix_product_function = block_matrix_product_function;
+
+        return environment;
+    }
+
+    /**
+     *  @param A                                the matrix whose eigenvalue problem should be solved
+     *  @param V                                a matrix of initial guess vectors (each column of the matrix is an initial guess vector)
+     * 
+     *  @return an environment that can be used to solve the eigenvalue problem for the given matrix, in which several matrix-vector products are calculated in one pass
+     */
+    static EigenproblemEnvironment BlockIterative(const SquareMatrix<double>& A, const MatrixX<double>& V) {
+
+        const auto block_matrix_product_function = [A](const MatrixX<double>& X) { return MatrixX<double>(A * X); };
+
+        auto environment = EigenproblemEnvironment::BlockIterative(block_matrix_product_function, A.diagonal(), V);
+        environment.matrix_block_function = [A](const std::vector<size_t>& indices) { return EigenproblemEnvironment::denseMatrixBlock(A, indices); };
+
+        return environment;
+    }
+
+    /**
+     *  @param A                                a dense matrix
+     *  @param indices                          the indices of the basis vectors between which the block of the matrix should be read
+     * 
+     *  @return the block of the given matrix between the basis vectors with the given indices
+     */
+    static SquareMatrix<double> denseMatrixBlock(const SquareMatrix<double>& A, const std::vector<size_t>& indices) {
+
+        const auto n = indices.size();
+
+        SquareMatrix<double> block = SquareMatrix<double>::Zero(n);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                block(i, j) = A(indices[i], indices[j]);
+            }
+        }
+        return block;
     }
 
 
@@ -112,6 +204,168 @@ public:
      *  PUBLIC METHODS
      */
 
+    /**
+     *  @return the active columns of V, i.e. the current subspace of guess vectors
+     */
+    Eigen::Map<const Eigen::MatrixXd> activeV() const { return Eigen::Map<const Eigen::MatrixXd>(this->subspaceStorage().data(), this->dimension, this->subspace_dimension); }
+
+    /**
+     *  @return the active columns of VA, i.e. the matrix-vector products that have already been calculated for the current subspace
+     */
+    Eigen::Map<const Eigen::MatrixXd> activeVA() const { return Eigen::Map<const Eigen::MatrixXd>(this->subspaceProductStorage().data(), this->dimension, this->number_of_subspace_products); }
+
+    /**
+     *  @param indices                  the indices of the basis vectors between which the block of the matrix should be calculated
+     * 
+     *  @return the block of the matrix between the basis vectors with the given indices
+     */
+    SquareMatrix<double> matrixBlock(const std::vector<size_t>& indices) {
+
+        // Use a dedicated function if it is available, or read the block from the dense matrix.
+        if (this->matrix_block_function) {
+            return this->matrix_block_function(indices);
+        }
+
+        if (this->A.cols() != 0) {
+            return EigenproblemEnvironment::denseMatrixBlock(this->A, indices);
+        }
+
+        const auto n = indices.size();
+        SquareMatrix<double> block = SquareMatrix<double>::Zero(n);
+
+        // Otherwise, calculate the matrix-vector products of the corresponding unit vectors: the product with the j-th unit vector is the j-th column of the matrix.
+        MatrixX<double> E = MatrixX<double>::Zero(this->dimension, n);
+        for (size_t j = 0; j < n; j++) {
+            E(indices[j], j) = 1.0;
+        }
+
+        MatrixX<double> AE = MatrixX<double>::Zero(this->dimension, n);
+        if (this->block_matrix_product_function) {
+            AE = this->block_matrix_product_function(E);
+        } else {
+            for (size_t j = 0; j < n; j++) {
+                AE.col(j) = this->matrix_vector_product_function(E.col(j));
+            }
+        }
+        this->number_of_matrix_vector_products += n;
+
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                block(i, j) = AE(indices[i], j);
+            }
+        }
+        return block;
+    }
+
+    /**
+     *  @return if the subspace (V and VA) is stored out-of-core, i.e. in memory-mapped files
+     */
+    bool isSubspaceOutOfCore() const { return static_cast<bool>(this->out_of_core_V); }
+
+    /**
+     *  Move the subspace (V and VA) to out-of-core storage: from now on, the subspace is stored in memory-mapped files in the given scratch directory, so that it doesn't have to fit in the physical memory. The active columns are kept.
+     * 
+     *  @param scratch_directory        the directory in which the (anonymous) backing files should be created
+     */
+    void storeSubspaceOutOfCore(const std::string& scratch_directory) {
+
+        if (this->isSubspaceOutOfCore()) {
+            return;
+        }
+
+        this->out_of_core_V = std::make_shared<MemoryMappedMatrix>(scratch_directory, this->dimension, this->V.cols());
+        this->out_of_core_VA = std::make_shared<MemoryMappedMatrix>(scratch_directory, this->dimension, this->VA.cols());
+
+        this->out_of_core_V->matrix().leftCols(this->subspace_dimension) = this->V.leftCols(this->subspace_dimension);
+        this->out_of_core_VA->matrix().leftCols(this->number_of_subspace_products) = this->VA.leftCols(this->number_of_subspace_products);
+
+        // Release the in-core storage.
+        this->V = MatrixX<double>::Zero(this->dimension, 0);
+        this->VA = MatrixX<double>::Zero(this->dimension, 0);
+    }
+
+    /**
+     *  @return the number of columns that the subspace storage can hold without having to be reallocated
+     */
+    size_t subspaceCapacity() const { return static_cast<size_t>(std::min(this->subspaceStorage().cols(), this->subspaceProductStorage().cols())); }
+
+    /**
+     *  @return a read-only view on the storage for the subspace of guess vectors V (including its inactive columns)
+     */
+    Eigen::Map<const Eigen::MatrixXd> subspaceStorage() const {
+
+        if (this->isSubspaceOutOfCore()) {
+            return static_cast<const MemoryMappedMatrix&>(*this->out_of_core_V).matrix();
+        }
+
+        return Eigen::Map<const Eigen::MatrixXd>(this->V.data(), this->V.rows(), this->V.cols());
+    }
+
+    /**
+     *  @return a writable view on the storage for the subspace of guess vectors V (including its inactive columns)
+     */
+    Eigen::Map<Eigen::MatrixXd> subspaceStorage() {
+
+        if (this->isSubspaceOutOfCore()) {
+            return this->out_of_core_V->matrix();
+        }
+
+        return Eigen::Map<Eigen::MatrixXd>(this->V.data(), this->V.rows(), this->V.cols());
+    }
+
+    /**
+     *  @return a read-only view on the storage for the matrix-vector products VA (including its inactive columns)
+     */
+    Eigen::Map<const Eigen::MatrixXd> subspaceProductStorage() const {
+
+        if (this->isSubspaceOutOfCore()) {
+            return static_cast<const MemoryMappedMatrix&>(*this->out_of_core_VA).matrix();
+        }
+
+        return Eigen::Map<const Eigen::MatrixXd>(this->VA.data(), this->VA.rows(), this->VA.cols());
+    }
+
+    /**
+     *  @return a writable view on the storage for the matrix-vector products VA (including its inactive columns)
+     */
+    Eigen::Map<Eigen::MatrixXd> subspaceProductStorage() {
+
+        if (this->isSubspaceOutOfCore()) {
+            return this->out_of_core_VA->matrix();
+        }
+
+        return Eigen::Map<Eigen::MatrixXd>(this->VA.data(), this->VA.rows(), this->VA.cols());
+    }
+
+    /**
+     *  Make sure that both V and VA can hold the given number of columns, so that the subspace can grow without any reallocations. The active columns are left untouched.
+     * 
+     *  @param capacity                 the number of columns that V and VA should be able to hold
+     */
+    void reserveSubspace(const size_t capacity) {
+
+        if (this->isSubspaceOutOfCore()) {
+            if (this->out_of_core_V->cols() < capacity) {
+                this->out_of_core_V->conservativeResize(capacity);
+            }
+
+            if (this->out_of_core_VA->cols() < capacity) {
+                this->out_of_core_VA->conservativeResize(capacity);
+            }
+
+            return;
+        }
+
+        if (static_cast<size_t>(this->V.cols()) < capacity) {
+            this->V.conservativeResize(this->dimension, capacity);
+        }
+
+        if (static_cast<size_t>(this->VA.cols()) < capacity) {
+            this->VA.conservativeResize(this->dimension, capacity);
+        }
+    }
+
+
     /**
      *  @param number_of_requested_eigenpairs               the number of eigenpairs you would like to retrieve
      * 
@@ -0,0 +1,168 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+
+#include <Eigen/Dense>
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+
+namespace GQCP {
+
+
+/**
+ *  An orthogonalizer X of a (positive semi-definite) overlap matrix S, i.e. X^dagger S X = 1, which reduces the generalized eigenvalue problem F C = S C e to the standard eigenvalue problem (X^dagger F X) C' = C' e, with C = X C'.
+ *
+ *  The eigenvalues of the overlap matrix that lie below a threshold correspond to (near-)linear dependencies in the basis. If there are none, X is the symmetric (Löwdin) orthogonalizer S^{-1/2}. Otherwise, X is the canonical orthogonalizer U s^{-1/2} that only keeps the eigenvectors U of the overlap matrix with eigenvalues s above the threshold.
+ *
+ *  Since the overlap matrix is only decomposed once, an orthogonalizer should be reused for all eigenvalue problems with the same overlap matrix, e.g. in every iteration of an SCF algorithm.
+ *
+ *  @tparam _Scalar         The scalar type of the matrix elements: real or complex.
+ */
+template <typename _Scalar>
+class Orthogonalizer {
+public:
+    // The scalar type of the matrix elements: real or complex.
+    using Scalar = _Scalar;
+
+
+private:
+    // The orthogonalizer, whose columns span the linearly independent part of the basis.
+    MatrixX<Scalar> X;
+
+    // The eigenvectors of the overlap matrix whose eigenvalues lie below the threshold, i.e. the directions that are discarded.
+    MatrixX<Scalar> U_discarded;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param S                The overlap matrix.
+     *  @param threshold        The threshold below which an eigenvalue of the overlap matrix signals a linear dependency.
+     */
+    Orthogonalizer(const SquareMatrix<Scalar>& S, const double threshold = 1.0e-07) {
+
+        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+        const Eigen::SelfAdjointEigenSolver<MatrixType> eigensolver {S};
+        const auto& s = eigensolver.eigenvalues();  // In ascending order.
+        const auto& U = eigensolver.eigenvectors();
+
+        const auto dim = S.dimension();
+        size_t number_of_discarded = 0;
+        while ((number_of_discarded < dim) && (s(number_of_discarded) < threshold)) {
+            number_of_discarded++;
+        }
+
+        if ((dim > 0) && (number_of_discarded == dim)) {
+            throw std::invalid_argument("Orthogonalizer(const SquareMatrix<Scalar>&, const double): All eigenvalues of the overlap matrix lie below the threshold.");
+        }
+
+        const auto number_of_kept = dim - number_of_discarded;
+        const VectorX<double> s_inverse_sqrt = s.tail(number_of_kept).cwiseSqrt().cwiseInverse();
+        const MatrixX<Scalar> U_kept = U.rightCols(number_of_kept);
+
+        if (number_of_discarded == 0) {
+            this->X = U_kept * s_inverse_sqrt.template cast<Scalar>().asDiagonal() * U_kept.adjoint();
+        } else {
+            this->X = U_kept * s_inverse_sqrt.template cast<Scalar>().asDiagonal();
+        }
+        this->U_discarded = U.leftCols(number_of_discarded);
+    }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The orthogonalizer X, as a (dimension x number of linearly independent functions)-matrix.
+     */
+    const MatrixX<Scalar>& matrix() const { return this->X; }
+
+    /**
+     *  @return The number of basis functions that are discarded because of linear dependencies.
+     */
+    size_t numberOfDiscardedFunctions() const { return this->U_discarded.cols(); }
+
+    /**
+     *  @return The number of linearly independent functions that the orthogonalizer keeps.
+     */
+    size_t numberOfLinearlyIndependentFunctions() const { return this->X.cols(); }
+
+
+    /*
+     *  MARK: Eigenvalue problems
+     */
+
+    /**
+     *  Solve the generalized eigenvalue problem F C = S C e, for the overlap matrix S of this orthogonalizer.
+     *
+     *  @param F                The self-adjoint matrix, e.g. a Fock matrix.
+     *
+     *  @return A (dimension x number of linearly independent functions)-matrix whose columns are the eigenvectors C, and the corresponding eigenvalues e, in ascending order. The eigenvectors only span the linearly independent part of the basis, so the matrix is only square if no functions are discarded, see `completed()`.
+     */
+    std::pair<MatrixX<Scalar>, VectorX<double>> solve(const SquareMatrix<Scalar>& F) const {
+
+        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+
+        // Solve the standard eigenvalue problem in the orthogonalized basis, and transform the eigenvectors back.
+        const MatrixType F_orthogonal = this->X.adjoint() * F * this->X;
+        const Eigen::SelfAdjointEigenSolver<MatrixType> eigensolver {F_orthogonal};
+
+        const MatrixX<Scalar> C = this->X * eigensolver.eigenvectors();
+        const VectorX<double> eigenvalues = eigensolver.eigenvalues();
+
+        return {C, eigenvalues};
+    }
+
+
+    /**
+     *  Complete the eigenvectors of `solve()` to a square, invertible matrix, by appending the discarded directions, i.e. the eigenvectors of the overlap matrix whose eigenvalues lie below the threshold.
+     *
+     *  The discarded directions are orthogonal to the given eigenvectors with respect to the overlap metric, but they are not normalized in it. They should therefore never be occupied: they only keep a coefficient matrix square, e.g. to be stored as a transformation.
+     *
+     *  @param C                A (dimension x number of linearly independent functions)-matrix whose columns are eigenvectors returned by `solve()`.
+     *
+     *  @return The square matrix whose leading columns are the given eigenvectors, followed by the discarded directions.
+     */
+    SquareMatrix<Scalar> completed(const MatrixX<Scalar>& C) const {
+
+        if (static_cast<size_t>(C.cols()) != this->numberOfLinearlyIndependentFunctions()) {
+            throw std::invalid_argument("Orthogonalizer::completed(const MatrixX<Scalar>&): The given matrix does not have a column for every linearly independent function.");
+        }
+
+        const auto dim = C.rows();
+        SquareMatrix<Scalar> C_completed = SquareMatrix<Scalar>::Zero(dim);
+        C_completed.leftCols(C.cols()) = C;
+        C_completed.rightCols(this->numberOfDiscardedFunctions()) = this->U_discarded;
+
+        return C_completed;
+    }
+};
+
+
+}  // namespace GQCP
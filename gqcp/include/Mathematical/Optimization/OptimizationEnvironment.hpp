@@ -18,7 +18,7 @@
 #pragma once
 
 
-#include <deque>
+#include "Mathematical/Algorithm/History.hpp"
 
 
 namespace GQCP {
@@ -37,7 +37,7 @@ public:
 
 
 public:
-    std::deque<_Iterate> variables;  // a collection of variables that iteratively grows through an optimization algorithm; for example all iterates x when solving f(x) = 0 iteratively
+    History<_Iterate> variables;  // a collection of variables that iteratively grows through an optimization algorithm; for example all iterates x when solving f(x) = 0 iteratively
 
 
 public:
@@ -50,8 +50,9 @@ public:
      * 
      *  @param initial_guess                the initial guess for the variables
      */
-    OptimizationEnvironment(const Iterate& initial_guess) :
-        variables {initial_guess} {}
+    OptimizationEnvironment(const Iterate& initial_guess) {
+        this->variables.push_back(initial_guess);
+    }
 };
 
 
@@ -279,6 +279,11 @@ public:
      */
     const Tensor<Scalar, 4>& asTensor() const { return this->T; }
 
+    /**
+     *  @return this as a writable tensor, whose dimensions should not be changed
+     */
+    Tensor<Scalar, 4>& asTensor() { return this->T; }
+
     /**
      *  Convert an implicit axis index to the axis index in the dense representation of this slice.
      * 
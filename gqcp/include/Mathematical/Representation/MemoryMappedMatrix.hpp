@@ -0,0 +1,109 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <Eigen/Dense>
+
+#include <string>
+
+
+namespace GQCP {
+
+
+/**
+ *  A column-major matrix of doubles whose elements are stored in a memory-mapped file, rather than in RAM. It can be used to store matrices that are (much) larger than the physical memory: the operating system only keeps the recently accessed pages in memory.
+ * 
+ *  The backing file is created in a scratch directory and is removed from the file system immediately, so that no files are left behind, even if the program terminates abnormally.
+ */
+class MemoryMappedMatrix {
+private:
+    std::string scratch_directory;  // the directory in which the backing file was created
+
+    int file_descriptor;  // the file descriptor of the backing file
+    double* data;         // the start of the memory-mapped region
+
+    size_t number_of_rows;
+    size_t number_of_columns;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  Create a memory-mapped matrix with zero-initialized elements.
+     * 
+     *  @param scratch_directory            the directory in which the backing file should be created
+     *  @param rows                         the number of rows of the matrix
+     *  @param cols                         the number of columns of the matrix
+     */
+    MemoryMappedMatrix(const std::string& scratch_directory, const size_t rows, const size_t cols);
+
+    // A memory-mapped matrix owns its backing file, so it can't be copied.
+    MemoryMappedMatrix(const MemoryMappedMatrix&) = delete;
+    MemoryMappedMatrix& operator=(const MemoryMappedMatrix&) = delete;
+
+
+    /*
+     *  DESTRUCTOR
+     */
+
+    ~MemoryMappedMatrix();
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  @return the number of columns of this matrix
+     */
+    size_t cols() const { return this->number_of_columns; }
+
+    /**
+     *  Conservatively resize the number of columns of this matrix: the elements in the columns that are kept are unchanged, while the elements of new columns are zero.
+     * 
+     *  @param cols                         the new number of columns
+     */
+    void conservativeResize(const size_t cols);
+
+    /**
+     *  @return a read-write Eigen view on the memory-mapped elements
+     */
+    Eigen::Map<Eigen::MatrixXd> matrix() { return Eigen::Map<Eigen::MatrixXd>(this->data, this->number_of_rows, this->number_of_columns); }
+
+    /**
+     *  @return a read-only Eigen view on the memory-mapped elements
+     */
+    Eigen::Map<const Eigen::MatrixXd> matrix() const { return Eigen::Map<const Eigen::MatrixXd>(this->data, this->number_of_rows, this->number_of_columns); }
+
+    /**
+     *  @return the number of rows of this matrix
+     */
+    size_t rows() const { return this->number_of_rows; }
+
+    /**
+     *  @return the directory in which the backing file was created
+     */
+    const std::string& scratchDirectory() const { return this->scratch_directory; }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,347 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/SquareRankFourTensor.hpp"
+#include "Utilities/miscellaneous.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A rank-4 tensor that only stores the unique elements of a tensor with the 8-fold permutational symmetry of real two-electron integrals (in chemist's notation):
+ *      g(i,j,k,l) = g(j,i,k,l) = g(i,j,l,k) = g(j,i,l,k) = g(k,l,i,j) = g(l,k,i,j) = g(k,l,j,i) = g(l,k,j,i).
+ *
+ *  Every pair of indices (i,j) is mapped onto a compound pair index ij = i (i + 1) / 2 + j (for i >= j), and every pair of pair indices (ij, kl) onto the compound index ij (ij + 1) / 2 + kl (for ij >= kl). For a dimension K, only (K (K + 1) / 2) (K (K + 1) / 2 + 1) / 2, i.e. approximately K^4 / 8, elements are stored.
+ *
+ *  The elements that belong to the same pair index ij (with kl <= ij) are stored contiguously, so that they can be visited as one block, see `pairBlock()`.
+ *
+ *  @tparam _Scalar      the scalar type, which should be real
+ */
+template <typename _Scalar>
+class PackedRankFourTensor {
+public:
+    using Scalar = _Scalar;
+
+    using Self = PackedRankFourTensor<Scalar>;
+
+
+private:
+    size_t dim;  // the dimension of each of the tensor's axes
+
+    std::vector<Scalar> elements;  // the unique elements, stored by their compound index
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  Default constructor
+     */
+    PackedRankFourTensor() :
+        PackedRankFourTensor(0) {}
+
+
+    /**
+     *  Construct a zero-initialized packed rank-4 tensor given a dimension
+     *
+     *  @param dim      the dimension of each of the tensor's axes
+     */
+    explicit PackedRankFourTensor(const size_t dim) :
+        dim {dim},
+        elements(Self::numberOfUniqueElements(dim), Scalar {0}) {}
+
+
+    /*
+     *  NAMED CONSTRUCTORS
+     */
+
+    /**
+     *  Pack a (square) rank-4 tensor that has the 8-fold permutational symmetry of real two-electron integrals. Only the elements with i >= j, k >= l and ij >= kl are read.
+     *
+     *  @param tensor       the rank-4 tensor
+     *
+     *  @return the packed representation of the given tensor
+     */
+    static Self FromDense(const Tensor<Scalar, 4>& tensor) {
+
+        const auto dims = tensor.dimensions();
+        if ((dims[0] != dims[1]) || (dims[1] != dims[2]) || (dims[2] != dims[3])) {
+            throw std::invalid_argument("PackedRankFourTensor::FromDense(const Tensor<Scalar, 4>&): The given tensor should have equal dimensions in every rank.");
+        }
+
+        Self result {static_cast<size_t>(dims[0])};
+        result.forEach([&tensor](const size_t i, const size_t j, const size_t k, const size_t l, Scalar& value) {
+            value = tensor(i, j, k, l);
+        });
+
+        return result;
+    }
+
+
+    /**
+     *  Read the two-electron integrals of an FCIDUMP file. The one-electron integrals and the internuclear repulsion energy are skipped.
+     *
+     *  @param fcidump_filename         the name of the FCIDUMP file
+     *
+     *  @return the packed two-electron integrals that are contained in the FCIDUMP file
+     *
+     *  @note Every line of an FCIDUMP file contains one unique two-electron integral (in chemist's notation), so no symmetric copies have to be made.
+     */
+    static Self FromFCIDUMP(const std::string& fcidump_filename) {
+
+        Self g;
+        parseFCIDUMP(
+            fcidump_filename,
+            [&g](const size_t K) { g = Self {K}; },
+            [&g](const double x, const size_t i, const size_t a, const size_t j, const size_t b) {
+                // Only the lines with four non-zero indices contain two-electron integrals.
+                if ((i > 0) && (a > 0) && (j > 0) && (b > 0)) {
+                    g(i - 1, a - 1, j - 1, b - 1) = x;
+                }
+            });
+
+        return g;
+    }
+
+
+    /**
+     *  Create a random packed rank-4 tensor, with values uniformly distributed between [-1,1].
+     *
+     *  @param dim          the dimension of each of the tensor's axes
+     *
+     *  @return a random packed rank-4 tensor
+     */
+    static Self Random(const size_t dim) {
+
+        Self result {dim};
+        for (auto& element : result.elements) {
+            element = 2 * (static_cast<Scalar>(std::rand()) / RAND_MAX) - 1;  // Scale from [0, 1] -> [0, 2] -> [-1, 1].
+        }
+
+        return result;
+    }
+
+
+    /*
+     *  STATIC PUBLIC METHODS
+     */
+
+    /**
+     *  @param dim          the dimension of each of the tensor's axes
+     *
+     *  @return the number of elements that a packed rank-4 tensor with the given dimension stores
+     */
+    static size_t numberOfUniqueElements(const size_t dim) {
+
+        const auto number_of_pairs = dim * (dim + 1) / 2;
+        return number_of_pairs * (number_of_pairs + 1) / 2;
+    }
+
+
+    /**
+     *  @param i            the first index
+     *  @param j            the second index
+     *
+     *  @return the compound index of the (unordered) pair (i,j)
+     */
+    static size_t pairIndex(const size_t i, const size_t j) { return (i >= j) ? i * (i + 1) / 2 + j : j * (j + 1) / 2 + i; }
+
+
+    /**
+     *  @param i            the first index
+     *  @param j            the second index
+     *  @param k            the third index
+     *  @param l            the fourth index
+     *
+     *  @return the position of the element g(i,j,k,l) in the packed storage
+     */
+    static size_t compoundIndex(const size_t i, const size_t j, const size_t k, const size_t l) {
+
+        const auto ij = Self::pairIndex(i, j);
+        const auto kl = Self::pairIndex(k, l);
+        return (ij >= kl) ? ij * (ij + 1) / 2 + kl : kl * (kl + 1) / 2 + ij;
+    }
+
+
+    /*
+     *  OPERATORS
+     */
+
+    /**
+     *  @param i            the first index
+     *  @param j            the second index
+     *  @param k            the third index
+     *  @param l            the fourth index
+     *
+     *  @return a read-only reference to the element g(i,j,k,l)
+     */
+    const Scalar& operator()(const size_t i, const size_t j, const size_t k, const size_t l) const { return this->elements[Self::compoundIndex(i, j, k, l)]; }
+
+    /**
+     *  @param i            the first index
+     *  @param j            the second index
+     *  @param k            the third index
+     *  @param l            the fourth index
+     *
+     *  @return a writable reference to the element g(i,j,k,l), which is shared with all its symmetric copies
+     */
+    Scalar& operator()(const size_t i, const size_t j, const size_t k, const size_t l) { return this->elements[Self::compoundIndex(i, j, k, l)]; }
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  @return a read-only pointer to the packed elements
+     */
+    const Scalar* data() const { return this->elements.data(); }
+
+    /**
+     *  @return a writable pointer to the packed elements
+     */
+    Scalar* data() { return this->elements.data(); }
+
+    /**
+     *  @return the dimension of each of the tensor's axes
+     */
+    size_t dimension() const { return this->dim; }
+
+
+    /**
+     *  Call the given function for every unique element g(i,j,k,l), i.e. with i >= j, k >= l and ij >= kl, in the order in which they are stored.
+     *
+     *  @param function         a callable that is called as function(i, j, k, l, value)
+     */
+    template <typename Function>
+    void forEach(const Function& function) const {
+
+        size_t index = 0;
+        for (size_t i = 0; i < this->dim; i++) {
+            for (size_t j = 0; j <= i; j++) {
+                for (size_t k = 0; k <= i; k++) {
+                    const auto l_max = (k == i) ? j : k;  // makes sure that ij >= kl
+                    for (size_t l = 0; l <= l_max; l++) {
+                        function(i, j, k, l, this->elements[index]);
+                        index++;
+                    }
+                }
+            }
+        }
+    }
+
+
+    /**
+     *  Call the given function for every unique element g(i,j,k,l), i.e. with i >= j, k >= l and ij >= kl, in the order in which they are stored.
+     *
+     *  @param function         a callable that is called as function(i, j, k, l, value), in which value is a writable reference
+     */
+    template <typename Function>
+    void forEach(const Function& function) {
+
+        size_t index = 0;
+        for (size_t i = 0; i < this->dim; i++) {
+            for (size_t j = 0; j <= i; j++) {
+                for (size_t k = 0; k <= i; k++) {
+                    const auto l_max = (k == i) ? j : k;  // makes sure that ij >= kl
+                    for (size_t l = 0; l <= l_max; l++) {
+                        function(i, j, k, l, this->elements[index]);
+                        index++;
+                    }
+                }
+            }
+        }
+    }
+
+
+    /**
+     *  @param other        the other packed tensor
+     *  @param tolerance    the tolerance for element-wise comparison
+     *
+     *  @return if this is approximately equal to the other
+     */
+    bool isApprox(const Self& other, const double tolerance = 1.0e-12) const {
+
+        if (this->dim != other.dim) {
+            throw std::invalid_argument("PackedRankFourTensor::isApprox(const Self&, double): the tensors have different dimensions");
+        }
+
+        for (size_t index = 0; index < this->elements.size(); index++) {
+            if (std::abs(this->elements[index] - other.elements[index]) > tolerance) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+
+    /**
+     *  @return the number of bytes that are occupied by the packed elements
+     */
+    size_t memoryFootprint() const { return this->elements.capacity() * sizeof(Scalar); }
+
+
+    /**
+     *  @return the number of elements that are stored
+     */
+    size_t numberOfElements() const { return this->elements.size(); }
+
+
+    /**
+     *  @param ij           a compound pair index
+     *
+     *  @return a read-only pointer to the first of the (ij + 1) contiguously stored elements g(ij, kl) with kl = 0, 1, ..., ij
+     */
+    const Scalar* pairBlock(const size_t ij) const { return this->elements.data() + ij * (ij + 1) / 2; }
+
+
+    /**
+     *  @return the full (unpacked) representation of this tensor
+     */
+    SquareRankFourTensor<Scalar> unpacked() const {
+
+        auto result = SquareRankFourTensor<Scalar>::Zero(this->dim);
+        this->forEach([&result](const size_t i, const size_t j, const size_t k, const size_t l, const Scalar& value) {
+            result(i, j, k, l) = value;
+            result(j, i, k, l) = value;
+            result(i, j, l, k) = value;
+            result(j, i, l, k) = value;
+            result(k, l, i, j) = value;
+            result(l, k, i, j) = value;
+            result(k, l, j, i) = value;
+            result(l, k, j, i) = value;
+        });
+
+        return result;
+    }
+};
+
+
+}  // namespace GQCP
@@ -22,6 +22,7 @@
 #include "Mathematical/Representation/Matrix.hpp"
 #include "Utilities/type_traits.hpp"
 
+#include <utility>
 #include <vector>
 
 
@@ -74,6 +75,17 @@ public:
         m_vectorizer {vectorizer} {}
 
 
+    /**
+     *  Create an array by taking over the given elements, so that they don't have to be copied.
+     * 
+     *  @param elements         The one-dimensional representation of the elements of the array.
+     *  @param vectorizer       The vectorizer that relates multiple tuple coordinates to a one-dimensional index.
+     */
+    StorageArray(std::vector<Element>&& elements, const Vectorizer& vectorizer) :
+        m_elements {std::move(elements)},
+        m_vectorizer {vectorizer} {}
+
+
     /**
      *  Create an array with equal elements.
      * 
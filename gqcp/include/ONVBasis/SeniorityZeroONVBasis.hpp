@@ -105,6 +105,49 @@ public:
      */
     void forEach(const std::function<void(const SpinUnresolvedONV&, const size_t)>& callback) const;
 
+    /**
+     *  Iterate over every pair excitation that couples two seniority-zero ONVs, i.e. that moves the electron pair in spatial orbital p to the unoccupied spatial orbital q, and apply the given function. Only the couplings towards a greater address are visited: the matrix representation of the pair excitations is symmetric.
+     * 
+     *  @param function             A callable that is called as function(I, J, p, q), in which I < J are the addresses of the coupled ONVs.
+     */
+    template <typename Function>
+    void forEachPairExcitation(const Function& function) const {
+
+        // Since alpha == beta, we can use the proxy ONV basis to treat them as one.
+        const auto dim = this->dimension();
+        const auto proxy_onv_basis = this->proxy();
+        auto onv = proxy_onv_basis.constructONVFromAddress(0);  // ONV with address 0.
+        for (size_t I = 0; I < dim; I++) {                      // I loops over all the addresses of the ONV.
+
+            for (size_t e1 = 0; e1 < this->N_P; e1++) {      // E1 (electron 1) loops over the (number of) electrons.
+                const size_t p = onv.occupationIndexOf(e1);  // Retrieve the index of a given electron.
+
+                // Remove the weight from the initial address I, because we annihilate.
+                size_t address = I - proxy_onv_basis.vertexWeight(p, e1 + 1);
+
+                // The e2 iteration counts the number of encountered electrons for the creation operator.
+                // We only consider greater addresses than the initial one (because of symmetry), hence we only count electron after the annihilated electron (e1).
+                size_t e2 = e1 + 1;
+                size_t q = p + 1;
+
+                // Skip the occupied orbitals, updating the address for every electron that is passed.
+                proxy_onv_basis.shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2);
+
+                while (q < this->K) {
+                    const size_t J = address + proxy_onv_basis.vertexWeight(q, e2);
+                    function(I, J, p, q);
+
+                    q++;  // Go to the next orbital.
+                    proxy_onv_basis.shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2);
+                }  // Creation.
+            }      // E1 loop (annihilation).
+
+            if (I < dim - 1) {  // Prevent the last permutation.
+                proxy_onv_basis.transformONVToNextPermutation(onv);
+            }
+        }  // Address (I) loop.
+    }
+
 
     /*
      *  MARK: Dense restricted operator evaluations
@@ -175,6 +218,16 @@ public:
      *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
      */
     VectorX<double> evaluateOperatorMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const VectorX<double>& x) const;
+
+    /**
+     *  Calculate the matrix-vector products of (the matrix representation of) a restricted Hamiltonian with a block of coefficient vectors, in one pass over the coupling data.
+     *
+     *  @param hamiltonian      A restricted Hamiltonian expressed in an orthonormal orbital basis.
+     *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+     *
+     *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+     */
+    MatrixX<double> evaluateOperatorBlockMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const MatrixX<double>& X) const;
 };
 
 
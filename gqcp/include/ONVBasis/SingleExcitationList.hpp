@@ -0,0 +1,118 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  One single excitation E_pq |I> = sign |J> of a spin-unresolved string I, as an entry of a `SingleExcitationList`.
+ * 
+ *  The entry is packed in 8 bytes: the target address is stored in 32 bits and the orbital indices in 8 bits each, which suffices since spin-unresolved ONVs are represented by at most 64 bits.
+ */
+struct SingleExcitation {
+    // The address of the target string J.
+    std::uint32_t address;
+
+    // The index of the orbital in which an electron is created.
+    std::uint8_t p;
+
+    // The index of the orbital in which an electron is annihilated.
+    std::uint8_t q;
+
+    // The sign (+1 or -1) of the excitation.
+    std::int8_t sign;
+};
+
+
+/**
+ *  The single-excitation string table of a full spin-unresolved ONV basis, as introduced by Knowles and Handy (1984) and by Olsen et al. (1988).
+ * 
+ *  For every string I, all its single excitations E_pq |I> = sign |J> (including the diagonal ones E_qq |I> = |I>, for every occupied orbital q) are stored in one contiguous array. Since every string has N occupied and (M - N) unoccupied orbitals, every string has exactly N (M - N + 1) single excitations, so the entries of string I start at `I * entriesPerString()`. Within every string, the entries are sorted by their target address.
+ */
+class SingleExcitationList {
+private:
+    // The number of single excitations of every string.
+    size_t entries_per_string;
+
+    // The single excitations of all strings, stored contiguously.
+    std::vector<SingleExcitation> entries;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param entries_per_string       The number of single excitations of every string.
+     *  @param entries                  The single excitations of all strings, stored contiguously.
+     */
+    SingleExcitationList(const size_t entries_per_string, std::vector<SingleExcitation>&& entries) :
+        entries_per_string {entries_per_string},
+        entries {std::move(entries)} {}
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @param I            The address of a string.
+     * 
+     *  @return A pointer to the first single excitation of the given string.
+     */
+    const SingleExcitation* begin(const size_t I) const { return this->entries.data() + I * this->entries_per_string; }
+
+    /**
+     *  @param I            The address of a string.
+     * 
+     *  @return A pointer past the last single excitation of the given string.
+     */
+    const SingleExcitation* end(const size_t I) const { return this->begin(I) + this->entries_per_string; }
+
+    /**
+     *  @return The number of single excitations of every string.
+     */
+    size_t entriesPerString() const { return this->entries_per_string; }
+
+    /**
+     *  @return The total number of single excitations that are stored.
+     */
+    size_t numberOfEntries() const { return this->entries.size(); }
+
+
+    /*
+     *  MARK: Memory
+     */
+
+    /**
+     *  @return The number of bytes that are occupied by the single excitations.
+     */
+    size_t memoryFootprint() const { return this->entries.capacity() * sizeof(SingleExcitation); }
+};
+
+
+}  // namespace GQCP
@@ -258,6 +258,16 @@ public:
      */
     VectorX<double> evaluateOperatorMatrixVectorProduct(const HubbardHamiltonian<double>& hamiltonian, const VectorX<double>& x) const;
 
+    /**
+     *  Calculate the matrix-vector products of (the matrix representation of) a restricted Hamiltonian with a block of coefficient vectors, in one pass over the coupling data.
+     *
+     *  @param hamiltonian      A restricted Hamiltonian expressed in an orthonormal orbital basis.
+     *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+     *
+     *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+     */
+    MatrixX<double> evaluateOperatorBlockMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const MatrixX<double>& X) const;
+
 
     /*
      *  MARK: Dense unrestricted operator evaluations
@@ -300,6 +310,16 @@ public:
      *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
      */
     VectorX<double> evaluateOperatorMatrixVectorProduct(const USQHamiltonian<double>& usq_hamiltonian, const VectorX<double>& x) const;
+
+    /**
+     *  Calculate the matrix-vector products of (the matrix representation of) an unrestricted Hamiltonian with a block of coefficient vectors, in one pass over the coupling data.
+     *
+     *  @param hamiltonian      An unrestricted Hamiltonian expressed in an orthonormal orbital basis.
+     *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+     *
+     *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+     */
+    MatrixX<double> evaluateOperatorBlockMatrixVectorProduct(const USQHamiltonian<double>& hamiltonian, const MatrixX<double>& X) const;
 };
 
 
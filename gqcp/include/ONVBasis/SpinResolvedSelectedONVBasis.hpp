@@ -79,6 +79,22 @@ public:
      */
     SpinResolvedSelectedONVBasis(const SpinResolvedONVBasis& onv_basis);
 
+    /**
+     *  Generate a `SpinResolvedSelectedONVBasis` from the ONVs with the given addresses in a seniority-zero ONV basis.
+     *
+     *  @param onv_basis        The seniority-zero ONV basis.
+     *  @param addresses        The addresses of the ONVs (in the seniority-zero ONV basis) that should be selected, in the order in which they should appear in the selected ONV basis.
+     */
+    SpinResolvedSelectedONVBasis(const SeniorityZeroONVBasis& onv_basis, const std::vector<size_t>& addresses);
+
+    /**
+     *  Generate a `SpinResolvedSelectedONVBasis` from the ONVs with the given addresses in a full spin-resolved ONV basis.
+     *
+     *  @param onv_basis        The full spin-resolved ONV basis.
+     *  @param addresses        The addresses of the ONVs (in the full spin-resolved ONV basis) that should be selected, in the order in which they should appear in the selected ONV basis.
+     */
+    SpinResolvedSelectedONVBasis(const SpinResolvedONVBasis& onv_basis, const std::vector<size_t>& addresses);
+
 
     /*
      *  MARK: General information
@@ -0,0 +1,193 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "ONVBasis/SpinResolvedONVBasis.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+
+#include <Eigen/Sparse>
+
+#include <functional>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A 'prepared' matrix-vector product (sigma vector) engine for a Hamiltonian in a full spin-resolved ONV basis.
+ * 
+ *  Upon construction, all operator-dependent intermediates that are required in the matrix-vector product are calculated once, such that repeated evaluations (e.g. in every iteration of the Davidson algorithm) only have to perform the actual products.
+ * 
+ *  The matrix-vector product can be evaluated by multiple threads, each of which calculates the contributions for a block of alpha strings. Inside these threads, MKL is restricted to a single thread, so that both levels of parallelism don't oversubscribe the cores.
+ *
+ *  Every element of the result goes through the same sequence of operations for any number of threads. The result is still not guaranteed to be bitwise reproducible across thread counts: a single-threaded evaluation lets MKL's DGEMM use its own threads, and MKL only guarantees bitwise identical results for a fixed number of threads (unless its conditional numerical reproducibility mode is enabled). The differences are at the level of round-off.
+ * 
+ *  @note The ONV basis is stored by reference, so it should outlive this engine.
+ */
+class SpinResolvedSigmaEngine {
+private:
+    // The full spin-resolved ONV basis in which the Hamiltonian is represented.
+    const SpinResolvedONVBasis& onv_basis;
+
+    // The sparse matrix representation of the pure alpha part of the Hamiltonian in the alpha ONV basis.
+    Eigen::SparseMatrix<double> H_alpha;
+
+    // The sparse matrix representation of the pure beta part of the Hamiltonian in the beta ONV basis. This matrix is left empty if it is identical to the alpha one.
+    Eigen::SparseMatrix<double> H_beta;
+
+    // Indicates if the pure alpha and pure beta parts of the Hamiltonian share the same sparse matrix representation, which is the case for a restricted Hamiltonian in an ONV basis with as many alpha as beta electrons.
+    bool shares_spin_hamiltonian;
+
+    // The mixed alpha-beta two-electron integrals g(ab)_{pqrs}, reshaped into a dense (K^2 x K^2) matrix whose element (r K + s, p K + q) is g(ab)_{pqrs}. Every column contains the integrals for one alpha orbital pair, so that the integrals for the alpha excitations of a string can be gathered as contiguous columns.
+    MatrixX<double> mixed_integrals;
+
+    // The number of threads that are used in a matrix-vector product evaluation. The work is partitioned over blocks of alpha strings.
+    size_t number_of_threads;
+
+
+    /**
+     *  Partition the columns (i.e. the alpha strings) of a mapped matrix-vector product into consecutive blocks, and evaluate every block on its own thread.
+     * 
+     *  @param dim_alpha            The number of columns, i.e. the dimension of the alpha ONV basis.
+     *  @param triangular           If the work for a block scales with the index of its last column (i.e. only the upper triangle is calculated), rather than with its number of columns.
+     *  @param evaluate_block       A function that evaluates the contributions for a block, given its first column and its number of columns.
+     */
+    void evaluateInBlocks(const long dim_alpha, const bool triangular, const std::function<void(const long, const long)>& evaluate_block) const;
+
+    /**
+     *  Add the 'mixed spin' contributions to the matrix-vector products of a number of coefficient vectors, for a block of alpha strings.
+     * 
+     *  For every alpha string I_alpha, the gather-DGEMM-scatter algorithm of Olsen et al. (1988) and Knowles, Handy (1984) is used:
+     *      1. gather: C'(J_beta, pq) = <I_alpha| E_pq |J_alpha> C(J_beta, J_alpha) for all alpha excitations of I_alpha,
+     *      2. DGEMM: D(rs, J_beta) = sum_pq g(ab)_{pqrs} C'(J_beta, pq),
+     *      3. scatter: sigma(I_beta, I_alpha) += <I_beta| E_rs |J_beta> D(rs, J_beta) for all beta excitations of I_beta,
+     *  in which the single excitations are read from the precomputed single-excitation string tables. The contraction with the integrals is a single dense matrix-matrix product per alpha string, for all coefficient vectors at once.
+     * 
+     *  @param x                    The coefficient vectors, stored contiguously one after the other.
+     *  @param matvec               The matrix-vector products to which the contributions are added, stored contiguously one after the other.
+     *  @param number_of_vectors    The number of coefficient vectors.
+     *  @param start                The first alpha string of the block.
+     *  @param cols                 The number of alpha strings in the block.
+     *  @param upper_triangle       If only the contributions for beta strings I_beta <= I_alpha should be calculated.
+     */
+    void addMixedContributions(const double* x, double* matvec, const long number_of_vectors, const long start, const long cols, const bool upper_triangle = false) const;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Prepare the matrix-vector product of an unrestricted Hamiltonian in a full spin-resolved ONV basis.
+     * 
+     *  @param onv_basis            The full spin-resolved ONV basis.
+     *  @param hamiltonian          An unrestricted Hamiltonian expressed in an orthonormal orbital basis.
+     *  @param number_of_threads    The number of threads that should be used in a matrix-vector product evaluation.
+     */
+    SpinResolvedSigmaEngine(const SpinResolvedONVBasis& onv_basis, const USQHamiltonian<double>& hamiltonian, const size_t number_of_threads = 1);
+
+    /**
+     *  Prepare the matrix-vector product of a restricted Hamiltonian in a full spin-resolved ONV basis.
+     * 
+     *  Since the alpha and beta parts of a restricted Hamiltonian are equal, only one spin-unresolved sparse Hamiltonian is calculated if the number of alpha and beta electrons are equal.
+     * 
+     *  @param onv_basis            The full spin-resolved ONV basis.
+     *  @param hamiltonian          A restricted Hamiltonian expressed in an orthonormal orbital basis.
+     *  @param number_of_threads    The number of threads that should be used in a matrix-vector product evaluation.
+     */
+    SpinResolvedSigmaEngine(const SpinResolvedONVBasis& onv_basis, const RSQHamiltonian<double>& hamiltonian, const size_t number_of_threads = 1);
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The sparse matrix representation of the pure alpha part of the Hamiltonian in the alpha ONV basis.
+     */
+    const Eigen::SparseMatrix<double>& alphaHamiltonian() const { return this->H_alpha; }
+
+    /**
+     *  @return The sparse matrix representation of the pure beta part of the Hamiltonian in the beta ONV basis.
+     */
+    const Eigen::SparseMatrix<double>& betaHamiltonian() const { return this->shares_spin_hamiltonian ? this->H_alpha : this->H_beta; }
+
+    /**
+     *  @return If the pure alpha and pure beta parts of the Hamiltonian share the same sparse matrix representation.
+     */
+    bool sharesSpinHamiltonian() const { return this->shares_spin_hamiltonian; }
+
+    /**
+     *  @return The mixed alpha-beta two-electron integrals, reshaped into a dense (K^2 x K^2) matrix whose element (r K + s, p K + q) is g(ab)_{pqrs}.
+     */
+    const MatrixX<double>& mixedIntegrals() const { return this->mixed_integrals; }
+
+    /**
+     *  @return The full spin-resolved ONV basis in which the Hamiltonian is represented.
+     */
+    const SpinResolvedONVBasis& onvBasis() const { return this->onv_basis; }
+
+    /**
+     *  @return The number of threads that are used in a matrix-vector product evaluation.
+     */
+    size_t numberOfThreads() const { return this->number_of_threads; }
+
+
+    /*
+     *  MARK: Matrix-vector product evaluations
+     */
+
+    /**
+     *  Calculate the matrix-vector product of (the matrix representation of) the prepared Hamiltonian with the given coefficient vector.
+     *
+     *  @param x                The coefficient vector of a linear expansion.
+     *
+     *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
+     */
+    VectorX<double> evaluateMatrixVectorProduct(const VectorX<double>& x) const;
+
+    /**
+     *  Calculate the matrix-vector products of (the matrix representation of) the prepared Hamiltonian with a block of coefficient vectors.
+     * 
+     *  The pure alpha contributions of all coefficient vectors are calculated in one pass over the sparse pure alpha Hamiltonian, rather than in one pass per vector.
+     *
+     *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+     *
+     *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+     */
+    MatrixX<double> evaluateBlockMatrixVectorProduct(const MatrixX<double>& X) const;
+
+    /**
+     *  Calculate the matrix-vector product of (the matrix representation of) the prepared Hamiltonian with the coefficient vector of a singlet linear expansion.
+     * 
+     *  The coefficient matrix C(I_beta, I_alpha) of a singlet is symmetric, and so is the coefficient matrix of the resulting matrix-vector product. Therefore, only its upper triangle is calculated, which roughly halves the work.
+     *
+     *  @param x                The coefficient vector of a linear expansion whose coefficient matrix is symmetric, e.g. a singlet.
+     *
+     *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
+     * 
+     *  @note This method can only be used for spin-resolved ONV bases with an equal number of alpha and beta electrons and for Hamiltonians whose pure alpha and pure beta parts are equal, i.e. if `sharesSpinHamiltonian()` returns true.
+     */
+    VectorX<double> evaluateSingletMatrixVectorProduct(const VectorX<double>& x) const;
+};
+
+
+}  // namespace GQCP
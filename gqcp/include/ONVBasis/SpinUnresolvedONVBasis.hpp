@@ -20,14 +20,18 @@
 
 #include "Mathematical/Representation/MatrixRepresentationEvaluationContainer.hpp"
 #include "ONVBasis/ONVPath.hpp"
+#include "ONVBasis/SingleExcitationList.hpp"
 #include "ONVBasis/SpinUnresolvedONV.hpp"
 #include "Operator/SecondQuantized/GSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/GSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/PureUSQTwoElectronOperatorComponent.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "Operator/SecondQuantized/USQOneElectronOperatorComponent.hpp"
+#include "Utilities/memory.hpp"
 
+#include <cstdint>
 #include <functional>
+#include <memory>
 
 
 namespace GQCP {
@@ -47,6 +51,110 @@ private:
     // The vertex weights corresponding to the addressing scheme for a full spin-unresolved ONV basis. This addressing scheme is taken from Helgaker, Jørgensen, Olsen (2000).
     std::vector<std::vector<size_t>> vertex_weights;
 
+    // A contiguous copy of the vertex weights, which is used in the address calculations. It is stored orbital-major: the weight of vertex (p, n) is found at `p * flat_vertex_weight_stride + n`. Every orbital row is padded to a whole number of cache lines.
+    std::vector<size_t, CacheAlignedAllocator<size_t>> flat_vertex_weights;
+
+    // The distance between the vertex weights of two consecutive orbitals in `flat_vertex_weights`.
+    size_t flat_vertex_weight_stride;
+
+    // A 32-bit copy of the vertex weights, with the same layout. It is only set up if all addresses in this ONV basis fit in 32 bits, and it halves the cache footprint of the address calculations.
+    std::vector<std::uint32_t, CacheAlignedAllocator<std::uint32_t>> compact_vertex_weights;
+
+    // The distance between the vertex weights of two consecutive orbitals in `compact_vertex_weights`.
+    size_t compact_vertex_weight_stride;
+
+    // The single-excitation string table of this ONV basis. It is only calculated when it is first requested, and it is shared between copies of this ONV basis.
+    mutable std::shared_ptr<const SingleExcitationList> single_excitation_list;
+
+
+    /**
+     *  @tparam Weight                  The integer type of the vertex weights.
+     *
+     *  @param number_of_columns        The number of vertex weights per orbital.
+     *
+     *  @return The distance between the vertex weights of two consecutive orbitals, such that every orbital row occupies a whole number of cache lines.
+     */
+    template <typename Weight>
+    static size_t paddedVertexWeightStride(const size_t number_of_columns) {
+
+        constexpr size_t weights_per_cache_line = cache_line_size / sizeof(Weight);
+        return ((number_of_columns + weights_per_cache_line - 1) / weights_per_cache_line) * weights_per_cache_line;
+    }
+
+    /**
+     *  @tparam Weight                  The integer type of the vertex weights.
+     *
+     *  @param vertex_weights           The vertex weights, stored as a vector of vectors.
+     *  @param stride                   The distance between the vertex weights of two consecutive orbitals in the contiguous table.
+     *
+     *  @return A contiguous, orbital-major copy of the given vertex weights, in which the weight of vertex (p, n) is found at `p * stride + n`.
+     */
+    template <typename Weight>
+    static std::vector<Weight, CacheAlignedAllocator<Weight>> flattenVertexWeights(const std::vector<std::vector<size_t>>& vertex_weights, const size_t stride) {
+
+        std::vector<Weight, CacheAlignedAllocator<Weight>> flat_vertex_weights(vertex_weights.size() * stride, 0);
+        for (size_t p = 0; p < vertex_weights.size(); p++) {
+            for (size_t n = 0; n < vertex_weights[p].size(); n++) {
+                flat_vertex_weights[p * stride + n] = static_cast<Weight>(vertex_weights[p][n]);
+            }
+        }
+        return flat_vertex_weights;
+    }
+
+    /**
+     *  Calculate the address of an unsigned representation of a spin-unresolved ONV, using the unrolled kernel for the given number of electrons if one is available.
+     *
+     *  @tparam Weight          The integer type of the vertex weights.
+     *
+     *  @param vertex_weights   The contiguously stored vertex weights.
+     *  @param stride           The distance between the vertex weights of two consecutive orbitals.
+     *  @param N                The number of electrons.
+     *  @param representation   The unsigned representation of a spin-unresolved ONV with N electrons.
+     *
+     *  @return The address corresponding to the unsigned representation of a spin-unresolved ONV.
+     */
+    template <typename Weight>
+    static size_t addressOfDispatch(const Weight* vertex_weights, const size_t stride, const size_t N, const size_t representation) {
+
+        switch (N) {
+        case 1: {
+            return SpinUnresolvedONVBasis::addressOf<1>(vertex_weights, stride, representation);
+        }
+
+        case 2: {
+            return SpinUnresolvedONVBasis::addressOf<2>(vertex_weights, stride, representation);
+        }
+
+        case 3: {
+            return SpinUnresolvedONVBasis::addressOf<3>(vertex_weights, stride, representation);
+        }
+
+        case 4: {
+            return SpinUnresolvedONVBasis::addressOf<4>(vertex_weights, stride, representation);
+        }
+
+        case 5: {
+            return SpinUnresolvedONVBasis::addressOf<5>(vertex_weights, stride, representation);
+        }
+
+        case 6: {
+            return SpinUnresolvedONVBasis::addressOf<6>(vertex_weights, stride, representation);
+        }
+
+        case 7: {
+            return SpinUnresolvedONVBasis::addressOf<7>(vertex_weights, stride, representation);
+        }
+
+        case 8: {
+            return SpinUnresolvedONVBasis::addressOf<8>(vertex_weights, stride, representation);
+        }
+
+        default: {
+            return SpinUnresolvedONVBasis::addressOf(vertex_weights, stride, representation);
+        }
+        }
+    }
+
 public:
     // The ONV that is naturally related to a full spin-unresolved ONV basis. See also `ONVPath`.
     using ONV = SpinUnresolvedONV;
@@ -119,13 +227,89 @@ public:
      * 
      *  @return The vertex weight related to the given indices (p,n).
      */
-    size_t vertexWeight(const size_t p, const size_t n) const { return this->vertex_weights[p][n]; }
+    size_t vertexWeight(const size_t p, const size_t n) const { return this->flat_vertex_weights[p * this->flat_vertex_weight_stride + n]; }
 
     /**
      *  @return All the vertex weights for this ONV basis, stored as a vector of vectors. The outer axis represents the orbital indices, the inner axis represents the electron indices.
      */
     const std::vector<std::vector<size_t>>& vertexWeights() const { return this->vertex_weights; }
 
+    /**
+     *  @return All the vertex weights for this ONV basis, stored contiguously. The weight of the vertex (p, n) is found at `p * flatVertexWeightStride() + n`.
+     */
+    const size_t* flatVertexWeights() const { return this->flat_vertex_weights.data(); }
+
+    /**
+     *  @return The distance between the vertex weights of two consecutive orbitals in `flatVertexWeights()`.
+     */
+    size_t flatVertexWeightStride() const { return this->flat_vertex_weight_stride; }
+
+    /**
+     *  @return If a 32-bit copy of the vertex weights is available, i.e. if all addresses in this ONV basis fit in 32 bits.
+     */
+    bool hasCompactVertexWeights() const { return !this->compact_vertex_weights.empty(); }
+
+    /**
+     *  @return The 32-bit copy of the vertex weights, stored contiguously. The weight of the vertex (p, n) is found at `p * compactVertexWeightStride() + n`.
+     */
+    const std::uint32_t* compactVertexWeights() const { return this->compact_vertex_weights.data(); }
+
+    /**
+     *  @return The distance between the vertex weights of two consecutive orbitals in `compactVertexWeights()`.
+     */
+    size_t compactVertexWeightStride() const { return this->compact_vertex_weight_stride; }
+
+    /**
+     *  Calculate the address of an unsigned representation of a spin-unresolved ONV with a number of electrons that is known at compile time. Since the number of occupied orbitals is fixed, the loop over the set bits can be fully unrolled.
+     *
+     *  @tparam N_              The number of electrons in the ONV.
+     *  @tparam Weight          The integer type of the vertex weights.
+     *
+     *  @param vertex_weights   The contiguously stored vertex weights.
+     *  @param stride           The distance between the vertex weights of two consecutive orbitals.
+     *  @param representation   The unsigned representation of a spin-unresolved ONV with exactly N_ electrons.
+     *
+     *  @return The address corresponding to the unsigned representation of a spin-unresolved ONV.
+     */
+    template <size_t N_, typename Weight>
+    static size_t addressOf(const Weight* vertex_weights, const size_t stride, size_t representation) {
+
+        size_t address = 0;
+        for (size_t e = 1; e <= N_; e++) {
+            const size_t p = __builtin_ctzl(representation);  // the orbital index of the e-th electron
+            address += vertex_weights[p * stride + e];
+
+            representation &= representation - 1;  // clear the least significant set bit
+        }
+        return address;
+    }
+
+    /**
+     *  Calculate the address of an unsigned representation of a spin-unresolved ONV, looping over all its set bits.
+     *
+     *  @tparam Weight          The integer type of the vertex weights.
+     *
+     *  @param vertex_weights   The contiguously stored vertex weights.
+     *  @param stride           The distance between the vertex weights of two consecutive orbitals.
+     *  @param representation   The unsigned representation of a spin-unresolved ONV.
+     *
+     *  @return The address corresponding to the unsigned representation of a spin-unresolved ONV.
+     */
+    template <typename Weight>
+    static size_t addressOf(const Weight* vertex_weights, const size_t stride, size_t representation) {
+
+        size_t address = 0;
+        size_t e = 0;  // counts the number of electrons in the spin string up to orbital p
+        while (representation != 0) {
+            const size_t p = __builtin_ctzl(representation);
+            e++;
+            address += vertex_weights[p * stride + e];
+
+            representation &= representation - 1;  // clear the least significant set bit
+        }
+        return address;
+    }
+
     /**
      *  Calculate the address (i.e. the ordering number) of an unsigned representation of a spin-unresolved ONV.
      * 
@@ -133,7 +317,15 @@ public:
      *
      *  @return The address corresponding to the unsigned representation of a spin-unresolved ONV.
      */
-    size_t addressOf(const size_t representation) const;
+    size_t addressOf(const size_t representation) const {
+
+        // An implementation of the formula in Helgaker, starting the addressing count from zero. For small numbers of electrons, we dispatch to a kernel in which the loop over the electrons is unrolled.
+        if (this->hasCompactVertexWeights()) {
+            return SpinUnresolvedONVBasis::addressOfDispatch(this->compactVertexWeights(), this->compactVertexWeightStride(), this->N, representation);
+        } else {
+            return SpinUnresolvedONVBasis::addressOfDispatch(this->flatVertexWeights(), this->flatVertexWeightStride(), this->N, representation);
+        }
+    }
 
     /**
      *  Calculate the address (i.e. the ordering number) of a spin-unresolved ONV.
@@ -230,6 +422,15 @@ public:
      */
     std::vector<Eigen::SparseMatrix<double>> calculateOneElectronCouplings() const;
 
+    /**
+     *  Access the single-excitation string table of this ONV basis, i.e. all single excitations E_pq |I> = sign |J> for all strings I, packed in one contiguous array. The table is calculated upon the first call, and reused afterwards.
+     *
+     *  @return The single-excitation string table of this ONV basis.
+     * 
+     *  @note The first call to this method is not thread-safe: it should happen before this ONV basis is shared between threads.
+     */
+    const SingleExcitationList& singleExcitations() const;
+
 
     /**
      *  MARK: Iterating
@@ -689,22 +890,32 @@ public:
      *  resulting from a difference between the initial vertex weights for the encountered occupied orbitals
      *  and the corrected vertex weights accounting for previously annihilated electrons
      *
-     *  @tparam T        the number of previously annihilated electrons
+     *  @tparam T               the number of previously annihilated electrons
+     *  @tparam Weight          the integer type of the vertex weights
      *
-     *  @param address   the address which is updated
-     *  @param onv       the spin-unresolved ONV for which we search the next unnocupied orbital
-     *  @param q         the orbital index
-     *  @param e         the electron count
+     *  @param vertex_weights   the contiguously stored vertex weights
+     *  @param stride           the distance between the vertex weights of two consecutive orbitals
+     *  @param N                the number of electrons
+     *  @param onv              the spin-unresolved ONV for which we search the next unnocupied orbital
+     *  @param address          the address which is updated
+     *  @param q                the orbital index
+     *  @param e                the electron count
      */
-    template <int T>
-    void shiftUntilNextUnoccupiedOrbital(const SpinUnresolvedONV& onv, size_t& address, size_t& q, size_t& e) const {
+    template <int T, typename Weight>
+    static void shiftUntilNextUnoccupiedOrbital(const Weight* vertex_weights, const size_t stride, const size_t N, const SpinUnresolvedONV& onv, size_t& address, size_t& q, size_t& e) {
+
+        // Moving to the next electron and orbital corresponds to moving diagonally through the contiguous vertex weight table, so we only have to increment the position in that table.
+        // +1 is added to the electron index, because of how the addressing scheme is arrayed.
+        size_t position = q * stride + e + 1;
+        const size_t diagonal_stride = stride + 1;
 
         // Test whether the current orbital index is occupied
-        while (e < this->N && q == onv.occupationIndexOf(e)) {
+        while (e < N && q == onv.occupationIndexOf(e)) {
 
             // Take the difference of vertex weights for the encountered electron weights to that of a vertex weight path with "a" fewer electrons
-            // +1 is added to the electron index, because of how the addressing scheme is arrayed.
-            address += this->vertexWeight(q, e + 1 - T) - this->vertexWeight(q, e + 1);
+            // The difference is taken in size_t, so that it wraps around in the same way for every type of vertex weights.
+            address += static_cast<size_t>(vertex_weights[position - T]) - static_cast<size_t>(vertex_weights[position]);
+            position += diagonal_stride;
 
             // move to the next electron and orbital
             e++;
@@ -720,23 +931,33 @@ public:
      *  resulting from a difference between the initial vertex weights for the encountered occupied orbitals
      *  and the corrected vertex weights accounting for previously annihilated electrons
      *
-     *  @tparam T        the number of previously annihilated electrons
+     *  @tparam T               the number of previously annihilated electrons
+     *  @tparam Weight          the integer type of the vertex weights
      *
-     *  @param address   the address which is updated
-     *  @param onv       the spin-unresolved ONV for which we search the next unnocupied orbital
-     *  @param q         the orbital index
-     *  @param e         the electron count
-     *  @param sign      the sign which is flipped for each iteration
+     *  @param vertex_weights   the contiguously stored vertex weights
+     *  @param stride           the distance between the vertex weights of two consecutive orbitals
+     *  @param N                the number of electrons
+     *  @param onv              the spin-unresolved ONV for which we search the next unnocupied orbital
+     *  @param address          the address which is updated
+     *  @param q                the orbital index
+     *  @param e                the electron count
+     *  @param sign             the sign which is flipped for each iteration
      */
-    template <int T>
-    void shiftUntilNextUnoccupiedOrbital(const SpinUnresolvedONV& onv, size_t& address, size_t& q, size_t& e, int& sign) const {
+    template <int T, typename Weight>
+    static void shiftUntilNextUnoccupiedOrbital(const Weight* vertex_weights, const size_t stride, const size_t N, const SpinUnresolvedONV& onv, size_t& address, size_t& q, size_t& e, int& sign) {
+
+        // Moving to the next electron and orbital corresponds to moving diagonally through the contiguous vertex weight table, so we only have to increment the position in that table.
+        // +1 is added to the electron index, because of how the addressing scheme is arrayed.
+        size_t position = q * stride + e + 1;
+        const size_t diagonal_stride = stride + 1;
 
         // Test whether the current orbital index is occupied
-        while (e < this->N && q == onv.occupationIndexOf(e)) {
+        while (e < N && q == onv.occupationIndexOf(e)) {
 
             // Take the difference of vertex weights for the encountered electron weights to that of a vertex weight path with "a" fewer electrons
-            // +1 is added to the electron index, because of how the addressing scheme is arrayed.
-            address += this->vertexWeight(q, e + 1 - T) - this->vertexWeight(q, e + 1);
+            // The difference is taken in size_t, so that it wraps around in the same way for every type of vertex weights.
+            address += static_cast<size_t>(vertex_weights[position - T]) - static_cast<size_t>(vertex_weights[position]);
+            position += diagonal_stride;
 
             // move to the next electron and orbital
             e++;
@@ -753,28 +974,113 @@ public:
      *  resulting from a difference between the initial vertex weights for the encountered occupied orbitals
      *  and the corrected vertex weights accounting for newly created electrons
      *
-     *  @tparam T        the number of newly created electrons
+     *  @tparam T               the number of newly created electrons
+     *  @tparam Weight          the integer type of the vertex weights
      *
-     *  @param address   the address which is updated
-     *  @param onv       the spin-unresolved ONV for which we search the next unoccupied orbital
-     *  @param q         the orbital index
-     *  @param e         the electron count
-     *  @param sign      the sign which is flipped for each iteration
+     *  @param vertex_weights   the contiguously stored vertex weights
+     *  @param stride           the distance between the vertex weights of two consecutive orbitals
+     *  @param onv              the spin-unresolved ONV for which we search the next unoccupied orbital
+     *  @param address          the address which is updated
+     *  @param q                the orbital index
+     *  @param e                the electron count
+     *  @param sign             the sign which is flipped for each iteration
      */
-    template <int T>
-    void shiftUntilPreviousUnoccupiedOrbital(const SpinUnresolvedONV& onv, size_t& address, size_t& q, size_t& e, int& sign) const {
+    template <int T, typename Weight>
+    static void shiftUntilPreviousUnoccupiedOrbital(const Weight* vertex_weights, const size_t stride, const SpinUnresolvedONV& onv, size_t& address, size_t& q, size_t& e, int& sign) {
+
+        // Moving to the previous electron and orbital corresponds to moving diagonally (backwards) through the contiguous vertex weight table, so we only have to decrement the position in that table.
+        size_t position = q * stride + e + 1;
+        const size_t diagonal_stride = stride + 1;
 
         // Test whether the current orbital index is occupied
         while (e != -1 && q == onv.occupationIndexOf(e)) {
 
-            int shift = static_cast<int>(this->vertexWeight(q, e + 1 + T)) - static_cast<int>(this->vertexWeight(q, e + 1));
+            int shift = static_cast<int>(vertex_weights[position + T]) - static_cast<int>(vertex_weights[position]);
             address += shift;
+            position -= diagonal_stride;
 
             e--;
             q--;
             sign *= -1;
         }
     }
+
+
+    /**
+     *  Find the next unoccupied orbital in a given spin-unresolved ONV,
+     *  update the electron count, orbital index,
+     *  and update the address by calculating a shift
+     *  resulting from a difference between the initial vertex weights for the encountered occupied orbitals
+     *  and the corrected vertex weights accounting for previously annihilated electrons
+     *
+     *  @tparam T        the number of previously annihilated electrons
+     *
+     *  @param address   the address which is updated
+     *  @param onv       the spin-unresolved ONV for which we search the next unnocupied orbital
+     *  @param q         the orbital index
+     *  @param e         the electron count
+     */
+    template <int T>
+    void shiftUntilNextUnoccupiedOrbital(const SpinUnresolvedONV& onv, size_t& address, size_t& q, size_t& e) const {
+
+        if (this->hasCompactVertexWeights()) {
+            SpinUnresolvedONVBasis::shiftUntilNextUnoccupiedOrbital<T>(this->compactVertexWeights(), this->compactVertexWeightStride(), this->N, onv, address, q, e);
+        } else {
+            SpinUnresolvedONVBasis::shiftUntilNextUnoccupiedOrbital<T>(this->flatVertexWeights(), this->flatVertexWeightStride(), this->N, onv, address, q, e);
+        }
+    }
+
+
+    /**
+     *  Find the next unoccupied orbital in a given spin-unresolved ONV,
+     *  update the electron count, orbital index, sign,
+     *  and update the address by calculating a shift
+     *  resulting from a difference between the initial vertex weights for the encountered occupied orbitals
+     *  and the corrected vertex weights accounting for previously annihilated electrons
+     *
+     *  @tparam T        the number of previously annihilated electrons
+     *
+     *  @param address   the address which is updated
+     *  @param onv       the spin-unresolved ONV for which we search the next unnocupied orbital
+     *  @param q         the orbital index
+     *  @param e         the electron count
+     *  @param sign      the sign which is flipped for each iteration
+     */
+    template <int T>
+    void shiftUntilNextUnoccupiedOrbital(const SpinUnresolvedONV& onv, size_t& address, size_t& q, size_t& e, int& sign) const {
+
+        if (this->hasCompactVertexWeights()) {
+            SpinUnresolvedONVBasis::shiftUntilNextUnoccupiedOrbital<T>(this->compactVertexWeights(), this->compactVertexWeightStride(), this->N, onv, address, q, e, sign);
+        } else {
+            SpinUnresolvedONVBasis::shiftUntilNextUnoccupiedOrbital<T>(this->flatVertexWeights(), this->flatVertexWeightStride(), this->N, onv, address, q, e, sign);
+        }
+    }
+
+
+    /**
+     *  Find the previous unoccupied orbital in a given spin-unresolved ONV,
+     *  update the electron count, orbital index, sign,
+     *  and update the address by calculating a shift
+     *  resulting from a difference between the initial vertex weights for the encountered occupied orbitals
+     *  and the corrected vertex weights accounting for newly created electrons
+     *
+     *  @tparam T        the number of newly created electrons
+     *
+     *  @param address   the address which is updated
+     *  @param onv       the spin-unresolved ONV for which we search the next unoccupied orbital
+     *  @param q         the orbital index
+     *  @param e         the electron count
+     *  @param sign      the sign which is flipped for each iteration
+     */
+    template <int T>
+    void shiftUntilPreviousUnoccupiedOrbital(const SpinUnresolvedONV& onv, size_t& address, size_t& q, size_t& e, int& sign) const {
+
+        if (this->hasCompactVertexWeights()) {
+            SpinUnresolvedONVBasis::shiftUntilPreviousUnoccupiedOrbital<T>(this->compactVertexWeights(), this->compactVertexWeightStride(), onv, address, q, e, sign);
+        } else {
+            SpinUnresolvedONVBasis::shiftUntilPreviousUnoccupiedOrbital<T>(this->flatVertexWeights(), this->flatVertexWeightStride(), onv, address, q, e, sign);
+        }
+    }
 };
 
 
@@ -0,0 +1,279 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Transformations/BasisTransformable.hpp"
+#include "Basis/Transformations/RTransformation.hpp"
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+#include "Mathematical/Representation/SquareRankFourTensor.hpp"
+#include "Mathematical/Representation/Tensor.hpp"
+#include "Operator/SecondQuantized/RSQTwoElectronOperator.hpp"
+
+#include <Eigen/Eigenvalues>
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/**
+ *  A restricted two-electron operator whose parameters are approximated by a low-rank factorization:
+ *      g_pqrs ~ sum_P B^P_pq B^P_rs.
+ *  The factors can be obtained by density fitting (resolution of the identity), in which P runs over the functions of an auxiliary basis, or by a pivoted incomplete Cholesky decomposition of the two-electron integrals, in which P runs over the Cholesky vectors.
+ *
+ *  Only the three-index factors B^P_pq are stored, which requires K^2 N_aux instead of K^4 elements (N_aux being the number of factors). The factors are stored as a (K^2 x N_aux)-matrix, in which every column is the column-major (K x K)-matrix B^P.
+ *
+ *  @tparam _Scalar                 The scalar type used for a single parameter/matrix element: real or complex.
+ */
+template <typename _Scalar>
+class FactorizedRSQTwoElectronOperator:
+    public BasisTransformable<FactorizedRSQTwoElectronOperator<_Scalar>> {
+public:
+    // The scalar type used for a single parameter/matrix element: real or complex.
+    using Scalar = _Scalar;
+
+    // The type of 'this'.
+    using Self = FactorizedRSQTwoElectronOperator<Scalar>;
+
+    // The type of transformation that is naturally associated to a `FactorizedRSQTwoElectronOperator`.
+    using Transformation = RTransformation<Scalar>;
+
+
+private:
+    // The number of orbitals.
+    size_t K;
+
+    // The three-index factors B^P_pq, stored as a (K^2 x N_aux)-matrix.
+    MatrixX<Scalar> B;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Construct a factorized two-electron operator from its three-index factors.
+     *
+     *  @param K                The number of orbitals.
+     *  @param B                The three-index factors B^P_pq, stored as a (K^2 x N_aux)-matrix, in which every column is the column-major (K x K)-matrix B^P.
+     */
+    FactorizedRSQTwoElectronOperator(const size_t K, const MatrixX<Scalar>& B) :
+        K {K},
+        B {B} {
+
+        if (static_cast<size_t>(B.rows()) != K * K) {
+            throw std::invalid_argument("FactorizedRSQTwoElectronOperator(const size_t, const MatrixX<Scalar>&): The number of rows of the three-index factors should be equal to the square of the number of orbitals.");
+        }
+    }
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Create a density-fitted two-electron operator from the three-center integrals (P|rs) and the Coulomb metric (P|Q), by calculating B^P_rs = sum_Q (P|Q)^{-1/2} (Q|rs).
+     *
+     *  @param three_center_integrals       The three-center integrals as a (K, K, N_aux)-tensor with elements (r, s, P).
+     *  @param metric                       The Coulomb metric (P|Q) over the auxiliary basis functions.
+     *  @param threshold                    The threshold below which eigenvalues of the Coulomb metric are considered to be zero. Removing them makes the fit stable for (nearly) linearly dependent auxiliary bases.
+     *
+     *  @return The density-fitted two-electron operator.
+     */
+    static Self DensityFitted(const Tensor<Scalar, 3>& three_center_integrals, const SquareMatrix<Scalar>& metric, const double threshold = 1.0e-10) {
+
+        const auto K = three_center_integrals.dimension(0);
+        const auto N_aux = three_center_integrals.dimension(2);
+        if ((three_center_integrals.dimension(1) != K) || (static_cast<size_t>(N_aux) != metric.dimension())) {
+            throw std::invalid_argument("FactorizedRSQTwoElectronOperator::DensityFitted(const Tensor<Scalar, 3>&, const SquareMatrix<Scalar>&, const double): The dimensions of the three-center integrals and the metric are incompatible.");
+        }
+
+
+        // Calculate the inverse square root of the Coulomb metric through its eigenvalue decomposition.
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>> eigensolver {metric};
+        const auto& U = eigensolver.eigenvectors();
+
+        VectorX<Scalar> inverse_square_roots = VectorX<Scalar>::Zero(N_aux);
+        for (long P = 0; P < N_aux; P++) {
+            const auto eigenvalue = eigensolver.eigenvalues()(P);
+            if (eigenvalue > threshold) {
+                inverse_square_roots(P) = 1.0 / std::sqrt(eigenvalue);
+            }
+        }
+        const MatrixX<Scalar> metric_inverse_sqrt = U * inverse_square_roots.asDiagonal() * U.adjoint();
+
+
+        // Since the tensor is stored column-major, it can be viewed as a (K^2 x N_aux)-matrix without copying.
+        const Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>> integrals_matrix {three_center_integrals.data(), K * K, N_aux};
+        return Self(K, integrals_matrix * metric_inverse_sqrt);
+    }
+
+
+    /*
+     *  MARK: Parameters
+     */
+
+    /**
+     *  @param P            The index of a factor, i.e. of an auxiliary basis function or a Cholesky vector.
+     *
+     *  @return A read-only view on the three-index factor B^P as a (K x K)-matrix.
+     */
+    Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>> factor(const size_t P) const { return Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>(this->B.col(P).data(), this->K, this->K); }
+
+    /**
+     *  @return The three-index factors B^P_pq, stored as a (K^2 x N_aux)-matrix, in which every column is the column-major (K x K)-matrix B^P.
+     */
+    const MatrixX<Scalar>& factors() const { return this->B; }
+
+    /**
+     *  @return The number of factors, i.e. the number of auxiliary basis functions that are used in the fit or the number of Cholesky vectors.
+     */
+    size_t numberOfFactors() const { return this->B.cols(); }
+
+    /**
+     *  @return The number of orbitals this two-electron operator is expressed in.
+     */
+    size_t numberOfOrbitals() const { return this->K; }
+
+
+    /**
+     *  Reconstruct one two-electron integral.
+     *
+     *  @param p            The first index.
+     *  @param q            The second index.
+     *  @param r            The third index.
+     *  @param s            The fourth index.
+     *
+     *  @return The (factorized) two-electron integral g_pqrs, in chemist's notation.
+     */
+    Scalar operator()(const size_t p, const size_t q, const size_t r, const size_t s) const {
+
+        return this->B.row(p + this->K * q).cwiseProduct(this->B.row(r + this->K * s)).sum();
+    }
+
+
+    /**
+     *  Reconstruct a block of the two-electron integrals, in chemist's notation.
+     *
+     *  @param offsets      The starting indices (p, q, r, s) of the block.
+     *  @param extents      The number of indices along each axis of the block.
+     *
+     *  @return The block of (factorized) two-electron integrals g(offsets[0] + i, offsets[1] + j, offsets[2] + k, offsets[3] + l) with dimensions given by the extents.
+     */
+    Tensor<Scalar, 4> block(const std::array<size_t, 4>& offsets, const std::array<size_t, 4>& extents) const {
+
+        for (size_t axis = 0; axis < 4; axis++) {
+            if (offsets[axis] + extents[axis] > this->K) {
+                throw std::invalid_argument("FactorizedRSQTwoElectronOperator::block(const std::array<size_t, 4>&, const std::array<size_t, 4>&): The requested block exceeds the number of orbitals.");
+            }
+        }
+
+
+        // Gather the rows of the factors that belong to the requested pairs (pq) and (rs), after which one matrix product reconstructs the block.
+        const auto gather = [this](const size_t p_offset, const size_t q_offset, const size_t p_extent, const size_t q_extent) {
+            MatrixX<Scalar> rows(p_extent * q_extent, this->B.cols());
+            for (size_t j = 0; j < q_extent; j++) {
+                rows.middleRows(j * p_extent, p_extent) = this->B.middleRows(p_offset + this->K * (q_offset + j), p_extent);
+            }
+            return rows;
+        };
+
+        const auto B_pq = gather(offsets[0], offsets[1], extents[0], extents[1]);
+        const auto B_rs = gather(offsets[2], offsets[3], extents[2], extents[3]);
+
+
+        // The column-major storage of the ((pq) x (rs))-matrix coincides with the storage of the rank-4 tensor, so the product can be written into the tensor directly.
+        Tensor<Scalar, 4> g_block {static_cast<long>(extents[0]), static_cast<long>(extents[1]), static_cast<long>(extents[2]), static_cast<long>(extents[3])};
+        Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>(g_block.data(), B_pq.rows(), B_rs.rows()).noalias() = B_pq * B_rs.transpose();
+
+        return g_block;
+    }
+
+
+    /**
+     *  @return All (factorized) two-electron integrals, in chemist's notation.
+     *
+     *  @note This method requires K^4 elements of storage, and should only be used if the full tensor is really needed.
+     */
+    SquareRankFourTensor<Scalar> parameters() const {
+
+        return SquareRankFourTensor<Scalar>(this->block({0, 0, 0, 0}, {this->K, this->K, this->K, this->K}));
+    }
+
+
+    /**
+     *  @return A regular restricted two-electron operator whose parameters are the reconstructed two-electron integrals.
+     *
+     *  @note This method requires K^4 elements of storage, and should only be used if the full tensor is really needed.
+     */
+    ScalarRSQTwoElectronOperator<Scalar> reconstructed() const { return ScalarRSQTwoElectronOperator<Scalar> {this->parameters()}; }
+
+
+    /*
+     *  MARK: Conforming to `BasisTransformable`
+     */
+
+    /**
+     *  Apply the basis transformation and return the result. Every three-index factor is transformed as B^P -> T^dagger B^P T, which requires O(N_aux K^3) operations.
+     *
+     *  @param T            The basis transformation.
+     *
+     *  @return The basis-transformed two-electron operator.
+     */
+    Self transformed(const Transformation& T) const override {
+
+        if (T.numberOfOrbitals() != this->K) {
+            throw std::invalid_argument("FactorizedRSQTwoElectronOperator::transformed(const Transformation&): The dimension of the transformation is incompatible with this two-electron operator.");
+        }
+
+        const auto& T_matrix = T.matrix();
+
+        MatrixX<Scalar> B_transformed(this->B.rows(), this->B.cols());
+        for (size_t P = 0; P < this->numberOfFactors(); P++) {
+            Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>(B_transformed.col(P).data(), this->K, this->K).noalias() = T_matrix.adjoint() * this->factor(P) * T_matrix;
+        }
+
+        return Self(this->K, B_transformed);
+    }
+};
+
+
+/*
+ *  MARK: BasisTransformableTraits
+ */
+
+/**
+ *  A type that provides compile-time information related to the abstract interface `BasisTransformable`.
+ *
+ *  @tparam Scalar          The scalar type used for a single parameter/matrix element: real or complex.
+ */
+template <typename Scalar>
+struct BasisTransformableTraits<FactorizedRSQTwoElectronOperator<Scalar>> {
+
+    // The type of transformation that is naturally associated to a `FactorizedRSQTwoElectronOperator`.
+    using Transformation = RTransformation<Scalar>;
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,133 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Transformations/BasisTransformable.hpp"
+#include "Basis/Transformations/RTransformation.hpp"
+#include "Basis/Transformations/UTransformation.hpp"
+#include "Operator/SecondQuantized/FactorizedRSQTwoElectronOperator.hpp"
+#include "Operator/SecondQuantized/USQTwoElectronOperator.hpp"
+#include "QuantumChemical/SpinResolvedBase.hpp"
+
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/**
+ *  An unrestricted two-electron operator whose parameters are approximated by a low-rank factorization. The alpha and beta components share the same (e.g. Cholesky) factorization in the scalar basis, but are transformed separately, so that
+ *      g_pqrs(sigma, tau) ~ sum_P B^P_pq(sigma) B^P_rs(tau).
+ *
+ *  @tparam _Scalar                 The scalar type used for a single parameter/matrix element: real or complex.
+ */
+template <typename _Scalar>
+class FactorizedUSQTwoElectronOperator:
+    public SpinResolvedBase<FactorizedRSQTwoElectronOperator<_Scalar>, FactorizedUSQTwoElectronOperator<_Scalar>>,
+    public BasisTransformable<FactorizedUSQTwoElectronOperator<_Scalar>> {
+public:
+    // The scalar type used for a single parameter/matrix element: real or complex.
+    using Scalar = _Scalar;
+
+    // The type of 'this'.
+    using Self = FactorizedUSQTwoElectronOperator<Scalar>;
+
+    // The type of transformation that is naturally associated to a `FactorizedUSQTwoElectronOperator`.
+    using Transformation = UTransformation<Scalar>;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    // Inherit `SpinResolvedBase`'s constructors.
+    using SpinResolvedBase<FactorizedRSQTwoElectronOperator<Scalar>, FactorizedUSQTwoElectronOperator<Scalar>>::SpinResolvedBase;
+
+
+    /*
+     *  MARK: Parameters
+     */
+
+    /**
+     *  @return A regular unrestricted two-electron operator whose parameters are the reconstructed two-electron integrals, including the mixed alpha-beta and beta-alpha components.
+     *
+     *  @note This method requires 4 K^4 elements of storage, and should only be used if the full tensors are really needed.
+     */
+    ScalarUSQTwoElectronOperator<Scalar> reconstructed() const {
+
+        const auto& B_a = this->alpha().factors();
+        const auto& B_b = this->beta().factors();
+        const auto K = this->alpha().numberOfOrbitals();
+
+        if ((this->beta().numberOfOrbitals() != K) || (B_a.cols() != B_b.cols())) {
+            throw std::invalid_argument("FactorizedUSQTwoElectronOperator::reconstructed(): The alpha and beta components do not share the same factorization.");
+        }
+
+
+        // The column-major storage of a ((pq) x (rs))-matrix coincides with the storage of the rank-4 tensor, so every product can be written into a tensor directly.
+        const auto contract = [K](const MatrixX<Scalar>& B_left, const MatrixX<Scalar>& B_right) {
+            auto g = SquareRankFourTensor<Scalar>::Zero(K);
+            Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>(g.data(), K * K, K * K).noalias() = B_left * B_right.transpose();
+            return g;
+        };
+
+        return ScalarUSQTwoElectronOperator<Scalar> {contract(B_a, B_a), contract(B_a, B_b), contract(B_b, B_a), contract(B_b, B_b)};
+    }
+
+
+    /*
+     *  MARK: Conforming to `BasisTransformable`
+     */
+
+    /**
+     *  Apply the basis transformation and return the result. The alpha and beta factors are transformed with the alpha and beta components of the transformation, respectively.
+     *
+     *  @param T            The basis transformation.
+     *
+     *  @return The basis-transformed two-electron operator.
+     */
+    Self transformed(const Transformation& T) const override {
+
+        const auto alpha_transformed = this->alpha().transformed(RTransformation<Scalar> {T.alpha().matrix()});
+        const auto beta_transformed = this->beta().transformed(RTransformation<Scalar> {T.beta().matrix()});
+
+        return Self {alpha_transformed, beta_transformed};
+    }
+};
+
+
+/*
+ *  MARK: BasisTransformableTraits
+ */
+
+/**
+ *  A type that provides compile-time information related to the abstract interface `BasisTransformable`.
+ *
+ *  @tparam Scalar          The scalar type used for a single parameter/matrix element: real or complex.
+ */
+template <typename Scalar>
+struct BasisTransformableTraits<FactorizedUSQTwoElectronOperator<Scalar>> {
+
+    // The type of transformation that is naturally associated to a `FactorizedUSQTwoElectronOperator`.
+    using Transformation = UTransformation<Scalar>;
+};
+
+
+}  // namespace GQCP
@@ -18,6 +18,7 @@
 #pragma once
 
 
+#include "Basis/Transformations/FourIndexTransformation.hpp"
 #include "Basis/Transformations/UTransformationComponent.hpp"
 #include "DensityMatrix/MixedSpinResolved2DMComponent.hpp"
 #include "DensityMatrix/SpinResolved1DMComponent.hpp"
@@ -112,31 +113,20 @@ public:
      */
     Self transformed(const UTransformationComponent<Scalar>& T, const Spin sigma) const {
 
-        // Since we're only getting T as a matrix, we should convert it to an appropriate tensor to perform contractions.
-        // Although not a necessity for the einsum implementation, it makes it a lot easier to follow the formulas.
-        const GQCP::Tensor<Scalar, 2> T_tensor = Eigen::TensorMap<Eigen::Tensor<const Scalar, 2>>(T.matrix().data(), T.matrix().rows(), T.matrix().cols());
-
-        // We calculate the conjugate as a tensor as well.
-        const GQCP::Tensor<Scalar, 2> T_conjugate = T_tensor.conjugate();
-
-
-        // Depending on the given spin-component, we should either transform the first two, or the second two axes.
+        // Depending on the given spin-component, we should either transform the first two, or the second two axes. Both are carried out as two quarter transformations, i.e. matrix-matrix products.
+        const auto& T_matrix = T.matrix();
         const auto& parameters = this->allParameters();
         auto result = this->allParameters();
 
         for (size_t i = 0; i < this->numberOfComponents(); i++) {
             switch (sigma) {
             case Spin::alpha: {
-                const auto temp = T_tensor.template einsum<1>("UQ,TUVW->TQVW", parameters[i]);
-                const auto transformed = T_conjugate.template einsum<1>("TP,TQVW->PQVW", temp);
-                result[i] = transformed;
+                result[i] = transformBraIndices<Scalar>(parameters[i], T_matrix, T_matrix);  // g'(P Q V W) = T^*(T P) T(U Q) g(T U V W)
                 break;
             }
 
             case Spin::beta: {
-                const auto temp = parameters[i].template einsum<1>("PQVW, WS->PQVS", T_tensor);
-                const auto transformed = temp.template einsum<1>("PQVS, VR->PQRS", T_conjugate);
-                result[i] = transformed;
+                result[i] = transformKetIndices<Scalar>(parameters[i], T_matrix, T_matrix);  // g'(T U R S) = T^*(V R) T(W S) g(T U V W)
                 break;
             }
             }
@@ -22,6 +22,7 @@
 #include "DensityMatrix/Orbital1DM.hpp"
 #include "DensityMatrix/Orbital2DM.hpp"
 #include "Mathematical/Representation/DenseVectorizer.hpp"
+#include "Mathematical/Representation/PackedRankFourTensor.hpp"
 #include "Operator/SecondQuantized/MixedUSQTwoElectronOperatorComponent.hpp"
 #include "Operator/SecondQuantized/PureUSQTwoElectronOperatorComponent.hpp"
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
@@ -61,6 +62,19 @@ public:
     using SimpleSQTwoElectronOperator<_Scalar, _Vectorizer, RSQTwoElectronOperator<_Scalar, _Vectorizer>>::SimpleSQTwoElectronOperator;
 
 
+    /**
+     *  Construct a scalar-like restricted two-electron operator from the unique elements of its (real) parameters.
+     * 
+     *  @param packed_parameters            The packed representation of the two-electron integrals, which have the 8-fold permutational symmetry of real two-electron integrals.
+     *
+     *  @note The operator stores its parameters as a full tensor, so this is an (opt-in) conversion that unpacks the given integrals.
+     */
+    template <typename Z = Vectorizer>
+    RSQTwoElectronOperator(const PackedRankFourTensor<Scalar>& packed_parameters,
+                           typename std::enable_if<std::is_same<Z, ScalarVectorizer>::value>::type* = 0) :
+        RSQTwoElectronOperator(packed_parameters.unpacked()) {}
+
+
     /*
      *  MARK: Conversions to spin components
      */
@@ -157,6 +157,25 @@ public:
      *  MARK: Named constructors
      */
 
+    /**
+     *  Create an `SQHamiltonian` that only consists of a one-electron (core) contribution, and whose two-electron operator is left empty (i.e. zero-dimensional) instead of being filled with K^4 zeros.
+     * 
+     *  @param h            The total one-electron interaction operator, i.e. the core Hamiltonian.
+     *
+     *  @return An `SQHamiltonian` that only holds the given core Hamiltonian.
+     *
+     *  @note This named constructor is meant for integral-direct methods, which recalculate the two-electron integrals whenever they need them, e.g. `RHFDirectFockMatrixCalculation`. The two-electron operator of the resulting Hamiltonian should not be used.
+     */
+    static Self FromCore(const ScalarSQOneElectronOperator& h) {
+
+        Self hamiltonian {ScalarSQOneElectronOperator::Zero(0), ScalarSQTwoElectronOperator::Zero(0)};
+        hamiltonian.h = h;
+        hamiltonian.h_contributions = {h};
+
+        return hamiltonian;
+    }
+
+
     /**
      *  Create an `RSQHamiltonian` from a `HubbardHamiltonian`.
      * 
@@ -290,87 +309,53 @@ public:
     template <typename Z1 = Scalar, typename Z2 = SpinorTag>
     static enable_if_t<std::is_same<Z1, double>::value && std::is_same<Z2, RestrictedSpinOrbitalTag>::value, SQHamiltonian<ScalarSQOneElectronOperator, ScalarSQTwoElectronOperator>> FromFCIDUMP(const std::string& fcidump_filename) {
 
-        std::ifstream input_file_stream = validateAndOpen(fcidump_filename, "FCIDUMP");
-
-
-        // Do the actual parsing
-
-        //  Get the number of orbitals to check if it's a valid FCIDUMP file
-        std::string start_line;  // first line contains orbitals and electron count
-        std::getline(input_file_stream, start_line);
-        std::stringstream linestream {start_line};
-
-        size_t K = 0;
-        char iter;
-
-        while (linestream >> iter) {
-            if (iter == '=') {
-                linestream >> K;  // right here we have the number of orbitals
-                break;            // we can finish reading the linestream after we found K
-            }
-        }
-
-        if (K == 0) {
-            throw std::invalid_argument("SQHamiltonian::FromFCIDUMP(std::string): The .FCIDUMP-file is invalid: could not read a number of orbitals.");
-        }
-
-
-        SquareMatrix<double> h_core = SquareMatrix<double>::Zero(K);
-        SquareRankFourTensor<double> g {K};
-        g.setZero();
-
-        //  Skip 3 lines
-        for (size_t counter = 0; counter < 3; counter++) {
-            std::getline(input_file_stream, start_line);
-        }
-
-
-        //  Start reading in the one- and two-electron integrals
-        double x;
-        size_t i, j, a, b;
-
-        std::string line;
-        while (std::getline(input_file_stream, line)) {
-            std::istringstream iss {line};
-
-            // Based on what the values of the indices are, we can read one-electron integrals, two-electron integrals and the internuclear repulsion energy
-            //  See also (http://hande.readthedocs.io/en/latest/manual/integrals.html)
-            //  I think the documentation is a bit unclear for the two-electron integrals, but we can rest assured that FCIDUMP files give the two-electron integrals in CHEMIST's notation.
-            iss >> x >> i >> a >> j >> b;
-
-            //  Single-particle eigenvalues (skipped)
-            if ((a == 0) && (j == 0) && (b == 0)) {
-            }
+        SquareMatrix<double> h_core;
+        SquareRankFourTensor<double> g;
+
+        parseFCIDUMP(
+            fcidump_filename,
+            [&h_core, &g](const size_t K) {
+                h_core = SquareMatrix<double>::Zero(K);
+                g = SquareRankFourTensor<double>::Zero(K);
+            },
+            [&h_core, &g](const double x, const size_t i, const size_t a, const size_t j, const size_t b) {
+                // Based on what the values of the indices are, we can read one-electron integrals, two-electron integrals and the internuclear repulsion energy
+                //  See also (http://hande.readthedocs.io/en/latest/manual/integrals.html)
+                //  I think the documentation is a bit unclear for the two-electron integrals, but we can rest assured that FCIDUMP files give the two-electron integrals in CHEMIST's notation.
+
+                //  Single-particle eigenvalues (skipped)
+                if ((a == 0) && (j == 0) && (b == 0)) {
+                }
 
-            //  One-electron integrals (h_core)
-            else if ((j == 0) && (b == 0)) {
-                size_t p = i - 1;
-                size_t q = a - 1;
-                h_core(p, q) = x;
+                //  One-electron integrals (h_core)
+                else if ((j == 0) && (b == 0)) {
+                    size_t p = i - 1;
+                    size_t q = a - 1;
+                    h_core(p, q) = x;
 
-                // Apply the permutational symmetry for real orbitals
-                h_core(q, p) = x;
-            }
+                    // Apply the permutational symmetry for real orbitals
+                    h_core(q, p) = x;
+                }
 
-            //  Two-electron integrals are given in CHEMIST'S NOTATION, so just copy them over
-            else if ((i > 0) && (a > 0) && (j > 0) && (b > 0)) {
-                size_t p = i - 1;
-                size_t q = a - 1;
-                size_t r = j - 1;
-                size_t s = b - 1;
-                g(p, q, r, s) = x;
-
-                // Apply the permutational symmetries for real orbitals
-                g(p, q, s, r) = x;
-                g(q, p, r, s) = x;
-                g(q, p, s, r) = x;
-
-                g(r, s, p, q) = x;
-                g(s, r, p, q) = x;
-                g(r, s, q, p) = x;
-                g(s, r, q, p) = x;
-            }
-        }  // while loop
+                //  Two-electron integrals are given in CHEMIST'S NOTATION, so just copy them over
+                else if ((i > 0) && (a > 0) && (j > 0) && (b > 0)) {
+                    size_t p = i - 1;
+                    size_t q = a - 1;
+                    size_t r = j - 1;
+                    size_t s = b - 1;
+                    g(p, q, r, s) = x;
+
+                    // Apply the permutational symmetries for real orbitals
+                    g(p, q, s, r) = x;
+                    g(q, p, r, s) = x;
+                    g(q, p, s, r) = x;
+
+                    g(r, s, p, q) = x;
+                    g(s, r, p, q) = x;
+                    g(r, s, q, p) = x;
+                    g(s, r, q, p) = x;
+                }
+            });
 
 
         return SQHamiltonian(ScalarSQOneElectronOperator(h_core), ScalarSQTwoElectronOperator(g));
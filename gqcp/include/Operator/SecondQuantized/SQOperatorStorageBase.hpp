@@ -23,6 +23,8 @@
 #include "Utilities/type_traits.hpp"
 
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 
 namespace GQCP {
@@ -68,6 +70,20 @@ protected:
     StorageArray<MatrixRepresentation, Vectorizer> array;
 
 
+    /**
+     *  @param element              A matrix representation.
+     * 
+     *  @return A vector that contains the given matrix representation, which has been moved into it. (Initializing a vector from a braced list would copy it.)
+     */
+    static std::vector<MatrixRepresentation> singleElementVector(MatrixRepresentation&& element) {
+
+        std::vector<MatrixRepresentation> elements;
+        elements.reserve(1);
+        elements.push_back(std::move(element));
+        return elements;
+    }
+
+
 public:
     /*
      *  MARK: Constructors
@@ -91,6 +107,24 @@ public:
     }
 
 
+    /**
+     *  Construct a second-quantized operator storage by taking over a storage array, so that the matrix representations don't have to be copied.
+     * 
+     *  @param array                A storage array that contains the matrix representations of all the components of the operator.
+     */
+    SQOperatorStorageBase(StorageArray<MatrixRepresentation, Vectorizer>&& array) :
+        array {std::move(array)} {
+
+        const auto first_dimension = this->array.elements()[0].dimension();
+
+        for (const auto& parameters : this->array.elements()) {
+            if (parameters.dimension() != first_dimension) {
+                throw std::invalid_argument("SQOperatorStorageBase(StorageArray<MatrixRepresentation, Vectorizer>&& array): The dimensions of the matrix representations must be equal.");
+            }
+        }
+    }
+
+
     /**
      *  Construct a second-quantized operator storage from one matrix representation.
      * 
@@ -102,6 +136,17 @@ public:
         SQOperatorStorageBase(StorageArray<MatrixRepresentation, ScalarVectorizer>({parameters}, ScalarVectorizer())) {}
 
 
+    /**
+     *  Construct a second-quantized operator storage by taking over one matrix representation, so that it doesn't have to be copied.
+     * 
+     *  @param parameters           The matrix representation of operator's parameters/matrix elements/integrals.
+     */
+    template <typename Z = Vectorizer>
+    SQOperatorStorageBase(MatrixRepresentation&& parameters,
+                          typename std::enable_if<std::is_same<Z, ScalarVectorizer>::value>::type* = 0) :
+        SQOperatorStorageBase(StorageArray<MatrixRepresentation, ScalarVectorizer>(SQOperatorStorageBase::singleElementVector(std::move(parameters)), ScalarVectorizer())) {}
+
+
     /**
      *  Construct a second-quantized operator storage from a set of three matrix representations, for each of the operator's components.
      * 
@@ -19,6 +19,7 @@
 
 
 #include "Basis/Transformations/BasisTransformable.hpp"
+#include "Basis/Transformations/FourIndexTransformation.hpp"
 #include "Basis/Transformations/JacobiRotatable.hpp"
 #include "Mathematical/Representation/SquareRankFourTensor.hpp"
 #include "Mathematical/Representation/StorageArray.hpp"
@@ -284,31 +285,16 @@ public:
      */
     DerivedOperator transformed(const Transformation& T) const override {
 
-        // Since we're only getting T as a matrix, we should convert it to an appropriate tensor to perform contractions.
-        // Although not a necessity for the einsum implementation, it makes it a lot easier to follow the formulas.
-        const GQCP::Tensor<Scalar, 2> T_tensor = Eigen::TensorMap<Eigen::Tensor<const Scalar, 2>>(T.matrix().data(), T.matrix().rows(), T.matrix().cols());
-
-        // We calculate the conjugate as a tensor as well.
-        const GQCP::Tensor<Scalar, 2> T_conjugate = T_tensor.conjugate();
-
-        // Calculate the basis transformation for every component of the operator.
+        // Calculate the basis transformation for every component of the operator, as a sequence of quarter transformations that are carried out as matrix-matrix products.
+        //      g'(P Q R S) = T^*(T P) T(U Q) T^*(V R) T(W S) g(T U V W)
+        // For real integrals that are symmetric in their ket indices (as the Coulomb integrals over real orbitals are), only half of the ket pairs have to be transformed.
+        const auto& T_matrix = T.matrix();
         const auto& parameters = this->allParameters();
         auto result = this->allParameters();
 
         for (size_t i = 0; i < this->numberOfComponents(); i++) {
-
-            // We will have to do four single contractions
-            // g(T U V W)  T^*(V R) -> a(T U R W)
-            // a(T U R W)  T(W S) -> b(T U R S)
-            const auto temp_1 = parameters[i].template einsum<1>("TUVW,VR->TURW", T_conjugate).template einsum<1>("TURW,WS->TURS", T_tensor);
-
-            // T(U Q)  b(T U R S) -> c(T Q R S)
-            const auto temp_2 = T_tensor.template einsum<1>("UQ,TURS->TQRS", temp_1);
-
-            // T^*(T P)  c(T Q R S) -> g'(P Q R S)
-            const auto transformed_component = T_conjugate.template einsum<1>("TP,TQRS->PQRS", temp_2);
-
-            result[i] = transformed_component;
+            const bool is_ket_symmetric = std::is_floating_point<Scalar>::value && isKetSymmetric<Scalar>(parameters[i]);
+            result[i] = transformFourIndices<Scalar>(parameters[i], T_matrix, T_matrix, T_matrix, T_matrix, is_ket_symmetric);
         }
 
         return DerivedOperator {StorageArray<MatrixRepresentation, Vectorizer>(result, this->array.vectorizer())};
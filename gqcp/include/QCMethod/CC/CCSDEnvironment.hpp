@@ -18,14 +18,13 @@
 #pragma once
 
 
+#include "Mathematical/Algorithm/History.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "QCModel/CC/CCD.hpp"
 #include "QCModel/CC/CCSD.hpp"
 #include "QCModel/CC/T1Amplitudes.hpp"
 #include "QCModel/CC/T2Amplitudes.hpp"
 
-#include <deque>
-
 
 namespace GQCP {
 
@@ -43,13 +42,14 @@ public:
 
 
 public:
-    std::deque<double> correlation_energies;  // The electronic correlation energies.
+    History<double> correlation_energies;  // The electronic correlation energies, which are always kept in full.
 
-    std::deque<T1Amplitudes<Scalar>> t1_amplitudes;
-    std::deque<T2Amplitudes<Scalar>> t2_amplitudes;
+    // The other histories only keep the most recent iterates, so that the memory of the environment doesn't grow with the number of iterations. By default, they keep the two most recent iterates, which suffices for the convergence criteria and the calculation of the T2 amplitude errors. The DIIS steps enlarge the capacity of the histories they extrapolate from. See also `keepFullHistory()`.
+    History<T1Amplitudes<Scalar>> t1_amplitudes;
+    History<T2Amplitudes<Scalar>> t2_amplitudes;
 
-    std::deque<VectorX<Scalar>> t1_amplitude_errors;
-    std::deque<VectorX<Scalar>> t2_amplitude_errors;
+    History<VectorX<Scalar>> t1_amplitude_errors;
+    History<VectorX<Scalar>> t2_amplitude_errors;
 
     SquareMatrix<Scalar> f;            // The elements of the (inactive) Fock matrix.
     SquareRankFourTensor<Scalar> V_A;  // The antisymmetrized two-electron integrals (in physicist's notation).
@@ -80,11 +80,15 @@ public:
      *  @param V_A                      The antisymmetrized two-electron integrals (in physicist's notation).
      */
     CCSDEnvironment(const T1Amplitudes<Scalar>& t1_amplitudes, const T2Amplitudes<Scalar>& t2_amplitudes, const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A) :
-        correlation_energies {QCModel::CCSD<Scalar>::calculateCorrelationEnergy(f, V_A, t1_amplitudes, t2_amplitudes)},  // already calculate the initial CCSD energy correction
-        t1_amplitudes {t1_amplitudes},
-        t2_amplitudes {t2_amplitudes},
         f {f},
-        V_A {V_A} {}
+        V_A {V_A} {
+
+        this->setHistoryCapacity(2);
+
+        this->correlation_energies.push_back(QCModel::CCSD<Scalar>::calculateCorrelationEnergy(f, V_A, t1_amplitudes, t2_amplitudes));  // already calculate the initial CCSD energy correction
+        this->t1_amplitudes.push_back(t1_amplitudes);
+        this->t2_amplitudes.push_back(t2_amplitudes);
+    }
 
 
     /**
@@ -95,10 +99,14 @@ public:
      *  @param V_A                      The antisymmetrized two-electron integrals (in physicist's notation).
      */
     CCSDEnvironment(const T2Amplitudes<Scalar>& t2_amplitudes, const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A) :
-        correlation_energies {QCModel::CCD<Scalar>::calculateCorrelationEnergy(f, V_A, t2_amplitudes)},  // Make sure to calculate the initial CCD energy correction already.
-        t2_amplitudes {t2_amplitudes},
         f {f},
-        V_A {V_A} {}
+        V_A {V_A} {
+
+        this->setHistoryCapacity(2);
+
+        this->correlation_energies.push_back(QCModel::CCD<Scalar>::calculateCorrelationEnergy(f, V_A, t2_amplitudes));  // Make sure to calculate the initial CCD energy correction already.
+        this->t2_amplitudes.push_back(t2_amplitudes);
+    }
 
 
     /**
@@ -145,6 +153,34 @@ public:
 
         return CCSDEnvironment<Scalar>(t2_amplitudes, f, V_A);
     }
+
+
+    /*
+     *  MARK: History
+     */
+
+    /**
+     *  Change the number of most recent iterates that are kept in the histories of this environment. If a history holds more iterates than the new capacity, its oldest ones are evicted. The correlation energies are always kept in full.
+     * 
+     *  @param capacity                 The number of most recent iterates that should be kept.
+     */
+    void setHistoryCapacity(const size_t capacity) {
+        this->t1_amplitudes.setCapacity(capacity);
+        this->t2_amplitudes.setCapacity(capacity);
+        this->t1_amplitude_errors.setCapacity(capacity);
+        this->t2_amplitude_errors.setCapacity(capacity);
+    }
+
+
+    /**
+     *  Keep every iterate that is added to the histories of this environment from now on, e.g. for debugging purposes.
+     */
+    void keepFullHistory() {
+        this->t1_amplitudes.makeUnbounded();
+        this->t2_amplitudes.makeUnbounded();
+        this->t1_amplitude_errors.makeUnbounded();
+        this->t2_amplitude_errors.makeUnbounded();
+    }
 };
 
 
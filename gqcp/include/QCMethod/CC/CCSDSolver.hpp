@@ -65,11 +65,11 @@ public:
 
         // Create a compound convergence criterion on the norm of subsequent T1- and T2-amplitudes, which is facilitated by the .norm() API of the T1- and T2-amplitudes.
         using T1ConvergenceType = ConsecutiveIteratesNormConvergence<T1Amplitudes<Scalar>, CCSDEnvironment<Scalar>>;
-        const auto t1_extractor = [](const CCSDEnvironment<Scalar>& environment) { return environment.t1_amplitudes; };
+        const auto t1_extractor = [](const CCSDEnvironment<Scalar>& environment) -> const History<T1Amplitudes<Scalar>>* { return &environment.t1_amplitudes; };
         const T1ConvergenceType t1_convergence_criterion {threshold, t1_extractor, "the T1 amplitudes"};
 
         using T2ConvergenceType = ConsecutiveIteratesNormConvergence<T2Amplitudes<Scalar>, CCSDEnvironment<Scalar>>;
-        const auto t2_extractor = [](const CCSDEnvironment<Scalar>& environment) { return environment.t2_amplitudes; };
+        const auto t2_extractor = [](const CCSDEnvironment<Scalar>& environment) -> const History<T2Amplitudes<Scalar>>* { return &environment.t2_amplitudes; };
         const T2ConvergenceType t2_convergence_criterion {threshold, t2_extractor, "the T2 amplitudes"};
 
         const CompoundConvergenceCriterion<CCSDEnvironment<Scalar>> convergence_criterion {t1_convergence_criterion, t2_convergence_criterion};
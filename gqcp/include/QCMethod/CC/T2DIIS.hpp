@@ -19,7 +19,7 @@
 
 
 #include "Mathematical/Algorithm/Step.hpp"
-#include "Mathematical/Optimization/Accelerator/DIIS.hpp"
+#include "Mathematical/Optimization/Accelerator/IncrementalDIIS.hpp"
 #include "QCMethod/CC/CCDAmplitudesUpdate.hpp"
 #include "QCMethod/CC/CCDIntermediatesUpdate.hpp"
 #include "QCMethod/CC/CCSDEnvironment.hpp"
@@ -54,8 +54,8 @@ private:
     // The maximum number of T2 amplitues that can be handled by DIIS.
     size_t maximum_subspace_dimension;
 
-    // The DIIS accelerator.
-    DIIS<Scalar> diis;
+    // The DIIS accelerator, which caches the overlaps of the error vectors in its subspace.
+    IncrementalDIIS<Scalar> diis;
 
 
 public:
@@ -69,7 +69,8 @@ public:
      */
     T2DIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6) :
         minimum_subspace_dimension {minimum_subspace_dimension},
-        maximum_subspace_dimension {maximum_subspace_dimension} {}
+        maximum_subspace_dimension {maximum_subspace_dimension},
+        diis {maximum_subspace_dimension} {}
 
 
     /*
@@ -91,23 +92,29 @@ public:
      */
     void execute(Environment& environment) override {
 
+        // Make sure that the environment keeps enough iterates for the DIIS subspace.
+        const auto subspace_capacity = std::max(this->minimum_subspace_dimension, this->maximum_subspace_dimension);
+        environment.t2_amplitude_errors.ensureCapacity(subspace_capacity);
+        environment.t2_amplitudes.ensureCapacity(subspace_capacity);
+
+        // Add the most recent error vector to the DIIS subspace in every iteration, so that only its overlaps have to be calculated.
+        this->diis.update(environment.t2_amplitude_errors);
+
         // Don't do anything if the minimum number of T2 amplitude iterations isn't satisfied.
         if (environment.t2_amplitude_errors.size() < this->minimum_subspace_dimension) {
             return;
         }
 
-        // Convert the deques in the environment to vectors that can be accepted by the DIIS accelerator. The total number of elements we can use in DIIS is either the maximum subspace dimension or the number of available error vectors.
+        // Calculate the accelerated T2 amplitudes by overwriting the previous T2 amplitudes in place. The T2 amplitudes are read through their dense representations, so no intermediate amplitudes are created.
         // TODO: Include the possibility for an x-iteration 'relaxation', i.e. not doing DIIS for x iterations long.
-        const auto n = std::min(this->maximum_subspace_dimension, environment.t2_amplitude_errors.size());
-        const std::vector<VectorX<Scalar>> error_vectors {environment.t2_amplitude_errors.end() - n, environment.t2_amplitude_errors.end()};  // The n-th last error vectors.
-        const std::vector<T2Amplitudes<Scalar>> t2_amplitudes {environment.t2_amplitudes.end() - n, environment.t2_amplitudes.end()};         // The n-th last T2 amplitudes.
-
-
-        // Calculate the accelerated T2 amplitudes and place them in the environment by overwriting the previous T2 amplitudes.
-        const auto t2_amplitudes_accelerated = this->diis.accelerate(t2_amplitudes, error_vectors);
-
-        environment.t2_amplitudes.pop_back();
-        environment.t2_amplitudes.push_back(t2_amplitudes_accelerated);
+        using VectorType = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+        const auto t2_elements = [](const T2Amplitudes<Scalar>& t2) {
+            const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+            return Eigen::Map<const VectorType>(t2_dense.data(), t2_dense.size());
+        };
+
+        auto& t2_dense_accelerated = environment.t2_amplitudes.back().asImplicitRankFourTensorSlice().asTensor();
+        this->diis.extrapolate(environment.t2_amplitudes.begin(), environment.t2_amplitudes.end(), t2_elements, Eigen::Map<VectorType>(t2_dense_accelerated.data(), t2_dense_accelerated.size()));
     }
 };
 
@@ -19,12 +19,41 @@
 
 
 #include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
+#include "ONVBasis/SeniorityZeroONVBasis.hpp"
+#include "ONVBasis/SpinResolvedSelectedONVBasis.hpp"
+#include "ONVBasis/SpinResolvedSigmaEngine.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
 
 
 namespace GQCP {
 namespace CIEnvironment {
 
 
+/**
+ *  Let the given environment calculate blocks of the Hamiltonian matrix representation directly, i.e. through the dense matrix representation in a selected ONV basis, rather than through matrix-vector products. Such blocks are used in the dense-block preconditioner of the Davidson algorithm.
+ * 
+ *  @tparam Hamiltonian             The type of Hamiltonian whose eigenproblem is trying to be solved.
+ *  @tparam ONVBasis                The type of ONV basis in which the Hamiltonian should be represented. A `SpinResolvedSelectedONVBasis` should be constructible from it and a set of addresses.
+ * 
+ *  @param environment              The environment that should be able to calculate blocks of the Hamiltonian matrix representation.
+ *  @param hamiltonian              A second-quantized Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param onv_basis                An ONV basis that spans a Fock (sub)space in which the Hamiltonian eigenproblem should be solved.
+ * 
+ *  @note The Hamiltonian and the ONV basis are captured by reference (just like in the matrix-vector product functions and the `SpinResolvedSigmaEngine`), so they should outlive the environment.
+ */
+template <typename Hamiltonian, typename ONVBasis>
+void enableMatrixBlocks(EigenproblemEnvironment& environment, const Hamiltonian& hamiltonian, const ONVBasis& onv_basis) {
+
+    environment.matrix_block_function = [&hamiltonian, &onv_basis](const std::vector<size_t>& addresses) {
+        const SpinResolvedSelectedONVBasis selected_onv_basis {onv_basis, addresses};
+        return selected_onv_basis.evaluateOperatorDense(hamiltonian);
+    };
+}
+
+
 /**
  *  Create an environment suitable for solving dense CI eigenvalue problems for the given Hamiltonian and ONV basis.
  * 
@@ -68,5 +97,230 @@ EigenproblemEnvironment Iterative(const Hamiltonian& hamiltonian, const ONVBasis
 }
 
 
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the given restricted Hamiltonian and seniority-zero ONV basis.
+ * 
+ *  @param hamiltonian              A restricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param onv_basis                A seniority-zero ONV basis in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis.
+ */
+inline EigenproblemEnvironment Iterative(const RSQHamiltonian<double>& hamiltonian, const SeniorityZeroONVBasis& onv_basis, const MatrixX<double>& V) {
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and supply a matrix-vector product function to the `EigenproblemEnvironment`.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto matvec_function = [&hamiltonian, &onv_basis](const VectorX<double>& x) { return onv_basis.evaluateOperatorMatrixVectorProduct(hamiltonian, x); };
+
+    auto environment = EigenproblemEnvironment::Iterative(matvec_function, diagonal, V);
+    enableMatrixBlocks(environment, hamiltonian, onv_basis);
+
+    return environment;
+}
+
+
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the given unrestricted Hamiltonian and full spin-resolved ONV basis.
+ * 
+ *  All operator-dependent intermediates of the matrix-vector product are prepared once (through a `SpinResolvedSigmaEngine`), rather than in every iteration.
+ * 
+ *  @param hamiltonian              An unrestricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param onv_basis                A full spin-resolved ONV basis in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector.
+ *  @param number_of_threads        The number of threads that should be used in every matrix-vector product evaluation.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis.
+ */
+inline EigenproblemEnvironment Iterative(const USQHamiltonian<double>& hamiltonian, const SpinResolvedONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads = 1) {
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and let the environment (through the matrix-vector product function) share ownership of the prepared sigma engine.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto sigma_engine = std::make_shared<SpinResolvedSigmaEngine>(onv_basis, hamiltonian, number_of_threads);
+    const auto matvec_function = [sigma_engine](const VectorX<double>& x) { return sigma_engine->evaluateMatrixVectorProduct(x); };
+
+    auto environment = EigenproblemEnvironment::Iterative(matvec_function, diagonal, V);
+    enableMatrixBlocks(environment, hamiltonian, onv_basis);
+
+    return environment;
+}
+
+
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the given restricted Hamiltonian and full spin-resolved ONV basis.
+ * 
+ *  All operator-dependent intermediates of the matrix-vector product are prepared once (through a `SpinResolvedSigmaEngine`), rather than in every iteration.
+ * 
+ *  @param hamiltonian              A restricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param onv_basis                A full spin-resolved ONV basis in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector.
+ *  @param number_of_threads        The number of threads that should be used in every matrix-vector product evaluation.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis.
+ */
+inline EigenproblemEnvironment Iterative(const RSQHamiltonian<double>& hamiltonian, const SpinResolvedONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads = 1) {
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and let the environment (through the matrix-vector product function) share ownership of the prepared sigma engine.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto sigma_engine = std::make_shared<SpinResolvedSigmaEngine>(onv_basis, hamiltonian, number_of_threads);
+    const auto matvec_function = [sigma_engine](const VectorX<double>& x) { return sigma_engine->evaluateMatrixVectorProduct(x); };
+
+    auto environment = EigenproblemEnvironment::Iterative(matvec_function, diagonal, V);
+    enableMatrixBlocks(environment, hamiltonian, onv_basis);
+
+    return environment;
+}
+
+
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the singlet states of the given restricted Hamiltonian in a full spin-resolved ONV basis.
+ * 
+ *  The coefficient matrix C(I_beta, I_alpha) of a singlet is symmetric, so the matrix-vector products are calculated through `SpinResolvedSigmaEngine::evaluateSingletMatrixVectorProduct`, which only calculates their upper triangle. Since the diagonal of the Hamiltonian is symmetric as well, the (diagonal or Olsen) Davidson corrections of symmetric guess vectors stay symmetric, and the whole Davidson subspace lies in the symmetric subspace.
+ * 
+ *  @param hamiltonian              A restricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param onv_basis                A full spin-resolved ONV basis with an equal number of alpha and beta electrons, in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector. Every guess vector is symmetrized, i.e. its coefficient matrix C is replaced by (C + C^T) / 2.
+ *  @param number_of_threads        The number of threads that should be used in every matrix-vector product evaluation.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the singlet states of the given Hamiltonian in the given ONV basis.
+ * 
+ *  @note The blocks of the dense-block preconditioner are adapted to the symmetric subspace (see the comments below), so that the preconditioned corrections of symmetric vectors stay symmetric. Since the Hamiltonian and the ONV basis are captured by reference in order to calculate these blocks, they should outlive the environment. Use `Iterative` for states that aren't singlets.
+ */
+inline EigenproblemEnvironment SingletIterative(const RSQHamiltonian<double>& hamiltonian, const SpinResolvedONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads = 1) {
+
+    if (onv_basis.alpha().numberOfElectrons() != onv_basis.beta().numberOfElectrons()) {
+        throw std::invalid_argument("CIEnvironment::SingletIterative(const RSQHamiltonian<double>&, const SpinResolvedONVBasis&, const MatrixX<double>&, const size_t): The number of alpha and beta electrons should be equal.");
+    }
+
+    if (static_cast<size_t>(V.rows()) != onv_basis.dimension()) {
+        throw std::invalid_argument("CIEnvironment::SingletIterative(const RSQHamiltonian<double>&, const SpinResolvedONVBasis&, const MatrixX<double>&, const size_t): The dimension of the guess vectors does not match the dimension of the ONV basis.");
+    }
+
+
+    // Every vector is mapped onto its (square) coefficient matrix, which is then symmetrized. This also removes the (numerically small) asymmetric components that build up in the Davidson subspace.
+    const auto dim = static_cast<long>(onv_basis.alpha().dimension());  // Casting is required because of Eigen.
+    const auto symmetrized = [dim](const VectorX<double>& x) {
+        const Eigen::Map<const Eigen::MatrixXd> C {x.data(), dim, dim};
+
+        VectorX<double> x_symmetric {x.size()};
+        Eigen::Map<Eigen::MatrixXd>(x_symmetric.data(), dim, dim) = 0.5 * (C + C.transpose());
+        return x_symmetric;
+    };
+
+    MatrixX<double> V_symmetric {V.rows(), V.cols()};
+    for (long i = 0; i < V.cols(); i++) {
+        V_symmetric.col(i) = symmetrized(V.col(i));
+    }
+
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and let the environment (through the matrix-vector product function) share ownership of the prepared sigma engine.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto sigma_engine = std::make_shared<SpinResolvedSigmaEngine>(onv_basis, hamiltonian, number_of_threads);
+    const auto matvec_function = [sigma_engine, symmetrized](const VectorX<double>& x) { return sigma_engine->evaluateSingletMatrixVectorProduct(symmetrized(x)); };
+
+    auto environment = EigenproblemEnvironment::Iterative(matvec_function, diagonal, V_symmetric);
+
+
+    // The dense-block preconditioner maps symmetric vectors onto symmetric vectors only if it commutes with the transposition (I_alpha, I_beta) -> (I_beta, I_alpha). The exact block of the Hamiltonian is therefore only used between the basis vectors whose transposed partner also lies in the block, since they span a subspace that is closed under the transposition. Every other basis vector is only treated through its diagonal element, just like its partner outside of the block.
+    environment.matrix_block_function = [&hamiltonian, &onv_basis, dim](const std::vector<size_t>& addresses) {
+        const SpinResolvedSelectedONVBasis selected_onv_basis {onv_basis, addresses};
+        SquareMatrix<double> H_PP = selected_onv_basis.evaluateOperatorDense(hamiltonian);
+
+        std::vector<bool> is_in_block(onv_basis.dimension(), false);
+        for (const auto address : addresses) {
+            is_in_block[address] = true;
+        }
+
+        const auto partner = [dim](const size_t address) { return (address % dim) * dim + address / dim; };
+        for (size_t i = 0; i < addresses.size(); i++) {
+            if (!is_in_block[partner(addresses[i])]) {
+                const auto diagonal_element = H_PP(i, i);
+                H_PP.row(i).setZero();
+                H_PP.col(i).setZero();
+                H_PP(i, i) = diagonal_element;
+            }
+        }
+
+        return H_PP;
+    };
+
+    return environment;
+}
+
+
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis, in which the matrix-vector products of several vectors are calculated in one block.
+ * 
+ *  @tparam Hamiltonian             The type of Hamiltonian whose eigenproblem is trying to be solved.
+ *  @tparam ONVBasis                The type of ONV basis in which the Hamiltonian should be represented.
+ * 
+ *  @param hamiltonian              A second-quantized Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param onv_basis                An ONV basis that spans a Fock (sub)space in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis with a block Davidson algorithm.
+ */
+template <typename Hamiltonian, typename ONVBasis>
+EigenproblemEnvironment BlockIterative(const Hamiltonian& hamiltonian, const ONVBasis& onv_basis, const MatrixX<double>& V) {
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and supply a block matrix-vector product function to the `EigenproblemEnvironment`.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto block_matvec_function = [&hamiltonian, &onv_basis](const MatrixX<double>& X) { return onv_basis.evaluateOperatorBlockMatrixVectorProduct(hamiltonian, X); };
+
+    return EigenproblemEnvironment::BlockIterative(block_matvec_function, diagonal, V);
+}
+
+
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the given unrestricted Hamiltonian and full spin-resolved ONV basis, in which the matrix-vector products of several vectors are calculated in one block.
+ * 
+ *  All operator-dependent intermediates of the matrix-vector product are prepared once (through a `SpinResolvedSigmaEngine`), rather than in every iteration.
+ * 
+ *  @param hamiltonian              An unrestricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param onv_basis                A full spin-resolved ONV basis in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector.
+ *  @param number_of_threads        The number of threads that should be used in every matrix-vector product evaluation.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis with a block Davidson algorithm.
+ */
+inline EigenproblemEnvironment BlockIterative(const USQHamiltonian<double>& hamiltonian, const SpinResolvedONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads = 1) {
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and let the environment (through the block matrix-vector product function) share ownership of the prepared sigma engine.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto sigma_engine = std::make_shared<SpinResolvedSigmaEngine>(onv_basis, hamiltonian, number_of_threads);
+    const auto block_matvec_function = [sigma_engine](const MatrixX<double>& X) { return sigma_engine->evaluateBlockMatrixVectorProduct(X); };
+
+    auto environment = EigenproblemEnvironment::BlockIterative(block_matvec_function, diagonal, V);
+    enableMatrixBlocks(environment, hamiltonian, onv_basis);
+
+    return environment;
+}
+
+
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the given restricted Hamiltonian and full spin-resolved ONV basis, in which the matrix-vector products of several vectors are calculated in one block.
+ * 
+ *  All operator-dependent intermediates of the matrix-vector product are prepared once (through a `SpinResolvedSigmaEngine`), rather than in every iteration.
+ * 
+ *  @param hamiltonian              A restricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param onv_basis                A full spin-resolved ONV basis in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector.
+ *  @param number_of_threads        The number of threads that should be used in every matrix-vector product evaluation.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis with a block Davidson algorithm.
+ */
+inline EigenproblemEnvironment BlockIterative(const RSQHamiltonian<double>& hamiltonian, const SpinResolvedONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads = 1) {
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and let the environment (through the block matrix-vector product function) share ownership of the prepared sigma engine.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto sigma_engine = std::make_shared<SpinResolvedSigmaEngine>(onv_basis, hamiltonian, number_of_threads);
+    const auto block_matvec_function = [sigma_engine](const MatrixX<double>& X) { return sigma_engine->evaluateBlockMatrixVectorProduct(X); };
+
+    auto environment = EigenproblemEnvironment::BlockIterative(block_matvec_function, diagonal, V);
+    enableMatrixBlocks(environment, hamiltonian, onv_basis);
+
+    return environment;
+}
+
+
 }  // namespace CIEnvironment
 }  // namespace GQCP
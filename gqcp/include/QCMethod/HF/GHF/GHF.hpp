@@ -24,6 +24,7 @@
 #include "QCMethod/QCStructure.hpp"
 #include "QCModel/HF/GHF.hpp"
 
+#include <stdexcept>
 #include <type_traits>
 
 
@@ -59,6 +60,11 @@ public:
     template <typename Solver>
     QCStructure<QCModel::GHF<Scalar>, Scalar> optimize(Solver& solver, GHFSCFEnvironment<Scalar>& environment) const {
 
+        // The GHF model describes a full set of spinors with their orbital energies, which (nearly) linearly dependent scalar (AO) bases can't provide. Check this before running the solver.
+        if (environment.orthogonalizer.numberOfDiscardedFunctions() > 0) {
+            throw std::invalid_argument("QCMethod::GHF::optimize(Solver&, GHFSCFEnvironment<Scalar>&): The scalar (AO) bases are (nearly) linearly dependent, so the GHF model can't be constructed. Run the solver on the environment directly instead.");
+        }
+
         // The GHF method's responsibility is to try to optimize the parameters of its method, given a solver and associated environment.
         solver.perform(environment);
 
@@ -0,0 +1,118 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/DirectJKCalculator.hpp"
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/HF/GHF/GHFSCFEnvironment.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the current GHF Fock matrix (expressed in the scalar/AO basis) from the current density matrix, without storing the two-electron integrals. Every iteration, the shell quartets (over the spatial scalar basis) are recalculated and contracted with the changes of the four spin-blocks of the density matrix since the previous iteration, all at the same time.
+ *
+ *  Only the core Hamiltonian of the environment's Hamiltonian is used, so the environment can be set up with a Hamiltonian that holds no two-electron integrals, see `SQHamiltonian::FromCore()`.
+ * 
+ *  @tparam _Scalar              The scalar type used to represent the expansion coefficient/elements of the transformation matrix: real or complex.
+ *
+ *  @note The alpha and beta components of the general spinors should be expanded in the same scalar basis.
+ */
+template <typename _Scalar>
+class GHFDirectFockMatrixCalculation:
+    public Step<GHFSCFEnvironment<_Scalar>> {
+
+public:
+    using Scalar = _Scalar;
+    using Environment = GHFSCFEnvironment<Scalar>;
+
+
+private:
+    // The calculator for the direct and exchange matrices, which keeps track of the previous density matrix blocks.
+    DirectJKCalculator<Scalar> jk_calculator;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param scalar_basis             The scalar basis in which both the alpha and beta components of the density and Fock matrices are expressed.
+     *  @param threshold                The threshold below which the (density-weighted) contribution of a shell quartet is considered to be negligible.
+     *  @param rebuild_frequency        The number of incremental Fock matrix builds after which the Fock matrix is rebuilt from the full density matrix.
+     *  @param number_of_threads        The number of worker threads that recalculate the shell quartets.
+     */
+    GHFDirectFockMatrixCalculation(const ScalarBasis<GTOShell>& scalar_basis, const double threshold = 1.0e-12, const size_t rebuild_frequency = 10, const size_t number_of_threads = 1) :
+        jk_calculator {scalar_basis, threshold, rebuild_frequency, number_of_threads} {}
+
+
+    /*
+     *  OVERRIDDEN PUBLIC METHODS
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Calculate the current GHF Fock matrix (expressed in the scalar/AO basis) integral-directly and place it in the environment.";
+    }
+
+
+    /**
+     *  Calculate the current GHF Fock matrix (expressed in the scalar/AO basis) and place it in the environment.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        const auto& P = environment.density_matrices.back().matrix();  // The most recent density matrix.
+        const auto M = P.dimension();
+        const auto K = M / 2;
+
+        const SquareMatrix<Scalar> P_aa = P.topLeftCorner(K, K);
+        const SquareMatrix<Scalar> P_ab = P.topRightCorner(K, K);
+        const SquareMatrix<Scalar> P_ba = P.bottomLeftCorner(K, K);
+        const SquareMatrix<Scalar> P_bb = P.bottomRightCorner(K, K);
+
+        const auto JK = this->jk_calculator.calculateIncremental({P_aa, P_ab, P_ba, P_bb});
+        const auto& J = JK.first;
+        const auto& Ks = JK.second;
+
+
+        // The direct contribution only couples equal spins:
+        //      P(rho lambda) (mu nu|rho lambda),
+        // while the exchange contribution of the spin-block (sigma tau) contracts the density matrix block (tau sigma):
+        //      P(lambda rho) (mu rho|lambda nu).
+        const SquareMatrix<Scalar> J_total = J[0] + J[3];
+
+        SquareMatrix<Scalar> G = SquareMatrix<Scalar>::Zero(M);
+        G.topLeftCorner(K, K) = J_total - Ks[0];
+        G.topRightCorner(K, K) = -Ks[2];
+        G.bottomLeftCorner(K, K) = -Ks[1];
+        G.bottomRightCorner(K, K) = J_total - Ks[3];
+
+        const SquareMatrix<Scalar> F = environment.sq_hamiltonian.core().parameters() + G;
+        environment.fock_matrices.push_back(ScalarGSQOneElectronOperator<Scalar> {F});
+    }
+};
+
+
+}  // namespace GQCP
@@ -40,7 +40,23 @@ public:
     using Environment = GHFSCFEnvironment<Scalar>;
 
 
+private:
+    // The number of worker threads that calculate the direct and exchange matrices.
+    size_t number_of_threads;
+
+
 public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param number_of_threads        The number of worker threads that calculate the direct and exchange matrices.
+     */
+    GHFFockMatrixCalculation(const size_t number_of_threads = 1) :
+        number_of_threads {number_of_threads} {}
+
+
     /*
      *  OVERRIDDEN PUBLIC METHODS
      */
@@ -61,7 +77,7 @@ public:
     void execute(Environment& environment) override {
 
         const auto& P = environment.density_matrices.back();  // The most recent density matrix.
-        const auto F = QCModel::GHF<Scalar>::calculateScalarBasisFockMatrix(P, environment.sq_hamiltonian);
+        const auto F = QCModel::GHF<Scalar>::calculateScalarBasisFockMatrix(P, environment.sq_hamiltonian, this->number_of_threads);
 
         environment.fock_matrices.push_back(F.parameters());
     }
@@ -20,6 +20,8 @@
 
 #include "Basis/Transformations/GTransformation.hpp"
 #include "DensityMatrix/G1DM.hpp"
+#include "Mathematical/Algorithm/History.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Orthogonalizer.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 #include "Operator/SecondQuantized/GSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
@@ -27,8 +29,6 @@
 
 #include <Eigen/Dense>
 
-#include <deque>
-
 
 namespace GQCP {
 
@@ -49,16 +49,18 @@ public:
 public:
     size_t N;  // The total number of electrons.
 
-    std::deque<Scalar> electronic_energies;
+    History<Scalar> electronic_energies;  // Always kept in full.
 
-    std::deque<VectorX<Scalar>> orbital_energies;
+    // The other histories only keep the most recent iterates, so that the memory of the environment doesn't grow with the number of iterations. By default, they keep the two most recent iterates, which suffices for the convergence criteria and the density matrix damper. The DIIS steps enlarge the capacity of the histories they extrapolate from. See also `keepFullHistory()`.
+    History<VectorX<Scalar>> orbital_energies;
 
     ScalarGSQOneElectronOperator<Scalar> S;  // The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
+    Orthogonalizer<Scalar> orthogonalizer;   // The orthogonalizer of the spin-blocked overlap matrix, which is calculated only once and reused in every diagonalization of a Fock matrix.
 
-    std::deque<GTransformation<Scalar>> coefficient_matrices;
-    std::deque<G1DM<Scalar>> density_matrices;                       // Expressed in the scalar (AO) basis.
-    std::deque<ScalarGSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
-    std::deque<VectorX<Scalar>> error_vectors;                       // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
+    History<GTransformation<Scalar>> coefficient_matrices;  // Expressed in the scalar (AO) bases. If the scalar bases are (nearly) linearly dependent, only the leading columns span their linearly independent part: the remaining ones are the discarded directions, see `Orthogonalizer::completed()`.
+    History<G1DM<Scalar>> density_matrices;                       // Expressed in the scalar (AO) basis.
+    History<ScalarGSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
+    History<VectorX<Scalar>> error_vectors;                       // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
 
     GSQHamiltonian<Scalar> sq_hamiltonian;  // The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis.
 
@@ -71,16 +73,25 @@ public:
     /**
      *  A constructor that initializes the environment with an initial guess for the coefficient matrix.
      * 
-     *  @param N                    The total number of electrons.
-     *  @param sq_hamiltonian       The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis.
-     *  @param S                    The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
-     *  @param C_initial            The initial coefficient matrix.
+     *  @param N                                The total number of electrons.
+     *  @param sq_hamiltonian                   The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis.
+     *  @param S                                The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
+     *  @param C_initial                        The initial coefficient matrix.
+     *  @param linear_dependency_threshold      The threshold below which an eigenvalue of the overlap matrix signals a linear dependency in the scalar (AO) basis. The linear dependencies are removed through canonical orthogonalization.
      */
-    GHFSCFEnvironment(const size_t N, const GSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S, const GTransformation<Scalar>& C_initial) :
+    GHFSCFEnvironment(const size_t N, const GSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S, const GTransformation<Scalar>& C_initial, const double linear_dependency_threshold = 1.0e-07) :
         N {N},
         S {S},
-        sq_hamiltonian {sq_hamiltonian},
-        coefficient_matrices {C_initial} {}
+        orthogonalizer {S.parameters(), linear_dependency_threshold},
+        sq_hamiltonian {sq_hamiltonian} {
+
+        this->setHistoryCapacity(2);
+        this->coefficient_matrices.push_back(C_initial);
+
+        if (this->N > this->orthogonalizer.numberOfLinearlyIndependentFunctions()) {
+            throw std::invalid_argument("GHFSCFEnvironment::GHFSCFEnvironment(const size_t, const GSQHamiltonian<Scalar>&, const ScalarGSQOneElectronOperator<Scalar>&, const GTransformation<Scalar>&, const double): The linearly independent part of the scalar (AO) bases can't accommodate all electrons.");
+        }
+    }
 
 
     /*
@@ -90,34 +101,36 @@ public:
     /**
      *  Initialize a GHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix.
      * 
-     *  @param N                    The total number of electrons.
-     *  @param sq_hamiltonian       The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis.
-     *  @param S                    The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
+     *  @param N                            The total number of electrons.
+     *  @param sq_hamiltonian               The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis.
+     *  @param S                            The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
+     *  @param linear_dependency_threshold  The threshold below which an eigenvalue of the overlap matrix signals a linear dependency in the scalar (AO) basis.
      * 
      *  @return A GHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix.
      */
-    static GHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N, const GSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S) {
+    static GHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N, const GSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S, const double linear_dependency_threshold = 1.0e-07) {
 
         const auto& H_core = sq_hamiltonian.core().parameters();  // Spin-blocked, in AO basis.
 
-        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
-        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver {H_core, S.parameters()};
-        const GTransformation<Scalar> C_initial {generalized_eigensolver.eigenvectors()};
+        // Diagonalize the core Hamiltonian through the same orthogonalizer as the SCF iterations, instead of running a generalized eigensolver on a possibly ill-conditioned overlap matrix.
+        const Orthogonalizer<Scalar> orthogonalizer {S.parameters(), linear_dependency_threshold};
+        const GTransformation<Scalar> C_initial {orthogonalizer.completed(orthogonalizer.solve(H_core).first)};
 
-        return GHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial);
+        return GHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial, linear_dependency_threshold);
     }
 
     /**
      *  Initialize a GHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix and subsequently adding/subtracting a small complex value from the off-diagonal elements.
      * 
-     *  @param N                    The total number of electrons.
-     *  @param sq_hamiltonian       The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis.
-     *  @param S                    The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
+     *  @param N                            The total number of electrons.
+     *  @param sq_hamiltonian               The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis.
+     *  @param S                            The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
+     *  @param linear_dependency_threshold  The threshold below which an eigenvalue of the overlap matrix signals a linear dependency in the scalar (AO) basis.
      * 
      *  @return A GHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix and subsequently adding/subtracting a small complex value from the off-diagonal elements.
      */
     template <typename Z = Scalar>
-    static enable_if_t<std::is_same<Z, complex>::value, GHFSCFEnvironment<complex>> WithComplexlyTransformedCoreGuess(const size_t N, const GSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S) {
+    static enable_if_t<std::is_same<Z, complex>::value, GHFSCFEnvironment<complex>> WithComplexlyTransformedCoreGuess(const size_t N, const GSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S, const double linear_dependency_threshold = 1.0e-07) {
 
         // Set up the lambda function used to transform the coefficient matrix.
         const auto transformation_function = [](SquareMatrix<complex> C_initial) {
@@ -136,7 +149,7 @@ public:
             return C_initial;
         };
 
-        return GHFSCFEnvironment<complex>::WithTransformedCoreGuess(N, sq_hamiltonian, S, transformation_function);
+        return GHFSCFEnvironment<complex>::WithTransformedCoreGuess(N, sq_hamiltonian, S, transformation_function, linear_dependency_threshold);
     }
 
 
@@ -147,20 +160,50 @@ public:
      *  @param sq_hamiltonian               The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis.
      *  @param S                            The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
      *  @param transformation_function      A function that transforms the core guess.
+     *  @param linear_dependency_threshold  The threshold below which an eigenvalue of the overlap matrix signals a linear dependency in the scalar (AO) basis.
      * 
      *  @return A GHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix and subsequently applying the given unary transformation function.
      */
-    static GHFSCFEnvironment<Scalar> WithTransformedCoreGuess(const size_t N, const GSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S, const std::function<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>(const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>&)>& transformation_function) {
+    static GHFSCFEnvironment<Scalar> WithTransformedCoreGuess(const size_t N, const GSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S, const std::function<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>(const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>&)>& transformation_function, const double linear_dependency_threshold = 1.0e-07) {
 
         const auto& H_core = sq_hamiltonian.core().parameters();  // Spin-blocked, in AO basis.
 
-        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
-        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver {H_core, S.parameters()};
-        auto C_initial {generalized_eigensolver.eigenvectors()};
+        const Orthogonalizer<Scalar> orthogonalizer {S.parameters(), linear_dependency_threshold};
+        const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> C_initial = orthogonalizer.completed(orthogonalizer.solve(H_core).first);
 
         const GTransformation<Scalar> C_initial_complex {transformation_function(C_initial)};
 
-        return GHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial_complex);
+        return GHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial_complex, linear_dependency_threshold);
+    }
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  Change the number of most recent iterates that are kept in the histories of this environment. If a history holds more iterates than the new capacity, its oldest ones are evicted. The electronic energies are always kept in full.
+     * 
+     *  @param capacity                 The number of most recent iterates that should be kept.
+     */
+    void setHistoryCapacity(const size_t capacity) {
+        this->orbital_energies.setCapacity(capacity);
+        this->coefficient_matrices.setCapacity(capacity);
+        this->density_matrices.setCapacity(capacity);
+        this->fock_matrices.setCapacity(capacity);
+        this->error_vectors.setCapacity(capacity);
+    }
+
+
+    /**
+     *  Keep every iterate that is added to the histories of this environment from now on, e.g. for debugging purposes.
+     */
+    void keepFullHistory() {
+        this->orbital_energies.makeUnbounded();
+        this->coefficient_matrices.makeUnbounded();
+        this->density_matrices.makeUnbounded();
+        this->fock_matrices.makeUnbounded();
+        this->error_vectors.makeUnbounded();
     }
 };
 
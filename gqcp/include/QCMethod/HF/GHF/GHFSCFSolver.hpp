@@ -21,12 +21,16 @@
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
 #include "QCMethod/HF/GHF/GHFDensityMatrixCalculation.hpp"
+#include "QCMethod/HF/GHF/GHFDirectFockMatrixCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFElectronicEnergyCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFErrorCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFFockMatrixCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFFockMatrixDIIS.hpp"
 #include "QCMethod/HF/GHF/GHFFockMatrixDiagonalization.hpp"
 #include "QCMethod/HF/GHF/GHFSCFEnvironment.hpp"
+#include "QCMethod/HF/GHF/GHFSpinBlockedFockMatrixCalculation.hpp"
+
+#include <utility>
 
 
 namespace GQCP {
@@ -51,21 +55,22 @@ public:
     /**
      *  @param threshold                            The threshold that is used in comparing the density matrices.
      *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that calculate the direct and exchange matrices in every iteration.
      * 
      *  @return A plain GHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion.
      */
-    static IterativeAlgorithm<GHFSCFEnvironment<Scalar>> Plain(const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+    static IterativeAlgorithm<GHFSCFEnvironment<Scalar>> Plain(const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1) {
 
         // Create the iteration cycle that effectively 'defines' a plain GHF SCF solver.
         StepCollection<GHFSCFEnvironment<Scalar>> plain_ghf_scf_cycle {};
         plain_ghf_scf_cycle
             .add(GHFDensityMatrixCalculation<Scalar>())
-            .add(GHFFockMatrixCalculation<Scalar>())
+            .add(GHFFockMatrixCalculation<Scalar>(number_of_threads))
             .add(GHFFockMatrixDiagonalization<Scalar>())
             .add(GHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const auto density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const auto density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const History<G1DM<Scalar>>* { return &environment.density_matrices; };
 
         using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
@@ -79,28 +84,151 @@ public:
      *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
      *  @param threshold                            The threshold that is used in comparing the density matrices.
      *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that calculate the direct and exchange matrices in every iteration.
      * 
      *  @return A DIIS GHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion.
      */
-    static IterativeAlgorithm<GHFSCFEnvironment<Scalar>> DIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+    static IterativeAlgorithm<GHFSCFEnvironment<Scalar>> DIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1) {
 
         // Create the iteration cycle that effectively 'defines' a DIIS GHF SCF solver.
         StepCollection<GHFSCFEnvironment<Scalar>> diis_ghf_scf_cycle {};
         diis_ghf_scf_cycle
             .add(GHFDensityMatrixCalculation<Scalar>())
-            .add(GHFFockMatrixCalculation<Scalar>())
+            .add(GHFFockMatrixCalculation<Scalar>(number_of_threads))
+            .add(GHFErrorCalculation<Scalar>())
+            .add(GHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
+            .add(GHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const History<G1DM<Scalar>>*(const GHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const History<G1DM<Scalar>>* { return &environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<GHFSCFEnvironment<Scalar>>(diis_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param scalar_basis                         The scalar basis in which the density and Fock matrices are expressed, over which the two-electron integrals are recalculated in every iteration.
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that recalculate the shell quartets in every iteration.
+     *  @param schwarz_threshold                    The threshold below which the (density-weighted) Schwarz bound of a shell quartet is considered to be negligible, so that the shell quartet is skipped.
+     *  @param rebuild_frequency                    The number of incremental Fock matrix builds after which the Fock matrix is rebuilt from the full density matrix.
+     * 
+     *  @return An integral-direct DIIS GHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion. The Fock matrix is calculated without storing the two-electron integrals, see `GHFDirectFockMatrixCalculation`.
+     */
+    static IterativeAlgorithm<GHFSCFEnvironment<Scalar>> DirectDIIS(const ScalarBasis<GTOShell>& scalar_basis, const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1, const double schwarz_threshold = 1.0e-12, const size_t rebuild_frequency = 10) {
+
+        // Create the iteration cycle that effectively 'defines' an integral-direct DIIS GHF SCF solver.
+        StepCollection<GHFSCFEnvironment<Scalar>> diis_ghf_scf_cycle {};
+        diis_ghf_scf_cycle
+            .add(GHFDensityMatrixCalculation<Scalar>())
+            .add(GHFDirectFockMatrixCalculation<Scalar>(scalar_basis, schwarz_threshold, rebuild_frequency, number_of_threads))
             .add(GHFErrorCalculation<Scalar>())
             .add(GHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
             .add(GHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<G1DM<Scalar>>(const GHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const std::function<const History<G1DM<Scalar>>*(const GHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const History<G1DM<Scalar>>* { return &environment.density_matrices; };
 
         using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
 
         return IterativeAlgorithm<GHFSCFEnvironment<Scalar>>(diis_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
     }
+
+
+    /**
+     *  @param scalar_basis                         The scalar basis in which the density and Fock matrices are expressed, over which the two-electron integrals are recalculated in every iteration.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that recalculate the shell quartets in every iteration.
+     *  @param schwarz_threshold                    The threshold below which the (density-weighted) Schwarz bound of a shell quartet is considered to be negligible, so that the shell quartet is skipped.
+     *  @param rebuild_frequency                    The number of incremental Fock matrix builds after which the Fock matrix is rebuilt from the full density matrix.
+     * 
+     *  @return An integral-direct plain GHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion. The Fock matrix is calculated without storing the two-electron integrals, see `GHFDirectFockMatrixCalculation`.
+     */
+    static IterativeAlgorithm<GHFSCFEnvironment<Scalar>> DirectPlain(const ScalarBasis<GTOShell>& scalar_basis, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1, const double schwarz_threshold = 1.0e-12, const size_t rebuild_frequency = 10) {
+
+        // Create the iteration cycle that effectively 'defines' an integral-direct plain GHF SCF solver.
+        StepCollection<GHFSCFEnvironment<Scalar>> plain_ghf_scf_cycle {};
+        plain_ghf_scf_cycle
+            .add(GHFDensityMatrixCalculation<Scalar>())
+            .add(GHFDirectFockMatrixCalculation<Scalar>(scalar_basis, schwarz_threshold, rebuild_frequency, number_of_threads))
+            .add(GHFFockMatrixDiagonalization<Scalar>())
+            .add(GHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const History<G1DM<Scalar>>*(const GHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const History<G1DM<Scalar>>* { return &environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<GHFSCFEnvironment<Scalar>>(plain_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param g                                    The two-electron integrals over the scalar basis in which both the alpha and beta components of the density and Fock matrices are expressed, in chemist's notation. Pass an rvalue to avoid copying them: the solver's steps share one instance.
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that calculate the direct and exchange matrices in every iteration.
+     * 
+     *  @return A DIIS GHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion. The Fock matrix is calculated from the spatial two-electron integrals, see `GHFSpinBlockedFockMatrixCalculation`. The (2K)^4 two-electron integrals are never needed: the DIIS step reuses the spin-blocked Fock matrix, and only the core Hamiltonian of the environment is used, so it may be set up through `GSQHamiltonian::FromCore`.
+     */
+    static IterativeAlgorithm<GHFSCFEnvironment<Scalar>> SpinBlockedDIIS(Tensor<Scalar, 4> g, const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1) {
+
+        // Create the iteration cycle that effectively 'defines' a spin-blocked DIIS GHF SCF solver.
+        StepCollection<GHFSCFEnvironment<Scalar>> diis_ghf_scf_cycle {};
+        diis_ghf_scf_cycle
+            .add(GHFDensityMatrixCalculation<Scalar>())
+            .add(GHFSpinBlockedFockMatrixCalculation<Scalar>(std::move(g), number_of_threads))
+            .add(GHFErrorCalculation<Scalar>())
+            .add(GHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
+            .add(GHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const History<G1DM<Scalar>>*(const GHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const History<G1DM<Scalar>>* { return &environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<GHFSCFEnvironment<Scalar>>(diis_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param g                                    The two-electron integrals over the scalar basis in which both the alpha and beta components of the density and Fock matrices are expressed, in chemist's notation. Pass an rvalue to avoid copying them: the solver's steps share one instance.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that calculate the direct and exchange matrices in every iteration.
+     * 
+     *  @return A plain GHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion. The Fock matrix is calculated from the spatial two-electron integrals, see `GHFSpinBlockedFockMatrixCalculation`.
+     */
+    static IterativeAlgorithm<GHFSCFEnvironment<Scalar>> SpinBlockedPlain(Tensor<Scalar, 4> g, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1) {
+
+        // Create the iteration cycle that effectively 'defines' a spin-blocked plain GHF SCF solver.
+        StepCollection<GHFSCFEnvironment<Scalar>> plain_ghf_scf_cycle {};
+        plain_ghf_scf_cycle
+            .add(GHFDensityMatrixCalculation<Scalar>())
+            .add(GHFSpinBlockedFockMatrixCalculation<Scalar>(std::move(g), number_of_threads))
+            .add(GHFFockMatrixDiagonalization<Scalar>())
+            .add(GHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const History<G1DM<Scalar>>*(const GHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const History<G1DM<Scalar>>* { return &environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<GHFSCFEnvironment<Scalar>>(plain_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
 };
 
 
@@ -0,0 +1,106 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Representation/Tensor.hpp"
+#include "QCMethod/HF/GHF/GHFSCFEnvironment.hpp"
+#include "QCModel/HF/GHF.hpp"
+
+#include <memory>
+#include <utility>
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the current GHF Fock matrix (expressed in the scalar/AO basis) from the current density matrix, using the two-electron integrals over the spatial scalar basis instead of the spin-blocked ones over the spinors. These are contracted with the four spin-blocks of the density matrix directly, so that the zero blocks of the spin-blocked integrals are never stored or visited.
+ *
+ *  Only the core Hamiltonian of the environment's Hamiltonian is used, so the environment can be set up with a Hamiltonian that holds no two-electron integrals, see `SQHamiltonian::FromCore()`.
+ * 
+ *  @tparam _Scalar              The scalar type used to represent the expansion coefficient/elements of the transformation matrix: real or complex.
+ *
+ *  @note The alpha and beta components of the general spinors should be expanded in the same scalar basis.
+ */
+template <typename _Scalar>
+class GHFSpinBlockedFockMatrixCalculation:
+    public Step<GHFSCFEnvironment<_Scalar>> {
+
+public:
+    using Scalar = _Scalar;
+    using Environment = GHFSCFEnvironment<Scalar>;
+
+
+private:
+    // The two-electron integrals over the spatial scalar basis, in chemist's notation. They are shared rather than owned, so that copies of this step (e.g. inside a `StepCollection`) don't copy the integrals.
+    std::shared_ptr<const Tensor<Scalar, 4>> g;
+
+    // The number of worker threads that calculate the direct and exchange matrices.
+    size_t number_of_threads;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param g                    The two-electron integrals over the scalar basis in which both the alpha and beta components of the density and Fock matrices are expressed, in chemist's notation.
+     *  @param number_of_threads    The number of worker threads that calculate the direct and exchange matrices.
+     */
+    GHFSpinBlockedFockMatrixCalculation(std::shared_ptr<const Tensor<Scalar, 4>> g, const size_t number_of_threads = 1) :
+        g {std::move(g)},
+        number_of_threads {number_of_threads} {}
+
+
+    /**
+     *  @param g                    The two-electron integrals over the scalar basis in which both the alpha and beta components of the density and Fock matrices are expressed, in chemist's notation. Pass an rvalue to avoid copying them.
+     *  @param number_of_threads    The number of worker threads that calculate the direct and exchange matrices.
+     */
+    GHFSpinBlockedFockMatrixCalculation(Tensor<Scalar, 4> g, const size_t number_of_threads = 1) :
+        GHFSpinBlockedFockMatrixCalculation(std::make_shared<const Tensor<Scalar, 4>>(std::move(g)), number_of_threads) {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Calculate the current GHF Fock matrix (expressed in the scalar/AO basis) from the spatial two-electron integrals and place it in the environment.";
+    }
+
+
+    /**
+     *  Calculate the current GHF Fock matrix (expressed in the scalar/AO basis) and place it in the environment.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+        const auto& P = environment.density_matrices.back();  // The most recent density matrix.
+        const auto F = QCModel::GHF<Scalar>::calculateScalarBasisFockMatrix(P, environment.sq_hamiltonian.core(), *this->g, this->number_of_threads);
+        environment.fock_matrices.push_back(F);
+    }
+};
+
+
+}  // namespace GQCP
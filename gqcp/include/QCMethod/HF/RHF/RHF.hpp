@@ -24,6 +24,7 @@
 #include "QCMethod/QCStructure.hpp"
 #include "QCModel/HF/RHF.hpp"
 
+#include <stdexcept>
 #include <type_traits>
 
 
@@ -61,6 +62,11 @@ public:
     template <typename QCObjective, typename Solver>
     QCStructure<QCModel::RHF<Scalar>, Scalar> optimize(const QCObjective& objective, Solver& solver, RHFSCFEnvironment<Scalar>& environment) const {
 
+        // The RHF model describes a full set of orbitals with their orbital energies, which a (nearly) linearly dependent scalar (AO) basis can't provide. Check this before running the solver.
+        if (environment.orthogonalizer.numberOfDiscardedFunctions() > 0) {
+            throw std::invalid_argument("QCMethod::RHF::optimize(const QCObjective&, Solver&, RHFSCFEnvironment<Scalar>&): The scalar (AO) basis is (nearly) linearly dependent, so the RHF model can't be constructed. Run the solver on the environment directly instead.");
+        }
+
         // The RHF method's responsibility is to try to optimize the parameters of its method, given a solver and associated environment.
         solver.perform(environment);
 
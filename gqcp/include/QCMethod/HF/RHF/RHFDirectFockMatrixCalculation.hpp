@@ -0,0 +1,98 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/DirectJKCalculator.hpp"
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/HF/RHF/RHFSCFEnvironment.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the current Fock matrix (expressed in the scalar/AO basis) from the current density matrix, without storing the two-electron integrals. Every iteration, the shell quartets are recalculated and contracted with the change of the density matrix since the previous iteration.
+ *
+ *  Only the core Hamiltonian of the environment's Hamiltonian is used, so the environment can be set up with a Hamiltonian that holds no two-electron integrals, see `SQHamiltonian::FromCore()`.
+ * 
+ *  @tparam _Scalar              The scalar type used to represent the expansion coefficient/elements of the transformation matrix: real or complex.
+ */
+template <typename _Scalar>
+class RHFDirectFockMatrixCalculation:
+    public Step<RHFSCFEnvironment<_Scalar>> {
+
+public:
+    using Scalar = _Scalar;
+    using Environment = RHFSCFEnvironment<Scalar>;
+
+
+private:
+    // The calculator for the direct and exchange matrices, which keeps track of the previous density matrix.
+    DirectJKCalculator<Scalar> jk_calculator;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param scalar_basis             The scalar basis in which the density and Fock matrices are expressed.
+     *  @param threshold                The threshold below which the (density-weighted) contribution of a shell quartet is considered to be negligible.
+     *  @param rebuild_frequency        The number of incremental Fock matrix builds after which the Fock matrix is rebuilt from the full density matrix.
+     *  @param number_of_threads        The number of worker threads that recalculate the shell quartets.
+     */
+    RHFDirectFockMatrixCalculation(const ScalarBasis<GTOShell>& scalar_basis, const double threshold = 1.0e-12, const size_t rebuild_frequency = 10, const size_t number_of_threads = 1) :
+        jk_calculator {scalar_basis, threshold, rebuild_frequency, number_of_threads} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Calculate the current RHF Fock matrix (expressed in the scalar/AO basis) integral-directly and place it in the environment.";
+    }
+
+
+    /**
+     *  Calculate the current RHF Fock matrix (expressed in the scalar/AO basis) and place it in the environment.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        // The RHF contractions (mu nu|rho lambda) P(lambda rho) and (mu lambda|rho nu) P(lambda rho) are the direct and exchange matrices of the transposed density matrix.
+        const auto& D = environment.density_matrices.back();  // The most recent density matrix.
+        const SquareMatrix<Scalar> D_transposed = D.matrix().transpose();
+
+        const auto JK = this->jk_calculator.calculateIncremental({D_transposed});
+        const auto& J = JK.first[0];
+        const auto& K = JK.second[0];
+
+        const SquareMatrix<Scalar> F = environment.sq_hamiltonian.core().parameters() + J - 0.5 * K;
+        environment.fock_matrices.push_back(ScalarRSQOneElectronOperator<Scalar> {F});
+    }
+};
+
+
+}  // namespace GQCP
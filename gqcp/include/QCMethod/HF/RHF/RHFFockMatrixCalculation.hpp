@@ -40,7 +40,23 @@ public:
     using Environment = RHFSCFEnvironment<Scalar>;
 
 
+private:
+    // The number of worker threads that calculate the direct and exchange matrices.
+    size_t number_of_threads;
+
+
 public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param number_of_threads        The number of worker threads that calculate the direct and exchange matrices.
+     */
+    RHFFockMatrixCalculation(const size_t number_of_threads = 1) :
+        number_of_threads {number_of_threads} {}
+
+
     /*
      *  PUBLIC OVERRIDDEN METHODS
      */
@@ -60,7 +76,7 @@ public:
      */
     void execute(Environment& environment) override {
         const auto& D = environment.density_matrices.back();  // The most recent density matrix.
-        const auto F = QCModel::RHF<Scalar>::calculateScalarBasisFockMatrix(D, environment.sq_hamiltonian);
+        const auto F = QCModel::RHF<Scalar>::calculateScalarBasisFockMatrix(D, environment.sq_hamiltonian, this->number_of_threads);
         environment.fock_matrices.push_back(F.parameters());
     }
 };
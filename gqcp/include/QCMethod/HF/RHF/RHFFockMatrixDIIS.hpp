@@ -19,7 +19,7 @@
 
 
 #include "Mathematical/Algorithm/Step.hpp"
-#include "Mathematical/Optimization/Accelerator/DIIS.hpp"
+#include "Mathematical/Optimization/Accelerator/IncrementalDIIS.hpp"
 #include "QCMethod/HF/RHF/RHFFockMatrixDiagonalization.hpp"
 #include "QCMethod/HF/RHF/RHFSCFEnvironment.hpp"
 #include "QCModel/HF/RHF.hpp"
@@ -33,6 +33,8 @@ namespace GQCP {
 /**
  *  An iteration step that accelerates the Fock matrix (expressed in the scalar/AO basis) based on a DIIS accelerator.
  * 
+ *  @note The most recent Fock matrix has to be calculated by a preceding step. This step never calculates it itself.
+ * 
  *  @tparam _Scalar              The scalar type used to represent the expansion coefficient/elements of the transformation matrix: real or complex.
  */
 template <typename _Scalar>
@@ -48,7 +50,7 @@ private:
     size_t minimum_subspace_dimension;  // The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
     size_t maximum_subspace_dimension;  // The maximum number of Fock matrices that can be handled by DIIS.
 
-    DIIS<Scalar> diis;  // The DIIS accelerator.
+    IncrementalDIIS<Scalar> diis;  // The DIIS accelerator, which caches the overlaps of the error vectors in its subspace.
 
 
 public:
@@ -62,7 +64,8 @@ public:
      */
     RHFFockMatrixDIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6) :
         minimum_subspace_dimension {minimum_subspace_dimension},
-        maximum_subspace_dimension {maximum_subspace_dimension} {}
+        maximum_subspace_dimension {maximum_subspace_dimension},
+        diis {maximum_subspace_dimension} {}
 
 
     /*
@@ -84,23 +87,26 @@ public:
      */
     void execute(Environment& environment) override {
 
+        // Make sure that the environment keeps enough iterates for the DIIS subspace. The Fock matrices need room for one more, since the accelerated Fock matrix is temporarily added to them.
+        const auto subspace_capacity = std::max(this->minimum_subspace_dimension, this->maximum_subspace_dimension);
+        environment.error_vectors.ensureCapacity(subspace_capacity);
+        environment.fock_matrices.ensureCapacity(subspace_capacity + 1);
+
+        // Add the most recent error vector to the DIIS subspace in every iteration, so that only its overlaps have to be calculated.
+        this->diis.update(environment.error_vectors);
+
         if (environment.error_vectors.size() < this->minimum_subspace_dimension) {
 
-            // No acceleration is possible, so calculate the regular Fock matrix and diagonalize it.
-            RHFFockMatrixCalculation<Scalar>().execute(environment);
+            // No acceleration is possible, so diagonalize the regular Fock matrix. It has already been calculated by a preceding step, which may have used another representation of the two-electron integrals than the Hamiltonian in the environment (e.g. an integral-direct or factorized one).
             RHFFockMatrixDiagonalization<Scalar>().execute(environment);
             return;
         }
 
-        // Convert the deques in the environment to vectors that can be accepted by the DIIS accelerator. The total number of elements we can use in DIIS is either the maximum subspace dimension or the number of available error matrices.
-        const auto n = std::min(this->maximum_subspace_dimension, environment.error_vectors.size());
-        const std::vector<VectorX<Scalar>> error_vectors {environment.error_vectors.end() - n, environment.error_vectors.end()};                       // The n-th last error vectors.
-        const std::vector<ScalarRSQOneElectronOperator<Scalar>> fock_matrices {environment.fock_matrices.end() - n, environment.fock_matrices.end()};  // The n-th last Fock matrices.
-
-        // Calculate the accelerated Fock matrix and do a diagonalization step on it.
-        const auto F_accelerated = this->diis.accelerate(fock_matrices, error_vectors);
+        // Extrapolate the Fock matrix into a new, most recent Fock matrix, which is the one the diagonalization step reads from. The Fock matrices that correspond to the error vectors in the DIIS subspace are read in place.
+        environment.fock_matrices.push_back(environment.fock_matrices.back());
+        const auto fock_parameters = [](const ScalarRSQOneElectronOperator<Scalar>& F) -> const SquareMatrix<Scalar>& { return F.parameters(); };
+        this->diis.extrapolate(environment.fock_matrices.begin(), environment.fock_matrices.end() - 1, fock_parameters, environment.fock_matrices.back().parameters().Eigen());
 
-        environment.fock_matrices.push_back(F_accelerated);  // The diagonalization step can only read from the environment.
         RHFFockMatrixDiagonalization<Scalar>().execute(environment);
         environment.fock_matrices.pop_back();  // The accelerated/extrapolated Fock matrix should not be used in further extrapolation steps, as it is not created from a density matrix.
     }
@@ -50,12 +50,12 @@ public:
      *  @return A textual description of this algorithmic step
      */
     std::string description() const override {
-        return "Solve the generalized eigenvalue problem for the most recent scalar/AO Fock matrix. Add the associated coefficient matrix and orbital energies to the environment.";
+        return "Solve the generalized eigenvalue problem for the most recent scalar/AO Fock matrix, through the orthogonalizer of the environment. Add the associated coefficient matrix and orbital energies to the environment.";
     }
 
 
     /**
-     *  Solve the generalized eigenvalue problem for the most recent scalar/AO Fock matrix. Add the associated coefficient matrix and orbital energies to the environment.
+     *  Solve the generalized eigenvalue problem for the most recent scalar/AO Fock matrix, through the orthogonalizer of the environment. Add the associated coefficient matrix and orbital energies to the environment.
      * 
      *  @param environment              The environment that acts as a sort of calculation space.
      */
@@ -63,10 +63,11 @@ public:
 
         const auto& F = environment.fock_matrices.back().parameters();  // The most recent scalar/AO basis Fock matrix.
 
-        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
-        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver {F, environment.S.parameters()};
-        const RTransformation<Scalar>& C {generalized_eigensolver.eigenvectors()};
-        const auto& orbital_energies = generalized_eigensolver.eigenvalues();
+        // Solve the standard eigenvalue problem for the orthogonalized Fock matrix, instead of decomposing the overlap matrix in every iteration.
+        const auto eigenpairs = environment.orthogonalizer.solve(F);
+        // If the scalar (AO) basis is (nearly) linearly dependent, complete the eigenvectors with the discarded directions, so that the coefficient matrix stays square. These are never occupied, since they come after all orbitals.
+        const RTransformation<Scalar> C {environment.orthogonalizer.completed(eigenpairs.first)};
+        const VectorX<Scalar> orbital_energies = eigenpairs.second.template cast<Scalar>();
 
         environment.coefficient_matrices.push_back(C);
         environment.orbital_energies.push_back(orbital_energies);
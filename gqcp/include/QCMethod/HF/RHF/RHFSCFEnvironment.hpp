@@ -20,6 +20,8 @@
 
 #include "Basis/Transformations/RTransformation.hpp"
 #include "DensityMatrix/Orbital1DM.hpp"
+#include "Mathematical/Algorithm/History.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Orthogonalizer.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
@@ -27,8 +29,6 @@
 
 #include <Eigen/Dense>
 
-#include <deque>
-
 
 namespace GQCP {
 
@@ -49,16 +49,18 @@ public:
 public:
     size_t N;  // The total number of electrons.
 
-    std::deque<Scalar> electronic_energies;
+    History<Scalar> electronic_energies;  // Always kept in full.
 
-    std::deque<VectorX<Scalar>> orbital_energies;
+    // The other histories only keep the most recent iterates, so that the memory of the environment doesn't grow with the number of iterations. By default, they keep the two most recent iterates, which suffices for the convergence criteria and the density matrix damper. The DIIS steps enlarge the capacity of the histories they extrapolate from. See also `keepFullHistory()`.
+    History<VectorX<Scalar>> orbital_energies;
 
     ScalarRSQOneElectronOperator<Scalar> S;  // The overlap matrix (of the scalar (AO) basis).
+    Orthogonalizer<Scalar> orthogonalizer;   // The orthogonalizer of the overlap matrix, which is calculated only once and reused in every diagonalization of a Fock matrix.
 
-    std::deque<RTransformation<Scalar>> coefficient_matrices;
-    std::deque<Orbital1DM<Scalar>> density_matrices;                 // Expressed in the scalar (AO) basis.
-    std::deque<ScalarRSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
-    std::deque<VectorX<Scalar>> error_vectors;                       // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
+    History<RTransformation<Scalar>> coefficient_matrices;  // Expressed in the scalar (AO) basis. If the scalar basis is (nearly) linearly dependent, only the leading columns span its linearly independent part: the remaining ones are the discarded directions, see `Orthogonalizer::completed()`.
+    History<Orbital1DM<Scalar>> density_matrices;                 // Expressed in the scalar (AO) basis.
+    History<ScalarRSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
+    History<VectorX<Scalar>> error_vectors;                       // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
 
     RSQHamiltonian<Scalar> sq_hamiltonian;  // The Hamiltonian expressed in the scalar (AO) basis.
 
@@ -71,20 +73,28 @@ public:
     /**
      *  A constructor that initializes the environment with an initial guess for the coefficient matrix.
      * 
-     *  @param N                    The total number of electrons.
-     *  @param sq_hamiltonian       The Hamiltonian expressed in the scalar (AO) basis.
-     *  @param S                    The overlap matrix (of the scalar (AO) basis).
-     *  @param C_initial            The initial coefficient matrix.
+     *  @param N                                The total number of electrons.
+     *  @param sq_hamiltonian                   The Hamiltonian expressed in the scalar (AO) basis.
+     *  @param S                                The overlap matrix (of the scalar (AO) basis).
+     *  @param C_initial                        The initial coefficient matrix.
+     *  @param linear_dependency_threshold      The threshold below which an eigenvalue of the overlap matrix signals a linear dependency in the scalar (AO) basis. The linear dependencies are removed through canonical orthogonalization.
      */
-    RHFSCFEnvironment(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S, const RTransformation<Scalar>& C_initial) :
+    RHFSCFEnvironment(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S, const RTransformation<Scalar>& C_initial, const double linear_dependency_threshold = 1.0e-07) :
         N {N},
         S {S},
-        sq_hamiltonian {sq_hamiltonian},
-        coefficient_matrices {C_initial} {
+        orthogonalizer {S.parameters(), linear_dependency_threshold},
+        sq_hamiltonian {sq_hamiltonian} {
+
+        this->setHistoryCapacity(2);
+        this->coefficient_matrices.push_back(C_initial);
 
         if (this->N % 2 != 0) {  // If the total number of electrons is odd.
             throw std::invalid_argument("RHFSCFEnvironment::RHFSCFEnvironment(const size_t, const RSQHamiltonian<Scalar>&, const SquareMatrix<Scalar>&, const RTransformation<Scalar>&): You have given an odd number of electrons.");
         }
+
+        if (this->N / 2 > this->orthogonalizer.numberOfLinearlyIndependentFunctions()) {
+            throw std::invalid_argument("RHFSCFEnvironment::RHFSCFEnvironment(const size_t, const RSQHamiltonian<Scalar>&, const SquareMatrix<Scalar>&, const RTransformation<Scalar>&): The linearly independent part of the scalar (AO) basis can't accommodate all electron pairs.");
+        }
     }
 
 
@@ -95,35 +105,37 @@ public:
     /**
      *  Initialize an RHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix.
      * 
-     *  @param N                    The total number of electrons.
-     *  @param sq_hamiltonian       The Hamiltonian expressed in the scalar (AO) basis.
-     *  @param S                    The overlap operator (of the scalar (AO) basis).
+     *  @param N                            The total number of electrons.
+     *  @param sq_hamiltonian               The Hamiltonian expressed in the scalar (AO) basis.
+     *  @param S                            The overlap operator (of the scalar (AO) basis).
+     *  @param linear_dependency_threshold  The threshold below which an eigenvalue of the overlap matrix signals a linear dependency in the scalar (AO) basis.
      * 
      *  @return An RHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix.
      */
-    static RHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S) {
+    static RHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S, const double linear_dependency_threshold = 1.0e-07) {
 
         const auto& H_core = sq_hamiltonian.core().parameters();  // In AO basis.
 
-        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
-        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver {H_core, S.parameters()};
-        const RTransformation<Scalar> C_initial {generalized_eigensolver.eigenvectors()};
+        // Diagonalize the core Hamiltonian through the same orthogonalizer as the SCF iterations, instead of running a generalized eigensolver on a possibly ill-conditioned overlap matrix.
+        const Orthogonalizer<Scalar> orthogonalizer {S.parameters(), linear_dependency_threshold};
+        const RTransformation<Scalar> C_initial {orthogonalizer.completed(orthogonalizer.solve(H_core).first)};
 
-        return RHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial);
+        return RHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial, linear_dependency_threshold);
     }
 
 
     /**
      *  Initialize an RHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix and subsequently adding/subtracting a small complex value from certain elements.
      * 
-     *  @param N                    The total number of electrons.
-     *  @param sq_hamiltonian       The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a RSpinOrbitalBasis.
-     *  @param S                    The overlap operator (of both scalar (AO) bases).
+     *  @param N                            The total number of electrons.
+     *  @param sq_hamiltonian               The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a RSpinOrbitalBasis.
+     *  @param S                            The overlap operator (of both scalar (AO) bases).
+     *  @param linear_dependency_threshold  The threshold below which an eigenvalue of the overlap matrix signals a linear dependency in the scalar (AO) basis.
      * 
      *  @return An RHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix and subsequently adding/subtracting a small complex value from certain elements.
      */
     template <typename Z = Scalar>
-    static enable_if_t<std::is_same<Z, complex>::value, RHFSCFEnvironment<complex>> WithComplexlyTransformedCoreGuess(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S) {
+    static enable_if_t<std::is_same<Z, complex>::value, RHFSCFEnvironment<complex>> WithComplexlyTransformedCoreGuess(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S, const double linear_dependency_threshold = 1.0e-07) {
 
         // Set up the lambda function used to transform the coefficient matrix.
         const auto transformation_function = [](SquareMatrix<complex> C_initial) {
@@ -142,7 +154,7 @@ public:
             return C_initial;
         };
 
-        return RHFSCFEnvironment<complex>::WithTransformedCoreGuess(N, sq_hamiltonian, S, transformation_function);
+        return RHFSCFEnvironment<complex>::WithTransformedCoreGuess(N, sq_hamiltonian, S, transformation_function, linear_dependency_threshold);
     }
 
 
@@ -153,21 +165,51 @@ public:
      *  @param sq_hamiltonian               The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a RSpinOrbitalBasis.
      *  @param S                            The overlap operator (of both scalar (AO) bases).
      *  @param transformation_function      A function that transforms the core guess.
+     *  @param linear_dependency_threshold  The threshold below which an eigenvalue of the overlap matrix signals a linear dependency in the scalar (AO) basis.
      * 
      *  @return An RHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix and subsequently applying the given unary transformation function.
      */
     template <typename Z = Scalar>
-    static RHFSCFEnvironment<Scalar> WithTransformedCoreGuess(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S, const std::function<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>(const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>&)>& transformation_function) {
+    static RHFSCFEnvironment<Scalar> WithTransformedCoreGuess(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S, const std::function<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>(const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>&)>& transformation_function, const double linear_dependency_threshold = 1.0e-07) {
 
         const auto& H_core = sq_hamiltonian.core().parameters();  // In AO basis.
 
-        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
-        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver {H_core, S.parameters()};
-        auto C_initial {generalized_eigensolver.eigenvectors()};
+        const Orthogonalizer<Scalar> orthogonalizer {S.parameters(), linear_dependency_threshold};
+        const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> C_initial = orthogonalizer.completed(orthogonalizer.solve(H_core).first);
 
         const RTransformation<Scalar> C_initial_complex {transformation_function(C_initial)};
 
-        return RHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial_complex);
+        return RHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial_complex, linear_dependency_threshold);
+    }
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  Change the number of most recent iterates that are kept in the histories of this environment. If a history holds more iterates than the new capacity, its oldest ones are evicted. The electronic energies are always kept in full.
+     * 
+     *  @param capacity                 The number of most recent iterates that should be kept.
+     */
+    void setHistoryCapacity(const size_t capacity) {
+        this->orbital_energies.setCapacity(capacity);
+        this->coefficient_matrices.setCapacity(capacity);
+        this->density_matrices.setCapacity(capacity);
+        this->fock_matrices.setCapacity(capacity);
+        this->error_vectors.setCapacity(capacity);
+    }
+
+
+    /**
+     *  Keep every iterate that is added to the histories of this environment from now on, e.g. for debugging purposes.
+     */
+    void keepFullHistory() {
+        this->orbital_energies.makeUnbounded();
+        this->coefficient_matrices.makeUnbounded();
+        this->density_matrices.makeUnbounded();
+        this->fock_matrices.makeUnbounded();
+        this->error_vectors.makeUnbounded();
     }
 };
 
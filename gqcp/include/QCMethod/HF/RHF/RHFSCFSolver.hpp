@@ -22,8 +22,10 @@
 #include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
 #include "QCMethod/HF/RHF/RHFDensityMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFDensityMatrixDamper.hpp"
+#include "QCMethod/HF/RHF/RHFDirectFockMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFElectronicEnergyCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFErrorCalculation.hpp"
+#include "QCMethod/HF/RHF/RHFFactorizedFockMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFFockMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFFockMatrixDIIS.hpp"
 #include "QCMethod/HF/RHF/RHFFockMatrixDiagonalization.hpp"
@@ -53,22 +55,23 @@ public:
      *  @param alpha                                The damping factor.
      *  @param threshold                            The threshold that is used in comparing the density matrices.
      *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that calculate the direct and exchange matrices in every iteration.
      * 
      *  @return A density-damped RHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion.
      */
-    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> DensityDamped(const double alpha, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> DensityDamped(const double alpha, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1) {
 
         // Create the iteration cycle that effectively 'defines' a damped RHF SCF solver.
         StepCollection<RHFSCFEnvironment<Scalar>> damped_rhf_scf_cycle {};
         damped_rhf_scf_cycle
             .add(RHFDensityMatrixCalculation<Scalar>())
             .add(RHFDensityMatrixDamper<Scalar>(alpha))
-            .add(RHFFockMatrixCalculation<Scalar>())
+            .add(RHFFockMatrixCalculation<Scalar>(number_of_threads))
             .add(RHFFockMatrixDiagonalization<Scalar>())
             .add(RHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<Orbital1DM<Scalar>>(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const std::function<const History<Orbital1DM<Scalar>>*(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const History<Orbital1DM<Scalar>>* { return &environment.density_matrices; };
 
         using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
@@ -82,22 +85,23 @@ public:
      *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
      *  @param threshold                            The threshold that is used in comparing the density matrices.
      *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that calculate the direct and exchange matrices in every iteration.
      * 
      *  @return A DIIS RHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion.
      */
-    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> DIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> DIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1) {
 
         // Create the iteration cycle that effectively 'defines' a DIIS RHF SCF solver.
         StepCollection<RHFSCFEnvironment<Scalar>> diis_rhf_scf_cycle {};
         diis_rhf_scf_cycle
             .add(RHFDensityMatrixCalculation<Scalar>())
-            .add(RHFFockMatrixCalculation<Scalar>())
+            .add(RHFFockMatrixCalculation<Scalar>(number_of_threads))
             .add(RHFErrorCalculation<Scalar>())
             .add(RHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
             .add(RHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<Orbital1DM<Scalar>>(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const std::function<const History<Orbital1DM<Scalar>>*(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const History<Orbital1DM<Scalar>>* { return &environment.density_matrices; };
 
         using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
@@ -109,21 +113,142 @@ public:
     /**
      *  @param threshold                            The threshold that is used in comparing the density matrices.
      *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that calculate the direct and exchange matrices in every iteration.
      * 
      *  @return A plain RHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion.
      */
-    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> Plain(const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> Plain(const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1) {
 
         // Create the iteration cycle that effectively 'defines' a plain RHF SCF solver.
         StepCollection<RHFSCFEnvironment<Scalar>> plain_rhf_scf_cycle {};
         plain_rhf_scf_cycle
             .add(RHFDensityMatrixCalculation<Scalar>())
-            .add(RHFFockMatrixCalculation<Scalar>())
+            .add(RHFFockMatrixCalculation<Scalar>(number_of_threads))
             .add(RHFFockMatrixDiagonalization<Scalar>())
             .add(RHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const auto density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const auto density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const History<Orbital1DM<Scalar>>* { return &environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(plain_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param scalar_basis                         The scalar basis in which the density and Fock matrices are expressed, over which the two-electron integrals are recalculated in every iteration.
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that recalculate the shell quartets in every iteration.
+     *  @param schwarz_threshold                    The threshold below which the (density-weighted) Schwarz bound of a shell quartet is considered to be negligible, so that the shell quartet is skipped.
+     *  @param rebuild_frequency                    The number of incremental Fock matrix builds after which the Fock matrix is rebuilt from the full density matrix.
+     * 
+     *  @return An integral-direct DIIS RHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion. The Fock matrix is calculated without storing the two-electron integrals, see `RHFDirectFockMatrixCalculation`.
+     */
+    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> DirectDIIS(const ScalarBasis<GTOShell>& scalar_basis, const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1, const double schwarz_threshold = 1.0e-12, const size_t rebuild_frequency = 10) {
+
+        // Create the iteration cycle that effectively 'defines' an integral-direct DIIS RHF SCF solver.
+        StepCollection<RHFSCFEnvironment<Scalar>> diis_rhf_scf_cycle {};
+        diis_rhf_scf_cycle
+            .add(RHFDensityMatrixCalculation<Scalar>())
+            .add(RHFDirectFockMatrixCalculation<Scalar>(scalar_basis, schwarz_threshold, rebuild_frequency, number_of_threads))
+            .add(RHFErrorCalculation<Scalar>())
+            .add(RHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
+            .add(RHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const History<Orbital1DM<Scalar>>*(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const History<Orbital1DM<Scalar>>* { return &environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(diis_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param scalar_basis                         The scalar basis in which the density and Fock matrices are expressed, over which the two-electron integrals are recalculated in every iteration.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that recalculate the shell quartets in every iteration.
+     *  @param schwarz_threshold                    The threshold below which the (density-weighted) Schwarz bound of a shell quartet is considered to be negligible, so that the shell quartet is skipped.
+     *  @param rebuild_frequency                    The number of incremental Fock matrix builds after which the Fock matrix is rebuilt from the full density matrix.
+     * 
+     *  @return An integral-direct plain RHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion. The Fock matrix is calculated without storing the two-electron integrals, see `RHFDirectFockMatrixCalculation`.
+     */
+    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> DirectPlain(const ScalarBasis<GTOShell>& scalar_basis, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1, const double schwarz_threshold = 1.0e-12, const size_t rebuild_frequency = 10) {
+
+        // Create the iteration cycle that effectively 'defines' an integral-direct plain RHF SCF solver.
+        StepCollection<RHFSCFEnvironment<Scalar>> plain_rhf_scf_cycle {};
+        plain_rhf_scf_cycle
+            .add(RHFDensityMatrixCalculation<Scalar>())
+            .add(RHFDirectFockMatrixCalculation<Scalar>(scalar_basis, schwarz_threshold, rebuild_frequency, number_of_threads))
+            .add(RHFFockMatrixDiagonalization<Scalar>())
+            .add(RHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const History<Orbital1DM<Scalar>>*(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const History<Orbital1DM<Scalar>>* { return &environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(plain_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param g                                    The factorized (density-fitted or Cholesky-decomposed) two-electron integrals, expressed in the scalar basis in which the density and Fock matrices are expressed.
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A DIIS RHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion. The Fock matrix is calculated from the factorized two-electron integrals, see `RHFFactorizedFockMatrixCalculation`. Only the core Hamiltonian of the environment is used, so it may be set up through `RSQHamiltonian::FromCore`.
+     */
+    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> FactorizedDIIS(const FactorizedRSQTwoElectronOperator<Scalar>& g, const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a factorized DIIS RHF SCF solver.
+        StepCollection<RHFSCFEnvironment<Scalar>> diis_rhf_scf_cycle {};
+        diis_rhf_scf_cycle
+            .add(RHFDensityMatrixCalculation<Scalar>())
+            .add(RHFFactorizedFockMatrixCalculation<Scalar>(g))
+            .add(RHFErrorCalculation<Scalar>())
+            .add(RHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
+            .add(RHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const History<Orbital1DM<Scalar>>*(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const History<Orbital1DM<Scalar>>* { return &environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(diis_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param g                                    The factorized (density-fitted or Cholesky-decomposed) two-electron integrals, expressed in the scalar basis in which the density and Fock matrices are expressed.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A plain RHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion. The Fock matrix is calculated from the factorized two-electron integrals, see `RHFFactorizedFockMatrixCalculation`. Only the core Hamiltonian of the environment is used, so it may be set up through `RSQHamiltonian::FromCore`.
+     */
+    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> FactorizedPlain(const FactorizedRSQTwoElectronOperator<Scalar>& g, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a factorized plain RHF SCF solver.
+        StepCollection<RHFSCFEnvironment<Scalar>> plain_rhf_scf_cycle {};
+        plain_rhf_scf_cycle
+            .add(RHFDensityMatrixCalculation<Scalar>())
+            .add(RHFFactorizedFockMatrixCalculation<Scalar>(g))
+            .add(RHFFockMatrixDiagonalization<Scalar>())
+            .add(RHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const History<Orbital1DM<Scalar>>*(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const History<Orbital1DM<Scalar>>* { return &environment.density_matrices; };
 
         using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
@@ -24,6 +24,7 @@
 #include "QCMethod/QCStructure.hpp"
 #include "QCModel/HF/UHF.hpp"
 
+#include <stdexcept>
 #include <type_traits>
 
 
@@ -59,6 +60,11 @@ public:
     template <typename Solver>
     QCStructure<QCModel::UHF<Scalar>, Scalar> optimize(Solver& solver, UHFSCFEnvironment<Scalar>& environment) const {
 
+        // The UHF model describes a full set of spin-orbitals with their orbital energies, which a (nearly) linearly dependent scalar (AO) basis can't provide. Check this before running the solver.
+        if ((environment.orthogonalizers.alpha().numberOfDiscardedFunctions() > 0) || (environment.orthogonalizers.beta().numberOfDiscardedFunctions() > 0)) {
+            throw std::invalid_argument("QCMethod::UHF::optimize(Solver&, UHFSCFEnvironment<Scalar>&): The scalar (AO) basis is (nearly) linearly dependent, so the UHF model can't be constructed. Run the solver on the environment directly instead.");
+        }
+
         // The UHF method's responsibility is to try to optimize the parameters of its method, given a solver and associated environment.
         solver.perform(environment);
 
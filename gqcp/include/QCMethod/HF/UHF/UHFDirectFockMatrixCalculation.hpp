@@ -0,0 +1,102 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/DirectJKCalculator.hpp"
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/HF/UHF/UHFSCFEnvironment.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the current UHF Fock matrices (expressed in the scalar/AO basis) from the current density matrices, without storing the two-electron integrals. Every iteration, the shell quartets are recalculated and contracted with the changes of the alpha and beta density matrices since the previous iteration, both at the same time.
+ *
+ *  Only the core Hamiltonian of the environment's Hamiltonian is used, so the environment can be set up with a Hamiltonian that holds no two-electron integrals, see `SQHamiltonian::FromCore()`.
+ * 
+ *  @tparam _Scalar              The scalar type used to represent the expansion coefficient/elements of the transformation matrix: real or complex.
+ *
+ *  @note The alpha and beta density matrices should be expressed in the same scalar basis.
+ */
+template <typename _Scalar>
+class UHFDirectFockMatrixCalculation:
+    public Step<UHFSCFEnvironment<_Scalar>> {
+
+public:
+    using Scalar = _Scalar;
+    using Environment = UHFSCFEnvironment<Scalar>;
+
+
+private:
+    // The calculator for the direct and exchange matrices, which keeps track of the previous density matrices.
+    DirectJKCalculator<Scalar> jk_calculator;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param scalar_basis             The scalar basis in which the density and Fock matrices are expressed.
+     *  @param threshold                The threshold below which the (density-weighted) contribution of a shell quartet is considered to be negligible.
+     *  @param rebuild_frequency        The number of incremental Fock matrix builds after which the Fock matrices are rebuilt from the full density matrices.
+     *  @param number_of_threads        The number of worker threads that recalculate the shell quartets.
+     */
+    UHFDirectFockMatrixCalculation(const ScalarBasis<GTOShell>& scalar_basis, const double threshold = 1.0e-12, const size_t rebuild_frequency = 10, const size_t number_of_threads = 1) :
+        jk_calculator {scalar_basis, threshold, rebuild_frequency, number_of_threads} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Calculate the current UHF Fock matrices (expressed in the scalar/AO basis) integral-directly and place them in the environment.";
+    }
+
+
+    /**
+     *  Calculate the current UHF Fock matrices (expressed in the scalar/AO basis) and place them in the environment.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        const auto& P = environment.density_matrices.back();  // The most recent alpha and beta density matrix.
+
+        const auto JK = this->jk_calculator.calculateIncremental({P.alpha().matrix(), P.beta().matrix()});
+        const auto& J = JK.first;
+        const auto& K = JK.second;
+
+        // F_sigma = H_core + (J_alpha + J_beta) - K_sigma.
+        const auto& H_core = environment.sq_hamiltonian.core();
+        const SquareMatrix<Scalar> F_a = H_core.alpha().parameters() + J[0] + J[1] - K[0];
+        const SquareMatrix<Scalar> F_b = H_core.beta().parameters() + J[0] + J[1] - K[1];
+
+        environment.fock_matrices.push_back(ScalarUSQOneElectronOperator<Scalar> {F_a, F_b});
+    }
+};
+
+
+}  // namespace GQCP
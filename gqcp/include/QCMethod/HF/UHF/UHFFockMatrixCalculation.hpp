@@ -40,7 +40,23 @@ public:
     using Environment = UHFSCFEnvironment<Scalar>;
 
 
+private:
+    // The number of worker threads that calculate the direct and exchange matrices.
+    size_t number_of_threads;
+
+
 public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param number_of_threads        The number of worker threads that calculate the direct and exchange matrices.
+     */
+    UHFFockMatrixCalculation(const size_t number_of_threads = 1) :
+        number_of_threads {number_of_threads} {}
+
+
     /*
      *  PUBLIC OVERRIDDEN METHODS
      */
@@ -62,7 +78,7 @@ public:
 
         const auto& P = environment.density_matrices.back();  // The most recent alpha and beta density matrix.
 
-        const auto F = QCModel::UHF<Scalar>::calculateScalarBasisFockMatrix(P, environment.sq_hamiltonian);
+        const auto F = QCModel::UHF<Scalar>::calculateScalarBasisFockMatrix(P, environment.sq_hamiltonian, this->number_of_threads);
 
         environment.fock_matrices.push_back(F);
     }
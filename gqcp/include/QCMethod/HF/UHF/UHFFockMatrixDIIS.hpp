@@ -19,7 +19,7 @@
 
 
 #include "Mathematical/Algorithm/Step.hpp"
-#include "Mathematical/Optimization/Accelerator/DIIS.hpp"
+#include "Mathematical/Optimization/Accelerator/IncrementalDIIS.hpp"
 #include "QCMethod/HF/UHF/UHFFockMatrixDiagonalization.hpp"
 #include "QCMethod/HF/UHF/UHFSCFEnvironment.hpp"
 #include "QCModel/HF/UHF.hpp"
@@ -33,6 +33,8 @@ namespace GQCP {
 /**
  *  An iteration step that accelerates the alpha- and beta- Fock matrices (expressed in the scalar/AO basis) based on a DIIS accelerator.
  * 
+ *  @note The most recent Fock matrices have to be calculated by a preceding step. This step never calculates them itself.
+ * 
  *  @tparam _Scalar              The scalar type used to represent the expansion coefficient/elements of the transformation matrix: real or complex.
  */
 template <typename _Scalar>
@@ -48,7 +50,7 @@ private:
     size_t minimum_subspace_dimension;  // The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
     size_t maximum_subspace_dimension;  // The maximum number of Fock matrices that can be handled by DIIS.
 
-    DIIS<Scalar> diis;  // The DIIS accelerator.
+    SpinResolved<IncrementalDIIS<Scalar>> diis;  // The DIIS accelerators for the alpha- and beta- Fock matrices, which cache the overlaps of the error vectors in their subspace.
 
 
 public:
@@ -62,7 +64,8 @@ public:
      */
     UHFFockMatrixDIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6) :
         minimum_subspace_dimension {minimum_subspace_dimension},
-        maximum_subspace_dimension {maximum_subspace_dimension} {}
+        maximum_subspace_dimension {maximum_subspace_dimension},
+        diis {IncrementalDIIS<Scalar>(maximum_subspace_dimension), IncrementalDIIS<Scalar>(maximum_subspace_dimension)} {}
 
 
     /*
@@ -84,43 +87,30 @@ public:
      */
     void execute(Environment& environment) override {
 
+        // Make sure that the environment keeps enough iterates for the DIIS subspace. The Fock matrices need room for one more, since the accelerated Fock matrix is temporarily added to them.
+        const auto subspace_capacity = std::max(this->minimum_subspace_dimension, this->maximum_subspace_dimension);
+        environment.error_vectors.ensureCapacity(subspace_capacity);
+        environment.fock_matrices.ensureCapacity(subspace_capacity + 1);
+
+        // Add the most recent error vectors to the DIIS subspaces in every iteration, so that only their overlaps have to be calculated.
+        const auto alpha_error = [](const SpinResolved<VectorX<Scalar>>& error) -> const VectorX<Scalar>& { return error.alpha(); };
+        const auto beta_error = [](const SpinResolved<VectorX<Scalar>>& error) -> const VectorX<Scalar>& { return error.beta(); };
+        this->diis.alpha().update(environment.error_vectors, alpha_error);
+        this->diis.beta().update(environment.error_vectors, beta_error);
+
         if (environment.error_vectors.size() < this->minimum_subspace_dimension) {  // The beta dimension will be the same.
 
-            // No acceleration is possible, so calculate the regular Fock matrices and diagonalize them.
-            UHFFockMatrixCalculation<Scalar>().execute(environment);
+            // No acceleration is possible, so diagonalize the regular Fock matrices. They have already been calculated by a preceding step, which may have used another representation of the two-electron integrals than the Hamiltonian in the environment (e.g. an integral-direct or factorized one).
             UHFFockMatrixDiagonalization<Scalar>().execute(environment);
             return;
         }
 
-        // Convert the deques in the environment to vectors that can be accepted by the DIIS accelerator. The total number of elements we can use in DIIS is either the maximum subspace dimension or the number of available error matrices.
-        const auto n = std::min(this->maximum_subspace_dimension, environment.error_vectors.size());
-        const std::vector<SpinResolved<VectorX<Scalar>>> error_vectors {environment.error_vectors.end() - n, environment.error_vectors.end()};  // The n-th last alpha error vectors.
-
-        const std::vector<ScalarUSQOneElectronOperator<Scalar>> fock_matrices {environment.fock_matrices.end() - n, environment.fock_matrices.end()};  // The n-th last Fock matrices.
-
-        std::vector<SquareMatrix<Scalar>> alpha_fock_matrices;
-        std::vector<SquareMatrix<Scalar>> beta_fock_matrices;
-
-        for (size_t i = 0; i < fock_matrices.size(); i++) {
-            alpha_fock_matrices.push_back(fock_matrices[i].alpha().parameters());
-            beta_fock_matrices.push_back(fock_matrices[i].beta().parameters());
-        }
-
-        std::vector<VectorX<Scalar>> alpha_error_vectors;
-        std::vector<VectorX<Scalar>> beta_error_vectors;
-
-        for (size_t i = 0; i < error_vectors.size(); i++) {
-            alpha_error_vectors.push_back(error_vectors[i].alpha());
-            beta_error_vectors.push_back(error_vectors[i].beta());
-        }
-
-        // Calculate the accelerated Fock matrices and do a diagonalization step on them.
-        const auto F_alpha_accelerated = this->diis.accelerate(alpha_fock_matrices, alpha_error_vectors);
-        const auto F_beta_accelerated = this->diis.accelerate(beta_fock_matrices, beta_error_vectors);
-
-        const ScalarUSQOneElectronOperator<Scalar> F_accelerated {F_alpha_accelerated, F_beta_accelerated};
-
-        environment.fock_matrices.push_back(F_accelerated);  // The diagonalization step can only read from the environment.
+        // Extrapolate the alpha- and beta- Fock matrices into new, most recent Fock matrices, which are the ones the diagonalization step reads from. The Fock matrices that correspond to the error vectors in the DIIS subspaces are read in place.
+        environment.fock_matrices.push_back(environment.fock_matrices.back());
+        const auto alpha_fock_parameters = [](const ScalarUSQOneElectronOperator<Scalar>& F) -> const SquareMatrix<Scalar>& { return F.alpha().parameters(); };
+        const auto beta_fock_parameters = [](const ScalarUSQOneElectronOperator<Scalar>& F) -> const SquareMatrix<Scalar>& { return F.beta().parameters(); };
+        this->diis.alpha().extrapolate(environment.fock_matrices.begin(), environment.fock_matrices.end() - 1, alpha_fock_parameters, environment.fock_matrices.back().alpha().parameters().Eigen());
+        this->diis.beta().extrapolate(environment.fock_matrices.begin(), environment.fock_matrices.end() - 1, beta_fock_parameters, environment.fock_matrices.back().beta().parameters().Eigen());
 
         UHFFockMatrixDiagonalization<Scalar>().execute(environment);
 
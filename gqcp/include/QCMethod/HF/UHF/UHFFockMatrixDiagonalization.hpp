@@ -50,12 +50,12 @@ public:
      *  @return A textual description of this algorithmic step.
      */
     std::string description() const override {
-        return "Solve the generalized eigenvalue problem for the most recent scalar/AO Fock matrices. Add the associated coefficient matrices and orbital energies to the environment.";
+        return "Solve the generalized eigenvalue problem for the most recent scalar/AO Fock matrices, through the orthogonalizers of the environment. Add the associated coefficient matrices and orbital energies to the environment.";
     }
 
 
     /**
-     *  Solve the generalized eigenvalue problem for the most recent scalar/AO Fock matrices. Add the associated coefficient matrices and orbital energies to the environment.
+     *  Solve the generalized eigenvalue problem for the most recent scalar/AO Fock matrices, through the orthogonalizers of the environment. Add the associated coefficient matrices and orbital energies to the environment.
      * 
      *  @param environment              The environment that acts as a sort of calculation space.
      */
@@ -63,17 +63,15 @@ public:
 
         const auto& F = environment.fock_matrices.back();  // The most recent scalar/AO basis alpha & beta Fock matrix.
 
-        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+        // Solve the standard eigenvalue problems for the orthogonalized Fock matrices, instead of decomposing the overlap matrices in every iteration.
+        // If the scalar (AO) basis is (nearly) linearly dependent, complete the eigenvectors with the discarded directions, so that the coefficient matrices stay square. These are never occupied, since they come after all spin-orbitals.
+        const auto eigenpairs_alpha = environment.orthogonalizers.alpha().solve(F.alpha().parameters());
+        const UTransformationComponent<Scalar> C_alpha {environment.orthogonalizers.alpha().completed(eigenpairs_alpha.first)};
+        const VectorX<Scalar> orbital_energies_alpha = eigenpairs_alpha.second.template cast<Scalar>();
 
-        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver_alpha {F.alpha().parameters(), environment.S.alpha().parameters()};
-        const UTransformationComponent<Scalar>& C_alpha {generalized_eigensolver_alpha.eigenvectors()};
-
-        const auto& orbital_energies_alpha = generalized_eigensolver_alpha.eigenvalues();
-
-        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver_beta {F.beta().parameters(), environment.S.beta().parameters()};
-        const UTransformationComponent<Scalar>& C_beta {generalized_eigensolver_beta.eigenvectors()};
-
-        const auto& orbital_energies_beta = generalized_eigensolver_beta.eigenvalues();
+        const auto eigenpairs_beta = environment.orthogonalizers.beta().solve(F.beta().parameters());
+        const UTransformationComponent<Scalar> C_beta {environment.orthogonalizers.beta().completed(eigenpairs_beta.first)};
+        const VectorX<Scalar> orbital_energies_beta = eigenpairs_beta.second.template cast<Scalar>();
 
         const UTransformation<Scalar>& C {C_alpha, C_beta};
         const SpinResolved<VectorX<Scalar>> mo_energies {orbital_energies_alpha, orbital_energies_beta};
@@ -21,15 +21,16 @@
 #include "Basis/Transformations/UTransformation.hpp"
 #include "Basis/Transformations/UTransformationComponent.hpp"
 #include "DensityMatrix/SpinResolved1DM.hpp"
+#include "Mathematical/Algorithm/History.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Orthogonalizer.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "Operator/SecondQuantized/USQOneElectronOperator.hpp"
 #include "QCModel/HF/RHF.hpp"
+#include "QuantumChemical/SpinResolved.hpp"
 
 #include <Eigen/Dense>
 
-#include <deque>
-
 
 namespace GQCP {
 
@@ -50,19 +51,22 @@ public:
 public:
     SpinResolved<size_t> N;  // The number of alpha and beta electrons (the number of occupied alpha-spin-orbitals).
 
-    std::deque<Scalar> electronic_energies;
+    History<Scalar> electronic_energies;  // Always kept in full.
 
-    std::deque<SpinResolved<VectorX<Scalar>>> orbital_energies;  // The alpha and beta MO energies.
+    // The other histories only keep the most recent iterates, so that the memory of the environment doesn't grow with the number of iterations. By default, they keep the two most recent iterates, which suffices for the convergence criteria. The DIIS steps enlarge the capacity of the histories they extrapolate from. See also `keepFullHistory()`.
+    History<SpinResolved<VectorX<Scalar>>> orbital_energies;  // The alpha and beta MO energies.
 
     ScalarUSQOneElectronOperator<Scalar> S;  // The overlap operator (of the scalar (AO) basis).
 
-    std::deque<UTransformation<Scalar>> coefficient_matrices;  // The alpha and beta coefficient matrices.
+    SpinResolved<Orthogonalizer<Scalar>> orthogonalizers;  // The orthogonalizers of the alpha and beta overlap matrices, which are calculated only once and reused in every diagonalization of the Fock matrices.
+
+    History<UTransformation<Scalar>> coefficient_matrices;  // The alpha and beta coefficient matrices, expressed in the scalar (AO) basis. If a scalar basis is (nearly) linearly dependent, only the leading columns span its linearly independent part: the remaining ones are the discarded directions, see `Orthogonalizer::completed()`.
 
-    std::deque<SpinResolved1DM<Scalar>> density_matrices;  // Expressed in the scalar (AO) basis.
+    History<SpinResolved1DM<Scalar>> density_matrices;  // Expressed in the scalar (AO) basis.
 
-    std::deque<ScalarUSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
+    History<ScalarUSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
 
-    std::deque<SpinResolved<VectorX<Scalar>>> error_vectors;  // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
+    History<SpinResolved<VectorX<Scalar>>> error_vectors;  // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
 
     USQHamiltonian<Scalar> sq_hamiltonian;  // The Hamiltonian expressed in the scalar (AO) basis.
 
@@ -75,18 +79,27 @@ public:
     /**
      *  A constructor that initializes the environment with initial guesses for the alpha and beta coefficient matrices.
      * 
-     *  @param N_alpha                  The number of alpha electrons (the number of occupied alpha-spin-orbitals).
-     *  @param N_beta                   The number of beta electrons (the number of occupied beta-spin-orbitals).
-     *  @param sq_hamiltonian           The Hamiltonian expressed in the scalar (AO) basis.
-     *  @param S                        The overlap matrix (of the scalar (AO) basis).
-     *  @param C_alpha_initial          The initial coefficient matrix for the alpha spin-orbitals.
-     *  @param C_beta_initial           The initial coefficient matrix for the beta spin-orbitals.
+     *  @param N_alpha                          The number of alpha electrons (the number of occupied alpha-spin-orbitals).
+     *  @param N_beta                           The number of beta electrons (the number of occupied beta-spin-orbitals).
+     *  @param sq_hamiltonian                   The Hamiltonian expressed in the scalar (AO) basis.
+     *  @param S                                The overlap matrix (of the scalar (AO) basis).
+     *  @param C_alpha_initial                  The initial coefficient matrix for the alpha spin-orbitals.
+     *  @param C_beta_initial                   The initial coefficient matrix for the beta spin-orbitals.
+     *  @param linear_dependency_threshold      The threshold below which an eigenvalue of an overlap matrix signals a linear dependency in the scalar (AO) basis. The linear dependencies are removed through canonical orthogonalization.
      */
-    UHFSCFEnvironment(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S, const UTransformation<Scalar>& C_initial) :
+    UHFSCFEnvironment(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S, const UTransformation<Scalar>& C_initial, const double linear_dependency_threshold = 1.0e-07) :
         N {N_alpha, N_beta},
         S {S},
-        sq_hamiltonian {sq_hamiltonian},
-        coefficient_matrices {C_initial} {}
+        orthogonalizers {Orthogonalizer<Scalar> {S.alpha().parameters(), linear_dependency_threshold}, Orthogonalizer<Scalar> {S.beta().parameters(), linear_dependency_threshold}},
+        sq_hamiltonian {sq_hamiltonian} {
+
+        this->setHistoryCapacity(2);
+        this->coefficient_matrices.push_back(C_initial);
+
+        if ((N_alpha > this->orthogonalizers.alpha().numberOfLinearlyIndependentFunctions()) || (N_beta > this->orthogonalizers.beta().numberOfLinearlyIndependentFunctions())) {
+            throw std::invalid_argument("UHFSCFEnvironment::UHFSCFEnvironment(const size_t, const size_t, const USQHamiltonian<Scalar>&, const ScalarUSQOneElectronOperator<Scalar>&, const UTransformation<Scalar>&, const double): The linearly independent part of the scalar (AO) basis can't accommodate all electrons.");
+        }
+    }
 
 
     /**
@@ -109,40 +122,42 @@ public:
     /**
      *  Initialize a UHF SCF environment with initial coefficient matrices (equal for alpha and beta) that is obtained by diagonalizing the core Hamiltonian matrix.
      * 
-     *  @param N_alpha                  The number of alpha electrons (the number of occupied alpha-spin-orbitals).
-     *  @param N_beta                   The number of beta electrons (the number of occupied beta-spin-orbitals).
-     *  @param sq_hamiltonian           The Hamiltonian expressed in the scalar (AO) basis.
-     *  @param S                        The overlap matrix (of the scalar (AO) basis).
+     *  @param N_alpha                      The number of alpha electrons (the number of occupied alpha-spin-orbitals).
+     *  @param N_beta                       The number of beta electrons (the number of occupied beta-spin-orbitals).
+     *  @param sq_hamiltonian               The Hamiltonian expressed in the scalar (AO) basis.
+     *  @param S                            The overlap matrix (of the scalar (AO) basis).
+     *  @param linear_dependency_threshold  The threshold below which an eigenvalue of an overlap matrix signals a linear dependency in the scalar (AO) basis.
      * 
      *  @return A UHF SCF environment with initial coefficient matrices (equal for alpha and beta) that is obtained by diagonalizing the core Hamiltonian matrix.
      */
-    static UHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S) {
+    static UHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S, const double linear_dependency_threshold = 1.0e-07) {
 
         const auto& H_core = sq_hamiltonian.core();  // In AO basis.
 
-        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
-        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver_a {H_core.alpha().parameters(), S.alpha().parameters()};
-        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver_b {H_core.beta().parameters(), S.beta().parameters()};
-        const UTransformationComponent<Scalar> C_initial_a {generalized_eigensolver_a.eigenvectors()};
-        const UTransformationComponent<Scalar> C_initial_b {generalized_eigensolver_b.eigenvectors()};
+        // Diagonalize the core Hamiltonians through the same orthogonalizers as the SCF iterations, instead of running a generalized eigensolver on possibly ill-conditioned overlap matrices.
+        const Orthogonalizer<Scalar> orthogonalizer_a {S.alpha().parameters(), linear_dependency_threshold};
+        const Orthogonalizer<Scalar> orthogonalizer_b {S.beta().parameters(), linear_dependency_threshold};
+        const UTransformationComponent<Scalar> C_initial_a {orthogonalizer_a.completed(orthogonalizer_a.solve(H_core.alpha().parameters()).first)};
+        const UTransformationComponent<Scalar> C_initial_b {orthogonalizer_b.completed(orthogonalizer_b.solve(H_core.beta().parameters()).first)};
         const UTransformation<Scalar> C_initial {C_initial_a, C_initial_b};
 
-        return UHFSCFEnvironment<Scalar>(N_alpha, N_beta, sq_hamiltonian, S, C_initial);
+        return UHFSCFEnvironment<Scalar>(N_alpha, N_beta, sq_hamiltonian, S, C_initial, linear_dependency_threshold);
     }
 
 
     /**
      *  Initialize a UHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix and subsequently adding/subtracting a small complex value from certain elements.
      * 
-     *  @param N_alpha                  The number of alpha electrons (the number of occupied alpha-spin-orbitals).
-     *  @param N_beta                   The number of beta electrons (the number of occupied beta-spin-orbitals).
-     *  @param sq_hamiltonian           The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a USpinOrbitalBasis.
-     *  @param S                        The overlap operator (of both scalar (AO) bases).
+     *  @param N_alpha                      The number of alpha electrons (the number of occupied alpha-spin-orbitals).
+     *  @param N_beta                       The number of beta electrons (the number of occupied beta-spin-orbitals).
+     *  @param sq_hamiltonian               The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a USpinOrbitalBasis.
+     *  @param S                            The overlap operator (of both scalar (AO) bases).
+     *  @param linear_dependency_threshold  The threshold below which an eigenvalue of an overlap matrix signals a linear dependency in the scalar (AO) basis.
      * 
      *  @return A UHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix and subsequently adding/subtracting a small complex value from certain elements.
      */
     template <typename Z = Scalar>
-    static enable_if_t<std::is_same<Z, complex>::value, UHFSCFEnvironment<complex>> WithComplexlyTransformedCoreGuess(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S) {
+    static enable_if_t<std::is_same<Z, complex>::value, UHFSCFEnvironment<complex>> WithComplexlyTransformedCoreGuess(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S, const double linear_dependency_threshold = 1.0e-07) {
 
         // Set up the lambda function used to transform the coefficient matrix.
         const auto transformation_function = [](SquareMatrix<complex> C_initial) {
@@ -161,7 +176,7 @@ public:
             return C_initial;
         };
 
-        return UHFSCFEnvironment<complex>::WithTransformedCoreGuess(N_alpha, N_beta, sq_hamiltonian, S, transformation_function);
+        return UHFSCFEnvironment<complex>::WithTransformedCoreGuess(N_alpha, N_beta, sq_hamiltonian, S, transformation_function, linear_dependency_threshold);
     }
 
 
@@ -173,23 +188,54 @@ public:
      *  @param sq_hamiltonian               The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a USpinOrbitalBasis.
      *  @param S                            The overlap operator (of both scalar (AO) bases).
      *  @param transformation_function      A function that transforms the alpha and beta core guesses.
+     *  @param linear_dependency_threshold  The threshold below which an eigenvalue of an overlap matrix signals a linear dependency in the scalar (AO) basis.
      * 
      *  @return A UHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix and subsequently applying the given unary transformation function.
      */
     template <typename Z = Scalar>
-    static UHFSCFEnvironment<Scalar> WithTransformedCoreGuess(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S, const std::function<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>(const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>&)>& transformation_function) {
+    static UHFSCFEnvironment<Scalar> WithTransformedCoreGuess(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S, const std::function<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>(const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>&)>& transformation_function, const double linear_dependency_threshold = 1.0e-07) {
 
         const auto& H_core = sq_hamiltonian.core();  // In AO basis.
 
         using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
-        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver_a {H_core.alpha().parameters(), S.alpha().parameters()};
-        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver_b {H_core.beta().parameters(), S.beta().parameters()};
-        auto C_initial_a {generalized_eigensolver_a.eigenvectors()};
-        auto C_initial_b {generalized_eigensolver_b.eigenvectors()};
+        const Orthogonalizer<Scalar> orthogonalizer_a {S.alpha().parameters(), linear_dependency_threshold};
+        const Orthogonalizer<Scalar> orthogonalizer_b {S.beta().parameters(), linear_dependency_threshold};
+        const MatrixType C_initial_a = orthogonalizer_a.completed(orthogonalizer_a.solve(H_core.alpha().parameters()).first);
+        const MatrixType C_initial_b = orthogonalizer_b.completed(orthogonalizer_b.solve(H_core.beta().parameters()).first);
 
         const UTransformation<Scalar> C_initial_complex {UTransformationComponent<Scalar> {transformation_function(C_initial_a)}, UTransformationComponent<Scalar> {transformation_function(C_initial_b)}};
 
-        return UHFSCFEnvironment<Scalar>(N_alpha, N_beta, sq_hamiltonian, S, C_initial_complex);
+        return UHFSCFEnvironment<Scalar>(N_alpha, N_beta, sq_hamiltonian, S, C_initial_complex, linear_dependency_threshold);
+    }
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  Change the number of most recent iterates that are kept in the histories of this environment. If a history holds more iterates than the new capacity, its oldest ones are evicted. The electronic energies are always kept in full.
+     * 
+     *  @param capacity                 The number of most recent iterates that should be kept.
+     */
+    void setHistoryCapacity(const size_t capacity) {
+        this->orbital_energies.setCapacity(capacity);
+        this->coefficient_matrices.setCapacity(capacity);
+        this->density_matrices.setCapacity(capacity);
+        this->fock_matrices.setCapacity(capacity);
+        this->error_vectors.setCapacity(capacity);
+    }
+
+
+    /**
+     *  Keep every iterate that is added to the histories of this environment from now on, e.g. for debugging purposes.
+     */
+    void keepFullHistory() {
+        this->orbital_energies.makeUnbounded();
+        this->coefficient_matrices.makeUnbounded();
+        this->density_matrices.makeUnbounded();
+        this->fock_matrices.makeUnbounded();
+        this->error_vectors.makeUnbounded();
     }
 };
 
@@ -22,6 +22,7 @@
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
 #include "QCMethod/HF/UHF/UHFDensityMatrixCalculation.hpp"
+#include "QCMethod/HF/UHF/UHFDirectFockMatrixCalculation.hpp"
 #include "QCMethod/HF/UHF/UHFElectronicEnergyCalculation.hpp"
 #include "QCMethod/HF/UHF/UHFErrorCalculation.hpp"
 #include "QCMethod/HF/UHF/UHFFockMatrixCalculation.hpp"
@@ -54,22 +55,23 @@ public:
      *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
      *  @param threshold                            The threshold that is used in comparing both the alpha and beta density matrices.
      *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that calculate the direct and exchange matrices in every iteration.
      * 
      *  @return A DIIS UHF SCF solver that uses the combination of norm of the difference of two consecutive alpha and beta density matrices as a convergence criterion.
      */
-    static IterativeAlgorithm<UHFSCFEnvironment<Scalar>> DIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+    static IterativeAlgorithm<UHFSCFEnvironment<Scalar>> DIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1) {
 
         // Create the iteration cycle that effectively 'defines' a DIIS UHF SCF solver.
         StepCollection<UHFSCFEnvironment<Scalar>> diis_uhf_scf_cycle {};
         diis_uhf_scf_cycle
             .add(UHFDensityMatrixCalculation<Scalar>())
-            .add(UHFFockMatrixCalculation<Scalar>())
+            .add(UHFFockMatrixCalculation<Scalar>(number_of_threads))
             .add(UHFErrorCalculation<Scalar>())
             .add(UHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
             .add(UHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<SpinResolved1DM<Scalar>>(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const std::function<const History<SpinResolved1DM<Scalar>>*(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) -> const History<SpinResolved1DM<Scalar>>* { return &environment.density_matrices; };
 
         using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the UHF spin resolved density matrix in AO basis"};
@@ -81,21 +83,85 @@ public:
     /**
      *  @param threshold                            The threshold that is used in comparing both the alpha and beta density matrices.
      *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that calculate the direct and exchange matrices in every iteration.
      * 
      *  @return A plain UHF SCF solver that uses the combination of norm of the difference of two consecutive alpha and beta density matrices as a convergence criterion.
      */
-    static IterativeAlgorithm<UHFSCFEnvironment<Scalar>> Plain(const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+    static IterativeAlgorithm<UHFSCFEnvironment<Scalar>> Plain(const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1) {
 
         // Create the iteration cycle that effectively 'defines' a plain UHF SCF solver.
         StepCollection<UHFSCFEnvironment<Scalar>> plain_uhf_scf_cycle {};
         plain_uhf_scf_cycle
             .add(UHFDensityMatrixCalculation<Scalar>())
-            .add(UHFFockMatrixCalculation<Scalar>())
+            .add(UHFFockMatrixCalculation<Scalar>(number_of_threads))
             .add(UHFFockMatrixDiagonalization<Scalar>())
             .add(UHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<SpinResolved1DM<Scalar>>(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const std::function<const History<SpinResolved1DM<Scalar>>*(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) -> const History<SpinResolved1DM<Scalar>>* { return &environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the UHF spin resolved density matrix in AO basis"};
+
+        return IterativeAlgorithm<UHFSCFEnvironment<Scalar>>(plain_uhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param scalar_basis                         The scalar basis in which the density and Fock matrices are expressed, over which the two-electron integrals are recalculated in every iteration.
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing both the alpha and beta density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that recalculate the shell quartets in every iteration.
+     *  @param schwarz_threshold                    The threshold below which the (density-weighted) Schwarz bound of a shell quartet is considered to be negligible, so that the shell quartet is skipped.
+     *  @param rebuild_frequency                    The number of incremental Fock matrix builds after which the Fock matrix is rebuilt from the full density matrix.
+     * 
+     *  @return An integral-direct DIIS UHF SCF solver that uses the combination of norm of the difference of two consecutive alpha and beta density matrices as a convergence criterion. The Fock matrices are calculated without storing the two-electron integrals, see `UHFDirectFockMatrixCalculation`.
+     */
+    static IterativeAlgorithm<UHFSCFEnvironment<Scalar>> DirectDIIS(const ScalarBasis<GTOShell>& scalar_basis, const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1, const double schwarz_threshold = 1.0e-12, const size_t rebuild_frequency = 10) {
+
+        // Create the iteration cycle that effectively 'defines' an integral-direct DIIS UHF SCF solver.
+        StepCollection<UHFSCFEnvironment<Scalar>> diis_uhf_scf_cycle {};
+        diis_uhf_scf_cycle
+            .add(UHFDensityMatrixCalculation<Scalar>())
+            .add(UHFDirectFockMatrixCalculation<Scalar>(scalar_basis, schwarz_threshold, rebuild_frequency, number_of_threads))
+            .add(UHFErrorCalculation<Scalar>())
+            .add(UHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
+            .add(UHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const History<SpinResolved1DM<Scalar>>*(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) -> const History<SpinResolved1DM<Scalar>>* { return &environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the UHF spin resolved density matrix in AO basis"};
+
+        return IterativeAlgorithm<UHFSCFEnvironment<Scalar>>(diis_uhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param scalar_basis                         The scalar basis in which the density and Fock matrices are expressed, over which the two-electron integrals are recalculated in every iteration.
+     *  @param threshold                            The threshold that is used in comparing both the alpha and beta density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     *  @param number_of_threads                    The number of worker threads that recalculate the shell quartets in every iteration.
+     *  @param schwarz_threshold                    The threshold below which the (density-weighted) Schwarz bound of a shell quartet is considered to be negligible, so that the shell quartet is skipped.
+     *  @param rebuild_frequency                    The number of incremental Fock matrix builds after which the Fock matrix is rebuilt from the full density matrix.
+     * 
+     *  @return An integral-direct plain UHF SCF solver that uses the combination of norm of the difference of two consecutive alpha and beta density matrices as a convergence criterion. The Fock matrices are calculated without storing the two-electron integrals, see `UHFDirectFockMatrixCalculation`.
+     */
+    static IterativeAlgorithm<UHFSCFEnvironment<Scalar>> DirectPlain(const ScalarBasis<GTOShell>& scalar_basis, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_threads = 1, const double schwarz_threshold = 1.0e-12, const size_t rebuild_frequency = 10) {
+
+        // Create the iteration cycle that effectively 'defines' an integral-direct plain UHF SCF solver.
+        StepCollection<UHFSCFEnvironment<Scalar>> plain_uhf_scf_cycle {};
+        plain_uhf_scf_cycle
+            .add(UHFDensityMatrixCalculation<Scalar>())
+            .add(UHFDirectFockMatrixCalculation<Scalar>(scalar_basis, schwarz_threshold, rebuild_frequency, number_of_threads))
+            .add(UHFFockMatrixDiagonalization<Scalar>())
+            .add(UHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const History<SpinResolved1DM<Scalar>>*(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) -> const History<SpinResolved1DM<Scalar>>* { return &environment.density_matrices; };
 
         using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the UHF spin resolved density matrix in AO basis"};
@@ -149,6 +149,11 @@ public:
      */
     const ImplicitRankFourTensorSlice<Scalar>& asImplicitRankFourTensorSlice() const { return this->t; }
 
+    /**
+     *  @return The T2-amplitudes as a writable `ImplicitRankFourTensorSlice`.
+     */
+    ImplicitRankFourTensorSlice<Scalar>& asImplicitRankFourTensorSlice() { return this->t; }
+
     /**
      *  @return The orbital space for these T2-amplitudes, which encapsulates the occupied-virtual separation.
      */
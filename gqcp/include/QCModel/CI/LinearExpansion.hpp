@@ -586,58 +586,17 @@ public:
 
         // Prepare some variables.
         const auto M = this->onv_basis.numberOfOrbitals();
-        const auto N = this->onv_basis.numberOfElectrons();
         const auto dim = onv_basis.dimension();  // Dimension of the SpinUnresolvedONVBasis = number of SpinUnresolvedONVs.
+        const auto& single_excitations = this->onv_basis.singleExcitations();
 
         GQCP::SquareMatrix<double> D = GQCP::SquareMatrix<double>::Zero(M);
 
-        SpinUnresolvedONV onv = onv_basis.constructONVFromAddress(0);  // Start with ONV with address 0.
-        for (size_t J = 0; J < dim; J++) {                             // Loops over all possible ONV indices.
+        // Every single excitation E_pq |J> = sign |I> contributes sign * c_I * c_J to D(p, q). The diagonal excitations E_qq |J> = |J> give the diagonal elements.
+        for (size_t J = 0; J < dim; J++) {  // Loops over all possible ONV indices.
+            const auto c_J = this->coefficient(J);
 
-            // Loop over electrons that can be annihilated in an ONV.
-            for (size_t e1 = 0; e1 < N; e1++) {
-
-                // Create an ONVPath for each new ONV.
-                ONVPath<SpinUnresolvedONVBasis> onv_path {onv_basis, onv};
-                const auto c_J = this->coefficient(J);
-
-                // Figure out the orbital index of the electron that will be annihilated.
-                const auto q = onv.occupationIndexOf(e1);
-
-
-                // The diagonal values are a result of annihilation-creation on the same orbital index and are thus the same as the initial ONV.
-                D(q, q) += c_J * c_J;
-
-                // For the non-diagonal values, we will create all possible matrix elements of the density matrix in the routine below.
-                onv_path.annihilate(q, e1);
-
-                // Stop the loop if 1) the path is finished, meaning that orbital index p is at M (the total number of orbitals) and 2) if the orbital index is out of bounds after left translation of a vertical arc.
-                while (!onv_path.isFinished() && onv_path.isOrbitalIndexValid()) {
-
-                    // Find the next unoccupied orbital, i.e. the next vertical arc in the path.
-                    onv_path.leftTranslateDiagonalArcUntilVerticalArc();
-
-                    // Calculate the address of the path if we would close it right now.
-                    const auto I = onv_path.addressAfterCreation();
-                    const auto c_I = this->coefficient(I);
-
-
-                    // Add the density matrix elements.
-                    const auto p = onv_path.orbitalIndex();
-
-                    const double value = c_I * c_J;
-
-                    D(p, q) += onv_path.sign() * value;
-                    D(q, p) += onv_path.sign() * value;
-
-                    // Move orbital index such that other unoccupied orbitals can be found within the loop.
-                    onv_path.leftTranslateVerticalArc();
-                }
-            }
-
-            // Prevent last ONV since there is no possibility for an electron to be annihilated anymore.
-            if (J < dim - 1) {
-                onv_basis.transformONVToNextPermutation(onv);
+            for (auto excitation = single_excitations.begin(J); excitation != single_excitations.end(J); excitation++) {
+                D(excitation->p, excitation->q) += excitation->sign * this->coefficient(excitation->address) * c_J;
             }
         }
 
@@ -750,108 +709,30 @@ public:
         SquareMatrix<double> D_aa = SquareMatrix<double>::Zero(K);
         SquareMatrix<double> D_bb = SquareMatrix<double>::Zero(K);
 
-        SpinUnresolvedONVBasis onv_basis_alpha = onv_basis.alpha();
-        SpinUnresolvedONVBasis onv_basis_beta = onv_basis.beta();
-
-        auto dim_alpha = onv_basis_alpha.dimension();
-        auto dim_beta = onv_basis_beta.dimension();
-
-        // ALPHA
-        SpinUnresolvedONV spin_string_alpha = onv_basis_alpha.constructONVFromAddress(0);  // alpha spin string with address 0
-        for (size_t I_alpha = 0; I_alpha < dim_alpha; I_alpha++) {                         // I_alpha loops over all the addresses of the alpha spin strings
-            for (size_t p = 0; p < K; p++) {                                               // p loops over SOs
-                int sign_p = 1;
-                if (spin_string_alpha.annihilate(p, sign_p)) {  // if p is in I_alpha
-                    double diagonal_contribution = 0;
-
-                    // Diagonal contributions for the 1-DM, i.e. D_pp
-                    // We are storing the alpha addresses as 'major', i.e. the total address I_alpha I_beta = I_alpha * dim_beta + I_beta
-                    for (size_t I_beta = 0; I_beta < dim_beta; I_beta++) {
-                        double c_I_alpha_I_beta = this->coefficient(I_alpha * dim_beta + I_beta);
-                        diagonal_contribution += std::pow(c_I_alpha_I_beta, 2);
-                    }
-                    D_aa(p, p) += diagonal_contribution;
-
-                    // Off-diagonal contributions for the 1-DM, i.e. D_pq (p!=q)
-                    for (size_t q = 0; q < p; q++) {  // q < p loops over SOs
-                        int sign_pq = sign_p;
-                        if (spin_string_alpha.create(q, sign_pq)) {                         // if q is not occupied in I_alpha
-                            size_t J_alpha = onv_basis_alpha.addressOf(spin_string_alpha);  // find all strings J_alpha that couple to I_alpha
-
-                            double off_diagonal_contribution = 0;
-                            for (size_t I_beta = 0; I_beta < dim_beta; I_beta++) {
-                                double c_I_alpha_I_beta = this->coefficient(I_alpha * dim_beta + I_beta);  // alpha addresses are 'major'
-                                double c_J_alpha_I_beta = this->coefficient(J_alpha * dim_beta + I_beta);
-                                off_diagonal_contribution += c_I_alpha_I_beta * c_J_alpha_I_beta;
-                            }
-
-                            D_aa(p, q) += sign_pq * off_diagonal_contribution;
-                            D_aa(q, p) += sign_pq * off_diagonal_contribution;  // add the symmetric contribution because we are looping over q < p
-
-                            spin_string_alpha.annihilate(q);  // undo the previous creation
-
-                        }  // create on q
-                    }      // q loop
+        const auto dim_alpha = this->onv_basis.alpha().dimension();
+        const auto dim_beta = this->onv_basis.beta().dimension();
 
-                    spin_string_alpha.create(p);  // undo the previous annihilation
+        // We are storing the alpha addresses as 'major', i.e. the total address I_alpha I_beta = I_alpha * dim_beta + I_beta. Therefore, the coefficients can be mapped onto a (dim_beta x dim_alpha) matrix C, whose columns correspond to alpha strings and whose rows correspond to beta strings.
+        Eigen::Map<const Eigen::MatrixXd> C {this->m_coefficients.data(), static_cast<long>(dim_beta), static_cast<long>(dim_alpha)};
 
-                }  // annihilate on p
-            }      // p loop
 
-            if (I_alpha < dim_alpha - 1) {  // prevent the last permutation from occurring
-                onv_basis_alpha.transformONVToNextPermutation(spin_string_alpha);
+        // ALPHA: every single excitation E_pq |I_alpha> = sign |J_alpha> contributes sign * sum_{I_beta} C(I_beta, J_alpha) C(I_beta, I_alpha) to D_aa(p, q).
+        const auto& alpha_excitations = this->onv_basis.alpha().singleExcitations();
+        for (size_t I_alpha = 0; I_alpha < dim_alpha; I_alpha++) {
+            for (auto excitation = alpha_excitations.begin(I_alpha); excitation != alpha_excitations.end(I_alpha); excitation++) {
+                D_aa(excitation->p, excitation->q) += excitation->sign * C.col(excitation->address).dot(C.col(I_alpha));
             }
+        }
 
-        }  // I_alpha loop
-
-
-        // BETA
-        SpinUnresolvedONV spin_string_beta = onv_basis_beta.constructONVFromAddress(0);  // spin string with address 0
-        for (size_t I_beta = 0; I_beta < dim_beta; I_beta++) {                           // I_beta loops over all the addresses of the spin strings
-            for (size_t p = 0; p < K; p++) {                                             // p loops over SOs
-                int sign_p = 1;
-                if (spin_string_beta.annihilate(p, sign_p)) {  // if p is in I_beta
-                    double diagonal_contribution = 0;
-
-                    // Diagonal contributions for the 1-DM, i.e. D_pp
-                    // We are storing the alpha addresses as 'major', i.e. the total address I_alpha I_beta = I_alpha * dim_beta + I_beta
-                    for (size_t I_alpha = 0; I_alpha < dim_alpha; I_alpha++) {
-                        double c_I_alpha_I_beta = this->coefficient(I_alpha * dim_beta + I_beta);
-                        diagonal_contribution += std::pow(c_I_alpha_I_beta, 2);
-                    }
-
-                    D_bb(p, p) += diagonal_contribution;
-
-                    // Off-diagonal contributions for the 1-DM
-                    for (size_t q = 0; q < p; q++) {  // q < p loops over SOs
-                        int sign_pq = sign_p;
-                        if (spin_string_beta.create(q, sign_pq)) {                       // if q is not in I_beta
-                            size_t J_beta = onv_basis_beta.addressOf(spin_string_beta);  // find all strings J_beta that couple to I_beta
-
-                            double off_diagonal_contribution = 0;
-                            for (size_t I_alpha = 0; I_alpha < dim_alpha; I_alpha++) {
-                                double c_I_alpha_I_beta = this->coefficient(I_alpha * dim_beta + I_beta);  // alpha addresses are 'major'
-                                double c_I_alpha_J_beta = this->coefficient(I_alpha * dim_beta + J_beta);
-                                off_diagonal_contribution += c_I_alpha_I_beta * c_I_alpha_J_beta;
-                            }
-                            D_bb(p, q) += sign_pq * off_diagonal_contribution;
-                            D_bb(q, p) += sign_pq * off_diagonal_contribution;  // add the symmetric contribution because we are looping over q < p
-
-                            spin_string_beta.annihilate(q);  // undo the previous creation
-
-                        }  // create on q
-                    }      // loop over q
-
-                    spin_string_beta.create(p);  // undo the previous annihilation
-
-                }  // annihilate on p
-            }      // loop over p
 
-            if (I_beta < dim_beta - 1) {  // prevent the last permutation from occurring
-                onv_basis_beta.transformONVToNextPermutation(spin_string_beta);
+        // BETA: every single excitation E_pq |I_beta> = sign |J_beta> contributes sign * sum_{I_alpha} C(J_beta, I_alpha) C(I_beta, I_alpha) to D_bb(p, q).
+        const auto& beta_excitations = this->onv_basis.beta().singleExcitations();
+        for (size_t I_beta = 0; I_beta < dim_beta; I_beta++) {
+            for (auto excitation = beta_excitations.begin(I_beta); excitation != beta_excitations.end(I_beta); excitation++) {
+                D_bb(excitation->p, excitation->q) += excitation->sign * C.row(excitation->address).dot(C.row(I_beta));
             }
+        }
 
-        }  // I_beta loop.
         return SpinResolved1DM<double> {SpinResolved1DMComponent<double> {D_aa}, SpinResolved1DMComponent<double> {D_bb}};
     }
 
@@ -18,6 +18,7 @@
 #pragma once
 
 
+#include "Basis/Integrals/JKCalculator.hpp"
 #include "Basis/Transformations/GTransformation.hpp"
 #include "DensityMatrix/G1DM.hpp"
 #include "Mathematical/Representation/ImplicitRankFourTensorSlice.hpp"
@@ -128,11 +129,27 @@ public:
      */
     static G1DM<Scalar> calculateScalarBasis1DM(const GTransformation<Scalar>& C, const size_t N) {
 
-        const size_t M = C.dimension();
-        const auto P_orthonormal = GHF<Scalar>::calculateOrthonormalBasis1DM(M, N);
+        return GHF<Scalar>::calculateScalarBasis1DM(C.matrix(), N);
+    }
+
+
+    /**
+     *  @param C            The coefficient matrix that expresses every spinor orbital (as a column) in the underlying scalar bases. If the scalar bases are (nearly) linearly dependent, it has fewer columns than rows.
+     *  @param N            The number of electrons.
+     *
+     *  @return The GHF 1-DM expressed in the underlying scalar basis.
+     */
+    static G1DM<Scalar> calculateScalarBasis1DM(const MatrixX<Scalar>& C, const size_t N) {
 
-        // Transform the 1-DM in an orthonormal basis to the underlying scalar basis.
-        return G1DM<Scalar>(C.matrix().conjugate() * P_orthonormal.matrix() * C.matrix().transpose());
+        if (N > static_cast<size_t>(C.cols())) {
+            throw std::invalid_argument("QCModel::GHF::calculateScalarBasis1DM(const MatrixX<Scalar>&, const size_t): There are fewer spinor orbitals than electrons.");
+        }
+
+        // Only the occupied spinors contribute to the 1-DM: P = C_occ^* C_occ^T.
+        const auto C_occupied = C.leftCols(N);
+        const SquareMatrix<Scalar> P = C_occupied.conjugate() * C_occupied.transpose();
+
+        return G1DM<Scalar> {P};
     }
 
 
@@ -214,16 +231,71 @@ public:
      *
      *  @param P                    The (spin-blocked) GHF density matrix in the scalar bases.
      *  @param sq_hamiltonian       The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis.
+     *  @param number_of_threads    The number of worker threads that calculate the direct and exchange matrices.
+     *
+     *  @return The GHF Fock operator expressed in the scalar basis.
+     */
+    static ScalarGSQOneElectronOperator<Scalar> calculateScalarBasisFockMatrix(const G1DM<Scalar>& P, const GSQHamiltonian<Scalar>& sq_hamiltonian, const size_t number_of_threads = 1) {
+
+        // The direct contribution only involves the spin-diagonal blocks of the density matrix, while the exchange contributions of the four spin-blocks add up to the exchange contribution of the full density matrix. Both are calculated in a single pass over the two-electron integrals:
+        //      P(rho lambda) (mu nu|rho lambda) and P(lambda rho) (mu rho|lambda nu).
+        const auto M = P.numberOfOrbitals();
+        SquareMatrix<Scalar> P_diagonal = SquareMatrix<Scalar>::Zero(M);
+        P_diagonal.topLeftCorner(M / 2, M / 2) = P.matrix().topLeftCorner(M / 2, M / 2);
+        P_diagonal.bottomRightCorner(M / 2, M / 2) = P.matrix().bottomRightCorner(M / 2, M / 2);
+
+        const auto JK = JKCalculator<Scalar>::calculate(sq_hamiltonian.twoElectron().parameters(), {P_diagonal, P.matrix()}, number_of_threads);
+        const auto& J = JK.first[0];
+        const auto& K = JK.second[1];
+
+        return ScalarGSQOneElectronOperator<Scalar> {sq_hamiltonian.core().parameters() + J - K};
+    }
+
+
+    /**
+     *  Calculate the GHF Fock matrix F = H_core + G from the two-electron integrals over the spatial scalar basis, instead of the spin-blocked two-electron integrals over the spinors. The spatial integrals are contracted with each of the four spin-blocks of the density matrix, all in a single pass.
+     *
+     *  @param P                    The (spin-blocked) GHF density matrix in the scalar bases.
+     *  @param H_core               The (spin-blocked) core Hamiltonian expressed in the scalar bases.
+     *  @param g                    The two-electron integrals over the scalar basis, in chemist's notation.
+     *  @param number_of_threads    The number of worker threads that calculate the direct and exchange matrices.
      *
      *  @return The GHF Fock operator expressed in the scalar basis.
+     *
+     *  @note The scalar bases for the alpha- and beta-components must be the same.
      */
-    static ScalarGSQOneElectronOperator<Scalar> calculateScalarBasisFockMatrix(const G1DM<Scalar>& P, const GSQHamiltonian<Scalar>& sq_hamiltonian) {
+    static ScalarGSQOneElectronOperator<Scalar> calculateScalarBasisFockMatrix(const G1DM<Scalar>& P, const ScalarGSQOneElectronOperator<Scalar>& H_core, const Tensor<Scalar, 4>& g, const size_t number_of_threads = 1) {
+
+        const auto M = P.numberOfOrbitals();
+        const auto K = M / 2;
+        if (static_cast<size_t>(g.dimension(0)) != K) {
+            throw std::invalid_argument("QCModel::GHF::calculateScalarBasisFockMatrix(const G1DM<Scalar>&, const ScalarGSQOneElectronOperator<Scalar>&, const Tensor<Scalar, 4>&, const size_t): The dimensions of the density matrix and the two-electron integrals are incompatible.");
+        }
+
+        const auto& P_matrix = P.matrix();
+        const SquareMatrix<Scalar> P_aa = P_matrix.topLeftCorner(K, K);
+        const SquareMatrix<Scalar> P_ab = P_matrix.topRightCorner(K, K);
+        const SquareMatrix<Scalar> P_ba = P_matrix.bottomLeftCorner(K, K);
+        const SquareMatrix<Scalar> P_bb = P_matrix.bottomRightCorner(K, K);
+
+        const auto JK = JKCalculator<Scalar>::calculate(g, {P_aa, P_ab, P_ba, P_bb}, number_of_threads);
+        const auto& J = JK.first;
+        const auto& Ks = JK.second;
+
+
+        // The direct contribution only couples equal spins:
+        //      P(rho lambda) (mu nu|rho lambda),
+        // while the exchange contribution of the spin-block (sigma tau) contracts the density matrix block (tau sigma):
+        //      P(lambda rho) (mu rho|lambda nu).
+        const SquareMatrix<Scalar> J_total = J[0] + J[3];
 
-        const auto& H_core = sq_hamiltonian.core();
-        const auto J = QCModel::GHF<Scalar>::calculateScalarBasisDirectMatrix(P, sq_hamiltonian);
-        const auto K = QCModel::GHF<Scalar>::calculateScalarBasisExchangeMatrix(P, sq_hamiltonian);
+        SquareMatrix<Scalar> G = SquareMatrix<Scalar>::Zero(M);
+        G.topLeftCorner(K, K) = J_total - Ks[0];
+        G.topRightCorner(K, K) = -Ks[2];
+        G.bottomLeftCorner(K, K) = -Ks[1];
+        G.bottomRightCorner(K, K) = J_total - Ks[3];
 
-        return H_core + J - K;
+        return ScalarGSQOneElectronOperator<Scalar> {H_core.parameters() + G};
     }
 
 
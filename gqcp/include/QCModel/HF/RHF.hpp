@@ -18,11 +18,14 @@
 #pragma once
 
 
+#include "Basis/Integrals/JKCalculator.hpp"
 #include "Basis/SpinorBasis/OrbitalSpace.hpp"
 #include "Basis/Transformations/RTransformation.hpp"
 #include "DensityMatrix/Orbital1DM.hpp"
 #include "Mathematical/Representation/ImplicitRankFourTensorSlice.hpp"
+#include "Mathematical/Representation/PackedRankFourTensor.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
+#include "Operator/SecondQuantized/FactorizedRSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "QCModel/HF/StabilityMatrices/RHFStabilityMatrices.hpp"
@@ -272,11 +275,32 @@ public:
      */
     static Orbital1DM<Scalar> calculateScalarBasis1DM(const RTransformation<Scalar>& C, const size_t N) {
 
-        const size_t K = C.numberOfOrbitals();
-        const auto D_orthonormal = RHF<Scalar>::calculateOrthonormalBasis1DM(K, N);
+        return RHF<Scalar>::calculateScalarBasis1DM(C.matrix(), N);
+    }
+
+
+    /**
+     *  @param C    The coefficient matrix that expresses every spatial orbital (as a column) in its underlying scalar basis. If the scalar basis is (nearly) linearly dependent, it has fewer columns than rows.
+     *  @param N    The number of electrons.
+     *
+     *  @return The RHF 1-DM expressed in the underlying scalar basis.
+     */
+    static Orbital1DM<Scalar> calculateScalarBasis1DM(const MatrixX<Scalar>& C, const size_t N) {
+
+        if (N % 2 != 0) {
+            throw std::invalid_argument("QCModel::RHF::calculateScalarBasis1DM(const MatrixX<Scalar>&, const size_t): The number of given electrons cannot be odd for RHF.");
+        }
+
+        const size_t N_P = N / 2;
+        if (N_P > static_cast<size_t>(C.cols())) {
+            throw std::invalid_argument("QCModel::RHF::calculateScalarBasis1DM(const MatrixX<Scalar>&, const size_t): There are fewer spatial orbitals than electron pairs.");
+        }
 
-        // Transform the 1-DM in an orthonormal basis to the underlying scalar basis.
-        return D_orthonormal.transformed(C.inverse());
+        // Only the occupied orbitals contribute to the 1-DM, so we don't need to invert the coefficient matrix: D = 2 C_occ^* C_occ^T.
+        const auto C_occupied = C.leftCols(N_P);
+        const SquareMatrix<Scalar> D = 2 * C_occupied.conjugate() * C_occupied.transpose();
+
+        return Orbital1DM<Scalar> {D};
     }
 
 
@@ -285,25 +309,112 @@ public:
      *
      *  @param D                    The RHF density matrix in a scalar basis.
      *  @param sq_hamiltonian       The Hamiltonian expressed in the same scalar basis.
+     *  @param number_of_threads    The number of worker threads that calculate the direct and exchange matrices.
      *
      *  @return The RHF Fock operator expressed in the scalar basis.
      */
-    static ScalarRSQOneElectronOperator<Scalar> calculateScalarBasisFockMatrix(const Orbital1DM<Scalar>& D, const RSQHamiltonian<Scalar>& sq_hamiltonian) {
+    static ScalarRSQOneElectronOperator<Scalar> calculateScalarBasisFockMatrix(const Orbital1DM<Scalar>& D, const RSQHamiltonian<Scalar>& sq_hamiltonian, const size_t number_of_threads = 1) {
 
         // Get the two-electron parameters.
         const auto& g = sq_hamiltonian.twoElectron().parameters();
 
-        // To calculate G, we must perform two double contractions:
+        // To calculate G, we need two double contractions, which are calculated in a single pass over the two-electron integrals:
         //      1. (mu nu|rho lambda) P(lambda rho),
-        const Tensor<Scalar, 2> direct_contraction = g.template einsum<2>("ijkl,lk->ij", D.matrix());
         //      2. -0.5 (mu lambda|rho nu) P(lambda rho).
-        const Tensor<Scalar, 2> exchange_contraction = -0.5 * g.template einsum<2>("ilkj,lk->ij", D.matrix());
+        // These are the direct and exchange matrices of the transposed density matrix.
+        const SquareMatrix<Scalar> D_transposed = D.matrix().transpose();
+        const auto JK = JKCalculator<Scalar>::calculate(g, {D_transposed}, number_of_threads);
+        const auto& J = JK.first[0];
+        const auto& K = JK.second[0];
+
+        return ScalarRSQOneElectronOperator<Scalar> {sq_hamiltonian.core().parameters() + J - 0.5 * K};
+    }
+
+
+    /**
+     *  Calculate the RHF Fock operator F = H_core + G from packed two-electron integrals. Every unique integral is visited only once and is contracted with the density matrix for all its symmetric copies.
+     *
+     *  @param D                    The RHF density matrix in a scalar basis.
+     *  @param h_core               The core Hamiltonian expressed in the same scalar basis.
+     *  @param g                    The packed (real) two-electron integrals expressed in the same scalar basis.
+     *
+     *  @return The RHF Fock operator expressed in the scalar basis.
+     */
+    static ScalarRSQOneElectronOperator<Scalar> calculateScalarBasisFockMatrix(const Orbital1DM<Scalar>& D, const ScalarRSQOneElectronOperator<Scalar>& h_core, const PackedRankFourTensor<Scalar>& g) {
 
-        // The previous contractions are Tensor<Scalar, 2> instances. In order to calculate the total G matrix, we will convert them back into GQCP::Matrix<Scalar>.
-        auto G1 = direct_contraction.asMatrix();
-        auto G2 = exchange_contraction.asMatrix();
+        const auto dim = g.dimension();
+        if (D.numberOfOrbitals() != dim) {
+            throw std::invalid_argument("QCModel::RHF::calculateScalarBasisFockMatrix(const Orbital1DM<Scalar>&, const ScalarRSQOneElectronOperator<Scalar>&, const PackedRankFourTensor<Scalar>&): The dimensions of the density matrix and the two-electron integrals are incompatible.");
+        }
+
+        const auto& D_matrix = D.matrix();
+
+        // Accumulate 'half' of the direct and exchange contributions, such that J = J_half + J_half^T and K = K_half + K_half^T for a symmetric density matrix.
+        // Integrals whose index pairs coincide are scaled down, since they are visited fewer times than their multiplicity in the 8-fold symmetric expansion.
+        SquareMatrix<Scalar> J_half = SquareMatrix<Scalar>::Zero(dim);
+        SquareMatrix<Scalar> K_half = SquareMatrix<Scalar>::Zero(dim);
+        g.forEach([&D_matrix, &J_half, &K_half](const size_t i, const size_t j, const size_t k, const size_t l, const Scalar& value) {
+            auto v = value;
+            if (i == j) {
+                v *= 0.5;
+            }
+            if (k == l) {
+                v *= 0.5;
+            }
+            if ((i == k) && (j == l)) {
+                v *= 0.5;
+            }
+
+            //      1. (mu nu|rho lambda) P(lambda rho),
+            J_half(i, j) += 2 * v * D_matrix(k, l);
+            J_half(k, l) += 2 * v * D_matrix(i, j);
+
+            //      2. (mu lambda|rho nu) P(lambda rho).
+            K_half(i, l) += v * D_matrix(j, k);
+            K_half(j, l) += v * D_matrix(i, k);
+            K_half(i, k) += v * D_matrix(j, l);
+            K_half(j, k) += v * D_matrix(i, l);
+        });
+
+        const SquareMatrix<Scalar> J = J_half + J_half.transpose();
+        const SquareMatrix<Scalar> K = K_half + K_half.transpose();
+
+        return ScalarRSQOneElectronOperator<Scalar> {h_core.parameters() + J - 0.5 * K};
+    }
+
+
+    /**
+     *  Calculate the RHF Fock operator F = H_core + G from factorized (density-fitted or Cholesky-decomposed) two-electron integrals, without reconstructing the four-index integrals.
+     *
+     *  @param D                    The RHF density matrix in a scalar basis.
+     *  @param h_core               The core Hamiltonian expressed in the same scalar basis.
+     *  @param g                    The factorized two-electron integrals expressed in the same scalar basis.
+     *
+     *  @return The RHF Fock operator expressed in the scalar basis.
+     */
+    static ScalarRSQOneElectronOperator<Scalar> calculateScalarBasisFockMatrix(const Orbital1DM<Scalar>& D, const ScalarRSQOneElectronOperator<Scalar>& h_core, const FactorizedRSQTwoElectronOperator<Scalar>& g) {
+
+        const auto dim = g.numberOfOrbitals();
+        if (D.numberOfOrbitals() != dim) {
+            throw std::invalid_argument("QCModel::RHF::calculateScalarBasisFockMatrix(const Orbital1DM<Scalar>&, const ScalarRSQOneElectronOperator<Scalar>&, const FactorizedRSQTwoElectronOperator<Scalar>&): The dimensions of the density matrix and the two-electron integrals are incompatible.");
+        }
+
+        const auto& D_matrix = D.matrix();
+        const SquareMatrix<Scalar> D_transpose = D_matrix.transpose();
+
+        //      1. (mu nu|rho lambda) P(lambda rho) = sum_P B^P_(mu nu) gamma_P, with gamma_P = sum_(rho lambda) B^P_(rho lambda) P(lambda rho).
+        const VectorX<Scalar> gamma = g.factors().transpose() * Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, 1>>(D_transpose.data(), dim * dim);
+        const VectorX<Scalar> J_vector = g.factors() * gamma;
+        const SquareMatrix<Scalar> J = SquareMatrix<Scalar>(Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>(J_vector.data(), dim, dim));
+
+        //      2. (mu lambda|rho nu) P(lambda rho) = sum_P (B^P P B^P)_(mu nu).
+        SquareMatrix<Scalar> K = SquareMatrix<Scalar>::Zero(dim);
+        for (size_t P = 0; P < g.numberOfFactors(); P++) {
+            const auto B_P = g.factor(P);
+            K += B_P * D_matrix * B_P;
+        }
 
-        return ScalarRSQOneElectronOperator<Scalar> {sq_hamiltonian.core().parameters() + G1 + G2};
+        return ScalarRSQOneElectronOperator<Scalar> {h_core.parameters() + J - 0.5 * K};
     }
 
 
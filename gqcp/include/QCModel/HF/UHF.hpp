@@ -18,6 +18,7 @@
 #pragma once
 
 
+#include "Basis/Integrals/JKCalculator.hpp"
 #include "Basis/SpinorBasis/SpinResolvedOrbitalSpace.hpp"
 #include "Basis/Transformations/UTransformation.hpp"
 #include "Basis/Transformations/UTransformationComponent.hpp"
@@ -300,12 +301,32 @@ public:
      */
     static SpinResolved1DM<Scalar> calculateScalarBasis1DM(const UTransformation<Scalar>& C, const size_t N_a, const size_t N_b) {
 
-        // Calculate the 1-DM in the spin-orbital basis, and transform to the underlying scalar basis.
-        const auto K_a = C.alpha().numberOfOrbitals();
-        const auto K_b = C.beta().numberOfOrbitals();
-        const auto D_orthonormal = UHF<Scalar>::calculateOrthonormalBasis1DM(K_a, K_b, N_a, N_b);
+        return UHF<Scalar>::calculateScalarBasis1DM(SpinResolved<MatrixX<Scalar>> {C.alpha().matrix(), C.beta().matrix()}, N_a, N_b);
+    }
+
+
+    /**
+     *  Calculate the UHF 1-DM expressed in the underlying scalar basis.
+     * 
+     *  @param C            The alpha and beta coefficient matrices that express every spin-orbital (as a column) in the underlying scalar basis. If a scalar basis is (nearly) linearly dependent, its coefficient matrix has fewer columns than rows.
+     *  @param N_a          The number of alpha electrons, i.e. the number of occupied alpha spin-orbitals.
+     *  @param N_b          The number of beta electrons, i.e. the number of occupied beta spin-orbitals.
+     *
+     *  @return The UHF 1-DM expressed in the underlying scalar basis.
+     */
+    static SpinResolved1DM<Scalar> calculateScalarBasis1DM(const SpinResolved<MatrixX<Scalar>>& C, const size_t N_a, const size_t N_b) {
+
+        if ((N_a > static_cast<size_t>(C.alpha().cols())) || (N_b > static_cast<size_t>(C.beta().cols()))) {
+            throw std::invalid_argument("QCModel::UHF::calculateScalarBasis1DM(const SpinResolved<MatrixX<Scalar>>&, const size_t, const size_t): There are fewer spin-orbitals than electrons of that spin.");
+        }
+
+        // Only the occupied spin-orbitals contribute to the 1-DM, so we don't need to invert the coefficient matrices: D_sigma = C_sigma,occ^* C_sigma,occ^T.
+        const auto C_a_occupied = C.alpha().leftCols(N_a);
+        const auto C_b_occupied = C.beta().leftCols(N_b);
+        const SquareMatrix<Scalar> D_a = C_a_occupied.conjugate() * C_a_occupied.transpose();
+        const SquareMatrix<Scalar> D_b = C_b_occupied.conjugate() * C_b_occupied.transpose();
 
-        return D_orthonormal.transformed(C.inverse());
+        return SpinResolved1DM<Scalar> {SpinResolved1DMComponent<Scalar> {D_a}, SpinResolved1DMComponent<Scalar> {D_b}};
     }
 
 
@@ -363,26 +384,29 @@ public:
      *
      *  @param P                    The UHF density matrices in a scalar basis.
      *  @param sq_hamiltonian       The Hamiltonian expressed in the same scalar basis.
+     *  @param number_of_threads    The number of worker threads that calculate the direct and exchange matrices.
      *
      *  @return The UHF Fock operator expressed in the scalar basis of the AOs.
      */
-    static ScalarUSQOneElectronOperator<Scalar> calculateScalarBasisFockMatrix(const SpinResolved1DM<Scalar>& P, const USQHamiltonian<Scalar>& sq_hamiltonian) {
+    static ScalarUSQOneElectronOperator<Scalar> calculateScalarBasisFockMatrix(const SpinResolved1DM<Scalar>& P, const USQHamiltonian<Scalar>& sq_hamiltonian, const size_t number_of_threads = 1) {
 
         // F_sigma = H_core + (J_alpha + J_beta) - K_sigma.
         // H_core is always the same.
         const auto& H_core = sq_hamiltonian.core();
 
-        // Get the alpha and beta parameters of the coulomb and exchange matrices.
-        const auto J_a = UHF<Scalar>::calculateScalarBasisDirectMatrix(P, sq_hamiltonian).alpha().parameters();
-        const auto J_b = UHF<Scalar>::calculateScalarBasisDirectMatrix(P, sq_hamiltonian).beta().parameters();
+        // Calculate the direct and exchange matrices of every spin component in a single pass over its two-electron integrals:
+        //      (mu nu|rho lambda) P(rho lambda) and (mu rho|lambda nu) P(lambda rho).
+        const auto JK_a = JKCalculator<Scalar>::calculate(sq_hamiltonian.twoElectron().alphaAlpha().parameters(), {P.alpha().matrix()}, number_of_threads);
+        const auto JK_b = JKCalculator<Scalar>::calculate(sq_hamiltonian.twoElectron().betaBeta().parameters(), {P.beta().matrix()}, number_of_threads);
 
-        const auto K_a = UHF<Scalar>::calculateScalarBasisExchangeMatrix(P, sq_hamiltonian).alpha().parameters();
-        const auto K_b = UHF<Scalar>::calculateScalarBasisExchangeMatrix(P, sq_hamiltonian).beta().parameters();
+        const SquareMatrix<Scalar> J = JK_a.first[0] + JK_b.first[0];
+        const auto& K_a = JK_a.second[0];
+        const auto& K_b = JK_b.second[0];
 
 
         // Generate the alpha and beta Fock matrix and put them in a USQOneElectronOperator.
-        const auto F_a = H_core.alpha().parameters() + J_a - K_a;
-        const auto F_b = H_core.beta().parameters() + J_b - K_b;
+        const SquareMatrix<Scalar> F_a = H_core.alpha().parameters() + J - K_a;
+        const SquareMatrix<Scalar> F_b = H_core.beta().parameters() + J - K_b;
 
         return ScalarUSQOneElectronOperator<Scalar> {F_a, F_b};
     }
@@ -24,7 +24,9 @@
 
 
 #include <cstddef>
+#include <cstdlib>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -71,4 +73,65 @@ template <class T, class... Args>
 typename _Unique_if<T>::_Known_bound make_unique(Args&&...) = delete;
 
 
+/**
+ *  The size of a cache line (in bytes) that is assumed by the cache-aligned storage.
+ */
+constexpr size_t cache_line_size = 64;
+
+
+/**
+ *  An allocator that aligns its allocations to the start of a cache line, so that a contiguous table occupies as few cache lines as possible.
+ *
+ *  @tparam T           The type of the elements that are allocated.
+ */
+template <typename T>
+class CacheAlignedAllocator {
+public:
+    using value_type = T;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    CacheAlignedAllocator() = default;
+
+    template <typename U>
+    CacheAlignedAllocator(const CacheAlignedAllocator<U>&) {}
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  @param n            The number of elements that should be allocated.
+     *
+     *  @return A pointer to uninitialized, cache-aligned memory for the given number of elements.
+     */
+    T* allocate(const size_t n) {
+
+        void* pointer = nullptr;
+        if (posix_memalign(&pointer, cache_line_size, n * sizeof(T)) != 0) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(pointer);
+    }
+
+    /**
+     *  @param pointer      A pointer to memory that was allocated by this allocator.
+     */
+    void deallocate(T* pointer, const size_t) { std::free(pointer); }
+};
+
+
+template <typename T, typename U>
+bool operator==(const CacheAlignedAllocator<T>&, const CacheAlignedAllocator<U>&) { return true; }
+
+
+template <typename T, typename U>
+bool operator!=(const CacheAlignedAllocator<T>&, const CacheAlignedAllocator<U>&) { return false; }
+
+
 }  // namespace GQCP
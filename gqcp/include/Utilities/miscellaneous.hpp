@@ -134,6 +134,15 @@ size_t triangularRootOf(const size_t x);
  */
 std::ifstream validateAndOpen(const std::string& filename, const std::string& extension);
 
+/**
+ *  Parse an FCIDUMP file. Its header is read for the number of orbitals, after which every line 'x i a j b' (in chemist's notation) is handed over to the caller.
+ *
+ *  @param fcidump_filename         the name of the FCIDUMP file
+ *  @param initialize               a callable that is called once as initialize(K), with K the number of orbitals, before any line is read
+ *  @param read                     a callable that is called as read(x, i, a, j, b) for every line after the header, with the (1-based) indices as they appear in the file
+ */
+void parseFCIDUMP(const std::string& fcidump_filename, const std::function<void(const size_t)>& initialize, const std::function<void(const double, const size_t, const size_t, const size_t, const size_t)>& read);
+
 /**
  *  @param i            the row index
  *  @param j            the column index
@@ -0,0 +1,65 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <mkl.h>
+
+
+namespace GQCP {
+
+
+/**
+ *  A scope guard that restricts the MKL (BLAS/LAPACK) calls of the calling thread to a single thread, for as long as the guard is alive.
+ *
+ *  Worker threads that are spawned by GQCP itself should create one of these, so that every worker doesn't spawn MKL's own threads on top of the ones GQCP already uses. The previous thread-local setting is restored upon destruction.
+ */
+class SingleThreadedMKLScope {
+private:
+    // The thread-local number of MKL threads before this scope was entered. A value of 0 means that the global setting was used.
+    int previous_number_of_threads;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Restrict the MKL calls of the calling thread to a single thread.
+     */
+    SingleThreadedMKLScope() :
+        previous_number_of_threads {mkl_set_num_threads_local(1)} {}
+
+    // A scope guard can't be copied, since the previous setting should only be restored once.
+    SingleThreadedMKLScope(const SingleThreadedMKLScope&) = delete;
+    SingleThreadedMKLScope& operator=(const SingleThreadedMKLScope&) = delete;
+
+
+    /*
+     *  MARK: Destructor
+     */
+
+    /**
+     *  Restore the previous number of MKL threads of the calling thread.
+     */
+    ~SingleThreadedMKLScope() { mkl_set_num_threads_local(this->previous_number_of_threads); }
+};
+
+
+}  // namespace GQCP
@@ -22,7 +22,11 @@
 #include "Basis/Integrals/BaseOneElectronIntegralEngine.hpp"
 #include "Basis/Integrals/BaseTwoElectronIntegralBuffer.hpp"
 #include "Basis/Integrals/BaseTwoElectronIntegralEngine.hpp"
+#include "Basis/Integrals/BoysFunction.hpp"
+#include "Basis/Integrals/CoulombRepulsionIntegralEngine.hpp"
+#include "Basis/Integrals/DirectJKCalculator.hpp"
 #include "Basis/Integrals/FunctionalPrimitiveEngine.hpp"
+#include "Basis/Integrals/HermiteCoulombIntegrals.hpp"
 #include "Basis/Integrals/IntegralCalculator.hpp"
 #include "Basis/Integrals/IntegralEngine.hpp"
 #include "Basis/Integrals/Interfaces/LibcintInterfacer.hpp"
@@ -35,15 +39,21 @@
 #include "Basis/Integrals/Interfaces/LibintOneElectronIntegralEngine.hpp"
 #include "Basis/Integrals/Interfaces/LibintTwoElectronIntegralBuffer.hpp"
 #include "Basis/Integrals/Interfaces/LibintTwoElectronIntegralEngine.hpp"
+#include "Basis/Integrals/JKCalculator.hpp"
 #include "Basis/Integrals/McMurchieDavidsonCoefficient.hpp"
+#include "Basis/Integrals/NuclearAttractionIntegralEngine.hpp"
 #include "Basis/Integrals/OneElectronIntegralBuffer.hpp"
 #include "Basis/Integrals/OneElectronIntegralEngine.hpp"
+#include "Basis/Integrals/ParallelIntegralCalculator.hpp"
 #include "Basis/Integrals/PrimitiveAngularMomentumIntegralEngine.hpp"
 #include "Basis/Integrals/PrimitiveCartesianOperatorIntegralEngine.hpp"
 #include "Basis/Integrals/PrimitiveDipoleIntegralEngine.hpp"
 #include "Basis/Integrals/PrimitiveKineticEnergyIntegralEngine.hpp"
 #include "Basis/Integrals/PrimitiveLinearMomentumIntegralEngine.hpp"
 #include "Basis/Integrals/PrimitiveOverlapIntegralEngine.hpp"
+#include "Basis/Integrals/PrimitivePairBatch.hpp"
+#include "Basis/Integrals/ShellPairHermiteExpansion.hpp"
+#include "Basis/Integrals/TwoElectronIntegralBuffer.hpp"
 #include "Basis/MullikenPartitioning/GMullikenPartitioning.hpp"
 #include "Basis/MullikenPartitioning/RMullikenPartitioning.hpp"
 #include "Basis/MullikenPartitioning/UMullikenPartitioning.hpp"
@@ -63,6 +73,7 @@
 #include "Basis/SpinorBasis/USpinOrbitalBasis.hpp"
 #include "Basis/SpinorBasis/USpinOrbitalBasisComponent.hpp"
 #include "Basis/Transformations/BasisTransformable.hpp"
+#include "Basis/Transformations/FourIndexTransformation.hpp"
 #include "Basis/Transformations/GTransformation.hpp"
 #include "Basis/Transformations/JacobiRotatable.hpp"
 #include "Basis/Transformations/JacobiRotation.hpp"
@@ -92,6 +103,7 @@
 #include "Mathematical/Algorithm/CompoundConvergenceCriterion.hpp"
 #include "Mathematical/Algorithm/ConvergenceCriterion.hpp"
 #include "Mathematical/Algorithm/FunctionalStep.hpp"
+#include "Mathematical/Algorithm/History.hpp"
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Algorithm/Step.hpp"
 #include "Mathematical/Algorithm/StepCollection.hpp"
@@ -106,8 +118,11 @@
 #include "Mathematical/Grid/WeightedGrid.hpp"
 #include "Mathematical/Optimization/Accelerator/ConstantDamper.hpp"
 #include "Mathematical/Optimization/Accelerator/DIIS.hpp"
+#include "Mathematical/Optimization/Accelerator/IncrementalDIIS.hpp"
 #include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/BlockMatrixVectorProductCalculation.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/CorrectionVectorCalculation.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/DavidsonCorrection.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/DavidsonSolver.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/GuessVectorUpdate.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/MatrixVectorProductCalculation.hpp"
@@ -120,6 +135,7 @@
 #include "Mathematical/Optimization/Eigenproblem/Eigenpair.hpp"
 #include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
 #include "Mathematical/Optimization/Eigenproblem/EigenproblemSolver.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Orthogonalizer.hpp"
 #include "Mathematical/Optimization/LinearEquation/ColPivHouseholderQRSolution.hpp"
 #include "Mathematical/Optimization/LinearEquation/HouseholderQRSolution.hpp"
 #include "Mathematical/Optimization/LinearEquation/LinearEquationEnvironment.hpp"
@@ -141,6 +157,8 @@
 #include "Mathematical/Representation/ImplicitRankFourTensorSlice.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
 #include "Mathematical/Representation/MatrixRepresentationEvaluationContainer.hpp"
+#include "Mathematical/Representation/MemoryMappedMatrix.hpp"
+#include "Mathematical/Representation/PackedRankFourTensor.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 #include "Mathematical/Representation/SquareRankFourTensor.hpp"
 #include "Mathematical/Representation/StorageArray.hpp"
@@ -164,6 +182,8 @@
 #include "Operator/FirstQuantized/Operator.hpp"
 #include "Operator/FirstQuantized/OverlapOperator.hpp"
 #include "Operator/SecondQuantized/EvaluatableScalarRSQOneElectronOperator.hpp"
+#include "Operator/SecondQuantized/FactorizedRSQTwoElectronOperator.hpp"
+#include "Operator/SecondQuantized/FactorizedUSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/GSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/GSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/MixedUSQTwoElectronOperatorComponent.hpp"
@@ -212,6 +232,7 @@
 #include "QCMethod/Geminals/vAP1roG.hpp"
 #include "QCMethod/HF/GHF/GHF.hpp"
 #include "QCMethod/HF/GHF/GHFDensityMatrixCalculation.hpp"
+#include "QCMethod/HF/GHF/GHFDirectFockMatrixCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFElectronicEnergyCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFErrorCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFFockMatrixCalculation.hpp"
@@ -219,12 +240,15 @@
 #include "QCMethod/HF/GHF/GHFFockMatrixDiagonalization.hpp"
 #include "QCMethod/HF/GHF/GHFSCFEnvironment.hpp"
 #include "QCMethod/HF/GHF/GHFSCFSolver.hpp"
+#include "QCMethod/HF/GHF/GHFSpinBlockedFockMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/DiagonalRHFFockMatrixObjective.hpp"
 #include "QCMethod/HF/RHF/RHF.hpp"
 #include "QCMethod/HF/RHF/RHFDensityMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFDensityMatrixDamper.hpp"
+#include "QCMethod/HF/RHF/RHFDirectFockMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFElectronicEnergyCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFErrorCalculation.hpp"
+#include "QCMethod/HF/RHF/RHFFactorizedFockMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFFockMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFFockMatrixDIIS.hpp"
 #include "QCMethod/HF/RHF/RHFFockMatrixDiagonalization.hpp"
@@ -232,6 +256,7 @@
 #include "QCMethod/HF/RHF/RHFSCFSolver.hpp"
 #include "QCMethod/HF/UHF/UHF.hpp"
 #include "QCMethod/HF/UHF/UHFDensityMatrixCalculation.hpp"
+#include "QCMethod/HF/UHF/UHFDirectFockMatrixCalculation.hpp"
 #include "QCMethod/HF/UHF/UHFElectronicEnergyCalculation.hpp"
 #include "QCMethod/HF/UHF/UHFErrorCalculation.hpp"
 #include "QCMethod/HF/UHF/UHFFockMatrixCalculation.hpp"
@@ -273,6 +298,7 @@
 #include "Utilities/literals.hpp"
 #include "Utilities/memory.hpp"
 #include "Utilities/miscellaneous.hpp"
+#include "Utilities/threading.hpp"
 #include "Utilities/type_traits.hpp"
 #include "Utilities/units.hpp"
 #include "version.hpp"
@@ -0,0 +1,147 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/BoysFunction.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+#include <cmath>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Static members
+ */
+
+constexpr size_t BoysFunction::NumberOfTaylorTerms;
+constexpr double BoysFunction::GridSpacing;
+constexpr double BoysFunction::MaximumGridArgument;
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param max_order            The maximum order of the Boys function that can be evaluated. For two-electron integrals over shells with angular momentum up to l, this should be at least 4l.
+ */
+BoysFunction::BoysFunction(const size_t max_order) :
+    max_order {max_order} {
+
+    // The Taylor expansion of F_n requires the orders up to n + NumberOfTaylorTerms - 1 on the grid.
+    const size_t number_of_orders = max_order + NumberOfTaylorTerms;
+    const auto number_of_grid_points = static_cast<size_t>(std::round(MaximumGridArgument / GridSpacing)) + 1;
+    this->table.resize(number_of_grid_points * number_of_orders);
+
+    for (size_t g = 0; g < number_of_grid_points; g++) {
+        const double T = g * GridSpacing;
+        const double exp_T = std::exp(-T);
+        double* values = &this->table[g * number_of_orders];
+
+        // Calculate the highest order through its series expansion F_n(T) = exp(-T) sum_i (2T)^i / ((2n+1)(2n+3)...(2n+2i+1)), whose terms are all positive.
+        const size_t n_top = number_of_orders - 1;
+        double term = 1.0 / (2 * n_top + 1);
+        double sum = term;
+        for (size_t i = 1; i < 1000; i++) {
+            term *= 2 * T / (2 * n_top + 2 * i + 1);
+            sum += term;
+
+            if (term < 1.0e-17 * sum) {
+                break;
+            }
+        }
+        values[n_top] = exp_T * sum;
+
+        // The downward recursion is numerically stable.
+        for (size_t n = n_top; n > 0; n--) {
+            values[n - 1] = (2 * T * values[n] + exp_T) / (2 * n - 1);
+        }
+    }
+}
+
+
+/*
+ *  MARK: Evaluations
+ */
+
+/**
+ *  Evaluate the Boys function F_n(T) for all orders n = 0, 1, ..., m at once.
+ *
+ *  @param T                    The argument of the Boys function.
+ *  @param m                    The highest order of the Boys function that should be evaluated.
+ *  @param values               A pointer to an array of at least (m + 1) elements, in which F_n(T) is written at position n.
+ */
+void BoysFunction::calculate(const double T, const size_t m, double* values) const {
+
+    if (m > this->max_order) {
+        throw std::invalid_argument("BoysFunction::calculate(const double, const size_t, double*): The requested order exceeds the maximum order of this Boys function.");
+    }
+
+    const double exp_T = std::exp(-T);
+
+
+    // For large arguments, F_0 follows from the error function and the upward recursion is numerically stable.
+    if (T > MaximumGridArgument) {
+        values[0] = 0.5 * std::sqrt(boost::math::constants::pi<double>() / T) * std::erf(std::sqrt(T));
+
+        const double one_over_2T = 0.5 / T;
+        for (size_t n = 0; n < m; n++) {
+            values[n + 1] = ((2 * n + 1) * values[n] - exp_T) * one_over_2T;
+        }
+        return;
+    }
+
+
+    // Otherwise, interpolate the highest order through a Taylor expansion around the nearest grid point: F_m(T) = sum_k F_{m+k}(T_g) (T_g - T)^k / k!.
+    const size_t number_of_orders = this->max_order + NumberOfTaylorTerms;
+    const auto g = static_cast<size_t>(T / GridSpacing + 0.5);
+    const double delta = g * GridSpacing - T;
+    const double* grid_values = &this->table[g * number_of_orders + m];
+
+    double F_m = grid_values[NumberOfTaylorTerms - 1];
+    for (size_t k = NumberOfTaylorTerms - 1; k > 0; k--) {  // Horner's scheme
+        F_m = grid_values[k - 1] + delta * F_m / k;
+    }
+    values[m] = F_m;
+
+
+    // The lower orders follow from the downward recursion.
+    for (size_t n = m; n > 0; n--) {
+        values[n - 1] = (2 * T * values[n] + exp_T) / (2 * n - 1);
+    }
+}
+
+
+/**
+ *  @param n                    The order of the Boys function.
+ *  @param T                    The argument of the Boys function.
+ *
+ *  @return The value F_n(T).
+ */
+double BoysFunction::operator()(const size_t n, const double T) const {
+
+    std::vector<double> values(n + 1);
+    this->calculate(T, n, values.data());
+
+    return values[n];
+}
+
+
+}  // namespace GQCP
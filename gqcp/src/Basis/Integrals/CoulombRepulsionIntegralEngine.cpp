@@ -0,0 +1,124 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/CoulombRepulsionIntegralEngine.hpp"
+
+#include "Basis/Integrals/ShellPairHermiteExpansion.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+#include <cmath>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param max_l                the maximum angular momentum of the shells over which integrals will be calculated
+ */
+CoulombRepulsionIntegralEngine::CoulombRepulsionIntegralEngine(const size_t max_l) :
+    hermite_coulomb_integrals(4 * max_l) {}
+
+
+/*
+ *  MARK: Conforming to `BaseTwoElectronIntegralEngine`
+ */
+
+/**
+ *  Calculate all the Coulomb repulsion integrals over the given shells.
+ *
+ *  @param shell1           the first shell
+ *  @param shell2           the second shell
+ *  @param shell3           the third shell
+ *  @param shell4           the fourth shell
+ *
+ *  @note This method is not marked const to allow the Engine's internals to be changed
+ *
+ *  @return a buffer containing the calculated integrals
+ */
+std::shared_ptr<BaseTwoElectronIntegralBuffer<CoulombRepulsionIntegralEngine::IntegralScalar, CoulombRepulsionIntegralEngine::N>> CoulombRepulsionIntegralEngine::calculate(const Shell& shell1, const Shell& shell2, const Shell& shell3, const Shell& shell4) {
+
+    // Expand both shell pairs in Hermite Gaussians.
+    const ShellPairHermiteExpansion bra_expansion {shell1, shell2};
+    const ShellPairHermiteExpansion ket_expansion {shell3, shell4};
+
+    const auto& bra_degrees = bra_expansion.hermiteDegrees();
+    const auto& ket_degrees = ket_expansion.hermiteDegrees();
+    const auto L = bra_expansion.totalAngularMomentum() + ket_expansion.totalAngularMomentum();
+
+    const auto nbf1 = bra_expansion.numberOfBasisFunctionsInShell1();
+    const auto nbf2 = bra_expansion.numberOfBasisFunctionsInShell2();
+    const auto nbf3 = ket_expansion.numberOfBasisFunctionsInShell1();
+    const auto nbf4 = ket_expansion.numberOfBasisFunctionsInShell2();
+
+    this->R.resize(bra_degrees.size(), ket_degrees.size());
+    this->W.resize(bra_degrees.size(), nbf3 * nbf4);
+    MatrixX<double> G = MatrixX<double>::Zero(nbf1 * nbf2, nbf3 * nbf4);  // the integrals as a ((ab) x (cd))-matrix
+
+
+    // The ket Hermite Gaussians enter with a sign (-1)^{t'+u'+v'}.
+    std::vector<double> ket_signs(ket_degrees.size());
+    for (size_t h = 0; h < ket_degrees.size(); h++) {
+        ket_signs[h] = ((ket_degrees[h][0] + ket_degrees[h][1] + ket_degrees[h][2]) % 2 == 0) ? 1.0 : -1.0;
+    }
+
+    const auto two_pi_to_the_5_2 = 2 * std::pow(boost::math::constants::pi<double>(), 2.5);
+
+
+    // For every bra primitive pair, accumulate the contraction over all ket primitive pairs before contracting with the bra expansion coefficients.
+    for (const auto& bra_pair : bra_expansion.primitivePairs()) {
+        const auto p = bra_pair.p;
+        this->W.setZero();
+
+        for (const auto& ket_pair : ket_expansion.primitivePairs()) {
+            const auto q = ket_pair.p;
+            const Vector<double, 3> R_PQ = bra_pair.P - ket_pair.P;
+
+            this->hermite_coulomb_integrals.calculate(L, p * q / (p + q), R_PQ);
+            const auto prefactor = two_pi_to_the_5_2 / (p * q * std::sqrt(p + q));
+
+            for (size_t h2 = 0; h2 < ket_degrees.size(); h2++) {
+                const auto& degrees2 = ket_degrees[h2];
+                const auto factor = prefactor * ket_signs[h2];
+
+                for (size_t h1 = 0; h1 < bra_degrees.size(); h1++) {
+                    const auto& degrees1 = bra_degrees[h1];
+                    this->R(h1, h2) = factor * this->hermite_coulomb_integrals(degrees1[0] + degrees2[0], degrees1[1] + degrees2[1], degrees1[2] + degrees2[2]);
+                }
+            }
+
+            this->W.noalias() += this->R * ket_pair.E.transpose();
+        }
+
+        G.noalias() += bra_pair.E * this->W;
+    }
+
+
+    // Store the integrals in row-major ordering of (f1, f2, f3, f4), which coincides with the row-major ordering of the ((ab) x (cd))-matrix.
+    std::array<std::vector<IntegralScalar>, N> integrals;
+    integrals[0].resize(G.size());
+    Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(integrals[0].data(), G.rows(), G.cols()) = G;
+
+    return std::make_shared<TwoElectronIntegralBuffer<IntegralScalar, N>>(nbf1, nbf2, nbf3, nbf4, integrals);
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,106 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/HermiteCoulombIntegrals.hpp"
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param max_degree           The maximum total degree t + u + v of the Hermite Coulomb integrals that can be calculated. For two-electron integrals over shells with angular momentum up to l, this should be at least 4l.
+ */
+HermiteCoulombIntegrals::HermiteCoulombIntegrals(const size_t max_degree) :
+    boys_function(max_degree),
+    L {0} {}
+
+
+/*
+ *  MARK: Calculations
+ */
+
+/**
+ *  Calculate all Hermite Coulomb integrals R_{tuv} with t + u + v <= L.
+ *
+ *  @param L                    The total degree up to which the Hermite Coulomb integrals should be calculated.
+ *  @param p                    The exponent of the Hermite Gaussian distribution, or the reduced exponent for a product of two Hermite Gaussian distributions.
+ *  @param R_PC                 The distance vector between the center of the Hermite Gaussian distribution and the Coulomb center, or between the centers of two Hermite Gaussian distributions.
+ */
+void HermiteCoulombIntegrals::calculate(const size_t L, const double p, const Vector<double, 3>& R_PC) {
+
+    this->L = L;
+    const size_t D = L + 1;
+    this->values.resize(D * D * D * D);  // This does not reallocate if the storage is already large enough.
+    this->boys_values.resize(D);
+
+    const auto index = [D](const size_t n, const size_t t, const size_t u, const size_t v) { return ((n * D + t) * D + u) * D + v; };
+    auto& R = this->values;
+
+
+    // Provide the base recurrence cases R^n_{000} = (-2p)^n F_n(p R_PC^2).
+    const double X = R_PC(0);
+    const double Y = R_PC(1);
+    const double Z = R_PC(2);
+    this->boys_function.calculate(p * (X * X + Y * Y + Z * Z), L, this->boys_values.data());
+
+    double factor = 1.0;
+    for (size_t n = 0; n <= L; n++) {
+        R[index(n, 0, 0, 0)] = factor * this->boys_values[n];
+        factor *= -2 * p;
+    }
+
+
+    // Level n requires the integrals with t + u + v <= L - n, which follow from the ones at level n + 1. The integrals at level 0 are the requested ones.
+    for (size_t n = L; n-- > 0;) {
+        const size_t degree = L - n;
+
+        for (size_t t = 0; t <= degree; t++) {
+            for (size_t u = 0; u <= degree - t; u++) {
+                for (size_t v = 0; v <= degree - t - u; v++) {
+                    double value;
+                    if (t > 0) {
+                        value = X * R[index(n + 1, t - 1, u, v)];
+                        if (t > 1) {
+                            value += (t - 1) * R[index(n + 1, t - 2, u, v)];
+                        }
+                    } else if (u > 0) {
+                        value = Y * R[index(n + 1, t, u - 1, v)];
+                        if (u > 1) {
+                            value += (u - 1) * R[index(n + 1, t, u - 2, v)];
+                        }
+                    } else if (v > 0) {
+                        value = Z * R[index(n + 1, t, u, v - 1)];
+                        if (v > 1) {
+                            value += (v - 1) * R[index(n + 1, t, u, v - 2)];
+                        }
+                    } else {
+                        continue;  // R^n_{000} is a base case.
+                    }
+
+                    R[index(n, t, u, v)] = value;
+                }
+            }
+        }
+    }
+}
+
+
+}  // namespace GQCP
@@ -36,6 +36,18 @@ OneElectronIntegralEngine<PrimitiveAngularMomentumIntegralEngine> IntegralEngine
 }
 
 
+/**
+ *  @param op               the Coulomb repulsion operator
+ *  @param max_l            the maximum angular momentum of Gaussian shell
+ * 
+ *  @return a two-electron integral engine that can calculate integrals over the Coulomb repulsion operator
+ */
+CoulombRepulsionIntegralEngine IntegralEngine::InHouse(const CoulombRepulsionOperator& op, const size_t max_l) {
+
+    return CoulombRepulsionIntegralEngine(max_l);
+}
+
+
 /**
  *  @param op               the electronic dipole operator
  * 
@@ -69,6 +81,18 @@ OneElectronIntegralEngine<PrimitiveLinearMomentumIntegralEngine> IntegralEngine:
 }
 
 
+/**
+ *  @param op               the nuclear attraction operator
+ *  @param max_l            the maximum angular momentum of Gaussian shell
+ * 
+ *  @return a one-electron integral engine that can calculate integrals over the nuclear attraction operator
+ */
+NuclearAttractionIntegralEngine IntegralEngine::InHouse(const NuclearAttractionOperator& op, const size_t max_l) {
+
+    return NuclearAttractionIntegralEngine(op, max_l);
+}
+
+
 /**
  *  @param op               the overlap operator
  * 
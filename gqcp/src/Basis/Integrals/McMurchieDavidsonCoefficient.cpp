@@ -77,6 +77,61 @@ double McMurchieDavidsonCoefficient::operator()(const int i, const int j, const
 }
 
 
+/**
+ *  Calculate all McMurchie-Davidson expansion coefficients up to the given Cartesian exponents at once, through an iterative application of the recurrence relations. Contrary to repeated calls to `operator()`, every coefficient is calculated only once.
+ *
+ *  @param i_max            The maximum Cartesian exponent of the left Cartesian GTO.
+ *  @param j_max            The maximum Cartesian exponent of the right Cartesian GTO.
+ *  @param table            The table that is (re)filled, in which E^{i,j}_t is stored at position (i * (j_max + 1) + j) * (i_max + j_max + 1) + t.
+ */
+void McMurchieDavidsonCoefficient::tabulate(const int i_max, const int j_max, std::vector<double>& table) const {
+
+    const int number_of_degrees = i_max + j_max + 1;
+    table.assign((i_max + 1) * (j_max + 1) * number_of_degrees, 0.0);
+
+    const auto index = [j_max, number_of_degrees](const int i, const int j, const int t) { return (i * (j_max + 1) + j) * number_of_degrees + t; };
+
+
+    // Prepare some variables that appear in the recurrence relations.
+    const double one_over_2p = 1.0 / (2 * this->totalExponent());
+    const double X_PK = -this->b / this->totalExponent() * this->distance();  // The distance between the center of mass and the left center.
+    const double X_PL = this->a / this->totalExponent() * this->distance();   // The distance between the center of mass and the right center.
+
+
+    // Provide the base recurrence case and increase i for j = 0 and increase j for every i, so that every coefficient only depends on previously calculated ones.
+    table[index(0, 0, 0)] = std::exp(-this->reducedExponent() * std::pow(this->distance(), 2));
+
+    for (int i = 0; i <= i_max; i++) {
+        for (int j = 0; j <= j_max; j++) {
+            if ((i == 0) && (j == 0)) {
+                continue;
+            }
+
+            // Determine the coefficients we recur from: E^{i-1, 0}_t if j = 0 and E^{i, j-1}_t otherwise.
+            const int i_previous = (j == 0) ? i - 1 : i;
+            const int j_previous = (j == 0) ? j : j - 1;
+            const double X = (j == 0) ? X_PK : X_PL;
+            const int t_previous_max = i_previous + j_previous;
+
+            for (int t = 0; t <= i + j; t++) {
+                double value = 0.0;
+                if (t > 0) {
+                    value += one_over_2p * table[index(i_previous, j_previous, t - 1)];
+                }
+                if (t <= t_previous_max) {
+                    value += X * table[index(i_previous, j_previous, t)];
+                }
+                if (t + 1 <= t_previous_max) {
+                    value += (t + 1) * table[index(i_previous, j_previous, t + 1)];
+                }
+
+                table[index(i, j, t)] = value;
+            }
+        }
+    }
+}
+
+
 /*
  *  MARK: Gaussian overlap behavior
  */
@@ -0,0 +1,94 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/NuclearAttractionIntegralEngine.hpp"
+
+#include "Basis/Integrals/ShellPairHermiteExpansion.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param op                   the nuclear attraction operator over which this engine should calculate integrals
+ *  @param max_l                the maximum angular momentum of the shells over which integrals will be calculated
+ */
+NuclearAttractionIntegralEngine::NuclearAttractionIntegralEngine(const NuclearAttractionOperator& op, const size_t max_l) :
+    nuclei {op.nuclearFramework().nucleiAsVector()},
+    hermite_coulomb_integrals(2 * max_l) {}
+
+
+/*
+ *  MARK: Conforming to `BaseOneElectronIntegralEngine`
+ */
+
+/**
+ *  Calculate all the nuclear attraction integrals over the given shells.
+ *
+ *  @param shell1           the first shell
+ *  @param shell2           the second shell
+ *
+ *  @note This method is not marked const to allow the Engine's internals to be changed
+ *
+ *  @return a buffer containing the calculated integrals
+ */
+std::shared_ptr<BaseOneElectronIntegralBuffer<NuclearAttractionIntegralEngine::IntegralScalar, NuclearAttractionIntegralEngine::N>> NuclearAttractionIntegralEngine::calculate(const Shell& shell1, const Shell& shell2) {
+
+    // Expand the shell pair in Hermite Gaussians.
+    const ShellPairHermiteExpansion expansion {shell1, shell2};
+    const auto& degrees = expansion.hermiteDegrees();
+    const auto L = expansion.totalAngularMomentum();
+
+    const auto nbf1 = expansion.numberOfBasisFunctionsInShell1();
+    const auto nbf2 = expansion.numberOfBasisFunctionsInShell2();
+    VectorX<double> V = VectorX<double>::Zero(nbf1 * nbf2);
+
+
+    // For every primitive pair, sum the Hermite Coulomb integrals over all nuclei before contracting with the expansion coefficients.
+    VectorX<double> w(degrees.size());
+    for (const auto& pair : expansion.primitivePairs()) {
+        w.setZero();
+
+        for (const auto& nucleus : this->nuclei) {
+            const Vector<double, 3> R_PC = pair.P - nucleus.position();
+            this->hermite_coulomb_integrals.calculate(L, pair.p, R_PC);
+
+            const auto charge = static_cast<double>(nucleus.charge());
+            for (size_t h = 0; h < degrees.size(); h++) {
+                w(h) -= charge * this->hermite_coulomb_integrals(degrees[h][0], degrees[h][1], degrees[h][2]);
+            }
+        }
+
+        V.noalias() += (2 * boost::math::constants::pi<double>() / pair.p) * (pair.E * w);
+    }
+
+
+    // The integrals are stored in row-major ordering of (f1, f2), which is the ordering of the products in the Hermite expansion.
+    std::array<std::vector<IntegralScalar>, N> integrals;
+    integrals[0].assign(V.data(), V.data() + V.size());
+
+    return std::make_shared<OneElectronIntegralBuffer<IntegralScalar, N>>(nbf1, nbf2, integrals);
+}
+
+
+}  // namespace GQCP
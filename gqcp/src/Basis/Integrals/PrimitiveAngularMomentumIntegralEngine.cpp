@@ -21,6 +21,8 @@
 #include "Basis/Integrals/PrimitiveLinearMomentumIntegralEngine.hpp"
 #include "Basis/Integrals/PrimitiveOverlapIntegralEngine.hpp"
 
+#include <array>
+
 
 namespace GQCP {
 
@@ -123,4 +125,64 @@ PrimitiveAngularMomentumIntegralEngine::IntegralScalar PrimitiveAngularMomentumI
 }
 
 
+
+/**
+ *  Calculate the contracted integral over two Cartesian basis functions of a shell pair by summing over all its primitive pairs at once, reusing the McMurchie-Davidson expansion coefficients that were calculated for the whole shell pair.
+ * 
+ *  @param primitive_pairs          the primitive pairs of the shell pair, with their McMurchie-Davidson expansion coefficients
+ *  @param left                     the Cartesian exponents of the left basis function
+ *  @param right                    the Cartesian exponents of the right basis function
+ * 
+ *  @return the contracted angular momentum integral (of the current component) over the two given basis functions
+ */
+PrimitiveAngularMomentumIntegralEngine::IntegralScalar PrimitiveAngularMomentumIntegralEngine::calculate(const PrimitivePairBatch& primitive_pairs, const CartesianExponents& left, const CartesianExponents& right) {
+
+    // Label the direction of the current component c and the two other directions a and b, such that (c, a, b) is a cyclic permutation of (x, y, z).
+    const auto c = this->component;
+    const auto a = static_cast<CartesianDirection>((c + 1) % 3);
+    const auto b = static_cast<CartesianDirection>((c + 2) % 3);
+
+    const auto* E_c = primitive_pairs.expansionCoefficients(c, left.value(c), right.value(c), 0);
+    const auto* beta = primitive_pairs.rightExponents();
+    const auto* prefactors = primitive_pairs.prefactors();
+
+    // For the directions a and b, we need the expansion coefficients that appear in the 1D dipole integrals and 1D linear momentum integrals.
+    std::array<const double*, 2> E_0;
+    std::array<const double*, 2> E_1;
+    std::array<const double*, 2> E_plus_1;
+    std::array<const double*, 2> E_minus_1;
+    std::array<const double*, 2> P;
+    std::array<double, 2> O;
+    std::array<double, 2> j;
+    const std::array<CartesianDirection, 2> directions {a, b};
+    for (size_t d = 0; d < 2; d++) {
+        const auto direction = directions[d];
+        const auto i_d = static_cast<int>(left.value(direction));
+        const auto j_d = static_cast<int>(right.value(direction));
+        j[d] = j_d;
+
+        E_0[d] = primitive_pairs.expansionCoefficients(direction, i_d, j_d, 0);
+        E_1[d] = primitive_pairs.expansionCoefficients(direction, i_d, j_d, 1);
+        E_plus_1[d] = primitive_pairs.expansionCoefficients(direction, i_d, j_d + 1, 0);
+        E_minus_1[d] = primitive_pairs.expansionCoefficients(direction, i_d, j_d - 1, 0);
+        P[d] = primitive_pairs.centersOfMass(direction);
+        O[d] = this->angular_momentum_operator.reference()(direction);
+    }
+
+
+    // The integral is S_c (r_a p_b - r_b p_a), in which the 1D position integrals are minus the 1D dipole integrals and the 1D linear momentum integrals are i (2 beta S_{i,j+1} - j S_{i,j-1}). The real sum can be accumulated first.
+    double integral = 0.0;
+    for (size_t k = 0; k < primitive_pairs.size(); k++) {
+        const auto r_a = E_1[0][k] + (P[0][k] - O[0]) * E_0[0][k];
+        const auto r_b = E_1[1][k] + (P[1][k] - O[1]) * E_0[1][k];
+        const auto m_a = 2 * beta[k] * E_plus_1[0][k] - j[0] * E_minus_1[0][k];
+        const auto m_b = 2 * beta[k] * E_plus_1[1][k] - j[1] * E_minus_1[1][k];
+
+        integral += prefactors[k] * E_c[k] * (r_a * m_b - r_b * m_a);
+    }
+
+    return IntegralScalar(0.0, integral);
+}
+
+
 }  // namespace GQCP
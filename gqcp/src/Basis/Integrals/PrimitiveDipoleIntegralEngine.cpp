@@ -113,4 +113,40 @@ PrimitiveDipoleIntegralEngine::IntegralScalar PrimitiveDipoleIntegralEngine::cal
 }
 
 
+
+/**
+ *  Calculate the contracted integral over two Cartesian basis functions of a shell pair by summing over all its primitive pairs at once, reusing the McMurchie-Davidson expansion coefficients that were calculated for the whole shell pair.
+ * 
+ *  @param primitive_pairs          the primitive pairs of the shell pair, with their McMurchie-Davidson expansion coefficients
+ *  @param left                     the Cartesian exponents of the left basis function
+ *  @param right                    the Cartesian exponents of the right basis function
+ * 
+ *  @return the contracted dipole integral (of the current component) over the two given basis functions
+ */
+PrimitiveDipoleIntegralEngine::IntegralScalar PrimitiveDipoleIntegralEngine::calculate(const PrimitivePairBatch& primitive_pairs, const CartesianExponents& left, const CartesianExponents& right) {
+
+    // Label the direction of the current component c and the two other directions a and b.
+    const auto c = this->component;
+    const auto a = static_cast<CartesianDirection>((c + 1) % 3);
+    const auto b = static_cast<CartesianDirection>((c + 2) % 3);
+
+    const auto* E_a = primitive_pairs.expansionCoefficients(a, left.value(a), right.value(a), 0);
+    const auto* E_b = primitive_pairs.expansionCoefficients(b, left.value(b), right.value(b), 0);
+    const auto* E_c0 = primitive_pairs.expansionCoefficients(c, left.value(c), right.value(c), 0);
+    const auto* E_c1 = primitive_pairs.expansionCoefficients(c, left.value(c), right.value(c), 1);
+    const auto* P_c = primitive_pairs.centersOfMass(c);
+    const auto O_c = this->dipole_operator.reference()(c);
+    const auto* prefactors = primitive_pairs.prefactors();
+
+
+    // For the current component, the integral is a product of a 1D dipole integral and two 1D overlap integrals.
+    IntegralScalar integral = 0.0;
+    for (size_t k = 0; k < primitive_pairs.size(); k++) {
+        integral -= prefactors[k] * (E_c1[k] + (P_c[k] - O_c) * E_c0[k]) * E_a[k] * E_b[k];  // the minus sign comes from the electronic dipole operator
+    }
+
+    return integral;
+}
+
+
 }  // namespace GQCP
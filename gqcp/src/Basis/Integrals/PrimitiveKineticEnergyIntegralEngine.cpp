@@ -19,6 +19,8 @@
 
 #include "Basis/Integrals/PrimitiveOverlapIntegralEngine.hpp"
 
+#include <array>
+
 
 namespace GQCP {
 
@@ -82,4 +84,47 @@ PrimitiveKineticEnergyIntegralEngine::IntegralScalar PrimitiveKineticEnergyInteg
 }
 
 
+
+/**
+ *  Calculate the contracted integral over two Cartesian basis functions of a shell pair by summing over all its primitive pairs at once, reusing the McMurchie-Davidson expansion coefficients that were calculated for the whole shell pair.
+ * 
+ *  @param primitive_pairs          the primitive pairs of the shell pair, with their McMurchie-Davidson expansion coefficients
+ *  @param left                     the Cartesian exponents of the left basis function
+ *  @param right                    the Cartesian exponents of the right basis function
+ * 
+ *  @return the contracted kinetic energy integral over the two given basis functions
+ */
+PrimitiveKineticEnergyIntegralEngine::IntegralScalar PrimitiveKineticEnergyIntegralEngine::calculate(const PrimitivePairBatch& primitive_pairs, const CartesianExponents& left, const CartesianExponents& right) {
+
+    // Prepare the expansion coefficients for the 1D overlap integrals S_{i,j}, S_{i,j+2} and S_{i,j-2} in every direction.
+    std::array<const double*, 3> E;
+    std::array<const double*, 3> E_plus_2;
+    std::array<const double*, 3> E_minus_2;
+    std::array<double, 3> j;
+    for (const auto& direction : {CartesianDirection::x, CartesianDirection::y, CartesianDirection::z}) {
+        const auto i = static_cast<int>(left.value(direction));
+        j[direction] = static_cast<double>(right.value(direction));
+
+        E[direction] = primitive_pairs.expansionCoefficients(direction, i, static_cast<int>(j[direction]), 0);
+        E_plus_2[direction] = primitive_pairs.expansionCoefficients(direction, i, static_cast<int>(j[direction]) + 2, 0);
+        E_minus_2[direction] = primitive_pairs.expansionCoefficients(direction, i, static_cast<int>(j[direction]) - 2, 0);
+    }
+    const auto* beta = primitive_pairs.rightExponents();
+    const auto* prefactors = primitive_pairs.prefactors();
+
+
+    // The 3D kinetic energy integral is a sum of three contributions (dx^2, dy^2, dz^2), in which every 1D kinetic energy integral is a sum of three 1D overlap integrals.
+    IntegralScalar integral = 0.0;
+    for (size_t k = 0; k < primitive_pairs.size(); k++) {
+        const auto T_x = -2 * beta[k] * beta[k] * E_plus_2[0][k] + beta[k] * (2 * j[0] + 1) * E[0][k] - 0.5 * j[0] * (j[0] - 1) * E_minus_2[0][k];
+        const auto T_y = -2 * beta[k] * beta[k] * E_plus_2[1][k] + beta[k] * (2 * j[1] + 1) * E[1][k] - 0.5 * j[1] * (j[1] - 1) * E_minus_2[1][k];
+        const auto T_z = -2 * beta[k] * beta[k] * E_plus_2[2][k] + beta[k] * (2 * j[2] + 1) * E[2][k] - 0.5 * j[2] * (j[2] - 1) * E_minus_2[2][k];
+
+        integral += prefactors[k] * (T_x * E[1][k] * E[2][k] + E[0][k] * T_y * E[2][k] + E[0][k] * E[1][k] * T_z);
+    }
+
+    return integral;
+}
+
+
 }  // namespace GQCP
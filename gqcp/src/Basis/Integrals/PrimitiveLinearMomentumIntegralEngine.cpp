@@ -98,4 +98,42 @@ PrimitiveLinearMomentumIntegralEngine::IntegralScalar PrimitiveLinearMomentumInt
 }
 
 
+
+/**
+ *  Calculate the contracted integral over two Cartesian basis functions of a shell pair by summing over all its primitive pairs at once, reusing the McMurchie-Davidson expansion coefficients that were calculated for the whole shell pair.
+ * 
+ *  @param primitive_pairs          the primitive pairs of the shell pair, with their McMurchie-Davidson expansion coefficients
+ *  @param left                     the Cartesian exponents of the left basis function
+ *  @param right                    the Cartesian exponents of the right basis function
+ * 
+ *  @return the contracted linear momentum integral (of the current component) over the two given basis functions
+ */
+PrimitiveLinearMomentumIntegralEngine::IntegralScalar PrimitiveLinearMomentumIntegralEngine::calculate(const PrimitivePairBatch& primitive_pairs, const CartesianExponents& left, const CartesianExponents& right) {
+
+    // Label the direction of the current component c and the two other directions a and b.
+    const auto c = this->component;
+    const auto a = static_cast<CartesianDirection>((c + 1) % 3);
+    const auto b = static_cast<CartesianDirection>((c + 2) % 3);
+
+    const auto i_c = static_cast<int>(left.value(c));
+    const auto j_c = static_cast<int>(right.value(c));
+
+    const auto* E_a = primitive_pairs.expansionCoefficients(a, left.value(a), right.value(a), 0);
+    const auto* E_b = primitive_pairs.expansionCoefficients(b, left.value(b), right.value(b), 0);
+    const auto* E_c_plus_1 = primitive_pairs.expansionCoefficients(c, i_c, j_c + 1, 0);
+    const auto* E_c_minus_1 = primitive_pairs.expansionCoefficients(c, i_c, j_c - 1, 0);
+    const auto* beta = primitive_pairs.rightExponents();
+    const auto* prefactors = primitive_pairs.prefactors();
+
+
+    // The 1D linear momentum integral is i (2 beta S_{i,j+1} - j S_{i,j-1}), so the real sum can be accumulated first.
+    double integral = 0.0;
+    for (size_t k = 0; k < primitive_pairs.size(); k++) {
+        integral += prefactors[k] * (2 * beta[k] * E_c_plus_1[k] - j_c * E_c_minus_1[k]) * E_a[k] * E_b[k];
+    }
+
+    return IntegralScalar(0.0, integral);
+}
+
+
 }  // namespace GQCP
@@ -75,4 +75,31 @@ PrimitiveOverlapIntegralEngine::IntegralScalar PrimitiveOverlapIntegralEngine::c
 }
 
 
+
+/**
+ *  Calculate the contracted integral over two Cartesian basis functions of a shell pair by summing over all its primitive pairs at once, reusing the McMurchie-Davidson expansion coefficients that were calculated for the whole shell pair.
+ * 
+ *  @param primitive_pairs          the primitive pairs of the shell pair, with their McMurchie-Davidson expansion coefficients
+ *  @param left                     the Cartesian exponents of the left basis function
+ *  @param right                    the Cartesian exponents of the right basis function
+ * 
+ *  @return the contracted overlap integral over the two given basis functions
+ */
+PrimitiveOverlapIntegralEngine::IntegralScalar PrimitiveOverlapIntegralEngine::calculate(const PrimitivePairBatch& primitive_pairs, const CartesianExponents& left, const CartesianExponents& right) {
+
+    // The 3D integral is a product of three 1D integrals, whose factors (pi/p)^{1/2} are gathered in the prefactors.
+    const auto* E_x = primitive_pairs.expansionCoefficients(CartesianDirection::x, left.value(CartesianDirection::x), right.value(CartesianDirection::x), 0);
+    const auto* E_y = primitive_pairs.expansionCoefficients(CartesianDirection::y, left.value(CartesianDirection::y), right.value(CartesianDirection::y), 0);
+    const auto* E_z = primitive_pairs.expansionCoefficients(CartesianDirection::z, left.value(CartesianDirection::z), right.value(CartesianDirection::z), 0);
+    const auto* prefactors = primitive_pairs.prefactors();
+
+    IntegralScalar integral = 0.0;
+    for (size_t k = 0; k < primitive_pairs.size(); k++) {
+        integral += prefactors[k] * E_x[k] * E_y[k] * E_z[k];
+    }
+
+    return integral;
+}
+
+
 }  // namespace GQCP
@@ -0,0 +1,161 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/PrimitivePairBatch.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+#include <cmath>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param shell1               The left shell.
+ *  @param shell2               The right shell.
+ *  @param additional_j         The number by which the Cartesian exponents of the right primitives may be raised when the expansion coefficients are requested, e.g. 2 for kinetic energy integrals.
+ */
+PrimitivePairBatch::PrimitivePairBatch(const GTOShell& shell1, const GTOShell& shell2, const int additional_j) :
+    n {shell1.contractionSize() * shell2.contractionSize()},
+    i_max {static_cast<int>(shell1.angularMomentum())},
+    j_max {static_cast<int>(shell2.angularMomentum()) + additional_j},
+    right_exponents(shell1.contractionSize() * shell2.contractionSize()),
+    m_prefactors(shell1.contractionSize() * shell2.contractionSize()),
+    zeros(shell1.contractionSize() * shell2.contractionSize(), 0.0) {
+
+    const auto& A = shell1.nucleus().position();
+    const auto& B = shell2.nucleus().position();
+    const auto& gaussian_exponents1 = shell1.gaussianExponents();
+    const auto& gaussian_exponents2 = shell2.gaussianExponents();
+    const auto& contraction_coefficients1 = shell1.contractionCoefficients();
+    const auto& contraction_coefficients2 = shell2.contractionCoefficients();
+
+
+    // Gather the properties of every pair in contiguous arrays.
+    std::vector<double> left_exponents(this->n);
+    std::vector<double> total_exponents(this->n);
+    for (size_t c1 = 0; c1 < shell1.contractionSize(); c1++) {
+        for (size_t c2 = 0; c2 < shell2.contractionSize(); c2++) {
+            const auto k = c1 * shell2.contractionSize() + c2;
+            left_exponents[k] = gaussian_exponents1[c1];
+            this->right_exponents[k] = gaussian_exponents2[c2];
+            total_exponents[k] = gaussian_exponents1[c1] + gaussian_exponents2[c2];
+            this->m_prefactors[k] = contraction_coefficients1[c1] * contraction_coefficients2[c2] * std::pow(boost::math::constants::pi<double>() / total_exponents[k], 1.5);
+        }
+    }
+
+    std::vector<double> one_over_2p(this->n);
+    for (size_t k = 0; k < this->n; k++) {
+        one_over_2p[k] = 0.5 / total_exponents[k];
+    }
+
+
+    // Calculate the expansion coefficients through the recurrence relations for every direction, in which the innermost loops run over the pairs.
+    const int number_of_degrees = this->i_max + this->j_max + 1;
+    const auto index = [this, number_of_degrees](const int i, const int j, const int t) { return static_cast<size_t>((i * (this->j_max + 1) + j) * number_of_degrees + t) * this->n; };
+
+    std::vector<double> X_PA(this->n);
+    std::vector<double> X_PB(this->n);
+    for (size_t x = 0; x < 3; x++) {
+        auto& P = this->centers_of_mass[x];
+        auto& E = this->coefficients[x];
+        P.resize(this->n);
+        E.assign((this->i_max + 1) * (this->j_max + 1) * number_of_degrees * this->n, 0.0);
+
+        const double X_AB = A(x) - B(x);
+        double* E_00 = &E[index(0, 0, 0)];
+        for (size_t k = 0; k < this->n; k++) {
+            P[k] = (left_exponents[k] * A(x) + this->right_exponents[k] * B(x)) / total_exponents[k];
+            X_PA[k] = P[k] - A(x);
+            X_PB[k] = P[k] - B(x);
+            E_00[k] = std::exp(-left_exponents[k] * this->right_exponents[k] / total_exponents[k] * X_AB * X_AB);
+        }
+
+        for (int i = 0; i <= this->i_max; i++) {
+            for (int j = 0; j <= this->j_max; j++) {
+                if ((i == 0) && (j == 0)) {
+                    continue;
+                }
+
+                // Recur from E^{i-1, 0}_t if j = 0 and from E^{i, j-1}_t otherwise.
+                const int i_previous = (j == 0) ? i - 1 : i;
+                const int j_previous = (j == 0) ? j : j - 1;
+                const auto& X = (j == 0) ? X_PA : X_PB;
+                const int t_previous_max = i_previous + j_previous;
+
+                for (int t = 0; t <= i + j; t++) {
+                    double* target = &E[index(i, j, t)];
+
+                    if (t > 0) {
+                        const double* lower = &E[index(i_previous, j_previous, t - 1)];
+                        for (size_t k = 0; k < this->n; k++) {
+                            target[k] += one_over_2p[k] * lower[k];
+                        }
+                    }
+                    if (t <= t_previous_max) {
+                        const double* same = &E[index(i_previous, j_previous, t)];
+                        for (size_t k = 0; k < this->n; k++) {
+                            target[k] += X[k] * same[k];
+                        }
+                    }
+                    if (t + 1 <= t_previous_max) {
+                        const double* higher = &E[index(i_previous, j_previous, t + 1)];
+                        for (size_t k = 0; k < this->n; k++) {
+                            target[k] += (t + 1) * higher[k];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ *  MARK: Access
+ */
+
+/**
+ *  @param direction            The Cartesian direction.
+ *  @param i                    The Cartesian exponent of the left primitives.
+ *  @param j                    The Cartesian exponent of the right primitives.
+ *  @param t                    The degree of the Hermite Gaussian.
+ *
+ *  @return The expansion coefficients E^{i,j}_t in the given direction for every pair. Coefficients that vanish (e.g. for negative exponents or t > i + j) are represented by zeros.
+ */
+const double* PrimitivePairBatch::expansionCoefficients(const CartesianDirection direction, const int i, const int j, const int t) const {
+
+    if ((i < 0) || (j < 0) || (t < 0) || (t > i + j)) {
+        return this->zeros.data();
+    }
+
+    if ((i > this->i_max) || (j > this->j_max)) {
+        throw std::invalid_argument("PrimitivePairBatch::expansionCoefficients(const CartesianDirection, const int, const int, const int): The requested Cartesian exponents exceed the ones for which the expansion coefficients were tabulated.");
+    }
+
+    const int number_of_degrees = this->i_max + this->j_max + 1;
+    return &this->coefficients[direction][static_cast<size_t>((i * (this->j_max + 1) + j) * number_of_degrees + t) * this->n];
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,128 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/ShellPairHermiteExpansion.hpp"
+
+#include "Basis/Integrals/McMurchieDavidsonCoefficient.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param shell1               The first shell.
+ *  @param shell2               The second shell.
+ *
+ *  @note Only Cartesian shells are supported for angular momenta higher than 1, i.e. starting from d-shells.
+ */
+ShellPairHermiteExpansion::ShellPairHermiteExpansion(const GTOShell& shell1, const GTOShell& shell2) {
+
+    const auto l1 = shell1.angularMomentum();
+    const auto l2 = shell2.angularMomentum();
+    if ((shell1.isPure() && (l1 > 1)) || (shell2.isPure() && (l2 > 1))) {
+        throw std::invalid_argument("ShellPairHermiteExpansion(const GTOShell&, const GTOShell&): Only Cartesian shells are supported starting from d-shells.");
+    }
+
+    const auto all_cartesian_exponents1 = shell1.generateCartesianExponents();
+    const auto all_cartesian_exponents2 = shell2.generateCartesianExponents();
+    this->nbf1 = all_cartesian_exponents1.size();
+    this->nbf2 = all_cartesian_exponents2.size();
+    this->L = l1 + l2;
+
+
+    // Enumerate all the Hermite Gaussians that can appear in the expansion.
+    for (size_t t = 0; t <= this->L; t++) {
+        for (size_t u = 0; u <= this->L - t; u++) {
+            for (size_t v = 0; v <= this->L - t - u; v++) {
+                this->hermite_degrees.push_back({t, u, v});
+            }
+        }
+    }
+
+
+    // Expand the products of the basis functions for every pair of primitives. The expansion coefficients are tabulated once per direction, after which they are combined for all pairs of Cartesian exponents.
+    const auto& A = shell1.nucleus().position();
+    const auto& B = shell2.nucleus().position();
+    const auto& gaussian_exponents1 = shell1.gaussianExponents();
+    const auto& gaussian_exponents2 = shell2.gaussianExponents();
+    const auto& contraction_coefficients1 = shell1.contractionCoefficients();
+    const auto& contraction_coefficients2 = shell2.contractionCoefficients();
+
+    const auto index = [l1, l2](const size_t i, const size_t j, const size_t t) { return (i * (l2 + 1) + j) * (l1 + l2 + 1) + t; };
+    std::array<std::vector<double>, 3> E_tables;
+
+    this->primitive_pairs.reserve(shell1.contractionSize() * shell2.contractionSize());
+    for (size_t c1 = 0; c1 < shell1.contractionSize(); c1++) {
+        const auto a = gaussian_exponents1[c1];
+
+        for (size_t c2 = 0; c2 < shell2.contractionSize(); c2++) {
+            const auto b = gaussian_exponents2[c2];
+            const auto p = a + b;
+            const auto d = contraction_coefficients1[c1] * contraction_coefficients2[c2];
+
+            // Skip pairs of primitives whose Gaussian overlap prefactor makes every product negligible.
+            const auto overlap_prefactor = d * std::exp(-a * b / p * (A - B).squaredNorm());
+            if (std::abs(overlap_prefactor) < 1.0e-20) {
+                continue;
+            }
+
+            for (size_t x = 0; x < 3; x++) {
+                McMurchieDavidsonCoefficient(A(x), a, B(x), b).tabulate(static_cast<int>(l1), static_cast<int>(l2), E_tables[x]);
+            }
+
+            PrimitivePair pair;
+            pair.p = p;
+            pair.P = (a * A + b * B) / p;
+            pair.E = MatrixX<double>::Zero(this->nbf1 * this->nbf2, this->numberOfHermiteGaussians());
+
+            for (size_t f1 = 0; f1 < this->nbf1; f1++) {
+                const auto& exponents1 = all_cartesian_exponents1[f1];
+                const auto i_x = exponents1.value(CartesianDirection::x);
+                const auto i_y = exponents1.value(CartesianDirection::y);
+                const auto i_z = exponents1.value(CartesianDirection::z);
+
+                for (size_t f2 = 0; f2 < this->nbf2; f2++) {
+                    const auto& exponents2 = all_cartesian_exponents2[f2];
+                    const auto j_x = exponents2.value(CartesianDirection::x);
+                    const auto j_y = exponents2.value(CartesianDirection::y);
+                    const auto j_z = exponents2.value(CartesianDirection::z);
+
+                    for (size_t h = 0; h < this->numberOfHermiteGaussians(); h++) {
+                        const auto& degrees = this->hermite_degrees[h];
+                        if ((degrees[0] > i_x + j_x) || (degrees[1] > i_y + j_y) || (degrees[2] > i_z + j_z)) {
+                            continue;
+                        }
+
+                        pair.E(f1 * this->nbf2 + f2, h) = d * E_tables[0][index(i_x, j_x, degrees[0])] * E_tables[1][index(i_y, j_y, degrees[1])] * E_tables[2][index(i_z, j_z, degrees[2])];
+                    }
+                }
+            }
+
+            this->primitive_pairs.push_back(std::move(pair));
+        }
+    }
+}
+
+
+}  // namespace GQCP
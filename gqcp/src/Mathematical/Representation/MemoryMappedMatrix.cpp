@@ -0,0 +1,122 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Mathematical/Representation/MemoryMappedMatrix.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/*
+ *  CONSTRUCTORS
+ */
+
+/**
+ *  Create a memory-mapped matrix with zero-initialized elements.
+ * 
+ *  @param scratch_directory            the directory in which the backing file should be created
+ *  @param rows                         the number of rows of the matrix
+ *  @param cols                         the number of columns of the matrix
+ */
+MemoryMappedMatrix::MemoryMappedMatrix(const std::string& scratch_directory, const size_t rows, const size_t cols) :
+    scratch_directory {scratch_directory},
+    file_descriptor {-1},
+    data {nullptr},
+    number_of_rows {rows},
+    number_of_columns {0} {
+
+    // Create a unique file in the scratch directory and unlink it immediately: the file stays alive for as long as it is opened.
+    const std::string file_template = scratch_directory + "/gqcp_XXXXXX";
+    std::vector<char> file_name {file_template.begin(), file_template.end()};
+    file_name.push_back('\0');
+
+    this->file_descriptor = mkstemp(file_name.data());
+    if (this->file_descriptor == -1) {
+        throw std::runtime_error("MemoryMappedMatrix::MemoryMappedMatrix(const std::string&, const size_t, const size_t): Could not create a backing file in the scratch directory " + scratch_directory + ".");
+    }
+    unlink(file_name.data());
+
+    // The destructor isn't called if the constructor throws, so the backing file has to be closed here.
+    try {
+        this->conservativeResize(cols);
+    } catch (...) {
+        close(this->file_descriptor);
+        this->file_descriptor = -1;
+        throw;
+    }
+}
+
+
+/*
+ *  DESTRUCTOR
+ */
+
+MemoryMappedMatrix::~MemoryMappedMatrix() {
+
+    if (this->data) {
+        munmap(this->data, this->number_of_rows * this->number_of_columns * sizeof(double));
+    }
+
+    if (this->file_descriptor != -1) {
+        close(this->file_descriptor);
+    }
+}
+
+
+/*
+ *  PUBLIC METHODS
+ */
+
+/**
+ *  Conservatively resize the number of columns of this matrix: the elements in the columns that are kept are unchanged, while the elements of new columns are zero.
+ * 
+ *  @param cols                         the new number of columns
+ */
+void MemoryMappedMatrix::conservativeResize(const size_t cols) {
+
+    // Since the matrix is stored column-major, keeping the first columns amounts to keeping the start of the file. Truncating the file to a larger size zero-initializes the new part.
+    if (this->data) {
+        munmap(this->data, this->number_of_rows * this->number_of_columns * sizeof(double));
+        this->data = nullptr;
+    }
+
+    const size_t number_of_bytes = this->number_of_rows * cols * sizeof(double);
+    if (ftruncate(this->file_descriptor, static_cast<off_t>(number_of_bytes)) != 0) {
+        throw std::runtime_error("MemoryMappedMatrix::conservativeResize(const size_t): Could not resize the backing file in the scratch directory " + this->scratch_directory + ".");
+    }
+    this->number_of_columns = cols;
+
+    if (number_of_bytes == 0) {  // mmap doesn't accept empty mappings
+        return;
+    }
+
+    void* mapping = mmap(nullptr, number_of_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, this->file_descriptor, 0);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("MemoryMappedMatrix::conservativeResize(const size_t): Could not map the backing file into memory.");
+    }
+    this->data = static_cast<double*>(mapping);
+}
+
+
+}  // namespace GQCP
@@ -100,53 +100,15 @@ SquareMatrix<double> SeniorityZeroONVBasis::evaluateOperatorDense(const RSQHamil
     }
 
 
-    // Prepare some variables to be used in the algorithm.
-    const size_t N_P = this->numberOfElectronPairs();
-    const size_t dim = this->dimension();
+    // Initialize the matrix representation from the diagonal contributions, and add the (symmetric) contributions of the pair excitations.
+    SquareMatrix<double> H = SquareMatrix<double>::Zero(this->dimension());
+    H.diagonal() = this->evaluateOperatorDiagonal(hamiltonian);
 
-    SquareMatrix<double> H = SquareMatrix<double>::Zero(dim);  // The matrix representation of the Hamiltonian.
-    const auto diagonal = this->evaluateOperatorDiagonal(hamiltonian);
     const auto& g = hamiltonian.twoElectron().parameters();
-
-
-    // Use a proxy ONV basis to treat alpha- and beta- ONVs as equal and multiply all contributions by 2.
-    const auto proxy_onv_basis = this->proxy();
-    auto onv = proxy_onv_basis.constructONVFromAddress(0);  // Create the ONV with address 0.
-    for (size_t I = 0; I < dim; I++) {                      // I loops over all the addresses of the ONVs.
-
-        H(I, I) += diagonal(I);
-
-        for (size_t e1 = 0; e1 < N_P; e1++) {            // E1 (electron 1) loops over the number of electrons.
-            const size_t p = onv.occupationIndexOf(e1);  // Retrieve the index of the orbital that the electron occupies.
-
-            // Remove the weight from the initial address I, because we annihilate.
-            size_t address = I - proxy_onv_basis.vertexWeight(p, e1 + 1);
-
-            // The e2 iteration counts the number of encountered electrons for the creation operator.
-            // We only consider greater addresses than the initial one (because of symmetry), hence we only count electron after the annihilated electron (e1).
-            size_t e2 = e1 + 1;
-            size_t q = p + 1;
-
-            // perform a shift  TODO: clarify what shift.
-            proxy_onv_basis.shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2);
-
-            while (q < K) {
-                const size_t J = address + proxy_onv_basis.vertexWeight(q, e2);
-
-                H(I, J) += g(p, q, p, q);
-                H(J, I) += g(p, q, p, q);
-
-                q++;  // Go to the next orbital.
-
-                // Perform a shift;  TODO: clarify what shift.
-                proxy_onv_basis.shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2);
-            }  // Creation.
-        }      // E1 loop (annihilation).
-
-        if (I < dim - 1) {  // Prevent the last permutation from occurring.
-            proxy_onv_basis.transformONVToNextPermutation(onv);
-        }
-    }  // Address (I) loop.
+    this->forEachPairExcitation([&g, &H](const size_t I, const size_t J, const size_t p, const size_t q) {
+        H(I, J) += g(p, q, p, q);
+        H(J, I) += g(p, q, p, q);
+    });
 
     return H;
 }
@@ -320,60 +282,47 @@ VectorX<double> SeniorityZeroONVBasis::evaluateOperatorMatrixVectorProduct(const
         throw std::invalid_argument("DOCI::matrixVectorProduct(const RSQHamiltonian<double>&, const VectorX<double>&, const VectorX<double>&): The number of spatial orbitals for the ONV basis and Hamiltonian are incompatible.");
     }
 
-    // Prepare some variables to be used in the algorithm.
-    const size_t N_P = this->numberOfElectronPairs();
-    const size_t dim = this->dimension();
-
     const auto& g = hamiltonian.twoElectron().parameters();
 
-
-    // Initialize the resulting matrix-vector product from the diagonal contributions.
+    // Initialize the resulting matrix-vector product from the diagonal contributions, and add the (symmetric) contributions of the pair excitations.
     VectorX<double> matvec = this->evaluateOperatorDiagonal(hamiltonian).cwiseProduct(x);
+    this->forEachPairExcitation([&g, &x, &matvec](const size_t I, const size_t J, const size_t p, const size_t q) {
+        matvec(I) += g(p, q, p, q) * x(J);
+        matvec(J) += g(p, q, p, q) * x(I);
+    });
 
-    // Create the first doubly-occupied ONV basis. Since in DOCI, alpha == beta, we can use the proxy ONV basis to treat them as one and multiply all contributions by 2.
-    const auto proxy_onv_basis = this->proxy();
-    auto onv = proxy_onv_basis.constructONVFromAddress(0);  // ONV with address 0.
-    for (size_t I = 0; I < dim; I++) {                      // I loops over all the addresses of the ONV.
-
-        // Using container values of type double reduce the number of times a vector has to be read from/written to.
-        double value = 0;
-        const double x_I = x(I);
-
-        for (size_t e1 = 0; e1 < N_P; e1++) {            // E1 (electron 1) loops over the (number of) electrons.
-            const size_t p = onv.occupationIndexOf(e1);  // Retrieve the index of a given electron.
-
-            // Remove the weight from the initial address I, because we annihilate.
-            size_t address = I - proxy_onv_basis.vertexWeight(p, e1 + 1);
-
-            // The e2 iteration counts the number of encountered electrons for the creation operator.
-            // We only consider greater addresses than the initial one (because of symmetry), hence we only count electron after the annihilated electron (e1).
-            size_t e2 = e1 + 1;
-            size_t q = p + 1;
-
-            // Perform a shift.  TODO: clarify what shift.
-            proxy_onv_basis.shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2);
+    return matvec;
+}
 
-            while (q < K) {
-                const size_t J = address + proxy_onv_basis.vertexWeight(q, e2);
 
-                value += g(p, q, p, q) * x(J);
-                matvec(J) += g(p, q, p, q) * x_I;
+/**
+ *  Calculate the matrix-vector products of (the matrix representation of) a restricted Hamiltonian with a block of coefficient vectors, in one pass over the coupling data.
+ *
+ *  @param hamiltonian      A restricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+ *
+ *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+ */
+MatrixX<double> SeniorityZeroONVBasis::evaluateOperatorBlockMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const MatrixX<double>& X) const {
 
-                q++;  // Go to the next orbital.
+    if (hamiltonian.numberOfOrbitals() != this->numberOfSpatialOrbitals()) {
+        throw std::invalid_argument("SeniorityZeroONVBasis::evaluateOperatorBlockMatrixVectorProduct(const RSQHamiltonian<double>&, const MatrixX<double>&): The number of spatial orbitals for the ONV basis and Hamiltonian are incompatible.");
+    }
 
-                // Perform a shift.  TODO: clarify what shift.
-                proxy_onv_basis.shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2);
-            }  // Creation.
-        }      // E1 loop (annihilation).
+    const auto& g = hamiltonian.twoElectron().parameters();
 
-        if (I < dim - 1) {  // Prevent the last permutation.
-            proxy_onv_basis.transformONVToNextPermutation(onv);
-        }
+    // We work with the transposed coefficient matrix, so that the coefficients of all vectors that belong to the same ONV are stored contiguously. In this way, every coupling that is generated is immediately used for all vectors.
+    const MatrixX<double> X_T = X.transpose();
 
-        matvec(I) += value;
-    }  // Address (I) loop.
+    // Initialize the resulting (transposed) matrix-vector products from the diagonal contributions, and add the (symmetric) contributions of the pair excitations.
+    const auto diagonal = this->evaluateOperatorDiagonal(hamiltonian);
+    MatrixX<double> matvecs_T = X_T * diagonal.asDiagonal();
+    this->forEachPairExcitation([&g, &X_T, &matvecs_T](const size_t I, const size_t J, const size_t p, const size_t q) {
+        matvecs_T.col(I) += g(p, q, p, q) * X_T.col(J);
+        matvecs_T.col(J) += g(p, q, p, q) * X_T.col(I);
+    });
 
-    return matvec;
+    return matvecs_T.transpose();
 }
 
 
@@ -17,6 +17,8 @@
 
 #include "ONVBasis/SpinResolvedONVBasis.hpp"
 
+#include "ONVBasis/SpinResolvedSigmaEngine.hpp"
+
 #include <boost/math/special_functions.hpp>
 #include <boost/numeric/conversion/converter.hpp>
 
@@ -479,12 +481,32 @@ VectorX<double> SpinResolvedONVBasis::evaluateOperatorMatrixVectorProduct(const
  */
 VectorX<double> SpinResolvedONVBasis::evaluateOperatorMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const VectorX<double>& x) const {
 
-    // We can avoid code duplication by delegating this method to the evaluation of an unrestricted Hamiltonian. This entails a small speed decrease, but doesn't change the order of the scaling.
-    const auto h_unrestricted = ScalarUSQOneElectronOperator<double>::FromRestricted(hamiltonian.core());
-    const auto g_unrestricted = ScalarUSQTwoElectronOperator<double>::FromRestricted(hamiltonian.twoElectron());
-    const USQHamiltonian<double> unrestricted_hamiltonian {h_unrestricted, g_unrestricted};
+    if (hamiltonian.numberOfOrbitals() != this->alpha().numberOfOrbitals()) {
+        throw std::invalid_argument("SpinResolvedONVBasis::evaluateOperatorMatrixVectorProduct(const RSQHamiltonian<double>&, const VectorX<double>&): The number of orbitals of the spin-resolved ONV basis and the Hamiltonian are incompatible.");
+    }
+
+    // The sigma engine has a dedicated restricted preparation, which avoids converting the Hamiltonian into an unrestricted one and shares the spin-unresolved sparse Hamiltonian between alpha and beta if possible.
+    const SpinResolvedSigmaEngine sigma_engine {*this, hamiltonian};
+    return sigma_engine.evaluateMatrixVectorProduct(x);
+}
+
+
+/**
+ *  Calculate the matrix-vector products of (the matrix representation of) a restricted Hamiltonian with a block of coefficient vectors, in one pass over the coupling data.
+ *
+ *  @param hamiltonian      A restricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+ *
+ *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+ */
+MatrixX<double> SpinResolvedONVBasis::evaluateOperatorBlockMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const MatrixX<double>& X) const {
+
+    if (hamiltonian.numberOfOrbitals() != this->alpha().numberOfOrbitals()) {
+        throw std::invalid_argument("SpinResolvedONVBasis::evaluateOperatorBlockMatrixVectorProduct(const RSQHamiltonian<double>&, const MatrixX<double>&): The number of orbitals of the spin-resolved ONV basis and the Hamiltonian are incompatible.");
+    }
 
-    return this->evaluateOperatorMatrixVectorProduct(unrestricted_hamiltonian, x);
+    const SpinResolvedSigmaEngine sigma_engine {*this, hamiltonian};
+    return sigma_engine.evaluateBlockMatrixVectorProduct(X);
 }
 
 
@@ -720,56 +742,28 @@ VectorX<double> SpinResolvedONVBasis::evaluateOperatorMatrixVectorProduct(const
         throw std::invalid_argument("SpinResolvedONVBasis::evaluateOperatorDense(const USQHamiltonian<double>&): The number of orbitals of this ONV basis and the given Hamiltonian are incompatible.");
     }
 
-    // Prepare some variables.
-    const auto& alpha_couplings = this->alphaCouplings();
-
-    const auto dim_alpha = static_cast<long>(this->alpha().dimension());  // Casting is required because of Eigen.
-    const auto dim_beta = static_cast<long>(this->beta().dimension());
-
-    // In order to call the semantically correct APIs in the remainder of this method, we'll have to convert the pure alpha and pure beta part of the unrestricted Hamiltonian into a generalized representation.
-    const auto& h_a = ScalarGSQOneElectronOperator<double>::FromUnrestrictedComponent(hamiltonian.core().alpha());
-    const auto& g_aa = ScalarGSQTwoElectronOperator<double>::FromUnrestrictedComponent(hamiltonian.twoElectron().alphaAlpha());
-    const GSQHamiltonian<double> alpha_hamiltonian {h_a, g_aa};
-
-    const auto& h_b = ScalarGSQOneElectronOperator<double>::FromUnrestrictedComponent(hamiltonian.core().beta());
-    const auto& g_bb = ScalarGSQTwoElectronOperator<double>::FromUnrestrictedComponent(hamiltonian.twoElectron().betaBeta());
-    const GSQHamiltonian<double> beta_hamiltonian {h_b, g_bb};
-
-    auto const& g_mixed = hamiltonian.twoElectron().alphaBeta();
-
-
-    // We can calculate the 'pure spin evaluations', i.e. those only resulting exclusively from the alph and beta part, using re-mapped approach. We first map x as a dense matrix instead of a vector, and prepare a zero-initialized vector for storing the result.
-    Eigen::Map<const Eigen::MatrixXd> x_map {x.data(), dim_beta, dim_alpha};
-    VectorX<double> matvec = VectorX<double>::Zero(this->dimension());
-    Eigen::Map<Eigen::MatrixXd> matvec_map {matvec.data(), dim_beta, dim_alpha};
-
-    // The 'pure spin contributions' can then be written very simply as matrix-matrix multiplications, taking advantage of mapped matvec representation. We use a sparse multiplication in order to reduce memory and speed impact.
-    const auto H_a = this->alpha().evaluateOperatorSparse(alpha_hamiltonian);
-    const auto H_b = this->beta().evaluateOperatorSparse(beta_hamiltonian);
-
-    matvec_map += H_b * x_map + x_map * H_a;
-
-
-    // For the 'mixed spin contributions', i.e. those resulting from the alpha-beta (and beta-alpha) part of the two-electron part of the Hamiltonian, we can use the intermediate variables 'sigma' and 'theta'.
-    for (size_t p = 0; p < this->alpha().numberOfOrbitals(); p++) {
-
-        const auto& P = this->calculateOneElectronPartition(p, p, g_mixed);
-        const auto& beta_two_electron_intermediate = this->beta().evaluateOperatorDense(P);
+    // The evaluation of the matrix-vector product is delegated to a sigma engine, which prepares all operator-dependent intermediates. For repeated evaluations (e.g. in the Davidson algorithm), the engine itself should be used directly.
+    const SpinResolvedSigmaEngine sigma_engine {*this, hamiltonian};
+    return sigma_engine.evaluateMatrixVectorProduct(x);
+}
 
-        // sigma(pp) * X * theta(pp)
-        matvec_map += beta_two_electron_intermediate * (x_map * alpha_couplings[p * (this->alpha().numberOfOrbitals() + this->alpha().numberOfOrbitals() + 1 - p) / 2]);
-        for (size_t q = p + 1; q < this->alpha().numberOfOrbitals(); q++) {
 
-            const auto& P = this->calculateOneElectronPartition(p, q, g_mixed);
-            const auto& beta_two_electron_intermediate = this->beta().evaluateOperatorDense(P);
+/**
+ *  Calculate the matrix-vector products of (the matrix representation of) an unrestricted Hamiltonian with a block of coefficient vectors, in one pass over the coupling data.
+ *
+ *  @param hamiltonian      An unrestricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+ *
+ *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+ */
+MatrixX<double> SpinResolvedONVBasis::evaluateOperatorBlockMatrixVectorProduct(const USQHamiltonian<double>& hamiltonian, const MatrixX<double>& X) const {
 
-            // (sigma(pq) + sigma(qp)) * X * theta(pq)
-            matvec_map += beta_two_electron_intermediate * (x_map * alpha_couplings[p * (this->alpha().numberOfOrbitals() + this->alpha().numberOfOrbitals() + 1 - p) / 2 + q - p]);
-        }
+    if (hamiltonian.numberOfOrbitals() != this->alpha().numberOfOrbitals()) {
+        throw std::invalid_argument("SpinResolvedONVBasis::evaluateOperatorBlockMatrixVectorProduct(const USQHamiltonian<double>&, const MatrixX<double>&): The number of orbitals of the spin-resolved ONV basis and the Hamiltonian are incompatible.");
     }
 
-    // We can safely return the vector representation of the matvec, because we have used Eigen's mapped representation to emplace its elements.
-    return matvec;
+    const SpinResolvedSigmaEngine sigma_engine {*this, hamiltonian};
+    return sigma_engine.evaluateBlockMatrixVectorProduct(X);
 }
 
 
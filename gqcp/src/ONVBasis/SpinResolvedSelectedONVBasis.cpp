@@ -106,6 +106,47 @@ SpinResolvedSelectedONVBasis::SpinResolvedSelectedONVBasis(const SpinResolvedONV
 }
 
 
+/**
+ *  Generate a `SpinResolvedSelectedONVBasis` from the ONVs with the given addresses in a seniority-zero ONV basis.
+ *
+ *  @param onv_basis        The seniority-zero ONV basis.
+ *  @param addresses        The addresses of the ONVs (in the seniority-zero ONV basis) that should be selected, in the order in which they should appear in the selected ONV basis.
+ */
+SpinResolvedSelectedONVBasis::SpinResolvedSelectedONVBasis(const SeniorityZeroONVBasis& onv_basis, const std::vector<size_t>& addresses) :
+    SpinResolvedSelectedONVBasis(onv_basis.numberOfSpatialOrbitals(), onv_basis.numberOfElectronPairs(), onv_basis.numberOfElectronPairs()) {
+
+    // Every seniority-zero ONV is a doubly-occupied ONV, whose alpha and beta parts equal the corresponding ONV in the proxy ONV basis.
+    const auto proxy_onv_basis = onv_basis.proxy();
+
+    this->onvs.reserve(addresses.size());
+    for (const auto& address : addresses) {
+        const auto onv = proxy_onv_basis.constructONVFromAddress(address);
+        this->onvs.emplace_back(onv, onv);
+    }
+}
+
+
+/**
+ *  Generate a `SpinResolvedSelectedONVBasis` from the ONVs with the given addresses in a full spin-resolved ONV basis.
+ *
+ *  @param onv_basis        The full spin-resolved ONV basis.
+ *  @param addresses        The addresses of the ONVs (in the full spin-resolved ONV basis) that should be selected, in the order in which they should appear in the selected ONV basis.
+ */
+SpinResolvedSelectedONVBasis::SpinResolvedSelectedONVBasis(const SpinResolvedONVBasis& onv_basis, const std::vector<size_t>& addresses) :
+    SpinResolvedSelectedONVBasis(onv_basis.alpha().numberOfOrbitals(), onv_basis.alpha().numberOfElectrons(), onv_basis.beta().numberOfElectrons()) {
+
+    // The compound address of a spin-resolved ONV is I_alpha * dim_beta + I_beta.
+    const auto dim_beta = onv_basis.beta().dimension();
+
+    this->onvs.reserve(addresses.size());
+    for (const auto& address : addresses) {
+        const auto alpha = onv_basis.alpha().constructONVFromAddress(address / dim_beta);
+        const auto beta = onv_basis.beta().constructONVFromAddress(address % dim_beta);
+        this->onvs.emplace_back(alpha, beta);
+    }
+}
+
+
 /*
  *  MARK: Modifying
  */
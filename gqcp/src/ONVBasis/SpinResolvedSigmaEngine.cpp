@@ -0,0 +1,421 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "ONVBasis/SpinResolvedSigmaEngine.hpp"
+
+#include "Utilities/threading.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  Prepare the matrix-vector product of an unrestricted Hamiltonian in a full spin-resolved ONV basis.
+ * 
+ *  @param onv_basis            The full spin-resolved ONV basis.
+ *  @param hamiltonian          An unrestricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param number_of_threads    The number of threads that should be used in a matrix-vector product evaluation.
+ */
+SpinResolvedSigmaEngine::SpinResolvedSigmaEngine(const SpinResolvedONVBasis& onv_basis, const USQHamiltonian<double>& hamiltonian, const size_t number_of_threads) :
+    onv_basis {onv_basis},
+    shares_spin_hamiltonian {false},
+    number_of_threads {number_of_threads} {
+
+    if (hamiltonian.numberOfOrbitals() != onv_basis.numberOfOrbitals()) {
+        throw std::invalid_argument("SpinResolvedSigmaEngine(const SpinResolvedONVBasis&, const USQHamiltonian<double>&, const size_t): The number of orbitals of the ONV basis and the given Hamiltonian are incompatible.");
+    }
+
+    if (number_of_threads == 0) {
+        throw std::invalid_argument("SpinResolvedSigmaEngine(const SpinResolvedONVBasis&, const USQHamiltonian<double>&, const size_t): The number of threads should be at least 1.");
+    }
+
+    // In order to call the semantically correct APIs, we'll have to convert the pure alpha and pure beta part of the unrestricted Hamiltonian into a generalized representation.
+    const auto h_a = ScalarGSQOneElectronOperator<double>::FromUnrestrictedComponent(hamiltonian.core().alpha());
+    const auto g_aa = ScalarGSQTwoElectronOperator<double>::FromUnrestrictedComponent(hamiltonian.twoElectron().alphaAlpha());
+    const GSQHamiltonian<double> alpha_hamiltonian {h_a, g_aa};
+
+    const auto h_b = ScalarGSQOneElectronOperator<double>::FromUnrestrictedComponent(hamiltonian.core().beta());
+    const auto g_bb = ScalarGSQTwoElectronOperator<double>::FromUnrestrictedComponent(hamiltonian.twoElectron().betaBeta());
+    const GSQHamiltonian<double> beta_hamiltonian {h_b, g_bb};
+
+    // The 'pure spin' contributions are stored as sparse matrices in their respective spin-unresolved ONV bases.
+    this->H_alpha = onv_basis.alpha().evaluateOperatorSparse(alpha_hamiltonian);
+    this->H_beta = onv_basis.beta().evaluateOperatorSparse(beta_hamiltonian);
+
+
+    // For the 'mixed spin' contributions, we reshape the mixed integrals such that the integrals for every alpha orbital pair form a contiguous column.
+    const auto K = onv_basis.numberOfOrbitals();
+    const auto& g_mixed = hamiltonian.twoElectron().alphaBeta().parameters();
+
+    this->mixed_integrals = MatrixX<double>(K * K, K * K);
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q < K; q++) {
+            for (size_t r = 0; r < K; r++) {
+                for (size_t s = 0; s < K; s++) {
+                    this->mixed_integrals(r * K + s, p * K + q) = g_mixed(p, q, r, s);
+                }
+            }
+        }
+    }
+
+    // The single-excitation string tables are calculated upon their first access, which should happen before they are shared between threads.
+    onv_basis.alpha().singleExcitations();
+    onv_basis.beta().singleExcitations();
+}
+
+
+/**
+ *  Prepare the matrix-vector product of a restricted Hamiltonian in a full spin-resolved ONV basis.
+ * 
+ *  Since the alpha and beta parts of a restricted Hamiltonian are equal, only one spin-unresolved sparse Hamiltonian is calculated if the number of alpha and beta electrons are equal.
+ * 
+ *  @param onv_basis            The full spin-resolved ONV basis.
+ *  @param hamiltonian          A restricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param number_of_threads    The number of threads that should be used in a matrix-vector product evaluation.
+ */
+SpinResolvedSigmaEngine::SpinResolvedSigmaEngine(const SpinResolvedONVBasis& onv_basis, const RSQHamiltonian<double>& hamiltonian, const size_t number_of_threads) :
+    onv_basis {onv_basis},
+    shares_spin_hamiltonian {onv_basis.alpha().numberOfElectrons() == onv_basis.beta().numberOfElectrons()},
+    number_of_threads {number_of_threads} {
+
+    if (hamiltonian.numberOfOrbitals() != onv_basis.numberOfOrbitals()) {
+        throw std::invalid_argument("SpinResolvedSigmaEngine(const SpinResolvedONVBasis&, const RSQHamiltonian<double>&, const size_t): The number of orbitals of the ONV basis and the given Hamiltonian are incompatible.");
+    }
+
+    if (number_of_threads == 0) {
+        throw std::invalid_argument("SpinResolvedSigmaEngine(const SpinResolvedONVBasis&, const RSQHamiltonian<double>&, const size_t): The number of threads should be at least 1.");
+    }
+
+    // The pure alpha and pure beta parts of a restricted Hamiltonian are equal, so we only have to wrap the restricted parameters once into a generalized representation. We avoid the detour through an unrestricted Hamiltonian, which would copy the two-electron integrals for every spin component.
+    const ScalarGSQOneElectronOperator<double> h {hamiltonian.core().parameters()};
+    const ScalarGSQTwoElectronOperator<double> g {hamiltonian.twoElectron().parameters()};
+    const GSQHamiltonian<double> spin_hamiltonian {h, g};
+
+    // If the number of alpha and beta electrons are equal, the alpha and beta ONV bases are equal as well, and the pure beta contributions are represented by the same sparse matrix as the pure alpha contributions.
+    this->H_alpha = onv_basis.alpha().evaluateOperatorSparse(spin_hamiltonian);
+    if (!this->shares_spin_hamiltonian) {
+        this->H_beta = onv_basis.beta().evaluateOperatorSparse(spin_hamiltonian);
+    }
+
+
+    // For the 'mixed spin' contributions, we reshape the integrals such that the integrals for every alpha orbital pair form a contiguous column. For a restricted Hamiltonian, the mixed integrals are the restricted ones.
+    const auto K = onv_basis.numberOfOrbitals();
+    const auto& g_mixed = hamiltonian.twoElectron().parameters();
+
+    this->mixed_integrals = MatrixX<double>(K * K, K * K);
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q < K; q++) {
+            for (size_t r = 0; r < K; r++) {
+                for (size_t s = 0; s < K; s++) {
+                    this->mixed_integrals(r * K + s, p * K + q) = g_mixed(p, q, r, s);
+                }
+            }
+        }
+    }
+
+    // The single-excitation string tables are calculated upon their first access, which should happen before they are shared between threads.
+    onv_basis.alpha().singleExcitations();
+    onv_basis.beta().singleExcitations();
+}
+
+
+/*
+ *  MARK: Matrix-vector product evaluations
+ */
+
+/**
+ *  Calculate the matrix-vector product of (the matrix representation of) the prepared Hamiltonian with the given coefficient vector.
+ *
+ *  @param x                The coefficient vector of a linear expansion.
+ *
+ *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
+ */
+VectorX<double> SpinResolvedSigmaEngine::evaluateMatrixVectorProduct(const VectorX<double>& x) const {
+
+    if (static_cast<size_t>(x.size()) != this->onv_basis.dimension()) {
+        throw std::invalid_argument("SpinResolvedSigmaEngine::evaluateMatrixVectorProduct(const VectorX<double>&): The dimension of the coefficient vector does not match the dimension of the ONV basis.");
+    }
+
+    // Prepare some variables.
+    const auto dim_alpha = static_cast<long>(this->onv_basis.alpha().dimension());  // Casting is required because of Eigen.
+    const auto dim_beta = static_cast<long>(this->onv_basis.beta().dimension());
+
+
+    // We first map x as a dense matrix instead of a vector, and prepare a zero-initialized vector for storing the result.
+    Eigen::Map<const Eigen::MatrixXd> x_map {x.data(), dim_beta, dim_alpha};
+    VectorX<double> matvec = VectorX<double>::Zero(this->onv_basis.dimension());
+    Eigen::Map<Eigen::MatrixXd> matvec_map {matvec.data(), dim_beta, dim_alpha};
+
+
+    // Every column of the mapped result corresponds to one alpha string, and can be calculated independently of the other columns. Therefore, we can partition the result in blocks of consecutive alpha strings, and let every thread fill in its own block.
+    // The calculation of every column doesn't depend on the partitioning, so the result only depends on the number of threads through the reduction order inside the DGEMMs.
+    const auto evaluate_block = [this, &x, &matvec, &x_map, &matvec_map](const long start, const long cols) {
+        auto matvec_block = matvec_map.middleCols(start, cols);
+
+        // The 'pure spin evaluations', i.e. those only resulting exclusively from the alpha and beta part.
+        matvec_block += this->betaHamiltonian() * x_map.middleCols(start, cols);
+        matvec_block += x_map * this->H_alpha.middleCols(start, cols);
+
+        // The 'mixed spin contributions' are calculated through a gather-DGEMM-scatter over the single-excitation string tables.
+        this->addMixedContributions(x.data(), matvec.data(), 1, start, cols);
+    };
+
+    this->evaluateInBlocks(dim_alpha, false, evaluate_block);
+
+    // We can safely return the vector representation of the matvec, because we have used Eigen's mapped representation to emplace its elements.
+    return matvec;
+}
+
+
+/**
+ *  Calculate the matrix-vector products of (the matrix representation of) the prepared Hamiltonian with a block of coefficient vectors.
+ * 
+ *  The pure alpha contributions of all coefficient vectors are calculated in one pass over the sparse pure alpha Hamiltonian, rather than in one pass per vector.
+ *
+ *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+ *
+ *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+ */
+MatrixX<double> SpinResolvedSigmaEngine::evaluateBlockMatrixVectorProduct(const MatrixX<double>& X) const {
+
+    if (static_cast<size_t>(X.rows()) != this->onv_basis.dimension()) {
+        throw std::invalid_argument("SpinResolvedSigmaEngine::evaluateBlockMatrixVectorProduct(const MatrixX<double>&): The dimension of the coefficient vectors does not match the dimension of the ONV basis.");
+    }
+
+    // Prepare some variables.
+    const auto dim_alpha = static_cast<long>(this->onv_basis.alpha().dimension());  // Casting is required because of Eigen.
+    const auto dim_beta = static_cast<long>(this->onv_basis.beta().dimension());
+    const auto number_of_vectors = X.cols();
+
+
+    // Every coefficient vector is mapped onto a dense (dim_beta x dim_alpha) matrix. In order to multiply all of them with a sparse matrix from the right in one pass over that sparse matrix, we stack them on top of each other.
+    MatrixX<double> X_stacked {number_of_vectors * dim_beta, dim_alpha};
+    for (long k = 0; k < number_of_vectors; k++) {
+        X_stacked.middleRows(k * dim_beta, dim_beta) = Eigen::Map<const Eigen::MatrixXd>(X.col(k).data(), dim_beta, dim_alpha);
+    }
+
+    MatrixX<double> matvecs = MatrixX<double>::Zero(X.rows(), number_of_vectors);
+
+
+    // As in the single matrix-vector product, every block of alpha strings can be calculated independently.
+    const auto evaluate_block = [this, &X, &X_stacked, &matvecs, dim_alpha, dim_beta, number_of_vectors](const long start, const long cols) {
+
+        // The 'pure alpha evaluations' act from the right, so they can be calculated for all coefficient matrices at once, in one pass over the sparse pure alpha Hamiltonian.
+        const MatrixX<double> alpha_contributions = X_stacked * this->H_alpha.middleCols(start, cols);
+
+        for (long k = 0; k < number_of_vectors; k++) {
+            Eigen::Map<const Eigen::MatrixXd> x_map {X.col(k).data(), dim_beta, dim_alpha};
+            Eigen::Map<Eigen::MatrixXd> matvec_map {matvecs.col(k).data(), dim_beta, dim_alpha};
+            auto matvec_block = matvec_map.middleCols(start, cols);
+
+            // The 'pure beta evaluations' act from the left on every coefficient matrix.
+            matvec_block += alpha_contributions.middleRows(k * dim_beta, dim_beta);
+            matvec_block += this->betaHamiltonian() * x_map.middleCols(start, cols);
+        }
+
+        // The 'mixed spin contributions' of all coefficient vectors are contracted with the integrals in one dense matrix-matrix product per alpha string.
+        this->addMixedContributions(X.data(), matvecs.data(), number_of_vectors, start, cols);
+    };
+
+    this->evaluateInBlocks(dim_alpha, false, evaluate_block);
+
+    return matvecs;
+}
+
+
+/**
+ *  Calculate the matrix-vector product of (the matrix representation of) the prepared Hamiltonian with the coefficient vector of a singlet linear expansion.
+ * 
+ *  The coefficient matrix C(I_beta, I_alpha) of a singlet is symmetric, and so is the coefficient matrix of the resulting matrix-vector product. Therefore, only its upper triangle is calculated, which roughly halves the work.
+ *
+ *  @param x                The coefficient vector of a linear expansion whose coefficient matrix is symmetric, e.g. a singlet.
+ *
+ *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
+ * 
+ *  @note This method can only be used for spin-resolved ONV bases with an equal number of alpha and beta electrons and for Hamiltonians whose pure alpha and pure beta parts are equal, i.e. if `sharesSpinHamiltonian()` returns true.
+ */
+VectorX<double> SpinResolvedSigmaEngine::evaluateSingletMatrixVectorProduct(const VectorX<double>& x) const {
+
+    if (!this->shares_spin_hamiltonian) {
+        throw std::invalid_argument("SpinResolvedSigmaEngine::evaluateSingletMatrixVectorProduct(const VectorX<double>&): The pure alpha and pure beta parts of the prepared Hamiltonian are not represented by the same sparse matrix.");
+    }
+
+    if (static_cast<size_t>(x.size()) != this->onv_basis.dimension()) {
+        throw std::invalid_argument("SpinResolvedSigmaEngine::evaluateSingletMatrixVectorProduct(const VectorX<double>&): The dimension of the coefficient vector does not match the dimension of the ONV basis.");
+    }
+
+    // Prepare some variables.
+    const auto dim = static_cast<long>(this->onv_basis.alpha().dimension());  // Casting is required because of Eigen. The alpha and beta dimensions are equal.
+
+
+    // We first map x as a dense matrix instead of a vector, and prepare a zero-initialized vector for storing the result.
+    Eigen::Map<const Eigen::MatrixXd> x_map {x.data(), dim, dim};
+    VectorX<double> matvec = VectorX<double>::Zero(this->onv_basis.dimension());
+    Eigen::Map<Eigen::MatrixXd> matvec_map {matvec.data(), dim, dim};
+
+
+    // For a block of alpha strings (i.e. a block of columns), we only have to calculate the rows up to and including the last column of the block, as the remaining elements belong to the lower triangle.
+    // Since the sparse matrix H is symmetric, its first rows are the transpose of its first columns, which can be accessed much more efficiently in Eigen's column-major storage.
+    const auto evaluate_block = [this, &x, &matvec, &x_map, &matvec_map](const long start, const long cols) {
+        const auto rows = start + cols;
+        auto matvec_block = matvec_map.block(0, start, rows, cols);
+
+        // The 'pure spin evaluations', i.e. those only resulting exclusively from the alpha and beta part.
+        matvec_block += this->H_alpha.leftCols(rows).transpose() * x_map.middleCols(start, cols);
+        matvec_block += x_map.topRows(rows) * this->H_alpha.middleCols(start, cols);
+
+        // The 'mixed spin contributions' are calculated through a gather-DGEMM-scatter, in which only the beta strings in the upper triangle are scattered to.
+        this->addMixedContributions(x.data(), matvec.data(), 1, start, cols, true);
+    };
+
+    this->evaluateInBlocks(dim, true, evaluate_block);
+
+
+    // The strict lower triangle of the result is the transpose of its strict upper triangle.
+    for (long j = 0; j < dim - 1; j++) {
+        matvec_map.col(j).tail(dim - j - 1) = matvec_map.row(j).tail(dim - j - 1).transpose();
+    }
+
+    // We can safely return the vector representation of the matvec, because we have used Eigen's mapped representation to emplace its elements.
+    return matvec;
+}
+
+
+/**
+ *  Add the 'mixed spin' contributions to the matrix-vector products of a number of coefficient vectors, for a block of alpha strings.
+ * 
+ *  For every alpha string I_alpha, the gather-DGEMM-scatter algorithm of Olsen et al. (1988) and Knowles, Handy (1984) is used:
+ *      1. gather: C'(J_beta, pq) = <I_alpha| E_pq |J_alpha> C(J_beta, J_alpha) for all alpha excitations of I_alpha,
+ *      2. DGEMM: D(rs, J_beta) = sum_pq g(ab)_{pqrs} C'(J_beta, pq),
+ *      3. scatter: sigma(I_beta, I_alpha) += <I_beta| E_rs |J_beta> D(rs, J_beta) for all beta excitations of I_beta,
+ *  in which the single excitations are read from the precomputed single-excitation string tables. The contraction with the integrals is a single dense matrix-matrix product per alpha string, for all coefficient vectors at once.
+ * 
+ *  @param x                    The coefficient vectors, stored contiguously one after the other.
+ *  @param matvec               The matrix-vector products to which the contributions are added, stored contiguously one after the other.
+ *  @param number_of_vectors    The number of coefficient vectors.
+ *  @param start                The first alpha string of the block.
+ *  @param cols                 The number of alpha strings in the block.
+ *  @param upper_triangle       If only the contributions for beta strings I_beta <= I_alpha should be calculated.
+ */
+void SpinResolvedSigmaEngine::addMixedContributions(const double* x, double* matvec, const long number_of_vectors, const long start, const long cols, const bool upper_triangle) const {
+
+    // Prepare some variables.
+    const auto& alpha_excitations = this->onv_basis.alpha().singleExcitations();
+    const auto& beta_excitations = this->onv_basis.beta().singleExcitations();
+
+    const auto K = static_cast<long>(this->onv_basis.numberOfOrbitals());
+    const auto dim_alpha = static_cast<long>(this->onv_basis.alpha().dimension());
+    const auto dim_beta = static_cast<long>(this->onv_basis.beta().dimension());
+    const auto dim = dim_alpha * dim_beta;
+    const auto number_of_excitations = static_cast<long>(alpha_excitations.entriesPerString());
+
+
+    // The intermediates are allocated once for the whole block of alpha strings. The gathered coefficients of all vectors are stacked on top of each other, so that one matrix-matrix product handles all vectors.
+    MatrixX<double> C_gathered {number_of_vectors * dim_beta, number_of_excitations};
+    MatrixX<double> g_gathered {K * K, number_of_excitations};
+    MatrixX<double> D {K * K, number_of_vectors * dim_beta};
+
+    for (long I_alpha = start; I_alpha < start + cols; I_alpha++) {
+
+        // Gather the coefficients that are connected to I_alpha, together with the integrals of the corresponding alpha excitations. Since E_pq |I_alpha> = sign |J_alpha>, we have <I_alpha| E_qp |J_alpha> = sign.
+        long e = 0;
+        for (auto excitation = alpha_excitations.begin(I_alpha); excitation != alpha_excitations.end(I_alpha); excitation++, e++) {
+            g_gathered.col(e) = this->mixed_integrals.col(excitation->q * K + excitation->p);
+
+            for (long k = 0; k < number_of_vectors; k++) {
+                const Eigen::Map<const Eigen::VectorXd> x_column {x + k * dim + excitation->address * dim_beta, dim_beta};
+                C_gathered.col(e).segment(k * dim_beta, dim_beta) = excitation->sign * x_column;
+            }
+        }
+
+        // Contract with the integrals in one dense matrix-matrix product, which is dispatched to (MKL's) DGEMM.
+        D.noalias() = g_gathered * C_gathered.transpose();
+
+        // Scatter the intermediates to the beta strings. Since E_pq |I_beta> = sign |J_beta>, we have <I_beta| E_qp |J_beta> = sign.
+        const auto rows = upper_triangle ? I_alpha + 1 : dim_beta;
+        for (long k = 0; k < number_of_vectors; k++) {
+            const double* D_k = D.data() + k * dim_beta * K * K;
+            double* matvec_column = matvec + k * dim + I_alpha * dim_beta;
+
+            for (long I_beta = 0; I_beta < rows; I_beta++) {
+                double value = 0.0;
+                for (auto excitation = beta_excitations.begin(I_beta); excitation != beta_excitations.end(I_beta); excitation++) {
+                    value += excitation->sign * D_k[excitation->address * K * K + excitation->q * K + excitation->p];
+                }
+                matvec_column[I_beta] += value;
+            }
+        }
+    }
+}
+
+
+/*
+ *  MARK: Parallelization
+ */
+
+/**
+ *  Partition the columns (i.e. the alpha strings) of a mapped matrix-vector product into consecutive blocks, and evaluate every block on its own thread.
+ * 
+ *  @param dim_alpha            The number of columns, i.e. the dimension of the alpha ONV basis.
+ *  @param triangular           If the work for a block scales with the index of its last column (i.e. only the upper triangle is calculated), rather than with its number of columns.
+ *  @param evaluate_block       A function that evaluates the contributions for a block, given its first column and its number of columns.
+ */
+void SpinResolvedSigmaEngine::evaluateInBlocks(const long dim_alpha, const bool triangular, const std::function<void(const long, const long)>& evaluate_block) const {
+
+    const auto number_of_blocks = std::min(static_cast<long>(this->number_of_threads), dim_alpha);
+    if (number_of_blocks <= 1) {
+        evaluate_block(0, dim_alpha);
+        return;
+    }
+
+    // Determine the block boundaries such that every block represents (approximately) the same amount of work. For a triangular workload, the work up to column c scales as c^2.
+    std::vector<long> boundaries(number_of_blocks + 1);
+    for (long block = 0; block <= number_of_blocks; block++) {
+        const auto fraction = static_cast<double>(block) / number_of_blocks;
+        boundaries[block] = triangular ? std::lround(dim_alpha * std::sqrt(fraction)) : (block * dim_alpha) / number_of_blocks;
+    }
+
+    // Every block already has its own thread, so the (MKL) DGEMMs inside a block should run single-threaded, in order not to oversubscribe the cores.
+    const auto evaluate_block_single_threaded_mkl = [&evaluate_block](const long start, const long cols) {
+        const SingleThreadedMKLScope mkl_scope {};
+        evaluate_block(start, cols);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(number_of_blocks);
+    for (long block = 0; block < number_of_blocks; block++) {
+        const auto cols = boundaries[block + 1] - boundaries[block];
+        if (cols > 0) {
+            threads.emplace_back(evaluate_block_single_threaded_mkl, boundaries[block], cols);
+        }
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+
+}  // namespace GQCP
@@ -20,6 +20,9 @@
 #include <boost/math/special_functions.hpp>
 #include <boost/numeric/conversion/converter.hpp>
 
+#include <algorithm>
+#include <limits>
+
 
 namespace GQCP {
 
@@ -85,6 +88,17 @@ SpinUnresolvedONVBasis::SpinUnresolvedONVBasis(const size_t M, const size_t N) :
     // [ 1 3 3 ]
     // [ 0 4 6 ]
     // [ 0 0 10]
+
+
+    // Copy the vertex weights into a contiguous table, in which every orbital row is padded to a whole number of cache lines. This is the table that is used in the address calculations.
+    this->flat_vertex_weight_stride = SpinUnresolvedONVBasis::paddedVertexWeightStride<size_t>(N + 1);
+    this->flat_vertex_weights = SpinUnresolvedONVBasis::flattenVertexWeights<size_t>(this->vertex_weights, this->flat_vertex_weight_stride);
+
+    // If every address fits in 32 bits, also set up a compact copy of the vertex weights. The largest vertex weight is the dimension of the ONV basis.
+    this->compact_vertex_weight_stride = SpinUnresolvedONVBasis::paddedVertexWeightStride<std::uint32_t>(N + 1);
+    if (this->vertex_weights[M][N] <= std::numeric_limits<std::uint32_t>::max()) {
+        this->compact_vertex_weights = SpinUnresolvedONVBasis::flattenVertexWeights<std::uint32_t>(this->vertex_weights, this->compact_vertex_weight_stride);
+    }
 }
 
 
@@ -130,29 +144,6 @@ size_t SpinUnresolvedONVBasis::arcWeight(const size_t p, const size_t n) const {
 }
 
 
-/**
- *  Calculate the address (i.e. the ordering number) of an unsigned representation of a spin-unresolved ONV.
- * 
- *  @param representation      The unsigned representation of a spin-unresolved ONV.
- *
- *  @return The address corresponding to the unsigned representation of a spin-unresolved ONV.
- */
-size_t SpinUnresolvedONVBasis::addressOf(const size_t representation) const {
-
-    // An implementation of the formula in Helgaker, starting the addressing count from zero
-    size_t copy = representation;
-    size_t address = 0;
-    size_t electron_count = 0;            // counts the number of electrons in the spin string up to orbital p
-    while (copy != 0) {                   // we will remove the least significant bit each loop, we are finished when no bits are left
-        size_t p = __builtin_ctzl(copy);  // p is the orbital index counter (starting from 1)
-        electron_count++;                 // each bit is an electron hence we add it up to the electron count
-        address += this->vertexWeight(p, electron_count);
-        copy ^= copy & -copy;  // flip the least significant bit
-    }
-    return address;
-}
-
-
 /**
  *  Calculate the next allowed unsigned representation of a spin-unresolved ONV in this ONV basis.
  * 
@@ -362,32 +353,83 @@ std::vector<Eigen::SparseMatrix<double>> SpinUnresolvedONVBasis::calculateOneEle
         }
     }
 
+    // Every single excitation E_pq |I> = sign |J> contributes the element (I, J) to sigma(pq) + sigma(qp). Since the table contains the excitations of every string, both (I, J) and (J, I) are encountered.
+    const auto& single_excitations = this->singleExcitations();
+    for (size_t I = 0; I < dim; I++) {
+        for (auto excitation = single_excitations.begin(I); excitation != single_excitations.end(I); excitation++) {
+            const size_t p = std::min(excitation->p, excitation->q);
+            const size_t q = std::max(excitation->p, excitation->q);
+
+            sparse_entries[p * (K + K + 1 - p) / 2 + q - p].emplace_back(I, excitation->address, excitation->sign);
+        }
+    }
+
+    for (size_t k = 0; k < K * (K + 1) / 2; k++) {
+        sparse_matrices[k].setFromTriplets(sparse_entries[k].begin(), sparse_entries[k].end());
+    }
+
+    return sparse_matrices;
+}
+
+
+/**
+ *  Access the single-excitation string table of this ONV basis, i.e. all single excitations E_pq |I> = sign |J> for all strings I, packed in one contiguous array. The table is calculated upon the first call, and reused afterwards.
+ *
+ *  @return The single-excitation string table of this ONV basis.
+ * 
+ *  @note The first call to this method is not thread-safe: it should happen before this ONV basis is shared between threads.
+ */
+const SingleExcitationList& SpinUnresolvedONVBasis::singleExcitations() const {
+
+    if (this->single_excitation_list) {
+        return *this->single_excitation_list;
+    }
+
+    const auto M = this->numberOfOrbitals();
+    const auto N = this->numberOfElectrons();
+    const auto dim = this->dimension();
+
+    if (dim > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::overflow_error("SpinUnresolvedONVBasis::singleExcitations(): The addresses of this ONV basis do not fit in the 32 bits of a single excitation.");
+    }
+
+
+    // Every string has N occupied orbitals that can be annihilated, and for each of them, (M - N) unoccupied orbitals and the annihilated orbital itself in which an electron can be created.
+    const size_t entries_per_string = N * (M - N + 1);
+    std::vector<SingleExcitation> entries(dim * entries_per_string);
+    std::vector<size_t> number_of_entries(dim, 0);  // the number of entries that have already been found for every string
+
+    const auto add_entry = [&entries, &number_of_entries, entries_per_string](const size_t I, const size_t J, const size_t p, const size_t q, const int sign) {
+        entries[I * entries_per_string + number_of_entries[I]] = SingleExcitation {static_cast<std::uint32_t>(J), static_cast<std::uint8_t>(p), static_cast<std::uint8_t>(q), static_cast<std::int8_t>(sign)};
+        number_of_entries[I]++;
+    };
+
+
+    // We only walk the addressing graph in the direction of larger orbital indices for the created electron. Every excitation E_pq |I> = sign |J> with p > q that is found in this way also gives the excitation E_qp |J> = sign |I>.
     SpinUnresolvedONV onv = this->constructONVFromAddress(0);  // onv with address 0
     for (size_t I = 0; I < dim; I++) {                         // I loops over all the addresses of the onv
         for (size_t e1 = 0; e1 < N; e1++) {                    // e1 (electron 1) loops over the (number of) electrons
-            size_t p = onv.occupationIndexOf(e1);              // retrieve the index of a given electron
-            // remove the weight from the initial address I, because we annihilate
-            size_t address = I - this->vertexWeight(p, e1 + 1);
-            // The e2 iteration counts the number of encountered electrons for the creation operator
-            // We only consider greater addresses than the initial one (because of symmetry)
-            // Hence we only count electron after the annihilated electron (e1)
-            sparse_entries[p * (K + K + 1 - p) / 2].emplace_back(I, I, 1);
+            const size_t q = onv.occupationIndexOf(e1);        // the orbital in which the electron is annihilated
+
+            add_entry(I, I, q, q, 1);
+
+            // Remove the weight from the initial address I, because we annihilate.
+            size_t address = I - this->vertexWeight(q, e1 + 1);
             size_t e2 = e1 + 1;
-            size_t q = p + 1;
-            int sign_e2 = 1;
-            // perform a shift
-            this->shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2, sign_e2);
-            while (q < K) {
-                size_t J = address + this->vertexWeight(q, e2);
-
-                sparse_entries[p * (K + K + 1 - p) / 2 + q - p].emplace_back(I, J, sign_e2);
-                sparse_entries[p * (K + K + 1 - p) / 2 + q - p].emplace_back(J, I, sign_e2);
-
-                q++;  // go to the next orbital
-                // perform a shift
-                this->shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2, sign_e2);
-            }  //  (creation)
-        }      // e1 loop (annihilation)
+            size_t p = q + 1;
+            int sign = 1;
+
+            this->shiftUntilNextUnoccupiedOrbital<1>(onv, address, p, e2, sign);
+            while (p < M) {
+                const size_t J = address + this->vertexWeight(p, e2);
+
+                add_entry(I, J, p, q, sign);
+                add_entry(J, I, q, p, sign);
+
+                p++;  // go to the next orbital
+                this->shiftUntilNextUnoccupiedOrbital<1>(onv, address, p, e2, sign);
+            }
+        }
 
         // Prevent last permutation
         if (I < dim - 1) {
@@ -395,11 +437,15 @@ std::vector<Eigen::SparseMatrix<double>> SpinUnresolvedONVBasis::calculateOneEle
         }
     }
 
-    for (size_t k = 0; k < K * (K + 1) / 2; k++) {
-        sparse_matrices[k].setFromTriplets(sparse_entries[k].begin(), sparse_entries[k].end());
+
+    // Sort the excitations of every string by their target address, so that the coefficients of the targets are accessed in order.
+    for (size_t I = 0; I < dim; I++) {
+        const auto first = entries.begin() + I * entries_per_string;
+        std::sort(first, first + entries_per_string, [](const SingleExcitation& lhs, const SingleExcitation& rhs) { return lhs.address < rhs.address; });
     }
 
-    return sparse_matrices;
+    this->single_excitation_list = std::make_shared<const SingleExcitationList>(entries_per_string, std::move(entries));
+    return *this->single_excitation_list;
 }
 
 
@@ -759,11 +805,21 @@ VectorX<double> SpinUnresolvedONVBasis::evaluateOperatorMatrixVectorProduct(cons
         throw std::invalid_argument("SpinUnresolvedONVBasis::evaluateOperatorMatrixVectorProduct(const ScalarGSQOneElectronOperator<double>&, const VectorX<double>&): The number of orbitals of this ONV basis and the operator are incompatible.");
     }
 
-    // Initialize a container for the matrix-vector product, and fill it with the general evaluation function.
-    MatrixRepresentationEvaluationContainer<VectorX<double>> container {x};
-    this->evaluate<VectorX<double>>(f, container);
+    // Every element of the matrix-vector product can be gathered from the single excitations of the corresponding string. As in the other evaluations, the operator is treated as Hermitian, i.e. only its lower triangle is used.
+    const auto& F = f.parameters();
+    const auto& single_excitations = this->singleExcitations();
+    const auto dim = this->dimension();
 
-    return container.evaluation();
+    VectorX<double> matvec = VectorX<double>::Zero(dim);
+    for (size_t I = 0; I < dim; I++) {
+        double value = 0.0;
+        for (auto excitation = single_excitations.begin(I); excitation != single_excitations.end(I); excitation++) {
+            value += excitation->sign * F(std::max(excitation->p, excitation->q), std::min(excitation->p, excitation->q)) * x(excitation->address);
+        }
+        matvec(I) = value;
+    }
+
+    return matvec;
 }
 
 
@@ -22,6 +22,8 @@
 
 #include <chrono>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 
 
 namespace GQCP {
@@ -289,4 +291,58 @@ std::ifstream validateAndOpen(const std::string& filename, const std::string& ex
 }
 
 
+/**
+ *  Parse an FCIDUMP file. Its header is read for the number of orbitals, after which every line 'x i a j b' (in chemist's notation) is handed over to the caller.
+ *
+ *  @param fcidump_filename         the name of the FCIDUMP file
+ *  @param initialize               a callable that is called once as initialize(K), with K the number of orbitals, before any line is read
+ *  @param read                     a callable that is called as read(x, i, a, j, b) for every line after the header, with the (1-based) indices as they appear in the file
+ */
+void parseFCIDUMP(const std::string& fcidump_filename, const std::function<void(const size_t)>& initialize, const std::function<void(const double, const size_t, const size_t, const size_t, const size_t)>& read) {
+
+    std::ifstream input_file_stream = validateAndOpen(fcidump_filename, "FCIDUMP");
+
+
+    //  Get the number of orbitals to check if it's a valid FCIDUMP file
+    std::string start_line;  // first line contains orbitals and electron count
+    std::getline(input_file_stream, start_line);
+    std::stringstream linestream {start_line};
+
+    size_t K = 0;
+    char iter;
+
+    while (linestream >> iter) {
+        if (iter == '=') {
+            linestream >> K;  // right here we have the number of orbitals
+            break;            // we can finish reading the linestream after we found K
+        }
+    }
+
+    if (K == 0) {
+        throw std::invalid_argument("parseFCIDUMP(const std::string&, const std::function<void(const size_t)>&, const std::function<void(const double, const size_t, const size_t, const size_t, const size_t)>&): The .FCIDUMP-file is invalid: could not read a number of orbitals.");
+    }
+
+    initialize(K);
+
+
+    //  Skip 3 lines
+    for (size_t counter = 0; counter < 3; counter++) {
+        std::getline(input_file_stream, start_line);
+    }
+
+
+    //  Hand over every line of integrals
+    double x;
+    size_t i, j, a, b;
+
+    std::string line;
+    while (std::getline(input_file_stream, line)) {
+        std::istringstream iss {line};
+        iss >> x >> i >> a >> j >> b;
+
+        read(x, i, a, j, b);
+    }
+}
+
+
 }  // namespace GQCP
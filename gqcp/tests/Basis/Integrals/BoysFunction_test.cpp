@@ -0,0 +1,85 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "BoysFunction"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/BoysFunction.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+#include <cmath>
+#include <vector>
+
+
+/**
+ *  Calculate the Boys function F_n(T) = int_0^1 t^{2n} exp(-T t^2) dt through a composite Simpson rule, as a reference.
+ */
+double referenceBoysFunction(const size_t n, const double T) {
+
+    const size_t number_of_intervals = 200000;
+    const double h = 1.0 / number_of_intervals;
+
+    double sum = 0.0;
+    for (size_t i = 0; i <= number_of_intervals; i++) {
+        const double t = i * h;
+        const double f = std::pow(t, 2 * n) * std::exp(-T * t * t);
+
+        const double weight = ((i == 0) || (i == number_of_intervals)) ? 1.0 : ((i % 2 == 1) ? 4.0 : 2.0);
+        sum += weight * f;
+    }
+
+    return sum * h / 3;
+}
+
+
+/**
+ *  Check the Boys function for small, intermediate and large arguments (i.e. inside and outside the interpolation grid) against a numerical quadrature.
+ */
+BOOST_AUTO_TEST_CASE(values) {
+
+    const GQCP::BoysFunction F {32};
+
+    for (const double T : {0.0, 1.0e-08, 0.013, 0.5, 1.234, 7.77, 15.0, 29.99, 30.01, 45.0, 120.0}) {
+        for (const size_t n : {0, 1, 2, 5, 10, 20, 32}) {
+            const auto ref_value = referenceBoysFunction(n, T);
+            BOOST_CHECK(std::abs(F(n, T) - ref_value) < 1.0e-12 * ref_value);
+        }
+    }
+
+    // F_n(0) = 1 / (2n + 1) and F_0(T) = sqrt(pi / T) erf(sqrt(T)) / 2.
+    BOOST_CHECK(std::abs(F(4, 0.0) - 1.0 / 9) < 1.0e-14);
+    BOOST_CHECK(std::abs(F(0, 2.5) - 0.5 * std::sqrt(boost::math::constants::pi<double>() / 2.5) * std::erf(std::sqrt(2.5))) < 1.0e-14);
+}
+
+
+/**
+ *  Check if evaluating all orders at once gives the same values as evaluating them separately, and if too high orders are rejected.
+ */
+BOOST_AUTO_TEST_CASE(calculate) {
+
+    const GQCP::BoysFunction F {16};
+
+    std::vector<double> values(17);
+    F.calculate(3.21, 16, values.data());
+    for (size_t n = 0; n <= 16; n++) {
+        BOOST_CHECK(std::abs(values[n] - F(n, 3.21)) < 1.0e-15);
+    }
+
+    BOOST_CHECK_THROW(F(17, 1.0), std::invalid_argument);
+}
@@ -0,0 +1,135 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#define BOOST_TEST_MODULE "DirectJKCalculator"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/DirectJKCalculator.hpp"
+#include "Basis/Integrals/IntegralCalculator.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Molecule/Molecule.hpp"
+#include "Operator/FirstQuantized/Operator.hpp"
+
+
+/**
+ *  Check if the integral-direct J and K matrices are equal to the contractions of the stored two-electron integrals, for a symmetric and a non-symmetric density matrix at the same time.
+ */
+BOOST_AUTO_TEST_CASE(calculate) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+    const auto K = scalar_basis.numberOfBasisFunctions();
+
+    const auto g = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis);
+
+    const GQCP::SquareMatrix<double> D_random = GQCP::SquareMatrix<double>::Random(K);
+    const GQCP::SquareMatrix<double> D_symmetric = D_random + D_random.transpose();
+    const std::vector<GQCP::SquareMatrix<double>> densities {D_symmetric, D_random};
+
+    const GQCP::DirectJKCalculator<double> jk_calculator {scalar_basis, 1.0e-14};
+    const auto JK = jk_calculator.calculate(densities);
+
+    for (size_t d = 0; d < densities.size(); d++) {
+        const GQCP::SquareMatrix<double> J_ref = g.einsum<2>("ijkl,kl->ij", densities[d]).asMatrix();
+        const GQCP::SquareMatrix<double> K_ref = g.einsum<2>("ijkl,kj->il", densities[d]).asMatrix();
+
+        BOOST_CHECK(JK.first[d].isApprox(J_ref, 1.0e-10));
+        BOOST_CHECK(JK.second[d].isApprox(K_ref, 1.0e-10));
+    }
+}
+
+
+/**
+ *  Check if the integral-direct J and K matrices are equal to the contractions of the stored two-electron integrals for complex density matrices, which are contracted without complex conjugation, for a Hermitian and a non-Hermitian density matrix at the same time.
+ */
+BOOST_AUTO_TEST_CASE(calculate_complex) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto K = scalar_basis.numberOfBasisFunctions();
+
+    const auto g_real = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis);
+    const GQCP::Tensor<GQCP::complex, 4> g {g_real.template cast<GQCP::complex>()};
+
+    const GQCP::SquareMatrix<GQCP::complex> D_random = GQCP::SquareMatrix<GQCP::complex>::Random(K);
+    const GQCP::SquareMatrix<GQCP::complex> D_hermitian = D_random + D_random.adjoint();
+    const std::vector<GQCP::SquareMatrix<GQCP::complex>> densities {D_hermitian, D_random};
+
+    const GQCP::DirectJKCalculator<GQCP::complex> jk_calculator {scalar_basis, 1.0e-14};
+    const auto JK = jk_calculator.calculate(densities);
+
+    for (size_t d = 0; d < densities.size(); d++) {
+        const GQCP::SquareMatrix<GQCP::complex> J_ref = g.einsum<2>("ijkl,kl->ij", densities[d]).asMatrix();
+        const GQCP::SquareMatrix<GQCP::complex> K_ref = g.einsum<2>("ijkl,kj->il", densities[d]).asMatrix();
+
+        BOOST_CHECK(JK.first[d].isApprox(J_ref, 1.0e-10));
+        BOOST_CHECK(JK.second[d].isApprox(K_ref, 1.0e-10));
+    }
+}
+
+
+/**
+ *  Check if the density-weighted screening doesn't discard shell quartets for non-symmetric density matrices. A strictly upper triangular density matrix vanishes in every block that a canonical shell quartet (PQ|RS) with P >= Q, R >= S would look at if only one ordering of the shell pairs were considered.
+ */
+BOOST_AUTO_TEST_CASE(calculate_non_symmetric_screening) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto K = scalar_basis.numberOfBasisFunctions();
+
+    const auto g = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis);
+
+    const GQCP::SquareMatrix<double> D_random = GQCP::SquareMatrix<double>::Random(K);
+    GQCP::SquareMatrix<double> D = GQCP::SquareMatrix<double>::Zero(K);
+    D.triangularView<Eigen::StrictlyUpper>() = D_random;
+
+    const GQCP::DirectJKCalculator<double> jk_calculator {scalar_basis, 1.0e-10, 10, 2};
+    const auto JK = jk_calculator.calculate({D});
+
+    const GQCP::SquareMatrix<double> J_ref = g.einsum<2>("ijkl,kl->ij", D).asMatrix();
+    const GQCP::SquareMatrix<double> K_ref = g.einsum<2>("ijkl,kj->il", D).asMatrix();
+
+    BOOST_CHECK(JK.first[0].isApprox(J_ref, 1.0e-08));
+    BOOST_CHECK(JK.second[0].isApprox(K_ref, 1.0e-08));
+}
+
+
+/**
+ *  Check if the incremental J and K matrices, which are built from the change in the density matrix, are equal to the ones that are built from the full density matrix.
+ */
+BOOST_AUTO_TEST_CASE(calculateIncremental) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto K = scalar_basis.numberOfBasisFunctions();
+
+    GQCP::DirectJKCalculator<double> jk_calculator {scalar_basis, 1.0e-14};
+
+    const GQCP::SquareMatrix<double> D1_random = GQCP::SquareMatrix<double>::Random(K);
+    const GQCP::SquareMatrix<double> D1 = D1_random + D1_random.transpose();
+    const GQCP::SquareMatrix<double> D2_random = GQCP::SquareMatrix<double>::Random(K);
+    const GQCP::SquareMatrix<double> D2 = D1 + 0.01 * (D2_random + D2_random.transpose());
+
+    jk_calculator.calculateIncremental({D1});  // the first calculation is a full build
+    const auto JK_incremental = jk_calculator.calculateIncremental({D2});
+    const auto JK_full = jk_calculator.calculate({D2});
+
+    BOOST_CHECK(JK_incremental.first[0].isApprox(JK_full.first[0], 1.0e-10));
+    BOOST_CHECK(JK_incremental.second[0].isApprox(JK_full.second[0], 1.0e-10));
+}
@@ -25,6 +25,35 @@
 #include "Operator/FirstQuantized/Operator.hpp"
 
 
+/*
+ *  MARK: Utilities for the unit tests
+ */
+
+/**
+ *  Create a scalar basis in which all the shells are Cartesian, since the in-house engines only support Cartesian shells starting from d-shells.
+ *
+ *  @param molecule             the molecule containing the nuclei on which the shells should be centered
+ *  @param basisset_name        the name of the basisset
+ *
+ *  @return a scalar basis with the shells of the given basisset, in which every shell is Cartesian
+ */
+GQCP::ScalarBasis<GQCP::GTOShell> cartesianScalarBasis(const GQCP::Molecule& molecule, const std::string& basisset_name) {
+
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, basisset_name};
+
+    std::vector<GQCP::GTOShell> cartesian_shells;
+    for (const auto& shell : scalar_basis.shellSet().asVector()) {
+        cartesian_shells.emplace_back(shell.angularMomentum(), shell.nucleus(), shell.gaussianExponents(), shell.contractionCoefficients(), false, shell.areEmbeddedNormalizationFactorsOfPrimitives(), shell.isNormalized());
+    }
+
+    return GQCP::ScalarBasis<GQCP::GTOShell> {GQCP::ShellSet<GQCP::GTOShell> {cartesian_shells}};
+}
+
+
+/*
+ *  MARK: Unit tests
+ */
+
 /**
  *  Check integrals calculated by Libint with reference values in Szabo.
  */
@@ -116,6 +145,81 @@ BOOST_AUTO_TEST_CASE(HORTON_integrals_h2o_sto3g) {
 }
 
 
+/**
+ *  Check if the two-electron integrals that are calculated through the canonical shell quartets, with and without Cauchy-Schwarz screening, are equal to those that are calculated over all shell quartets.
+ */
+BOOST_AUTO_TEST_CASE(symmetric_two_electron_integrals) {
+
+    // Set up an AO basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+    const auto shell_set = scalar_basis.shellSet();
+
+
+    // Calculate the integrals over all shell quartets as a reference.
+    auto engine = GQCP::IntegralEngine::Libint(GQCP::Operator::Coulomb(), shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+    const auto ref_g = GQCP::IntegralCalculator::calculate(engine, shell_set, shell_set)[0];
+
+
+    // Without screening, every integral should be reproduced.
+    const auto g_unscreened = GQCP::IntegralCalculator::calculateSymmetric(engine, shell_set, 0.0)[0];
+    BOOST_CHECK(g_unscreened.isApprox(ref_g, 1.0e-12));
+
+    // With screening, the neglected integrals should be smaller than the threshold.
+    const auto g_screened = GQCP::IntegralCalculator::calculateSymmetric(engine, shell_set, 1.0e-08)[0];
+    BOOST_CHECK(g_screened.isApprox(ref_g, 1.0e-08));
+
+    // The Cauchy-Schwarz bounds should be symmetric and bound every integral.
+    const auto Q = GQCP::IntegralCalculator::calculateSchwarzBounds(engine, shell_set);
+    BOOST_CHECK(Q.isApprox(Q.transpose(), 1.0e-12));
+    BOOST_CHECK(std::abs(ref_g(0, 0, 0, 0)) <= Q(0, 0) * Q(0, 0) + 1.0e-12);
+}
+
+
+/**
+ *  Check if the packed two-electron integrals contain the same unique integrals as the full tensor.
+ */
+BOOST_AUTO_TEST_CASE(packed_two_electron_integrals) {
+
+    // Set up an AO basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+
+    const auto ref_g = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis);
+    const auto g = GQCP::IntegralCalculator::calculatePackedLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis);
+
+    BOOST_CHECK(g.dimension() == scalar_basis.numberOfBasisFunctions());
+    BOOST_CHECK(g.isApprox(GQCP::PackedRankFourTensor<double>::FromDense(ref_g), 1.0e-12));
+}
+
+
+/**
+ *  Check if the Cholesky vectors reproduce the exact two-electron integrals up to the requested tolerance.
+ */
+BOOST_AUTO_TEST_CASE(Cholesky_two_electron_integrals) {
+
+    // Set up an AO basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+    const auto K = scalar_basis.numberOfBasisFunctions();
+
+    const auto ref_g = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis);
+    const Eigen::Map<const Eigen::MatrixXd> ref_g_matrix {ref_g.data(), static_cast<long>(K * K), static_cast<long>(K * K)};
+
+
+    // The error on every integral is bounded by the largest remaining diagonal element, and a tighter tolerance requires more Cholesky vectors.
+    const double tolerance = 1.0e-06;
+    const auto L = GQCP::IntegralCalculator::calculateLibintCholeskyVectors(GQCP::Operator::Coulomb(), scalar_basis, tolerance);
+    BOOST_CHECK(static_cast<size_t>(L.rows()) == K * K);
+    BOOST_CHECK(static_cast<size_t>(L.cols()) < K * (K + 1) / 2);  // there are only K (K + 1) / 2 unique pairs
+    BOOST_CHECK((L * L.transpose() - ref_g_matrix).cwiseAbs().maxCoeff() < tolerance);
+
+    const auto L_tight = GQCP::IntegralCalculator::calculateLibintCholeskyVectors(GQCP::Operator::Coulomb(), scalar_basis, 1.0e-10);
+    BOOST_CHECK(L_tight.cols() > L.cols());
+    BOOST_CHECK((L_tight * L_tight.transpose() - ref_g_matrix).cwiseAbs().maxCoeff() < 1.0e-10);
+}
+
+
 // The following test has been commented out as this test has been shown to fail on the current Docker infrastructure.
 /**
  *  Check the calculation of some integrals between Libint2 and libcint.
@@ -354,3 +458,89 @@ BOOST_AUTO_TEST_CASE(angular_momentum_integrals) {
         BOOST_CHECK(angular_momentum_integrals[i].isApprox(ref_angular_momentum_integrals[i], 1.0e-07));
     }
 }
+
+
+/**
+ *  Check if our implementation of the nuclear attraction integrals yields the same result as Libint.
+ */
+BOOST_AUTO_TEST_CASE(nuclear_attraction_integrals) {
+
+    // Set up an AO basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+
+
+    // Calculate the nuclear attraction integrals and check if they are equal.
+    const auto ref_V = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::NuclearAttraction(molecule), scalar_basis);
+
+    auto engine = GQCP::IntegralEngine::InHouse(GQCP::Operator::NuclearAttraction(molecule));
+    const auto V = GQCP::IntegralCalculator::calculate(engine, scalar_basis.shellSet(), scalar_basis.shellSet())[0];
+
+    BOOST_CHECK(V.isApprox(ref_V, 1.0e-12));
+}
+
+
+/**
+ *  Check if our implementation of the Coulomb repulsion integrals yields the same result as Libint.
+ */
+BOOST_AUTO_TEST_CASE(coulomb_repulsion_integrals) {
+
+    // Set up an AO basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+    const auto shell_set = scalar_basis.shellSet();
+
+
+    // Calculate the Coulomb repulsion integrals and check if they are equal.
+    auto libint_engine = GQCP::IntegralEngine::Libint(GQCP::Operator::Coulomb(), shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+    const auto ref_g = GQCP::IntegralCalculator::calculate(libint_engine, shell_set, shell_set)[0];
+
+    auto engine = GQCP::IntegralEngine::InHouse(GQCP::Operator::Coulomb(), shell_set.maximumAngularMomentum());
+    const auto g = GQCP::IntegralCalculator::calculate(engine, shell_set, shell_set)[0];
+
+    BOOST_CHECK(g.isApprox(ref_g, 1.0e-12));
+}
+
+
+/**
+ *  Check if our implementation of the nuclear attraction integrals yields the same result as Libint, for a basis with (Cartesian) d-shells.
+ */
+BOOST_AUTO_TEST_CASE(nuclear_attraction_integrals_d_shells) {
+
+    // Set up an AO basis with d-shells on the oxygen atom.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const auto scalar_basis = cartesianScalarBasis(molecule, "cc-pVDZ");
+    BOOST_REQUIRE(scalar_basis.shellSet().maximumAngularMomentum() == 2);
+
+
+    // Calculate the nuclear attraction integrals and check if they are equal.
+    const auto ref_V = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::NuclearAttraction(molecule), scalar_basis);
+
+    auto engine = GQCP::IntegralEngine::InHouse(GQCP::Operator::NuclearAttraction(molecule));
+    const auto V = GQCP::IntegralCalculator::calculate(engine, scalar_basis.shellSet(), scalar_basis.shellSet())[0];
+
+    BOOST_CHECK(V.isApprox(ref_V, 1.0e-12));
+}
+
+
+/**
+ *  Check if our implementation of the Coulomb repulsion integrals yields the same result as Libint, for a basis with (Cartesian) d-shells.
+ */
+BOOST_AUTO_TEST_CASE(coulomb_repulsion_integrals_d_shells) {
+
+    // Set up an AO basis with d-shells on the oxygen atom.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const auto scalar_basis = cartesianScalarBasis(molecule, "cc-pVDZ");
+    const auto shell_set = scalar_basis.shellSet();
+    BOOST_REQUIRE(shell_set.maximumAngularMomentum() == 2);
+
+
+    // Calculate the Coulomb repulsion integrals and check if they are equal.
+    auto libint_engine = GQCP::IntegralEngine::Libint(GQCP::Operator::Coulomb(), shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+    const auto ref_g = GQCP::IntegralCalculator::calculate(libint_engine, shell_set, shell_set)[0];
+
+    auto engine = GQCP::IntegralEngine::InHouse(GQCP::Operator::Coulomb(), shell_set.maximumAngularMomentum());
+    const auto g = GQCP::IntegralCalculator::calculate(engine, shell_set, shell_set)[0];
+
+    BOOST_CHECK(g.isApprox(ref_g, 1.0e-12));
+}
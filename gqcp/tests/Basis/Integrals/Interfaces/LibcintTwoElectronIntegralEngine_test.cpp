@@ -0,0 +1,231 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "LibcintTwoElectronIntegralEngine"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/IntegralCalculator.hpp"
+#include "Basis/Integrals/IntegralEngine.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Molecule/Molecule.hpp"
+#include "Operator/FirstQuantized/Operator.hpp"
+
+#include <memory>
+#include <type_traits>
+
+
+/*
+ *  MARK: Utilities for the unit tests
+ */
+
+using Engine = GQCP::LibcintTwoElectronIntegralEngine<GQCP::GTOShell, 1, double>;
+
+
+/**
+ *  Check if two buffers contain the same integrals.
+ *
+ *  @param buffer1          the first buffer
+ *  @param buffer2          the second buffer
+ *
+ *  @return if the two buffers describe the same shell quartet and contain the same integrals
+ */
+bool areEqual(const GQCP::BaseTwoElectronIntegralBuffer<double, 1>& buffer1, const GQCP::BaseTwoElectronIntegralBuffer<double, 1>& buffer2) {
+
+    if ((buffer1.numberOfBasisFunctionsInShell1() != buffer2.numberOfBasisFunctionsInShell1()) || (buffer1.numberOfBasisFunctionsInShell2() != buffer2.numberOfBasisFunctionsInShell2()) ||
+        (buffer1.numberOfBasisFunctionsInShell3() != buffer2.numberOfBasisFunctionsInShell3()) || (buffer1.numberOfBasisFunctionsInShell4() != buffer2.numberOfBasisFunctionsInShell4())) {
+        return false;
+    }
+
+    for (size_t f1 = 0; f1 < buffer1.numberOfBasisFunctionsInShell1(); f1++) {
+        for (size_t f2 = 0; f2 < buffer1.numberOfBasisFunctionsInShell2(); f2++) {
+            for (size_t f3 = 0; f3 < buffer1.numberOfBasisFunctionsInShell3(); f3++) {
+                for (size_t f4 = 0; f4 < buffer1.numberOfBasisFunctionsInShell4(); f4++) {
+                    if (std::abs(buffer1.value(0, f1, f2, f3, f4) - buffer2.value(0, f1, f2, f3, f4)) > 1.0e-12) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ *  MARK: Unit tests
+ */
+
+/**
+ *  Check if the shell-based calculate(), calculateByIndex() and the index-based calculate() with a caller-owned buffer yield the same integrals, and if the buffers that are returned through the virtual interface are not overwritten by subsequent calls.
+ */
+BOOST_AUTO_TEST_CASE(index_vs_shell) {
+
+    // Set up an AO basis with only s- and p-shells, so that the Cartesian and spherical shells coincide.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+    const auto shell_set = scalar_basis.shellSet();
+    const auto& shells = shell_set.asVector();
+    const auto nsh = shells.size();
+
+    auto engine = GQCP::IntegralEngine::Libcint(GQCP::Operator::Coulomb(), shell_set);
+    Engine::Buffer buffer {engine.maximumBufferSize()};
+
+    for (size_t i = 0; i < nsh; i++) {
+        for (size_t j = 0; j < nsh; j++) {
+            for (size_t k = 0; k < nsh; k++) {
+                for (size_t l = 0; l < nsh; l++) {
+                    const auto by_shell = engine.calculate(shells[i], shells[j], shells[k], shells[l]);
+                    const auto by_index = engine.calculateByIndex(shells, i, j, k, l);
+                    engine.calculate(i, j, k, l, buffer);
+
+                    BOOST_CHECK(by_shell != by_index);
+                    BOOST_CHECK(areEqual(*by_shell, *by_index));
+                    BOOST_CHECK(areEqual(*by_shell, buffer));
+                }
+            }
+        }
+    }
+
+
+    // A buffer that was returned through the virtual interface should keep its integrals after the next call.
+    const auto first = engine.calculateByIndex(shells, 0, 0, 0, 0);
+    const auto first_copy = engine.calculateByIndex(shells, 0, 0, 0, 0);
+    engine.calculateByIndex(shells, nsh - 1, nsh - 1, nsh - 1, nsh - 1);
+    BOOST_CHECK(areEqual(*first, *first_copy));
+
+
+    // Shells that do not belong to the engine's shell set at the given indices should be looked up.
+    const std::vector<GQCP::GTOShell> reversed_shells {shells.rbegin(), shells.rend()};
+    const auto by_reversed_index = engine.calculateByIndex(reversed_shells, nsh - 1, nsh - 1, 0, nsh - 2);
+    const auto reference = engine.calculateByIndex(shells, 0, 0, nsh - 1, 1);
+    BOOST_CHECK(areEqual(*by_reversed_index, *reference));
+
+
+    // A caller-owned buffer that is too small should be rejected.
+    Engine::Buffer small_buffer {0};
+    BOOST_CHECK_THROW(engine.calculate(0, 0, 0, 0, small_buffer), std::invalid_argument);
+}
+
+
+/**
+ *  Check if calculateByIndex() with a buffer allocates one buffer for all shell quartets, and if it doesn't overwrite a buffer that is shared with someone else.
+ */
+BOOST_AUTO_TEST_CASE(reused_buffer) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+    const auto shell_set = scalar_basis.shellSet();
+    const auto& shells = shell_set.asVector();
+    const auto nsh = shells.size();
+
+    auto engine = GQCP::IntegralEngine::Libcint(GQCP::Operator::Coulomb(), shell_set);
+
+    std::shared_ptr<GQCP::BaseTwoElectronIntegralBuffer<double, 1>> buffer;
+    engine.calculateByIndex(shells, 0, 0, 0, 0, buffer);
+    const auto* const allocated = buffer.get();
+
+    for (size_t i = 0; i < nsh; i++) {
+        for (size_t j = 0; j < nsh; j++) {
+            for (size_t k = 0; k < nsh; k++) {
+                for (size_t l = 0; l < nsh; l++) {
+                    engine.calculateByIndex(shells, i, j, k, l, buffer);
+                    const auto reference = engine.calculateByIndex(shells, i, j, k, l);
+
+                    BOOST_CHECK(buffer.get() == allocated);
+                    BOOST_CHECK(areEqual(*buffer, *reference));
+                }
+            }
+        }
+    }
+
+
+    // A buffer that is shared should keep its integrals.
+    engine.calculateByIndex(shells, 0, 0, 0, 0, buffer);
+    const auto shared = buffer;
+    const auto reference = engine.calculateByIndex(shells, 0, 0, 0, 0);
+
+    engine.calculateByIndex(shells, nsh - 1, nsh - 1, nsh - 1, nsh - 1, buffer);
+    BOOST_CHECK(buffer != shared);
+    BOOST_CHECK(areEqual(*shared, *reference));
+}
+
+
+/**
+ *  Check if an engine can be moved but not copied, and if a moved-to engine (which takes over the libcint optimizer struct) still calculates the correct integrals.
+ */
+BOOST_AUTO_TEST_CASE(move_only) {
+
+    static_assert(!std::is_copy_constructible<Engine>::value, "The libcint engine owns its optimizer struct, so it should not be copyable.");
+    static_assert(!std::is_copy_assignable<Engine>::value, "The libcint engine owns its optimizer struct, so it should not be copyable.");
+    static_assert(std::is_move_constructible<Engine>::value, "The libcint engine should be movable.");
+
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+    const auto shell_set = scalar_basis.shellSet();
+    const auto& shells = shell_set.asVector();
+
+    auto engine = GQCP::IntegralEngine::Libcint(GQCP::Operator::Coulomb(), shell_set);
+    const auto reference = engine.calculateByIndex(shells, 2, 1, 3, 0);
+
+    Engine moved_engine {std::move(engine)};
+    const auto buffer = moved_engine.calculateByIndex(shells, 2, 1, 3, 0);
+    BOOST_CHECK(areEqual(*buffer, *reference));
+}
+
+
+/**
+ *  Check if the Coulomb integrals that are calculated by libcint (using its optimizer struct) through the canonical shell quartets are equal to those that are calculated by libint2.
+ */
+BOOST_AUTO_TEST_CASE(libcint_vs_libint2_Coulomb) {
+
+    // Set up an AO basis with only s- and p-shells, so that the Cartesian and spherical shells coincide.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+    const auto shell_set = scalar_basis.shellSet();
+
+    const auto g_libint2 = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis);
+
+    auto engine = GQCP::IntegralEngine::Libcint(GQCP::Operator::Coulomb(), shell_set);
+    const auto g_libcint = GQCP::IntegralCalculator::calculateSymmetric(engine, shell_set)[0];
+
+    BOOST_CHECK(g_libcint.isApprox(g_libint2, 1.0e-08));
+}
+
+
+/**
+ *  Check if the buffers that the libint2 engine returns are owned by the caller, i.e. if they are not overwritten by subsequent calls, as the libcint engine's buffers.
+ */
+BOOST_AUTO_TEST_CASE(libint2_buffer_ownership) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+    const auto shell_set = scalar_basis.shellSet();
+    const auto& shells = shell_set.asVector();
+    const auto nsh = shells.size();
+
+    auto engine = GQCP::IntegralEngine::Libint(GQCP::Operator::Coulomb(), shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+    auto reference_engine = GQCP::IntegralEngine::Libint(GQCP::Operator::Coulomb(), shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+
+    // The reference engine isn't used afterwards, so its results are never overwritten.
+    const auto first = engine.calculate(shells[0], shells[0], shells[0], shells[0]);
+    const auto reference = reference_engine.calculate(shells[0], shells[0], shells[0], shells[0]);
+    engine.calculate(shells[nsh - 1], shells[nsh - 1], shells[nsh - 1], shells[nsh - 1]);
+    BOOST_CHECK(areEqual(*first, *reference));
+}
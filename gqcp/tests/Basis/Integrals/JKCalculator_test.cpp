@@ -0,0 +1,83 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "JKCalculator"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/JKCalculator.hpp"
+
+
+/**
+ *  Check if the single-pass J and K matrices are equal to the einsum contractions of the two-electron integrals, for several non-symmetric density matrices at the same time and for different numbers of threads.
+ */
+BOOST_AUTO_TEST_CASE(calculate) {
+
+    const size_t K = 7;
+
+    GQCP::Tensor<double, 4> g {K, K, K, K};
+    g.setRandom();
+
+    const std::vector<GQCP::SquareMatrix<double>> densities {GQCP::SquareMatrix<double>::Random(K), GQCP::SquareMatrix<double>::Random(K)};
+
+    for (const size_t number_of_threads : {1, 3}) {
+        const auto JK = GQCP::JKCalculator<double>::calculate(g, densities, number_of_threads);
+
+        for (size_t d = 0; d < densities.size(); d++) {
+            // J[D](mu nu) = (mu nu|rho lambda) D(rho lambda) and K[D](mu nu) = (mu lambda|rho nu) D(rho lambda).
+            const GQCP::SquareMatrix<double> J_ref = g.einsum<2>("ijkl,kl->ij", densities[d]).asMatrix();
+            const GQCP::SquareMatrix<double> K_ref = g.einsum<2>("ijkl,kj->il", densities[d]).asMatrix();
+
+            BOOST_CHECK(JK.first[d].isApprox(J_ref, 1.0e-12));
+            BOOST_CHECK(JK.second[d].isApprox(K_ref, 1.0e-12));
+        }
+    }
+}
+
+
+/**
+ *  Check if the single-pass J and K matrices are correct for complex integrals and density matrices.
+ */
+BOOST_AUTO_TEST_CASE(calculate_complex) {
+
+    const size_t K = 4;
+
+    GQCP::Tensor<GQCP::complex, 4> g {K, K, K, K};
+    g.setRandom();
+
+    const GQCP::SquareMatrix<GQCP::complex> D = GQCP::SquareMatrix<GQCP::complex>::Random(K);
+
+    const auto JK = GQCP::JKCalculator<GQCP::complex>::calculate(g, {D}, 2);
+
+    const GQCP::SquareMatrix<GQCP::complex> J_ref = g.einsum<2>("ijkl,kl->ij", D).asMatrix();
+    const GQCP::SquareMatrix<GQCP::complex> K_ref = g.einsum<2>("ijkl,kj->il", D).asMatrix();
+
+    BOOST_CHECK(JK.first[0].isApprox(J_ref, 1.0e-12));
+    BOOST_CHECK(JK.second[0].isApprox(K_ref, 1.0e-12));
+}
+
+
+/**
+ *  Check if the calculation throws when the density matrices are incompatible with the two-electron integrals.
+ */
+BOOST_AUTO_TEST_CASE(calculate_throws) {
+
+    GQCP::Tensor<double, 4> g {3, 3, 3, 3};
+    g.setZero();
+
+    BOOST_CHECK_THROW(GQCP::JKCalculator<double>::calculate(g, {GQCP::SquareMatrix<double>::Zero(4)}), std::invalid_argument);
+}
@@ -0,0 +1,80 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#define BOOST_TEST_MODULE "ParallelIntegralCalculator"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/IntegralCalculator.hpp"
+#include "Basis/Integrals/ParallelIntegralCalculator.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Molecule/Molecule.hpp"
+#include "Operator/FirstQuantized/Operator.hpp"
+
+
+/**
+ *  Check if the one-electron integrals that are calculated by multiple threads are equal to the serially calculated ones.
+ */
+BOOST_AUTO_TEST_CASE(parallel_one_electron_integrals) {
+
+    // Set up an AO basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+
+    const auto ref_T = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Kinetic(), scalar_basis);
+    const auto ref_V = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::NuclearAttraction(molecule), scalar_basis);
+
+
+    // Check the result for a number of threads that is smaller than, and larger than, the number of shells.
+    for (const size_t number_of_threads : {1, 2, 4, 64}) {
+        const auto T = GQCP::ParallelIntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Kinetic(), scalar_basis, number_of_threads);
+        const auto V = GQCP::ParallelIntegralCalculator::calculateLibintIntegrals(GQCP::Operator::NuclearAttraction(molecule), scalar_basis, number_of_threads);
+
+        BOOST_CHECK(T.isApprox(ref_T, 1.0e-12));
+        BOOST_CHECK(V.isApprox(ref_V, 1.0e-12));
+    }
+}
+
+
+/**
+ *  Check if the two-electron integrals that are calculated by multiple threads, both over all shell quartets and over the canonical shell quartets, are equal to the serially calculated ones.
+ */
+BOOST_AUTO_TEST_CASE(parallel_two_electron_integrals) {
+
+    // Set up an AO basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+    const auto shell_set = scalar_basis.shellSet();
+
+    auto engine = GQCP::IntegralEngine::Libint(GQCP::Operator::Coulomb(), shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+    const auto ref_g = GQCP::IntegralCalculator::calculate(engine, shell_set, shell_set)[0];
+
+    const auto create_engine = [&shell_set]() { return GQCP::IntegralEngine::Libint(GQCP::Operator::Coulomb(), shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum()); };
+
+
+    for (const size_t number_of_threads : {1, 2, 4}) {
+        const auto g_full = GQCP::ParallelIntegralCalculator::calculateTwoElectron(create_engine, shell_set, shell_set, number_of_threads)[0];
+        BOOST_CHECK(g_full.isApprox(ref_g, 1.0e-12));
+
+        const auto g_symmetric = GQCP::ParallelIntegralCalculator::calculateSymmetric(create_engine, shell_set, number_of_threads, 0.0)[0];
+        BOOST_CHECK(g_symmetric.isApprox(ref_g, 1.0e-12));
+
+        const auto g = GQCP::ParallelIntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis, number_of_threads);
+        BOOST_CHECK(g.isApprox(ref_g, 1.0e-10));
+    }
+}
@@ -0,0 +1,154 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+#define BOOST_TEST_MODULE "PrimitivePairBatch"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/PrimitiveAngularMomentumIntegralEngine.hpp"
+#include "Basis/Integrals/PrimitiveDipoleIntegralEngine.hpp"
+#include "Basis/Integrals/PrimitiveKineticEnergyIntegralEngine.hpp"
+#include "Basis/Integrals/PrimitiveLinearMomentumIntegralEngine.hpp"
+#include "Basis/Integrals/PrimitiveOverlapIntegralEngine.hpp"
+#include "Basis/Integrals/PrimitivePairBatch.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Molecule/Molecule.hpp"
+#include "Operator/FirstQuantized/Operator.hpp"
+
+
+/*
+ *  MARK: Utilities for the unit tests
+ */
+
+/**
+ *  Check if the contracted integrals that a primitive engine calculates over a batch of primitive pairs are equal to the ones that are calculated as a contraction over the integrals of the individual primitives, for all Cartesian functions of the given shell pair.
+ *
+ *  @param engine           The primitive engine, prepared for the operator component that should be checked.
+ *  @param shell1           The left shell.
+ *  @param shell2           The right shell.
+ *
+ *  @return If all batched integrals are equal to the per-primitive ones.
+ */
+template <typename PrimitiveEngine>
+bool areBatchedIntegralsCorrect(PrimitiveEngine& engine, const GQCP::GTOShell& shell1, const GQCP::GTOShell& shell2) {
+
+    const GQCP::PrimitivePairBatch primitive_pairs {shell1, shell2};
+
+    for (const auto& cartesian_exponents1 : shell1.generateCartesianExponents()) {
+        for (const auto& cartesian_exponents2 : shell2.generateCartesianExponents()) {
+
+            typename PrimitiveEngine::IntegralScalar reference = 0.0;
+            for (size_t c1 = 0; c1 < shell1.contractionSize(); c1++) {
+                const GQCP::CartesianGTO primitive1 {shell1.gaussianExponents()[c1], cartesian_exponents1, shell1.nucleus().position()};
+
+                for (size_t c2 = 0; c2 < shell2.contractionSize(); c2++) {
+                    const GQCP::CartesianGTO primitive2 {shell2.gaussianExponents()[c2], cartesian_exponents2, shell2.nucleus().position()};
+
+                    reference += shell1.contractionCoefficients()[c1] * shell2.contractionCoefficients()[c2] * engine.calculate(primitive1, primitive2);
+                }
+            }
+
+            const auto integral = engine.calculate(primitive_pairs, cartesian_exponents1, cartesian_exponents2);
+            if (std::abs(integral - reference) > 1.0e-10 * std::max(1.0, std::abs(reference))) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ *  @return The shells of H2O in the cc-pVDZ basis, which contains d-shells.
+ */
+std::vector<GQCP::GTOShell> testShells() {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "cc-pVDZ"};
+    return scalar_basis.shellSet().asVector();
+}
+
+
+/*
+ *  MARK: Unit tests
+ */
+
+/**
+ *  Check if the tabulated expansion coefficients vanish outside of their domain, and if requesting coefficients beyond the tabulated exponents throws.
+ */
+BOOST_AUTO_TEST_CASE(expansion_coefficients) {
+
+    const auto shells = testShells();
+    const auto& d_shell = *std::find_if(shells.begin(), shells.end(), [](const GQCP::GTOShell& shell) { return shell.angularMomentum() == 2; });
+
+    const GQCP::PrimitivePairBatch primitive_pairs {d_shell, d_shell};
+    BOOST_CHECK(primitive_pairs.size() == d_shell.contractionSize() * d_shell.contractionSize());
+
+    for (size_t k = 0; k < primitive_pairs.size(); k++) {
+        BOOST_CHECK(primitive_pairs.expansionCoefficients(GQCP::CartesianDirection::x, 1, -1, 0)[k] == 0.0);  // negative exponent, as for j - 2 < 0 in the kinetic energy integrals
+        BOOST_CHECK(primitive_pairs.expansionCoefficients(GQCP::CartesianDirection::y, 2, 1, 4)[k] == 0.0);   // t > i + j
+    }
+
+    BOOST_CHECK_THROW(primitive_pairs.expansionCoefficients(GQCP::CartesianDirection::z, 3, 0, 0), std::invalid_argument);  // i exceeds the left angular momentum
+    BOOST_CHECK_THROW(primitive_pairs.expansionCoefficients(GQCP::CartesianDirection::z, 0, 5, 0), std::invalid_argument);  // j exceeds the right angular momentum + 2
+}
+
+
+/**
+ *  Check the batched overlap and kinetic energy integrals against the per-primitive ones, for all shell pairs of H2O//cc-pVDZ.
+ */
+BOOST_AUTO_TEST_CASE(overlap_and_kinetic_energy) {
+
+    const auto shells = testShells();
+
+    GQCP::PrimitiveOverlapIntegralEngine overlap_engine {};
+    GQCP::PrimitiveKineticEnergyIntegralEngine kinetic_engine {};
+    for (const auto& shell1 : shells) {
+        for (const auto& shell2 : shells) {
+            BOOST_CHECK(areBatchedIntegralsCorrect(overlap_engine, shell1, shell2));
+            BOOST_CHECK(areBatchedIntegralsCorrect(kinetic_engine, shell1, shell2));
+        }
+    }
+}
+
+
+/**
+ *  Check the batched electronic dipole, linear momentum and angular momentum integrals against the per-primitive ones, for every component and all shell pairs of H2O//cc-pVDZ.
+ */
+BOOST_AUTO_TEST_CASE(cartesian_operators) {
+
+    const auto shells = testShells();
+    const GQCP::Vector<double, 3> origin {0.0, 1.0, -0.5};
+
+    GQCP::PrimitiveDipoleIntegralEngine dipole_engine {GQCP::Operator::ElectronicDipole(origin)};
+    GQCP::PrimitiveLinearMomentumIntegralEngine linear_momentum_engine {};
+    GQCP::PrimitiveAngularMomentumIntegralEngine angular_momentum_engine {GQCP::Operator::AngularMomentum(origin)};
+
+    for (size_t component = 0; component < 3; component++) {
+        dipole_engine.prepareStateForComponent(component);
+        linear_momentum_engine.prepareStateForComponent(component);
+        angular_momentum_engine.prepareStateForComponent(component);
+
+        for (const auto& shell1 : shells) {
+            for (const auto& shell2 : shells) {
+                BOOST_CHECK(areBatchedIntegralsCorrect(dipole_engine, shell1, shell2));
+                BOOST_CHECK(areBatchedIntegralsCorrect(linear_momentum_engine, shell1, shell2));
+                BOOST_CHECK(areBatchedIntegralsCorrect(angular_momentum_engine, shell1, shell2));
+            }
+        }
+    }
+}
@@ -81,3 +81,66 @@ BOOST_AUTO_TEST_CASE(basisFunctions_integration) {
     BOOST_CHECK(std::abs(grid.integrate(bf2_squared_evaluated) - S(1, 1)) < 1.0e-04);
     BOOST_CHECK(std::abs(grid.integrate(bf1_bf2_evaluated) - S(0, 1)) < 1.0e-04);
 }
+
+
+/**
+ *  Check if quantizing the Coulomb operator for the occupied-virtual-occupied-virtual orbital ranges only yields the corresponding elements of the fully quantized operator.
+ *
+ *  The test system is H2O//STO-3G.
+ */
+BOOST_AUTO_TEST_CASE(quantize_Coulomb_orbital_space) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spinor_basis {molecule, "STO-3G"};
+    const auto K = spinor_basis.numberOfSpatialOrbitals();
+    spinor_basis.transform(GQCP::RTransformation<double>::RandomUnitary(K));
+
+    const auto occ = GQCP::OccupationType::k_occupied;
+    const auto virt = GQCP::OccupationType::k_virtual;
+    const auto orbital_space = GQCP::OrbitalSpace::Implicit({{occ, 5}, {virt, K - 5}});
+
+
+    // Compare the requested slice with the elements of the full tensor.
+    const auto g_ovov = spinor_basis.quantize(GQCP::CoulombRepulsionOperator(), orbital_space, occ, virt, occ, virt);
+    const auto g = spinor_basis.quantize(GQCP::CoulombRepulsionOperator()).parameters();
+
+    BOOST_CHECK(g_ovov.asTensor().dimension(0) == 5);
+    BOOST_CHECK(g_ovov.asTensor().dimension(1) == K - 5);
+
+    for (const auto& i : orbital_space.indices(occ)) {
+        for (const auto& a : orbital_space.indices(virt)) {
+            for (const auto& j : orbital_space.indices(occ)) {
+                for (const auto& b : orbital_space.indices(virt)) {
+                    BOOST_CHECK(std::abs(g_ovov(i, a, j, b) - g(i, a, j, b)) < 1.0e-12);
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ *  Check if the Coulomb operator can be quantized in a complex restricted spin-orbital basis, and if it then has the same (real) integrals as in the corresponding real spin-orbital basis.
+ *
+ *  The test system is H2O//STO-3G.
+ */
+BOOST_AUTO_TEST_CASE(quantize_Coulomb_complex) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> real_spinor_basis {molecule, "STO-3G"};
+    const GQCP::RSpinOrbitalBasis<GQCP::complex, GQCP::GTOShell> complex_spinor_basis {molecule, "STO-3G"};
+    const auto K = real_spinor_basis.numberOfSpatialOrbitals();
+
+    const auto g_real = real_spinor_basis.quantize(GQCP::CoulombRepulsionOperator()).parameters();
+    const auto g_complex = complex_spinor_basis.quantize(GQCP::CoulombRepulsionOperator()).parameters();
+
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q < K; q++) {
+            for (size_t r = 0; r < K; r++) {
+                for (size_t s = 0; s < K; s++) {
+                    BOOST_CHECK(std::abs(g_complex(p, q, r, s) - g_real(p, q, r, s)) < 1.0e-12);
+                }
+            }
+        }
+    }
+}
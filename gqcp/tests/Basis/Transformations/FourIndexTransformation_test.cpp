@@ -0,0 +1,142 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "FourIndexTransformation"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Transformations/FourIndexTransformation.hpp"
+
+
+namespace {
+
+
+/**
+ *  @return the four-index transformation of the given tensor, calculated through successive einsum contractions
+ */
+template <typename Scalar>
+GQCP::Tensor<Scalar, 4> referenceTransformation(const GQCP::Tensor<Scalar, 4>& g, const GQCP::MatrixX<Scalar>& C1, const GQCP::MatrixX<Scalar>& C2, const GQCP::MatrixX<Scalar>& C3, const GQCP::MatrixX<Scalar>& C4) {
+
+    const GQCP::Tensor<Scalar, 2> C1_conjugate = Eigen::TensorMap<Eigen::Tensor<const Scalar, 2>>(C1.data(), C1.rows(), C1.cols()).conjugate();
+    const GQCP::Tensor<Scalar, 2> C2_tensor = Eigen::TensorMap<Eigen::Tensor<const Scalar, 2>>(C2.data(), C2.rows(), C2.cols());
+    const GQCP::Tensor<Scalar, 2> C3_conjugate = Eigen::TensorMap<Eigen::Tensor<const Scalar, 2>>(C3.data(), C3.rows(), C3.cols()).conjugate();
+    const GQCP::Tensor<Scalar, 2> C4_tensor = Eigen::TensorMap<Eigen::Tensor<const Scalar, 2>>(C4.data(), C4.rows(), C4.cols());
+
+    const auto temp_1 = g.template einsum<1>("TUVW,VR->TURW", C3_conjugate).template einsum<1>("TURW,WS->TURS", C4_tensor);
+    const auto temp_2 = C2_tensor.template einsum<1>("UQ,TURS->TQRS", temp_1);
+    return C1_conjugate.template einsum<1>("TP,TQRS->PQRS", temp_2);
+}
+
+
+}  // namespace
+
+
+/**
+ *  Check if the four-index transformation with rectangular transformation matrices matches the one through successive einsum contractions.
+ */
+BOOST_AUTO_TEST_CASE(transformFourIndices_rectangular) {
+
+    const long K = 5;
+
+    GQCP::Tensor<double, 4> g {K, K, K, K};
+    g.setRandom();
+
+    const GQCP::MatrixX<double> C1 = GQCP::MatrixX<double>::Random(K, 2);
+    const GQCP::MatrixX<double> C2 = GQCP::MatrixX<double>::Random(K, 3);
+    const GQCP::MatrixX<double> C3 = GQCP::MatrixX<double>::Random(K, 4);
+    const GQCP::MatrixX<double> C4 = GQCP::MatrixX<double>::Random(K, 1);
+
+    const auto g_transformed = GQCP::transformFourIndices(g, C1, C2, C3, C4);
+    const auto g_transformed_ref = referenceTransformation(g, C1, C2, C3, C4);
+
+    BOOST_CHECK(g_transformed.dimension(0) == 2);
+    BOOST_CHECK(g_transformed.dimension(3) == 1);
+    BOOST_CHECK(g_transformed.isApprox(g_transformed_ref, 1.0e-12));
+
+
+    // Check that the bra and ket transformations compose to the same four-index transformation.
+    const auto g_bra_ket = GQCP::transformKetIndices(GQCP::transformBraIndices(g, C1, C2), C3, C4);
+    BOOST_CHECK(g_bra_ket.isApprox(g_transformed_ref, 1.0e-12));
+}
+
+
+/**
+ *  Check if the four-index transformation that uses the (r s)-symmetry of a ket-symmetric tensor gives the same result as the one through successive einsum contractions.
+ */
+BOOST_AUTO_TEST_CASE(transformFourIndices_ket_symmetric) {
+
+    const long K = 6;
+
+    // Set up a tensor that is symmetric in its last two indices.
+    GQCP::Tensor<double, 4> A {K, K, K, K};
+    A.setRandom();
+
+    const Eigen::array<int, 4> shuffle {0, 1, 3, 2};
+    const GQCP::Tensor<double, 4> g = A + A.shuffle(shuffle);
+
+    const GQCP::MatrixX<double> C = GQCP::MatrixX<double>::Random(K, 4);
+    const GQCP::MatrixX<double> C1 = GQCP::MatrixX<double>::Random(K, 3);
+
+    const auto g_transformed = GQCP::transformFourIndices(g, C1, C, C, C, true);
+    BOOST_CHECK(g_transformed.isApprox(referenceTransformation(g, C1, C, C, C), 1.0e-12));
+
+
+    // The ket transformation should be able to use the symmetry as well.
+    const auto g_bra_ket = GQCP::transformKetIndices(GQCP::transformBraIndices(g, C1, C), C, C, true);
+    BOOST_CHECK(g_bra_ket.isApprox(referenceTransformation(g, C1, C, C, C), 1.0e-12));
+
+
+    // The ket symmetry of the tensor should be detected.
+    BOOST_CHECK(GQCP::isKetSymmetric(g));
+    BOOST_CHECK(GQCP::isKetSymmetric(g_transformed));
+    BOOST_CHECK(!GQCP::isKetSymmetric(A));
+}
+
+
+/**
+ *  Check if the four-index transformation handles complex transformation matrices correctly.
+ */
+BOOST_AUTO_TEST_CASE(transformFourIndices_complex) {
+
+    const long K = 4;
+
+    GQCP::Tensor<GQCP::complex, 4> g {K, K, K, K};
+    g.setRandom();
+
+    const GQCP::MatrixX<GQCP::complex> C1 = GQCP::MatrixX<GQCP::complex>::Random(K, 3);
+    const GQCP::MatrixX<GQCP::complex> C2 = GQCP::MatrixX<GQCP::complex>::Random(K, 2);
+
+    BOOST_CHECK(GQCP::transformFourIndices(g, C1, C2, C1, C2).isApprox(referenceTransformation(g, C1, C2, C1, C2), 1.0e-12));
+    BOOST_CHECK(GQCP::transformKetIndices(GQCP::transformBraIndices(g, C1, C2), C2, C1).isApprox(referenceTransformation(g, C1, C2, C2, C1), 1.0e-12));
+}
+
+
+/**
+ *  Check if the four-index transformation throws when the transformation matrices are incompatible with the tensor.
+ */
+BOOST_AUTO_TEST_CASE(transformFourIndices_throws) {
+
+    GQCP::Tensor<double, 4> g {3, 3, 3, 3};
+    g.setZero();
+
+    const GQCP::MatrixX<double> C = GQCP::MatrixX<double>::Identity(3, 3);
+    const GQCP::MatrixX<double> C_wrong = GQCP::MatrixX<double>::Identity(4, 4);
+
+    BOOST_CHECK_THROW(GQCP::transformFourIndices(g, C, C, C, C_wrong), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::transformBraIndices(g, C_wrong, C), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::transformKetIndices(g, C, C_wrong), std::invalid_argument);
+}
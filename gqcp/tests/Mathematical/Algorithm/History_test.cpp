@@ -0,0 +1,152 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "History"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Algorithm/History.hpp"
+
+
+/**
+ *  Check if a bounded history only keeps its most recent iterates.
+ */
+BOOST_AUTO_TEST_CASE(bounded) {
+
+    GQCP::History<int> history {3};
+    BOOST_CHECK(history.isBounded());
+    BOOST_CHECK(history.empty());
+
+    for (int i = 0; i < 10; i++) {
+        history.push_back(i);
+        BOOST_CHECK(history.size() <= 3);
+    }
+
+    BOOST_CHECK(history.size() == 3);
+    BOOST_CHECK(history.front() == 7);
+    BOOST_CHECK(history[1] == 8);
+    BOOST_CHECK(history.back() == 9);
+    BOOST_CHECK(*(history.end() - 2) == 8);
+
+
+    // Replacing the most recent iterate shouldn't evict an older one.
+    history.pop_back();
+    history.push_back(-9);
+    BOOST_CHECK(history.size() == 3);
+    BOOST_CHECK(history.front() == 7);
+    BOOST_CHECK(history.back() == -9);
+}
+
+
+/**
+ *  Check if the capacity of a history can be changed.
+ */
+BOOST_AUTO_TEST_CASE(capacity) {
+
+    GQCP::History<int> history {2};
+    for (int i = 0; i < 5; i++) {
+        history.push_back(i);
+    }
+
+    // Enlarging the capacity keeps more iterates from now on.
+    history.ensureCapacity(4);
+    history.ensureCapacity(3);  // This shouldn't shrink the capacity.
+    BOOST_CHECK(history.capacity() == 4);
+    for (int i = 5; i < 10; i++) {
+        history.push_back(i);
+    }
+    BOOST_CHECK(history.size() == 4);
+    BOOST_CHECK(history.front() == 6);
+
+    // Shrinking the capacity evicts the oldest iterates.
+    history.setCapacity(2);
+    BOOST_CHECK(history.size() == 2);
+    BOOST_CHECK(history.front() == 8);
+    BOOST_CHECK(history.back() == 9);
+
+    // An unbounded history keeps every iterate.
+    history.makeUnbounded();
+    BOOST_CHECK(!history.isBounded());
+    for (int i = 10; i < 100; i++) {
+        history.push_back(i);
+    }
+    BOOST_CHECK(history.size() == 92);
+
+    BOOST_CHECK_THROW(GQCP::History<int> zero_history {0}, std::invalid_argument);
+    BOOST_CHECK_THROW(history.setCapacity(0), std::invalid_argument);
+}
+
+
+/**
+ *  Check if a default history is unbounded and can be traversed.
+ */
+BOOST_AUTO_TEST_CASE(unbounded) {
+
+    GQCP::History<double> history {};
+    BOOST_CHECK(!history.isBounded());
+
+    for (size_t i = 0; i < 100; i++) {
+        history.push_back(static_cast<double>(i));
+    }
+    BOOST_CHECK(history.size() == 100);
+
+    double sum = 0.0;
+    for (const auto& iterate : history) {
+        sum += iterate;
+    }
+    BOOST_CHECK(std::abs(sum - 4950.0) < 1.0e-12);
+}
+
+
+/**
+ *  Check if the generation of a history changes whenever an iterate is added or removed, and if it keeps track of the generation before the most recent iterate was added.
+ */
+BOOST_AUTO_TEST_CASE(generations) {
+
+    GQCP::History<int> history {2};
+    GQCP::History<int> other_history {2};
+    BOOST_CHECK(history.generation() != other_history.generation());
+
+    // Adding an iterate (also when the oldest one is evicted) starts a new generation that follows the previous one.
+    for (int i = 0; i < 3; i++) {
+        const auto generation = history.generation();
+        history.push_back(i);
+
+        BOOST_CHECK(history.generation() != generation);
+        BOOST_CHECK(history.previousGeneration() == generation);
+    }
+
+    // Removing iterates doesn't start a generation that follows the previous one.
+    const auto generation = history.generation();
+    history.pop_back();
+    BOOST_CHECK(history.generation() != generation);
+    BOOST_CHECK(history.previousGeneration() == 0);
+
+    history.push_back(3);
+    history.clear();
+    BOOST_CHECK(history.previousGeneration() == 0);
+
+    // Changing the capacity only starts a new generation if iterates are evicted.
+    history.push_back(4);
+    history.push_back(5);
+    const auto full_generation = history.generation();
+    history.setCapacity(3);
+    BOOST_CHECK(history.generation() == full_generation);
+    history.setCapacity(1);
+    BOOST_CHECK(history.generation() != full_generation);
+    BOOST_CHECK(history.previousGeneration() == 0);
+}
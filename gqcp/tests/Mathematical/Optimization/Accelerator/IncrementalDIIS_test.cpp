@@ -0,0 +1,210 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "IncrementalDIIS"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Algorithm/History.hpp"
+#include "Mathematical/Optimization/Accelerator/DIIS.hpp"
+#include "Mathematical/Optimization/Accelerator/IncrementalDIIS.hpp"
+
+#include <vector>
+
+
+/**
+ *  Check if the incremental DIIS accelerator reproduces the regular DIIS accelerator over a number of iterations, also after the oldest error vectors have been evicted from its subspace.
+ */
+BOOST_AUTO_TEST_CASE(incremental_vs_regular) {
+
+    const size_t dim = 20;
+    const size_t maximum_subspace_dimension = 4;
+
+    GQCP::History<GQCP::VectorX<double>> errors {maximum_subspace_dimension};
+    GQCP::History<GQCP::SquareMatrix<double>> subjects {maximum_subspace_dimension};
+
+    const GQCP::DIIS<double> diis {};
+    GQCP::IncrementalDIIS<double> incremental_diis {maximum_subspace_dimension};
+
+    for (size_t iteration = 0; iteration < 10; iteration++) {
+        errors.push_back(GQCP::VectorX<double>::Random(dim));
+        subjects.push_back(GQCP::SquareMatrix<double>::Random(3));
+
+        incremental_diis.update(errors);
+        BOOST_CHECK(incremental_diis.subspaceDimension() == std::min(iteration + 1, maximum_subspace_dimension));
+
+        // Check the overlaps of the error vectors and the DIIS coefficients.
+        const std::vector<GQCP::VectorX<double>> error_vectors {errors.begin(), errors.end()};
+        const std::vector<GQCP::SquareMatrix<double>> subject_matrices {subjects.begin(), subjects.end()};
+
+        const auto n = error_vectors.size();
+        GQCP::MatrixX<double> B_ref {n, n};
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                B_ref(i, j) = error_vectors[i].dot(error_vectors[j]);
+            }
+        }
+        BOOST_CHECK(incremental_diis.errorOverlaps().isApprox(B_ref, 1.0e-12));
+
+        if (n > 1) {
+            const GQCP::VectorX<double> coefficients_ref = diis.calculateDIISCoefficients(error_vectors).col(0).head(n);
+            BOOST_CHECK(incremental_diis.coefficients().isApprox(coefficients_ref, 1.0e-10));
+        }
+
+        // Check the extrapolated subject.
+        GQCP::SquareMatrix<double> extrapolated_subject = GQCP::SquareMatrix<double>::Zero(3);
+        const auto identity = [](const GQCP::SquareMatrix<double>& subject) -> const GQCP::SquareMatrix<double>& { return subject; };
+        incremental_diis.extrapolate(subjects.begin(), subjects.end(), identity, extrapolated_subject.Eigen());
+
+        BOOST_CHECK(extrapolated_subject.isApprox(diis.accelerate(subject_matrices, error_vectors), 1.0e-10));
+    }
+}
+
+
+/**
+ *  Check if only the overlaps of the most recent error vector are calculated in every iteration, also once the subspace is full and the history of error vectors only holds as many error vectors as the maximum subspace dimension.
+ */
+BOOST_AUTO_TEST_CASE(steady_state_overlaps) {
+
+    const size_t dim = 10;
+    const size_t maximum_subspace_dimension = 4;
+
+    GQCP::History<GQCP::VectorX<double>> errors {maximum_subspace_dimension};
+    GQCP::IncrementalDIIS<double> incremental_diis {maximum_subspace_dimension};
+
+    // Count the number of times an error vector is read. When the subspace is recalculated, both error vectors of every overlap are read.
+    size_t number_of_reads = 0;
+    const auto counting_error = [&number_of_reads](const GQCP::VectorX<double>& error) -> const GQCP::VectorX<double>& {
+        number_of_reads++;
+        return error;
+    };
+
+    for (size_t iteration = 0; iteration < 10; iteration++) {
+        errors.push_back(GQCP::VectorX<double>::Random(dim));
+
+        number_of_reads = 0;
+        incremental_diis.update(errors, counting_error);
+
+        const auto n = std::min(iteration + 1, maximum_subspace_dimension);
+        BOOST_CHECK(incremental_diis.subspaceDimension() == n);
+        if (iteration > 0) {
+            BOOST_CHECK_EQUAL(number_of_reads, n);  // The most recent error vector, and the n - 1 previous ones it has an overlap with.
+        }
+    }
+
+
+    // Replacing the most recent error vector doesn't continue the subspace, so all overlaps should be recalculated.
+    errors.pop_back();
+    errors.push_back(GQCP::VectorX<double>::Random(dim));
+
+    number_of_reads = 0;
+    incremental_diis.update(errors, counting_error);
+    BOOST_CHECK_EQUAL(number_of_reads, maximum_subspace_dimension * (maximum_subspace_dimension + 1));
+
+    GQCP::MatrixX<double> B_ref {maximum_subspace_dimension, maximum_subspace_dimension};
+    for (size_t i = 0; i < maximum_subspace_dimension; i++) {
+        for (size_t j = 0; j < maximum_subspace_dimension; j++) {
+            B_ref(i, j) = errors[i].dot(errors[j]);
+        }
+    }
+    BOOST_CHECK(incremental_diis.errorOverlaps().isApprox(B_ref, 1.0e-12));
+}
+
+
+/**
+ *  Check if the most recent subject can be overwritten in place by the extrapolated subject, and if the subjects can be read through a view.
+ */
+BOOST_AUTO_TEST_CASE(in_place) {
+
+    const size_t dim = 10;
+
+    GQCP::History<GQCP::VectorX<double>> errors {};
+    std::vector<GQCP::SquareMatrix<double>> subjects;
+    for (size_t i = 0; i < 5; i++) {
+        errors.push_back(GQCP::VectorX<double>::Random(dim));
+        subjects.push_back(GQCP::SquareMatrix<double>::Random(4));
+    }
+
+    GQCP::IncrementalDIIS<double> incremental_diis {3};
+    incremental_diis.update(errors);
+    BOOST_CHECK(incremental_diis.subspaceDimension() == 3);
+
+    const std::vector<GQCP::VectorX<double>> error_vectors {errors.end() - 3, errors.end()};
+    const std::vector<GQCP::SquareMatrix<double>> subject_matrices {subjects.end() - 3, subjects.end()};
+    const GQCP::SquareMatrix<double> extrapolated_subject_ref = GQCP::DIIS<double>().accelerate(subject_matrices, error_vectors);
+
+    using VectorType = Eigen::Matrix<double, Eigen::Dynamic, 1>;
+    const auto elements = [](const GQCP::SquareMatrix<double>& subject) { return Eigen::Map<const VectorType>(subject.data(), subject.size()); };
+    incremental_diis.extrapolate(subjects.begin(), subjects.end(), elements, Eigen::Map<VectorType>(subjects.back().data(), subjects.back().size()));
+
+    BOOST_CHECK(subjects.back().isApprox(extrapolated_subject_ref, 1.0e-10));
+}
+
+
+/**
+ *  Check if the incremental DIIS accelerator recalculates its subspace when it is updated with error vectors that don't continue from it.
+ */
+BOOST_AUTO_TEST_CASE(resynchronization) {
+
+    const size_t dim = 10;
+
+    GQCP::IncrementalDIIS<double> incremental_diis {3};
+
+    GQCP::History<GQCP::VectorX<double>> errors {3};
+    for (size_t i = 0; i < 5; i++) {
+        errors.push_back(GQCP::VectorX<double>::Random(dim));
+        incremental_diis.update(errors);
+    }
+
+    // Start over with a new sequence of error vectors, e.g. for a new environment.
+    GQCP::History<GQCP::VectorX<double>> new_errors {3};
+    new_errors.push_back(GQCP::VectorX<double>::Random(dim));
+    new_errors.push_back(GQCP::VectorX<double>::Random(dim));
+    incremental_diis.update(new_errors);
+
+    BOOST_CHECK(incremental_diis.subspaceDimension() == 2);
+
+    GQCP::MatrixX<double> B_ref {2, 2};
+    for (size_t i = 0; i < 2; i++) {
+        for (size_t j = 0; j < 2; j++) {
+            B_ref(i, j) = new_errors[i].dot(new_errors[j]);
+        }
+    }
+    BOOST_CHECK(incremental_diis.errorOverlaps().isApprox(B_ref, 1.0e-12));
+
+
+    BOOST_CHECK_THROW(GQCP::IncrementalDIIS<double> zero_diis {0}, std::invalid_argument);
+}
+
+
+/**
+ *  Check if the overlaps of complex error vectors are Hermitian.
+ */
+BOOST_AUTO_TEST_CASE(complex) {
+
+    GQCP::History<GQCP::VectorX<GQCP::complex>> errors {};
+    GQCP::IncrementalDIIS<GQCP::complex> incremental_diis {4};
+
+    for (size_t i = 0; i < 6; i++) {
+        errors.push_back(GQCP::VectorX<GQCP::complex>::Random(8));
+        incremental_diis.update(errors);
+    }
+
+    const auto B = incremental_diis.errorOverlaps();
+    BOOST_CHECK(B.isApprox(B.adjoint(), 1.0e-12));
+    BOOST_CHECK(std::abs(B(0, 3) - errors[2].dot(errors[5])) < 1.0e-12);
+}
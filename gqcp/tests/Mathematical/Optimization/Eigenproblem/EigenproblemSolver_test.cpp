@@ -363,3 +363,212 @@ BOOST_AUTO_TEST_CASE(Davidson_Liu_1000_number_of_requested_eigenpairs) {
         BOOST_CHECK(std::abs(davidson_environment.eigenvectors.col(i).norm() - 1) < 1.0e-12);
     }
 }
+
+
+/**
+ *  Check if the block Davidson algorithm works for Liu's reference test (Liu1978) with large dimensions, for a number of requested eigenpairs different from 1 and when a subspace collapse is forced.
+ */
+BOOST_AUTO_TEST_CASE(BlockDavidson_Liu_1000_number_of_requested_eigenpairs) {
+
+    const size_t number_of_requested_eigenpairs = 3;
+
+    // Build up the example matrix.
+    const size_t N = 1000;
+    GQCP::SquareMatrix<double> A = GQCP::SquareMatrix<double>::Ones(N, N);
+    for (size_t i = 0; i < N; i++) {
+        if (i < 5) {
+            A(i, i) = 1 + 0.1 * i;
+        } else {
+            A(i, i) = 2 * (i + 1) - 1;
+        }
+    }
+
+
+    // Solve the eigenvalue problem with Eigen.
+    const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {A};
+    const GQCP::VectorX<double> ref_lowest_eigenvalues = eigensolver.eigenvalues().head(number_of_requested_eigenpairs);
+    const GQCP::MatrixX<double> ref_lowest_eigenvectors = eigensolver.eigenvectors().topLeftCorner(N, number_of_requested_eigenpairs);
+
+
+    // Solve using our block Davidson diagonalization algorithm, supplying a number of initial guesses. We also keep track of the number of vectors that are supplied to the block matrix-vector product function.
+    const GQCP::MatrixX<double> X_0 = GQCP::MatrixX<double>::Identity(N, N).topLeftCorner(N, number_of_requested_eigenpairs);
+
+    size_t number_of_calls = 0;
+    size_t number_of_products = 0;
+    const auto block_matrix_product_function = [&A, &number_of_calls, &number_of_products](const GQCP::MatrixX<double>& X) {
+        number_of_calls++;
+        number_of_products += X.cols();
+        return GQCP::MatrixX<double>(A * X);
+    };
+
+    auto davidson_environment = GQCP::EigenproblemEnvironment::BlockIterative(block_matrix_product_function, A.diagonal(), X_0);
+    auto davidson_solver = GQCP::EigenproblemSolver::BlockDavidson(3, 10);  // number_of_requested_eigenpairs=3, maximum_subspace_dimension=10
+    davidson_solver.perform(davidson_environment);
+
+
+    for (size_t i = 0; i < number_of_requested_eigenpairs; i++) {
+        BOOST_CHECK(std::abs(davidson_environment.eigenvalues(i) - ref_lowest_eigenvalues(i)) < 1.0e-08);
+
+        const GQCP::VectorX<double> davidson_eigenvector = davidson_environment.eigenvectors.col(i);
+        const GQCP::VectorX<double> ref_eigenvector = ref_lowest_eigenvectors.col(i);
+        BOOST_CHECK(davidson_eigenvector.isEqualEigenvectorAs(ref_eigenvector, 1.0e-08));
+
+        BOOST_CHECK(std::abs(davidson_environment.eigenvectors.col(i).norm() - 1) < 1.0e-12);
+    }
+
+    // Multiple vectors should have been handled in the same call of the block matrix-vector product function.
+    BOOST_CHECK(number_of_products > number_of_calls);
+}
+
+
+/**
+ *  Check if the Davidson algorithm keeps its subspace in preallocated storage when a subspace collapse is forced: the storage for V and VA shouldn't grow beyond the maximum subspace dimension, and the matrix-vector products of the collapsed subspace vectors shouldn't be recalculated.
+ */
+BOOST_AUTO_TEST_CASE(Davidson_Liu_1000_collapse_preallocated_subspace) {
+
+    // Build up the example matrix.
+    const size_t N = 1000;
+    GQCP::SquareMatrix<double> A = GQCP::SquareMatrix<double>::Ones(N, N);
+    for (size_t i = 0; i < N; i++) {
+        if (i < 5) {
+            A(i, i) = 1 + 0.1 * i;
+        } else {
+            A(i, i) = 2 * (i + 1) - 1;
+        }
+    }
+
+
+    // Solve the eigenvalue problem with Eigen.
+    const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {A};
+    const double ref_lowest_eigenvalue = eigensolver.eigenvalues()(0);
+
+
+    // Solve using our Davidson diagonalization algorithm, keeping track of the number of matrix-vector products.
+    const GQCP::VectorX<double> x_0 = GQCP::VectorX<double>::Unit(N, 0);
+
+    size_t number_of_products = 0;
+    const auto matrix_vector_product_function = [&A, &number_of_products](const GQCP::VectorX<double>& x) {
+        number_of_products++;
+        return GQCP::VectorX<double>(A * x);
+    };
+
+    const size_t maximum_subspace_dimension = 4;
+    auto davidson_environment = GQCP::EigenproblemEnvironment::Iterative(matrix_vector_product_function, A.diagonal(), x_0);
+    auto davidson_solver = GQCP::EigenproblemSolver::Davidson(1, maximum_subspace_dimension);
+    davidson_solver.perform(davidson_environment);
+
+    BOOST_CHECK(std::abs(davidson_environment.eigenvalues(0) - ref_lowest_eigenvalue) < 1.0e-08);
+
+
+    // The subspace storage should have been allocated once, and its active part should be orthonormal.
+    BOOST_CHECK(static_cast<size_t>(davidson_environment.V.cols()) == maximum_subspace_dimension);
+    BOOST_CHECK(static_cast<size_t>(davidson_environment.VA.cols()) == maximum_subspace_dimension);
+
+    const GQCP::MatrixX<double> V = davidson_environment.activeV();
+    BOOST_CHECK((V.transpose() * V).isApprox(GQCP::MatrixX<double>::Identity(V.cols(), V.cols()), 1.0e-08));
+
+    // Every iteration adds at most one vector to the subspace, so the matrix-vector products of the collapsed vectors cannot have been recalculated if there is at most one matrix-vector product per iteration.
+    BOOST_CHECK(number_of_products <= davidson_solver.numberOfIterations());
+}
+
+
+/**
+ *  Check if the Davidson algorithm gives the same results when the subspace is stored out-of-core (in memory-mapped files) and a subspace collapse is forced.
+ */
+BOOST_AUTO_TEST_CASE(Davidson_Liu_1000_out_of_core) {
+
+    const size_t number_of_requested_eigenpairs = 3;
+
+    // Build up the example matrix.
+    const size_t N = 1000;
+    GQCP::SquareMatrix<double> A = GQCP::SquareMatrix<double>::Ones(N, N);
+    for (size_t i = 0; i < N; i++) {
+        if (i < 5) {
+            A(i, i) = 1 + 0.1 * i;
+        } else {
+            A(i, i) = 2 * (i + 1) - 1;
+        }
+    }
+
+
+    // Solve the eigenvalue problem with Eigen.
+    const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {A};
+    const GQCP::VectorX<double> ref_lowest_eigenvalues = eigensolver.eigenvalues().head(number_of_requested_eigenpairs);
+    const GQCP::MatrixX<double> ref_lowest_eigenvectors = eigensolver.eigenvectors().topLeftCorner(N, number_of_requested_eigenpairs);
+
+
+    // Solve using our Davidson diagonalization algorithm, storing the subspace in the current directory. We use a small row block size in order to check the streaming over the subspace storage.
+    const GQCP::MatrixX<double> X_0 = GQCP::MatrixX<double>::Identity(N, N).topLeftCorner(N, number_of_requested_eigenpairs);
+
+    auto davidson_environment = GQCP::EigenproblemEnvironment::Iterative(A, X_0);
+    davidson_environment.storeSubspaceOutOfCore(".");
+    davidson_environment.row_block_size = 64;
+
+    auto davidson_solver = GQCP::EigenproblemSolver::Davidson(number_of_requested_eigenpairs, 10);
+    davidson_solver.perform(davidson_environment);
+
+    BOOST_CHECK(davidson_environment.isSubspaceOutOfCore());
+    BOOST_CHECK(davidson_environment.V.size() == 0);  // the in-core storage should have been released
+    for (size_t i = 0; i < number_of_requested_eigenpairs; i++) {
+        BOOST_CHECK(std::abs(davidson_environment.eigenvalues(i) - ref_lowest_eigenvalues(i)) < 1.0e-08);
+
+        const GQCP::VectorX<double> davidson_eigenvector = davidson_environment.eigenvectors.col(i);
+        const GQCP::VectorX<double> ref_eigenvector = ref_lowest_eigenvectors.col(i);
+        BOOST_CHECK(davidson_eigenvector.isEqualEigenvectorAs(ref_eigenvector, 1.0e-08));
+    }
+}
+
+
+/**
+ *  Check if the Davidson algorithm works for Liu's reference test (Liu1978) with large dimensions, for all correction schemes, with and without a dense-block preconditioner and with and without thick restarts.
+ */
+BOOST_AUTO_TEST_CASE(Davidson_Liu_1000_corrections) {
+
+    const size_t number_of_requested_eigenpairs = 3;
+
+    // Build up the example matrix.
+    const size_t N = 1000;
+    GQCP::SquareMatrix<double> A = GQCP::SquareMatrix<double>::Ones(N, N);
+    for (size_t i = 0; i < N; i++) {
+        if (i < 5) {
+            A(i, i) = 1 + 0.1 * i;
+        } else {
+            A(i, i) = 2 * (i + 1) - 1;
+        }
+    }
+
+
+    // Solve the eigenvalue problem with Eigen.
+    const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {A};
+    const GQCP::VectorX<double> ref_lowest_eigenvalues = eigensolver.eigenvalues().head(number_of_requested_eigenpairs);
+    const GQCP::MatrixX<double> ref_lowest_eigenvectors = eigensolver.eigenvectors().topLeftCorner(N, number_of_requested_eigenpairs);
+
+
+    // Solve using the different variants of our Davidson diagonalization algorithm, forcing subspace collapses.
+    const GQCP::MatrixX<double> X_0 = GQCP::MatrixX<double>::Identity(N, N).topLeftCorner(N, number_of_requested_eigenpairs);
+
+    const std::vector<GQCP::DavidsonCorrection> corrections {GQCP::DavidsonCorrection::k_diagonal, GQCP::DavidsonCorrection::k_olsen};
+    const std::vector<size_t> preconditioner_block_dimensions {0, 10};
+    const std::vector<bool> thick_restarts {false, true};
+
+    for (const auto& correction : corrections) {
+        for (const auto& preconditioner_block_dimension : preconditioner_block_dimensions) {
+            for (const auto thick_restart : thick_restarts) {
+                auto davidson_environment = GQCP::EigenproblemEnvironment::Iterative(A, X_0);
+                auto davidson_solver = GQCP::EigenproblemSolver::Davidson(number_of_requested_eigenpairs, 12, 1.0e-08, 1.0e-12, 128, 1.0e-03, correction, preconditioner_block_dimension, thick_restart);
+                davidson_solver.perform(davidson_environment);
+
+                for (size_t i = 0; i < number_of_requested_eigenpairs; i++) {
+                    BOOST_CHECK(std::abs(davidson_environment.eigenvalues(i) - ref_lowest_eigenvalues(i)) < 1.0e-08);
+
+                    const GQCP::VectorX<double> davidson_eigenvector = davidson_environment.eigenvectors.col(i);
+                    const GQCP::VectorX<double> ref_eigenvector = ref_lowest_eigenvectors.col(i);
+                    BOOST_CHECK(davidson_eigenvector.isEqualEigenvectorAs(ref_eigenvector, 1.0e-08));
+                }
+
+                // Since the matrix is stored explicitly, the dense block of the preconditioner should not require any matrix-vector products.
+                BOOST_CHECK(davidson_environment.number_of_matrix_vector_products <= number_of_requested_eigenpairs * davidson_solver.numberOfIterations());
+            }
+        }
+    }
+}
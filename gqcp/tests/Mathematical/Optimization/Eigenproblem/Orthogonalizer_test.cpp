@@ -0,0 +1,136 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "Orthogonalizer"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Optimization/Eigenproblem/Orthogonalizer.hpp"
+
+
+/**
+ *  Check if the symmetric orthogonalizer of a well-conditioned overlap matrix orthonormalizes the basis, and if it reproduces the eigenpairs of the generalized eigenvalue problem.
+ */
+BOOST_AUTO_TEST_CASE(symmetric) {
+
+    const size_t dim = 6;
+
+    // Set up a positive definite overlap matrix and a symmetric matrix.
+    const GQCP::MatrixX<double> A = GQCP::MatrixX<double>::Random(dim, dim);
+    const GQCP::SquareMatrix<double> S = A.transpose() * A + GQCP::MatrixX<double>::Identity(dim, dim);
+    const GQCP::MatrixX<double> B = GQCP::MatrixX<double>::Random(dim, dim);
+    const GQCP::SquareMatrix<double> F = B + B.transpose();
+
+    const GQCP::Orthogonalizer<double> orthogonalizer {S};
+    const auto& X = orthogonalizer.matrix();
+
+    BOOST_CHECK(orthogonalizer.numberOfLinearlyIndependentFunctions() == dim);
+    BOOST_CHECK(orthogonalizer.numberOfDiscardedFunctions() == 0);
+    BOOST_CHECK((X.transpose() * S * X).isApprox(GQCP::MatrixX<double>::Identity(dim, dim), 1.0e-12));
+    BOOST_CHECK(X.isApprox(X.transpose(), 1.0e-12));  // The symmetric orthogonalizer is self-adjoint.
+
+
+    // Check the eigenpairs with the ones of the generalized eigensolver.
+    const auto eigenpairs = orthogonalizer.solve(F);
+    const auto& C = eigenpairs.first;
+    const auto& eigenvalues = eigenpairs.second;
+
+    const Eigen::GeneralizedSelfAdjointEigenSolver<Eigen::MatrixXd> generalized_eigensolver {F, S};
+    BOOST_CHECK(eigenvalues.isApprox(generalized_eigensolver.eigenvalues(), 1.0e-12));
+
+    BOOST_CHECK((C.transpose() * S * C).isApprox(GQCP::MatrixX<double>::Identity(dim, dim), 1.0e-12));
+    BOOST_CHECK((F * C).isApprox(S * C * eigenvalues.asDiagonal(), 1.0e-10));
+}
+
+
+/**
+ *  Check if the canonical orthogonalizer discards the linear dependencies of a singular overlap matrix.
+ */
+BOOST_AUTO_TEST_CASE(canonical) {
+
+    const size_t dim = 5;
+
+    // Set up an overlap matrix of five functions, of which the last one is a linear combination of the first two.
+    GQCP::MatrixX<double> V = GQCP::MatrixX<double>::Random(8, dim);
+    V.col(4) = 0.5 * V.col(0) - 2.0 * V.col(1);
+    const GQCP::SquareMatrix<double> S = V.transpose() * V;
+
+    const GQCP::MatrixX<double> B = GQCP::MatrixX<double>::Random(dim, dim);
+    const GQCP::SquareMatrix<double> F = B + B.transpose();
+
+    const GQCP::Orthogonalizer<double> orthogonalizer {S};
+    const auto& X = orthogonalizer.matrix();
+
+    BOOST_CHECK(orthogonalizer.numberOfLinearlyIndependentFunctions() == 4);
+    BOOST_CHECK(orthogonalizer.numberOfDiscardedFunctions() == 1);
+    BOOST_CHECK(X.cols() == 4);
+    BOOST_CHECK((X.transpose() * S * X).isApprox(GQCP::MatrixX<double>::Identity(4, 4), 1.0e-10));
+
+
+    // The eigenvectors should only span the linearly independent part of the basis.
+    const auto eigenpairs = orthogonalizer.solve(F);
+    const auto& C = eigenpairs.first;
+    const auto& eigenvalues = eigenpairs.second;
+
+    BOOST_CHECK(C.rows() == dim);
+    BOOST_CHECK(C.cols() == 4);
+    BOOST_CHECK(eigenvalues.size() == 4);
+
+    const GQCP::MatrixX<double> E = eigenvalues.asDiagonal();
+    BOOST_CHECK((C.transpose() * S * C).isApprox(GQCP::MatrixX<double>::Identity(4, 4), 1.0e-10));
+    BOOST_CHECK((C.transpose() * F * C).isApprox(E, 1.0e-10));
+
+
+    // The completed coefficient matrix should be square and invertible, and start with the eigenvectors.
+    const auto C_completed = orthogonalizer.completed(C);
+    BOOST_CHECK(C_completed.dimension() == dim);
+    BOOST_CHECK(C_completed.leftCols(4).isApprox(C, 1.0e-12));
+    BOOST_CHECK(Eigen::FullPivLU<Eigen::MatrixXd>(C_completed).rank() == dim);
+    BOOST_CHECK_THROW(orthogonalizer.completed(C.leftCols(3)), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the orthogonalizer reproduces the eigenvalues of the generalized eigenvalue problem for complex Hermitian matrices.
+ */
+BOOST_AUTO_TEST_CASE(complex) {
+
+    const size_t dim = 4;
+
+    const GQCP::MatrixX<GQCP::complex> A = GQCP::MatrixX<GQCP::complex>::Random(dim, dim);
+    const GQCP::SquareMatrix<GQCP::complex> S = A.adjoint() * A + GQCP::MatrixX<GQCP::complex>::Identity(dim, dim);
+    const GQCP::MatrixX<GQCP::complex> B = GQCP::MatrixX<GQCP::complex>::Random(dim, dim);
+    const GQCP::SquareMatrix<GQCP::complex> F = B + B.adjoint();
+
+    const GQCP::Orthogonalizer<GQCP::complex> orthogonalizer {S};
+    const auto& X = orthogonalizer.matrix();
+    BOOST_CHECK((X.adjoint() * S * X).isApprox(GQCP::MatrixX<GQCP::complex>::Identity(dim, dim), 1.0e-12));
+
+    const auto eigenpairs = orthogonalizer.solve(F);
+    const Eigen::GeneralizedSelfAdjointEigenSolver<Eigen::MatrixXcd> generalized_eigensolver {F, S};
+    BOOST_CHECK(eigenpairs.second.isApprox(generalized_eigensolver.eigenvalues(), 1.0e-12));
+}
+
+
+/**
+ *  Check if the orthogonalizer throws when all functions would be discarded.
+ */
+BOOST_AUTO_TEST_CASE(throws) {
+
+    const GQCP::SquareMatrix<double> S = GQCP::SquareMatrix<double>::Zero(3);
+    BOOST_CHECK_THROW(GQCP::Orthogonalizer<double> orthogonalizer {S}, std::invalid_argument);
+}
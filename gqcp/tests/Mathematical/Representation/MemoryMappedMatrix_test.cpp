@@ -0,0 +1,60 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+#define BOOST_TEST_MODULE "MemoryMappedMatrix"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Representation/MemoryMappedMatrix.hpp"
+
+
+/**
+ *  Check if the constructor throws when the scratch directory doesn't exist.
+ */
+BOOST_AUTO_TEST_CASE(constructor) {
+
+    BOOST_CHECK_THROW(GQCP::MemoryMappedMatrix("non_existing_scratch_directory", 10, 2), std::runtime_error);
+    BOOST_CHECK_NO_THROW(GQCP::MemoryMappedMatrix(".", 10, 2));
+}
+
+
+/**
+ *  Check if a memory-mapped matrix is zero-initialized and if it keeps its elements when it is conservatively resized.
+ */
+BOOST_AUTO_TEST_CASE(conservativeResize) {
+
+    const size_t rows = 1000;
+    GQCP::MemoryMappedMatrix M {".", rows, 2};
+
+    BOOST_CHECK(M.matrix().isZero(1.0e-15));
+
+    const Eigen::MatrixXd M_ref = Eigen::MatrixXd::Random(rows, 2);
+    M.matrix() = M_ref;
+
+
+    // Check if the first columns are left untouched when growing the matrix, and that the new columns are zero.
+    M.conservativeResize(5);
+    BOOST_CHECK(M.rows() == rows);
+    BOOST_CHECK(M.cols() == 5);
+    BOOST_CHECK(M.matrix().leftCols(2).isApprox(M_ref, 1.0e-15));
+    BOOST_CHECK(M.matrix().rightCols(3).isZero(1.0e-15));
+
+
+    // Check if the first columns are left untouched when shrinking the matrix.
+    M.conservativeResize(1);
+    BOOST_CHECK(M.cols() == 1);
+    BOOST_CHECK(M.matrix().col(0).isApprox(M_ref.col(0), 1.0e-15));
+}
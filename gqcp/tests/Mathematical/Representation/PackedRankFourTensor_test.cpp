@@ -0,0 +1,113 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "PackedRankFourTensor"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Representation/PackedRankFourTensor.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+
+
+/**
+ *  Check if the compound indices respect the 8-fold permutational symmetry and coincide with the storage order of `forEach`.
+ */
+BOOST_AUTO_TEST_CASE(compound_indices) {
+
+    const size_t dim = 5;
+    const GQCP::PackedRankFourTensor<double> g {dim};
+
+    BOOST_CHECK(g.numberOfElements() == 120);  // 15 pairs, so 15 * 16 / 2 pairs of pairs
+    BOOST_CHECK(g.numberOfElements() == GQCP::PackedRankFourTensor<double>::numberOfUniqueElements(dim));
+
+
+    // Every permutation of the indices should refer to the same element.
+    using Packed = GQCP::PackedRankFourTensor<double>;
+    const auto index = Packed::compoundIndex(3, 1, 4, 2);
+    BOOST_CHECK(Packed::compoundIndex(1, 3, 4, 2) == index);
+    BOOST_CHECK(Packed::compoundIndex(3, 1, 2, 4) == index);
+    BOOST_CHECK(Packed::compoundIndex(1, 3, 2, 4) == index);
+    BOOST_CHECK(Packed::compoundIndex(4, 2, 3, 1) == index);
+    BOOST_CHECK(Packed::compoundIndex(2, 4, 3, 1) == index);
+    BOOST_CHECK(Packed::compoundIndex(4, 2, 1, 3) == index);
+    BOOST_CHECK(Packed::compoundIndex(2, 4, 1, 3) == index);
+
+
+    // The unique elements should be visited in the order in which they are stored.
+    size_t counter = 0;
+    g.forEach([&counter](const size_t i, const size_t j, const size_t k, const size_t l, const double) {
+        BOOST_CHECK(Packed::compoundIndex(i, j, k, l) == counter);
+        counter++;
+    });
+    BOOST_CHECK(counter == g.numberOfElements());
+}
+
+
+/**
+ *  Check if packing and unpacking a tensor with 8-fold permutational symmetry are each other's inverse.
+ */
+BOOST_AUTO_TEST_CASE(FromDense_unpacked) {
+
+    const size_t dim = 6;
+    const auto g_packed = GQCP::PackedRankFourTensor<double>::Random(dim);
+    const auto g_dense = g_packed.unpacked();
+
+    // The unpacked tensor should have all the symmetric copies.
+    BOOST_CHECK(std::abs(g_dense(1, 4, 2, 5) - g_dense(5, 2, 4, 1)) < 1.0e-12);
+    BOOST_CHECK(std::abs(g_dense(1, 4, 2, 5) - g_packed(4, 1, 5, 2)) < 1.0e-12);
+
+    BOOST_CHECK(GQCP::PackedRankFourTensor<double>::FromDense(g_dense).isApprox(g_packed, 1.0e-12));
+
+
+    // A tensor that isn't square can't be packed.
+    const GQCP::Tensor<double, 4> T {2, 1, 2, 2};
+    BOOST_CHECK_THROW(GQCP::PackedRankFourTensor<double>::FromDense(T), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the elements that belong to one pair index are stored contiguously.
+ */
+BOOST_AUTO_TEST_CASE(pairBlock) {
+
+    const auto g = GQCP::PackedRankFourTensor<double>::Random(4);
+
+    using Packed = GQCP::PackedRankFourTensor<double>;
+    const auto ij = Packed::pairIndex(3, 2);
+    const auto* block = g.pairBlock(ij);
+
+    BOOST_CHECK(std::abs(block[0] - g(3, 2, 0, 0)) < 1.0e-12);
+    BOOST_CHECK(std::abs(block[Packed::pairIndex(2, 1)] - g(3, 2, 2, 1)) < 1.0e-12);
+    BOOST_CHECK(std::abs(block[ij] - g(3, 2, 3, 2)) < 1.0e-12);
+}
+
+
+/**
+ *  Check if the FCIDUMP reader for packed two-electron integrals reads the same integrals as the Hamiltonian's FCIDUMP reader.
+ */
+BOOST_AUTO_TEST_CASE(FromFCIDUMP) {
+
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/beh_cation_631g_caitlin.FCIDUMP");
+    const auto& g_ref = hamiltonian.twoElectron().parameters();
+
+    const auto g = GQCP::PackedRankFourTensor<double>::FromFCIDUMP("data/beh_cation_631g_caitlin.FCIDUMP");
+    BOOST_CHECK(g.dimension() == 16);
+    BOOST_CHECK(g.unpacked().isApprox(g_ref, 1.0e-12));
+
+    // The packed integrals should occupy roughly 1/8 of the memory of the full tensor.
+    BOOST_CHECK(g.memoryFootprint() < 16 * 16 * 16 * 16 * sizeof(double) / 7);
+}
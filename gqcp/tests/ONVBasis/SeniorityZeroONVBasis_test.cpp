@@ -51,3 +51,26 @@ BOOST_AUTO_TEST_CASE(evaluateOperatorDiagonal) {
     BOOST_CHECK(sz_onv_basis.evaluateOperatorDiagonal(g).isApprox(selected_onv_basis.evaluateOperatorDiagonal(g), 1.0e-08));
     BOOST_CHECK(sz_onv_basis.evaluateOperatorDiagonal(sq_hamiltonian).isApprox(selected_onv_basis.evaluateOperatorDiagonal(sq_hamiltonian), 1.0e-08));
 }
+
+
+/**
+ *  Check if the block matrix-vector product of a restricted Hamiltonian in a seniority-zero ONV basis matches the column-wise evaluation of the single matrix-vector product.
+ * 
+ *  The test system is H2O in an STO-3G basisset, which has a DOCI dimension of 21.
+ */
+BOOST_AUTO_TEST_CASE(evaluateOperatorBlockMatrixVectorProduct) {
+
+    // Read in the molecular Hamiltonian and set up the seniority-zero ONV basis.
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = sq_hamiltonian.numberOfOrbitals();
+    const GQCP::SeniorityZeroONVBasis onv_basis {K, 5};
+
+    const GQCP::MatrixX<double> X = GQCP::MatrixX<double>::Random(onv_basis.dimension(), 3);
+    const auto block_mvp = onv_basis.evaluateOperatorBlockMatrixVectorProduct(sq_hamiltonian, X);
+
+    BOOST_REQUIRE(block_mvp.cols() == X.cols());
+    for (long k = 0; k < X.cols(); k++) {
+        const GQCP::VectorX<double> x = X.col(k);
+        BOOST_CHECK(block_mvp.col(k).isApprox(onv_basis.evaluateOperatorMatrixVectorProduct(sq_hamiltonian, x), 1.0e-12));
+    }
+}
@@ -105,3 +105,52 @@ BOOST_AUTO_TEST_CASE(restricted_hamiltonian_diagonal) {
 
     BOOST_CHECK(diagonal_specialized.isApprox(dense_matrix.diagonal(), 1.0e-08));
 }
+
+
+/**
+ *  Check if the dense Hamiltonian matrix representation in a selected ONV basis that is generated from some addresses of a full spin-resolved ONV basis equals the corresponding block of the dense Hamiltonian matrix representation in the full spin-resolved ONV basis.
+ * 
+ *  The test system is H2O in an STO-3G basisset, which has a FCI dimension of 441.
+ */
+BOOST_AUTO_TEST_CASE(constructor_addresses_spin_resolved) {
+
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = hamiltonian.numberOfOrbitals();
+
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 5};
+    const auto H_dense = onv_basis.evaluateOperatorDense(hamiltonian);
+
+    const std::vector<size_t> addresses {440, 0, 21, 37, 200};
+    const GQCP::SpinResolvedSelectedONVBasis selected_onv_basis {onv_basis, addresses};
+    const auto H_block = selected_onv_basis.evaluateOperatorDense(hamiltonian);
+
+    BOOST_REQUIRE(selected_onv_basis.dimension() == addresses.size());
+    for (size_t i = 0; i < addresses.size(); i++) {
+        for (size_t j = 0; j < addresses.size(); j++) {
+            BOOST_CHECK(std::abs(H_block(i, j) - H_dense(addresses[i], addresses[j])) < 1.0e-12);
+        }
+    }
+}
+
+
+/**
+ *  Check if the dense Hamiltonian matrix representation in a selected ONV basis that is generated from some addresses of a seniority-zero ONV basis equals the corresponding block of the dense Hamiltonian matrix representation in the seniority-zero ONV basis.
+ */
+BOOST_AUTO_TEST_CASE(constructor_addresses_seniority_zero) {
+
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = hamiltonian.numberOfOrbitals();
+
+    const GQCP::SeniorityZeroONVBasis onv_basis {K, 5};
+    const auto H_dense = onv_basis.evaluateOperatorDense(hamiltonian);
+
+    const std::vector<size_t> addresses {20, 0, 3, 7};
+    const GQCP::SpinResolvedSelectedONVBasis selected_onv_basis {onv_basis, addresses};
+    const auto H_block = selected_onv_basis.evaluateOperatorDense(hamiltonian);
+
+    for (size_t i = 0; i < addresses.size(); i++) {
+        for (size_t j = 0; j < addresses.size(); j++) {
+            BOOST_CHECK(std::abs(H_block(i, j) - H_dense(addresses[i], addresses[j])) < 1.0e-12);
+        }
+    }
+}
@@ -0,0 +1,263 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "SpinResolvedSigmaEngine"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Transformations/UTransformation.hpp"
+#include "ONVBasis/SpinResolvedSigmaEngine.hpp"
+#include "QCModel/CI/LinearExpansion.hpp"
+
+
+/**
+ *  Check if the matrix-vector product of a restricted Hamiltonian through a prepared sigma engine matches the one through a direct evaluation (i.e. through the dense Hamiltonian matrix representation).
+ * 
+ *  The test system is H2O in an STO-3G basisset, which has a FCI dimension of 441.
+ */
+BOOST_AUTO_TEST_CASE(restricted_dense_vs_sigma_engine) {
+
+    // Read in the molecular Hamiltonian and set up the full spin-resolved ONV basis.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = hamiltonian.numberOfOrbitals();
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 5};
+
+    // Determine the Hamiltonian matrix and let it act on a random linear expansion.
+    const auto linear_expansion = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::Random(onv_basis);
+    const auto H_dense = onv_basis.evaluateOperatorDense(hamiltonian);
+    const GQCP::VectorX<double> direct_mvp = H_dense * linear_expansion.coefficients();  // mvp: matrix-vector-product
+
+    // Prepare the sigma engine and check if its matrix-vector product is equal to the direct one.
+    const GQCP::SpinResolvedSigmaEngine sigma_engine {onv_basis, hamiltonian};
+    const auto sigma_engine_mvp = sigma_engine.evaluateMatrixVectorProduct(linear_expansion.coefficients());
+
+    BOOST_CHECK(sigma_engine_mvp.isApprox(direct_mvp, 1.0e-08));
+}
+
+
+/**
+ *  Check if a prepared sigma engine can be re-used for multiple matrix-vector products of an unrestricted Hamiltonian, and that these match the direct evaluations (i.e. through the dense Hamiltonian matrix representation).
+ * 
+ *  The test system is H2O(+) in an STO-3G basisset, which has a FCI dimension of 735.
+ */
+BOOST_AUTO_TEST_CASE(unrestricted_repeated_sigma_engine) {
+
+    // Read in the molecular Hamiltonian and set up the full spin-resolved ONV basis.
+    const auto r_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto hamiltonian = GQCP::USQHamiltonian<double>::FromRestricted(r_hamiltonian);
+    const auto K = hamiltonian.numberOfOrbitals();
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 4};
+
+    // Prepare the sigma engine and let it act on several random linear expansions.
+    const auto H_dense = onv_basis.evaluateOperatorDense(hamiltonian);
+    const GQCP::SpinResolvedSigmaEngine sigma_engine {onv_basis, hamiltonian};
+    for (size_t i = 0; i < 3; i++) {
+        const auto x = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::Random(onv_basis).coefficients();
+
+        const GQCP::VectorX<double> direct_mvp = H_dense * x;
+        const auto sigma_engine_mvp = sigma_engine.evaluateMatrixVectorProduct(x);
+
+        BOOST_CHECK(sigma_engine_mvp.isApprox(direct_mvp, 1.0e-08));
+    }
+}
+
+
+/**
+ *  Check if the sigma engine rejects coefficient vectors whose dimension doesn't match the dimension of the ONV basis.
+ */
+BOOST_AUTO_TEST_CASE(sigma_engine_dimension_check) {
+
+    // Read in the molecular Hamiltonian and set up the full spin-resolved ONV basis.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = hamiltonian.numberOfOrbitals();
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 5};
+
+    const GQCP::SpinResolvedSigmaEngine sigma_engine {onv_basis, hamiltonian};
+    const GQCP::VectorX<double> x_too_small = GQCP::VectorX<double>::Random(onv_basis.dimension() - 1);
+    const GQCP::VectorX<double> x_too_large = GQCP::VectorX<double>::Random(onv_basis.dimension() + 1);
+
+    BOOST_CHECK_THROW(sigma_engine.evaluateMatrixVectorProduct(x_too_small), std::invalid_argument);
+    BOOST_CHECK_THROW(sigma_engine.evaluateMatrixVectorProduct(x_too_large), std::invalid_argument);
+    BOOST_CHECK_THROW(sigma_engine.evaluateSingletMatrixVectorProduct(x_too_small), std::invalid_argument);
+}
+
+
+/**
+ *  Check if a multithreaded sigma engine produces the same matrix-vector product as a single-threaded one, for several numbers of threads (including more threads than there are alpha strings).
+ *
+ *  The results are compared up to round-off (1.0e-12, relative) rather than bitwise. The single-threaded engine lets MKL's DGEMM use its own threads, while the workers of a multithreaded engine run it single-threaded, and MKL doesn't guarantee bitwise identical results for different numbers of threads.
+ * 
+ *  The test system is H2O(+) in an STO-3G basisset, which has a FCI dimension of 735.
+ */
+BOOST_AUTO_TEST_CASE(multithreaded_sigma_engine) {
+
+    // Read in the molecular Hamiltonian and set up the full spin-resolved ONV basis.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = hamiltonian.numberOfOrbitals();
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 4};  // 21 alpha strings
+
+    const auto x = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::Random(onv_basis).coefficients();
+
+    const GQCP::SpinResolvedSigmaEngine serial_sigma_engine {onv_basis, hamiltonian};
+    const auto serial_mvp = serial_sigma_engine.evaluateMatrixVectorProduct(x);
+
+    // The partitioning over alpha strings should not alter the result.
+    for (const size_t number_of_threads : {2, 3, 4, 64}) {
+        const GQCP::SpinResolvedSigmaEngine parallel_sigma_engine {onv_basis, hamiltonian, number_of_threads};
+        const auto parallel_mvp = parallel_sigma_engine.evaluateMatrixVectorProduct(x);
+
+        BOOST_CHECK(parallel_mvp.isApprox(serial_mvp, 1.0e-12));
+    }
+
+    // Check that a thread count of zero is rejected.
+    BOOST_CHECK_THROW(GQCP::SpinResolvedSigmaEngine(onv_basis, hamiltonian, 0), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the dedicated restricted preparation of the sigma engine yields the same intermediates and matrix-vector products as the preparation through the equivalent unrestricted Hamiltonian, both for an equal and an unequal number of alpha and beta electrons.
+ * 
+ *  The test system is H2O in an STO-3G basisset.
+ */
+BOOST_AUTO_TEST_CASE(restricted_vs_unrestricted_preparation) {
+
+    // Read in the molecular Hamiltonian, and convert it into an unrestricted one.
+    const auto r_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto u_hamiltonian = GQCP::USQHamiltonian<double>::FromRestricted(r_hamiltonian);
+    const auto K = r_hamiltonian.numberOfOrbitals();
+
+    for (const size_t N_beta : {5, 4}) {
+        const GQCP::SpinResolvedONVBasis onv_basis {K, 5, N_beta};
+
+        const GQCP::SpinResolvedSigmaEngine restricted_sigma_engine {onv_basis, r_hamiltonian};
+        const GQCP::SpinResolvedSigmaEngine unrestricted_sigma_engine {onv_basis, u_hamiltonian};
+
+        // The spin-unresolved sparse Hamiltonian should only be shared if the alpha and beta ONV bases are equal.
+        BOOST_CHECK(restricted_sigma_engine.sharesSpinHamiltonian() == (N_beta == 5));
+        BOOST_CHECK(!unrestricted_sigma_engine.sharesSpinHamiltonian());
+
+        BOOST_CHECK(restricted_sigma_engine.alphaHamiltonian().isApprox(unrestricted_sigma_engine.alphaHamiltonian(), 1.0e-12));
+        BOOST_CHECK(restricted_sigma_engine.betaHamiltonian().isApprox(unrestricted_sigma_engine.betaHamiltonian(), 1.0e-12));
+
+        const auto x = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::Random(onv_basis).coefficients();
+        const auto restricted_mvp = restricted_sigma_engine.evaluateMatrixVectorProduct(x);
+        const auto unrestricted_mvp = unrestricted_sigma_engine.evaluateMatrixVectorProduct(x);
+
+        BOOST_CHECK(restricted_mvp.isApprox(unrestricted_mvp, 1.0e-12));
+    }
+}
+
+
+/**
+ *  Check if the singlet matrix-vector product matches the general one for the (singlet) ground state and for a random spin-symmetric vector, for several numbers of threads.
+ * 
+ *  The test system is H2O in an STO-3G basisset, which has a FCI dimension of 441.
+ */
+BOOST_AUTO_TEST_CASE(singlet_sigma_engine) {
+
+    // Read in the molecular Hamiltonian and set up the full spin-resolved ONV basis.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = hamiltonian.numberOfOrbitals();
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 5};
+    const auto dim = onv_basis.alpha().dimension();
+
+    // Determine the ground state through a dense diagonalization, and construct a random vector whose coefficient matrix is symmetric.
+    const auto H_dense = onv_basis.evaluateOperatorDense(hamiltonian);
+    const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {H_dense};
+    const GQCP::VectorX<double> ground_state = eigensolver.eigenvectors().col(0);
+
+    const GQCP::MatrixX<double> A = GQCP::MatrixX<double>::Random(dim, dim);
+    const GQCP::MatrixX<double> A_symmetric = A + A.transpose();
+    const GQCP::VectorX<double> x_symmetric = Eigen::Map<const Eigen::VectorXd>(A_symmetric.data(), A_symmetric.size());
+
+    for (const auto& x : {ground_state, x_symmetric}) {
+        const GQCP::VectorX<double> direct_mvp = H_dense * x;
+
+        for (const size_t number_of_threads : {1, 3}) {
+            const GQCP::SpinResolvedSigmaEngine sigma_engine {onv_basis, hamiltonian, number_of_threads};
+            const auto singlet_mvp = sigma_engine.evaluateSingletMatrixVectorProduct(x);
+
+            BOOST_CHECK(singlet_mvp.isApprox(direct_mvp, 1.0e-08));
+        }
+    }
+
+
+    // Check that the singlet matrix-vector product is rejected if the alpha and beta ONV bases differ.
+    const GQCP::SpinResolvedONVBasis onv_basis_doublet {K, 5, 4};
+    const GQCP::SpinResolvedSigmaEngine sigma_engine_doublet {onv_basis_doublet, hamiltonian};
+    const auto x_doublet = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::Random(onv_basis_doublet).coefficients();
+    BOOST_CHECK_THROW(sigma_engine_doublet.evaluateSingletMatrixVectorProduct(x_doublet), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the block matrix-vector product of a sigma engine matches the column-wise evaluation of the single matrix-vector product, for several numbers of threads.
+ * 
+ *  The test system is H2O(+) in an STO-3G basisset, which has a FCI dimension of 735.
+ */
+BOOST_AUTO_TEST_CASE(block_sigma_engine) {
+
+    // Read in the molecular Hamiltonian and set up the full spin-resolved ONV basis.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = hamiltonian.numberOfOrbitals();
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 4};
+
+    const GQCP::MatrixX<double> X = GQCP::MatrixX<double>::Random(onv_basis.dimension(), 4);
+
+    for (const size_t number_of_threads : {1, 3}) {
+        const GQCP::SpinResolvedSigmaEngine sigma_engine {onv_basis, hamiltonian, number_of_threads};
+        const auto block_mvp = sigma_engine.evaluateBlockMatrixVectorProduct(X);
+
+        BOOST_REQUIRE(block_mvp.cols() == X.cols());
+        for (long k = 0; k < X.cols(); k++) {
+            const GQCP::VectorX<double> x = X.col(k);
+            BOOST_CHECK(block_mvp.col(k).isApprox(sigma_engine.evaluateMatrixVectorProduct(x), 1.0e-12));
+        }
+    }
+}
+
+
+/**
+ *  Check if the matrix-vector product of an unrestricted Hamiltonian whose alpha and beta orbitals differ matches the one through a direct evaluation. In such a Hamiltonian, the mixed alpha-beta integrals g(ab)_{pqrs} have no symmetry between the alpha pair (pq) and the beta pair (rs), which is a check on the gather-DGEMM-scatter of the mixed contributions.
+ * 
+ *  The test system is H2O(+) in an STO-3G basisset, which has a FCI dimension of 735.
+ */
+BOOST_AUTO_TEST_CASE(unrestricted_rotated_sigma_engine) {
+
+    // Read in the molecular Hamiltonian, and rotate its alpha and beta orbitals independently.
+    const auto r_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    auto hamiltonian = GQCP::USQHamiltonian<double>::FromRestricted(r_hamiltonian);
+    const auto K = hamiltonian.numberOfOrbitals();
+    hamiltonian.rotate(GQCP::UTransformation<double>::RandomUnitary(K));
+
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 4};
+
+    // Compare the matrix-vector products of a single and a block of random linear expansions with the dense ones.
+    const auto H_dense = onv_basis.evaluateOperatorDense(hamiltonian);
+    const GQCP::MatrixX<double> X = GQCP::MatrixX<double>::Random(onv_basis.dimension(), 3);
+
+    for (const size_t number_of_threads : {1, 2}) {
+        const GQCP::SpinResolvedSigmaEngine sigma_engine {onv_basis, hamiltonian, number_of_threads};
+
+        const GQCP::VectorX<double> x = X.col(0);
+        const GQCP::VectorX<double> direct_mvp = H_dense * x;
+        BOOST_CHECK(sigma_engine.evaluateMatrixVectorProduct(x).isApprox(direct_mvp, 1.0e-08));
+
+        const GQCP::MatrixX<double> direct_block_mvp = H_dense * X;
+        BOOST_CHECK(sigma_engine.evaluateBlockMatrixVectorProduct(X).isApprox(direct_block_mvp, 1.0e-08));
+    }
+}
@@ -25,6 +25,10 @@
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "QCModel/CI/LinearExpansion.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+
 
 /**
  *  Check if the calculation of the dimension of a SpinUnresolvedONVBasis is correct and if it can throw errors.
@@ -63,6 +67,48 @@ BOOST_AUTO_TEST_CASE(vertex_weights_M5_N3) {
 }
 
 
+/**
+ *  Check if the vertex weights are stored contiguously in cache-aligned, padded rows, and if the contiguous tables (including the 32-bit copy) contain the same vertex weights as the vector of vectors.
+ */
+BOOST_AUTO_TEST_CASE(vertex_weights_layout) {
+
+    const GQCP::SpinUnresolvedONVBasis onv_basis {12, 5};
+
+    BOOST_CHECK(reinterpret_cast<std::uintptr_t>(onv_basis.flatVertexWeights()) % GQCP::cache_line_size == 0);
+    BOOST_CHECK(onv_basis.flatVertexWeightStride() * sizeof(size_t) % GQCP::cache_line_size == 0);
+    BOOST_CHECK(onv_basis.flatVertexWeightStride() >= 6);
+
+    BOOST_REQUIRE(onv_basis.hasCompactVertexWeights());
+    BOOST_CHECK(reinterpret_cast<std::uintptr_t>(onv_basis.compactVertexWeights()) % GQCP::cache_line_size == 0);
+    for (size_t p = 0; p < 13; p++) {
+        for (size_t n = 0; n < 6; n++) {
+            BOOST_CHECK_EQUAL(onv_basis.compactVertexWeights()[p * onv_basis.compactVertexWeightStride() + n], onv_basis.vertexWeight(p, n));
+            BOOST_CHECK_EQUAL(onv_basis.flatVertexWeights()[p * onv_basis.flatVertexWeightStride() + n], onv_basis.vertexWeight(p, n));
+            BOOST_CHECK_EQUAL(onv_basis.vertexWeights()[p][n], onv_basis.vertexWeight(p, n));
+        }
+    }
+}
+
+
+/**
+ *  Check if the address calculations (which use unrolled kernels for small numbers of electrons) are the inverse of the calculation of the representations, for numbers of electrons for which an unrolled kernel is and isn't available.
+ */
+BOOST_AUTO_TEST_CASE(addressOf_unrolled_kernels) {
+
+    const size_t M = 12;
+    for (size_t N = 0; N <= M; N++) {
+        const GQCP::SpinUnresolvedONVBasis onv_basis {M, N};
+
+        for (size_t I = 0; I < onv_basis.dimension(); I++) {
+            const auto representation = onv_basis.representationOf(I);
+
+            BOOST_CHECK_EQUAL(onv_basis.addressOf(representation), I);
+            BOOST_CHECK_EQUAL(GQCP::SpinUnresolvedONVBasis::addressOf(onv_basis.flatVertexWeights(), onv_basis.flatVertexWeightStride(), representation), I);
+        }
+    }
+}
+
+
 /**
  *  Test if the arc weights of the SpinUnresolvedONV basis addressing scheme are correct for the Fock space F(5,3).
  * 
@@ -380,6 +426,71 @@ BOOST_AUTO_TEST_CASE(generalized_dense_vs_matvec) {
 }
 
 
+/**
+ *  Check if the single-excitation string table contains exactly all single excitations E_pq |I> = sign |J>, by comparing with the explicit action of the creation and annihilation operators on the ONVs.
+ */
+BOOST_AUTO_TEST_CASE(single_excitations) {
+
+    const size_t M = 7;
+    const size_t N = 3;
+    const GQCP::SpinUnresolvedONVBasis onv_basis {M, N};
+    const auto& single_excitations = onv_basis.singleExcitations();
+
+    BOOST_CHECK_EQUAL(single_excitations.entriesPerString(), N * (M - N + 1));
+    BOOST_CHECK_EQUAL(single_excitations.numberOfEntries(), onv_basis.dimension() * N * (M - N + 1));
+    BOOST_CHECK_EQUAL(single_excitations.memoryFootprint(), single_excitations.numberOfEntries() * 8);
+
+    onv_basis.forEach([&onv_basis, &single_excitations](const GQCP::SpinUnresolvedONV& onv, const size_t I) {
+        // Construct all single excitations explicitly.
+        std::vector<std::tuple<size_t, size_t, size_t, int>> reference;  // (J, p, q, sign)
+        for (size_t q = 0; q < M; q++) {
+            for (size_t p = 0; p < M; p++) {
+                auto excited_onv = onv;
+                int sign = 1;
+                if (excited_onv.annihilate(q, sign) && excited_onv.create(p, sign)) {
+                    reference.emplace_back(onv_basis.addressOf(excited_onv), p, q, sign);
+                }
+            }
+        }
+
+        std::vector<std::tuple<size_t, size_t, size_t, int>> entries;
+        for (auto excitation = single_excitations.begin(I); excitation != single_excitations.end(I); excitation++) {
+            entries.emplace_back(excitation->address, excitation->p, excitation->q, excitation->sign);
+        }
+
+        // The entries of every string should be sorted by their target address.
+        BOOST_CHECK(std::is_sorted(entries.begin(), entries.end(), [](const std::tuple<size_t, size_t, size_t, int>& lhs, const std::tuple<size_t, size_t, size_t, int>& rhs) { return std::get<0>(lhs) < std::get<0>(rhs); }));
+
+        std::sort(reference.begin(), reference.end());
+        std::sort(entries.begin(), entries.end());
+        BOOST_CHECK(entries == reference);
+    });
+
+
+    // The table should be calculated only once, and shared between copies of the ONV basis.
+    const auto onv_basis_copy = onv_basis;
+    BOOST_CHECK(&onv_basis_copy.singleExcitations() == &single_excitations);
+}
+
+
+/**
+ *  Check if the matrix-vector product of a one-electron operator, which uses the single-excitation string table, matches the product with the dense matrix representation.
+ */
+BOOST_AUTO_TEST_CASE(one_electron_dense_vs_matvec) {
+
+    const size_t M = 8;
+    const GQCP::SpinUnresolvedONVBasis onv_basis {M, 3};
+
+    const auto f = GQCP::ScalarGSQOneElectronOperator<double>::Random(M);
+    const auto x = GQCP::LinearExpansion<GQCP::SpinUnresolvedONVBasis>::Random(onv_basis).coefficients();
+
+    const GQCP::VectorX<double> direct_mvp = onv_basis.evaluateOperatorDense(f) * x;
+    const auto specialized_mvp = onv_basis.evaluateOperatorMatrixVectorProduct(f, x);
+
+    BOOST_CHECK(specialized_mvp.isApprox(direct_mvp, 1.0e-12));
+}
+
+
 /*
  *  MARK: Tests for legacy code
  */
@@ -519,3 +630,57 @@ BOOST_AUTO_TEST_CASE(shiftToPreviousOrbital_signed) {
     BOOST_CHECK(q == 1);
     BOOST_CHECK(sign == -1);
 }
+
+
+/**
+ *  Check if the shift kernels yield the same shifts, orbital indices, electron counts and signs for the 64-bit and the 32-bit vertex weights, for every ONV and every starting electron.
+ */
+BOOST_AUTO_TEST_CASE(shift_kernels_weight_types) {
+
+    const GQCP::SpinUnresolvedONVBasis onv_basis {8, 4};
+    BOOST_REQUIRE(onv_basis.hasCompactVertexWeights());
+
+    const auto* const weights = onv_basis.flatVertexWeights();
+    const auto stride = onv_basis.flatVertexWeightStride();
+    const auto* const compact_weights = onv_basis.compactVertexWeights();
+    const auto compact_stride = onv_basis.compactVertexWeightStride();
+
+    for (size_t I = 0; I < onv_basis.dimension(); I++) {
+        const auto onv = onv_basis.constructONVFromAddress(I);
+
+        for (size_t e = 0; e < 4; e++) {
+            const size_t q = onv.occupationIndexOf(e);
+
+            // Shifting forward, after annihilating one electron.
+            size_t address1 = I, q1 = q, e1 = e;
+            size_t address2 = I, q2 = q, e2 = e;
+            int sign1 = 1, sign2 = 1;
+            GQCP::SpinUnresolvedONVBasis::shiftUntilNextUnoccupiedOrbital<1>(weights, stride, 4, onv, address1, q1, e1, sign1);
+            GQCP::SpinUnresolvedONVBasis::shiftUntilNextUnoccupiedOrbital<1>(compact_weights, compact_stride, 4, onv, address2, q2, e2, sign2);
+
+            BOOST_CHECK_EQUAL(address1, address2);
+            BOOST_CHECK_EQUAL(q1, q2);
+            BOOST_CHECK_EQUAL(e1, e2);
+            BOOST_CHECK_EQUAL(sign1, sign2);
+
+            // Shifting backward, before creating one electron. The created electron should still fit in the ONV.
+            if (e + 2 > 4) {
+                continue;
+            }
+
+            address1 = I;
+            q1 = q;
+            e1 = e;
+            address2 = I;
+            q2 = q;
+            e2 = e;
+            GQCP::SpinUnresolvedONVBasis::shiftUntilPreviousUnoccupiedOrbital<1>(weights, stride, onv, address1, q1, e1, sign1);
+            GQCP::SpinUnresolvedONVBasis::shiftUntilPreviousUnoccupiedOrbital<1>(compact_weights, compact_stride, onv, address2, q2, e2, sign2);
+
+            BOOST_CHECK_EQUAL(address1, address2);
+            BOOST_CHECK_EQUAL(q1, q2);
+            BOOST_CHECK_EQUAL(e1, e2);
+            BOOST_CHECK_EQUAL(sign1, sign2);
+        }
+    }
+}
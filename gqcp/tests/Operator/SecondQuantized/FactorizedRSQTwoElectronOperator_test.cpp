@@ -0,0 +1,130 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "FactorizedRSQTwoElectronOperator"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/SpinorBasis/RSpinOrbitalBasis.hpp"
+#include "Basis/Transformations/RTransformation.hpp"
+#include "Molecule/Molecule.hpp"
+#include "Operator/SecondQuantized/FactorizedRSQTwoElectronOperator.hpp"
+
+
+/**
+ *  Create random three-index factors B^P_pq that are symmetric in p and q.
+ */
+GQCP::MatrixX<double> randomFactors(const size_t K, const size_t N_aux) {
+
+    GQCP::MatrixX<double> B(K * K, N_aux);
+    for (size_t P = 0; P < N_aux; P++) {
+        const GQCP::SquareMatrix<double> M = GQCP::SquareMatrix<double>::Random(K);
+        const GQCP::SquareMatrix<double> M_symmetric = M + M.transpose();
+        B.col(P) = Eigen::Map<const Eigen::VectorXd>(M_symmetric.data(), K * K);
+    }
+
+    return B;
+}
+
+
+/**
+ *  Check if the constructor throws when the factors are incompatible with the number of orbitals.
+ */
+BOOST_AUTO_TEST_CASE(constructor) {
+
+    const auto B = randomFactors(3, 5);
+
+    BOOST_CHECK_NO_THROW(GQCP::FactorizedRSQTwoElectronOperator<double>(3, B));
+    BOOST_CHECK_THROW(GQCP::FactorizedRSQTwoElectronOperator<double>(4, B), std::invalid_argument);
+}
+
+
+/**
+ *  Check if single elements and blocks of the reconstructed two-electron integrals are consistent with the full reconstruction.
+ */
+BOOST_AUTO_TEST_CASE(reconstruction) {
+
+    const size_t K = 5;
+    const GQCP::FactorizedRSQTwoElectronOperator<double> g_op {K, randomFactors(K, 8)};
+    const auto g = g_op.parameters();
+
+    BOOST_CHECK(std::abs(g_op(1, 3, 4, 0) - g(1, 3, 4, 0)) < 1.0e-12);
+    BOOST_CHECK(std::abs(g(1, 3, 4, 0) - g(4, 0, 3, 1)) < 1.0e-12);  // The reconstructed integrals should have the 8-fold permutational symmetry.
+
+    const auto block = g_op.block({1, 0, 2, 3}, {3, 2, 2, 2});
+    for (size_t p = 0; p < 3; p++) {
+        for (size_t q = 0; q < 2; q++) {
+            for (size_t r = 0; r < 2; r++) {
+                for (size_t s = 0; s < 2; s++) {
+                    BOOST_CHECK(std::abs(block(p, q, r, s) - g(1 + p, q, 2 + r, 3 + s)) < 1.0e-12);
+                }
+            }
+        }
+    }
+
+    BOOST_CHECK_THROW(g_op.block({3, 0, 0, 0}, {3, 1, 1, 1}), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the basis transformation of the three-index factors is equal to the basis transformation of the reconstructed two-electron integrals.
+ */
+BOOST_AUTO_TEST_CASE(transform) {
+
+    const size_t K = 4;
+    const GQCP::FactorizedRSQTwoElectronOperator<double> g_op {K, randomFactors(K, 6)};
+    const auto T = GQCP::RTransformation<double>::RandomUnitary(K);
+
+    const auto g_transformed_ref = g_op.reconstructed().transformed(T).parameters();
+    const auto g_transformed = g_op.transformed(T).parameters();
+
+    BOOST_CHECK(g_transformed.isApprox(g_transformed_ref, 1.0e-10));
+}
+
+
+/**
+ *  Check if the density-fitted Coulomb integrals approximate the exact Coulomb integrals for H2O in cc-pVDZ, with the cc-pVDZ-RI auxiliary basis.
+ */
+BOOST_AUTO_TEST_CASE(density_fitting_H2O) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {molecule, "cc-pVDZ"};
+    const GQCP::ScalarBasis<GQCP::GTOShell> auxiliary_scalar_basis {molecule, "cc-pVDZ-RI"};
+
+    const auto g_exact = spin_orbital_basis.quantize(GQCP::Operator::Coulomb()).parameters();
+    const auto g_op = spin_orbital_basis.quantize(GQCP::Operator::Coulomb(), auxiliary_scalar_basis);
+
+    BOOST_CHECK(g_op.numberOfOrbitals() == spin_orbital_basis.numberOfSpatialOrbitals());
+    BOOST_CHECK(g_op.numberOfFactors() == auxiliary_scalar_basis.numberOfBasisFunctions());
+    BOOST_CHECK(g_op.parameters().isApprox(g_exact, 1.0e-03));
+}
+
+
+/**
+ *  Check if the Cholesky-decomposed Coulomb integrals approximate the exact Coulomb integrals for H2O in 6-31G.
+ */
+BOOST_AUTO_TEST_CASE(Cholesky_H2O) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {molecule, "6-31G"};
+
+    const auto g_exact = spin_orbital_basis.quantize(GQCP::Operator::Coulomb()).parameters();
+    const auto g_op = spin_orbital_basis.quantizeCholesky(GQCP::Operator::Coulomb(), 1.0e-08);
+
+    BOOST_CHECK(g_op.numberOfOrbitals() == spin_orbital_basis.numberOfSpatialOrbitals());
+    BOOST_CHECK(g_op.parameters().isApprox(g_exact, 1.0e-06));
+}
@@ -0,0 +1,63 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#define BOOST_TEST_MODULE "FactorizedUSQTwoElectronOperator"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/SpinorBasis/USpinOrbitalBasis.hpp"
+#include "Basis/Transformations/UTransformation.hpp"
+#include "Molecule/Molecule.hpp"
+#include "Operator/SecondQuantized/FactorizedUSQTwoElectronOperator.hpp"
+
+
+/**
+ *  Check if transforming the alpha and beta factors separately is equal to the basis transformation of all the reconstructed spin components.
+ */
+BOOST_AUTO_TEST_CASE(transform) {
+
+    const size_t K = 4;
+    const GQCP::MatrixX<double> B = GQCP::MatrixX<double>::Random(K * K, 6);
+    const auto g_op = GQCP::FactorizedUSQTwoElectronOperator<double>::FromEqual(GQCP::FactorizedRSQTwoElectronOperator<double> {K, B});
+    const auto T = GQCP::UTransformation<double>::RandomUnitary(K);
+
+    const auto g_transformed_ref = g_op.reconstructed().transformed(T);
+    const auto g_transformed = g_op.transformed(T).reconstructed();
+
+    BOOST_CHECK(g_transformed.alphaAlpha().parameters().isApprox(g_transformed_ref.alphaAlpha().parameters(), 1.0e-10));
+    BOOST_CHECK(g_transformed.alphaBeta().parameters().isApprox(g_transformed_ref.alphaBeta().parameters(), 1.0e-10));
+    BOOST_CHECK(g_transformed.betaAlpha().parameters().isApprox(g_transformed_ref.betaAlpha().parameters(), 1.0e-10));
+    BOOST_CHECK(g_transformed.betaBeta().parameters().isApprox(g_transformed_ref.betaBeta().parameters(), 1.0e-10));
+}
+
+
+/**
+ *  Check if the Cholesky-decomposed Coulomb integrals approximate the exact Coulomb integrals for H2O in 6-31G, in an unrestricted spin-orbital basis.
+ */
+BOOST_AUTO_TEST_CASE(Cholesky_H2O) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::USpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {molecule, "6-31G"};
+
+    const auto g_exact = spin_orbital_basis.quantize(GQCP::Operator::Coulomb());
+    const auto g = spin_orbital_basis.quantizeCholesky(GQCP::Operator::Coulomb(), 1.0e-08).reconstructed();
+
+    BOOST_CHECK(g.alphaAlpha().parameters().isApprox(g_exact.alphaAlpha().parameters(), 1.0e-06));
+    BOOST_CHECK(g.alphaBeta().parameters().isApprox(g_exact.alphaBeta().parameters(), 1.0e-06));
+    BOOST_CHECK(g.betaBeta().parameters().isApprox(g_exact.betaBeta().parameters(), 1.0e-06));
+}
@@ -391,3 +391,128 @@ BOOST_AUTO_TEST_CASE(naturals) {
 
     BOOST_CHECK(D_after.matrix().diagonal().isApprox(diagonalizer.eigenvalues(), 1.0e-12));
 }
+
+
+/**
+ *  Check if the block Davidson algorithm finds the three lowest FCI eigenvalues of H2O//STO-3G, by comparing them with the ones from a dense diagonalization.
+ */
+BOOST_AUTO_TEST_CASE(FCI_H2O_block_Davidson) {
+
+    // Read in the molecular Hamiltonian (in an orthonormal basis) and set up the full spin-resolved ONV basis.
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = sq_hamiltonian.numberOfOrbitals();
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 5};  // The dimension of this ONV basis is 441.
+
+    // Determine the reference eigenvalues through a dense diagonalization.
+    auto dense_environment = GQCP::CIEnvironment::Dense(sq_hamiltonian, onv_basis);
+    auto dense_solver = GQCP::EigenproblemSolver::Dense();
+    dense_solver.perform(dense_environment);
+    const GQCP::VectorX<double> reference_eigenvalues = dense_environment.eigenvalues.head(3);
+
+    // Solve the eigenvalue problem with a block Davidson solver. In order not to miss any eigenvectors because of symmetry, we start from three orthonormalized random guess vectors.
+    const auto dim = onv_basis.dimension();
+    const Eigen::HouseholderQR<Eigen::MatrixXd> qr {GQCP::MatrixX<double>::Random(dim, 3)};
+    const GQCP::MatrixX<double> X_0 = qr.householderQ() * GQCP::MatrixX<double>::Identity(dim, 3);
+    auto block_environment = GQCP::CIEnvironment::BlockIterative(sq_hamiltonian, onv_basis, X_0, 2);
+    auto block_solver = GQCP::EigenproblemSolver::BlockDavidson(3);
+    block_solver.perform(block_environment);
+
+    for (size_t i = 0; i < 3; i++) {
+        BOOST_CHECK(std::abs(block_environment.eigenvalues(i) - reference_eigenvalues(i)) < 1.0e-08);
+    }
+}
+
+
+/**
+ *  Check if the Davidson solver finds the FCI ground state energy of H2O in an STO-3G basisset with all its correction schemes, with a dense-block preconditioner and with thick restarts.
+ * 
+ *  The Hamiltonian is read in from an FCIDUMP file, so that the test doesn't depend on an integral engine.
+ */
+BOOST_AUTO_TEST_CASE(FCI_H2O_Davidson_corrections) {
+
+    // Read in the molecular Hamiltonian (in an orthonormal basis) and set up the full spin-resolved ONV basis.
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = sq_hamiltonian.numberOfOrbitals();
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 5};  // The dimension of this ONV basis is 441.
+
+    // Determine the reference energy through a dense diagonalization.
+    auto dense_environment = GQCP::CIEnvironment::Dense(sq_hamiltonian, onv_basis);
+    auto dense_solver = GQCP::EigenproblemSolver::Dense();
+    dense_solver.perform(dense_environment);
+    const double reference_energy = dense_environment.eigenvalues(0);
+
+
+    // Solve the eigenvalue problem with the different Davidson variants, using a small maximum subspace dimension in order to force subspace collapses.
+    const GQCP::VectorX<double> x0 = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::HartreeFock(onv_basis).coefficients();
+
+    const std::vector<GQCP::DavidsonCorrection> corrections {GQCP::DavidsonCorrection::k_diagonal, GQCP::DavidsonCorrection::k_olsen};
+    const std::vector<size_t> preconditioner_block_dimensions {0, 20};
+    const std::vector<bool> thick_restarts {false, true};
+
+    for (const auto& correction : corrections) {
+        for (const auto& preconditioner_block_dimension : preconditioner_block_dimensions) {
+            for (const auto thick_restart : thick_restarts) {
+                auto environment = GQCP::CIEnvironment::Iterative(sq_hamiltonian, onv_basis, x0);
+                auto solver = GQCP::EigenproblemSolver::Davidson(1, 6, 1.0e-08, 1.0e-12, 128, 1.0e-03, correction, preconditioner_block_dimension, thick_restart);
+                solver.perform(environment);
+
+                BOOST_CHECK(std::abs(environment.eigenvalues(0) - reference_energy) < 1.0e-08);
+
+                // The dense block should have been calculated directly, i.e. not through matrix-vector products.
+                BOOST_CHECK(environment.number_of_matrix_vector_products <= solver.numberOfIterations());
+            }
+        }
+    }
+}
+
+
+/**
+ *  Check if the singlet Davidson environment finds the same FCI ground state energy of H2O in an STO-3G basisset as a dense diagonalization, for the diagonal and Olsen corrections and for the dense-block preconditioner. Also check that it is rejected for an ONV basis with an unequal number of alpha and beta electrons.
+ */
+BOOST_AUTO_TEST_CASE(FCI_H2O_singlet_Davidson) {
+
+    // Read in the molecular Hamiltonian (in an orthonormal basis) and set up the full spin-resolved ONV basis.
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = sq_hamiltonian.numberOfOrbitals();
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 5};  // The dimension of this ONV basis is 441.
+
+    // Determine the reference energy through a dense diagonalization.
+    auto dense_environment = GQCP::CIEnvironment::Dense(sq_hamiltonian, onv_basis);
+    auto dense_solver = GQCP::EigenproblemSolver::Dense();
+    dense_solver.perform(dense_environment);
+    const double reference_energy = dense_environment.eigenvalues(0);
+
+
+    // Solve the eigenvalue problem through singlet matrix-vector products, starting from the (singlet) Hartree-Fock determinant.
+    const GQCP::VectorX<double> x0 = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::HartreeFock(onv_basis).coefficients();
+
+    for (const auto& correction : {GQCP::DavidsonCorrection::k_diagonal, GQCP::DavidsonCorrection::k_olsen}) {
+        for (const size_t number_of_threads : {1, 2}) {
+            auto environment = GQCP::CIEnvironment::SingletIterative(sq_hamiltonian, onv_basis, x0, number_of_threads);
+            auto solver = GQCP::EigenproblemSolver::Davidson(1, 8, 1.0e-08, 1.0e-12, 128, 1.0e-03, correction);
+            solver.perform(environment);
+
+            BOOST_CHECK(std::abs(environment.eigenvalues(0) - reference_energy) < 1.0e-08);
+        }
+    }
+
+
+    // The dense-block preconditioner should keep the corrections symmetric, also if a basis vector lies in the block while its transposed partner doesn't (which is likely for an odd block dimension).
+    const auto dim = static_cast<long>(onv_basis.alpha().dimension());
+    for (const size_t preconditioner_block_dimension : {20, 21}) {
+        auto environment = GQCP::CIEnvironment::SingletIterative(sq_hamiltonian, onv_basis, x0);
+        auto solver = GQCP::EigenproblemSolver::Davidson(1, 8, 1.0e-08, 1.0e-12, 128, 1.0e-03, GQCP::DavidsonCorrection::k_diagonal, preconditioner_block_dimension);
+        solver.perform(environment);
+
+        BOOST_CHECK(std::abs(environment.eigenvalues(0) - reference_energy) < 1.0e-08);
+
+        const Eigen::Map<const Eigen::MatrixXd> C {environment.eigenvectors.col(0).data(), dim, dim};
+        BOOST_CHECK(C.isApprox(C.transpose(), 1.0e-06));
+    }
+
+
+    // The singlet matrix-vector product requires equal alpha and beta ONV bases.
+    const GQCP::SpinResolvedONVBasis onv_basis_doublet {K, 5, 4};
+    const GQCP::VectorX<double> x0_doublet = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::HartreeFock(onv_basis_doublet).coefficients();
+    BOOST_CHECK_THROW(GQCP::CIEnvironment::SingletIterative(sq_hamiltonian, onv_basis_doublet, x0_doublet), std::invalid_argument);
+}
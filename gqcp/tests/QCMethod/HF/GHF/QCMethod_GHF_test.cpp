@@ -239,3 +239,143 @@ BOOST_AUTO_TEST_CASE(H3_test_DIIS) {
     BOOST_CHECK(std::abs(s_z1 - reference_s_z) < 1.0e-08);
     BOOST_CHECK(std::abs(s_z2 - reference_s_z) < 1.0e-08);
 }
+
+
+/**
+ *  Check if the integral-direct plain GHF SCF solver, which never stores the two-electron integrals, finds the same solution as the regular plain GHF SCF solver for the H3-triangle of `H3_test_1`.
+ */
+BOOST_AUTO_TEST_CASE(H3_test_direct) {
+
+    const auto molecule = GQCP::Molecule::HRingFromDistance(3, 1.0);  // H3-triangle, 1 bohr apart
+    const auto N = molecule.numberOfElectrons();
+
+    const GQCP::GSpinorBasis<double, GQCP::GTOShell> g_spinor_basis {molecule, "STO-3G"};
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto S = g_spinor_basis.overlap();
+
+    const auto sq_hamiltonian = GQCP::GSQHamiltonian<double>::Molecular(g_spinor_basis, molecule);
+    const auto direct_sq_hamiltonian = GQCP::GSQHamiltonian<double>::FromCore(sq_hamiltonian.core());  // The two-electron integrals are recalculated in every iteration.
+
+
+    // Let both solvers start from the same initial guess.
+    GQCP::SquareMatrix<double> C_initial_matrix {6};
+    // clang-format off
+    C_initial_matrix << -0.3585282,  0.0,        0.89935394,  0.0,         0.0,        1.57117404,
+                        -0.3585282,  0.0,       -1.81035361,  0.0,         0.0,        0.00672366,
+                        -0.3585282,  0.0,        0.91099966,  0.0,         0.0,        1.56445038,
+                         0.0,       -0.3585282,  0.0,         0.89935394, -1.57117404, 0.0,
+                         0.0,       -0.3585282,  0.0,        -1.81035361,  0.00672366, 0.0,
+                         0.0,       -0.3585282,  0.0,         0.91099966,  1.56445038, 0.0;
+    // clang-format on
+    const GQCP::GTransformation<double> C_initial {C_initial_matrix};
+
+    GQCP::GHFSCFEnvironment<double> environment {N, sq_hamiltonian, S, C_initial};
+    auto solver = GQCP::GHFSCFSolver<double>::Plain(1.0e-08, 3000);
+    solver.perform(environment);
+
+    GQCP::GHFSCFEnvironment<double> direct_environment {N, direct_sq_hamiltonian, S, C_initial};
+    auto direct_solver = GQCP::GHFSCFSolver<double>::DirectPlain(scalar_basis, 1.0e-08, 3000);
+    direct_solver.perform(direct_environment);
+
+
+    BOOST_CHECK(std::abs(direct_environment.electronic_energies.back() - environment.electronic_energies.back()) < 1.0e-08);
+    BOOST_CHECK(direct_environment.orbital_energies.back().isApprox(environment.orbital_energies.back(), 1.0e-06));
+}
+
+
+/**
+ *  Check if the integral-direct DIIS GHF SCF solver finds the same solution as the regular DIIS GHF SCF solver for the H3-triangle of `H3_test_1`, when starting from a complex initial guess, so that the integral-direct Fock matrices are built from complex density matrices.
+ */
+BOOST_AUTO_TEST_CASE(H3_test_direct_complex) {
+
+    const auto molecule = GQCP::Molecule::HRingFromDistance(3, 1.0);  // H3-triangle, 1 bohr apart
+    const auto N = molecule.numberOfElectrons();
+
+    const GQCP::GSpinorBasis<GQCP::complex, GQCP::GTOShell> g_spinor_basis {molecule, "STO-3G"};
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto S = g_spinor_basis.overlap();
+
+    const auto sq_hamiltonian = GQCP::GSQHamiltonian<GQCP::complex>::Molecular(g_spinor_basis, molecule);
+    const auto direct_sq_hamiltonian = GQCP::GSQHamiltonian<GQCP::complex>::FromCore(sq_hamiltonian.core());  // The two-electron integrals are recalculated in every iteration.
+
+
+    // Let both solvers start from the same complex initial guess, which is the real guess of `H3_test_direct` rotated by the unitary matrix exp(i A), with A a real symmetric matrix.
+    GQCP::SquareMatrix<double> C_real {6};
+    // clang-format off
+    C_real << -0.3585282,  0.0,        0.89935394,  0.0,         0.0,        1.57117404,
+              -0.3585282,  0.0,       -1.81035361,  0.0,         0.0,        0.00672366,
+              -0.3585282,  0.0,        0.91099966,  0.0,         0.0,        1.56445038,
+               0.0,       -0.3585282,  0.0,         0.89935394, -1.57117404, 0.0,
+               0.0,       -0.3585282,  0.0,        -1.81035361,  0.00672366, 0.0,
+               0.0,       -0.3585282,  0.0,         0.91099966,  1.56445038, 0.0;
+    // clang-format on
+
+    GQCP::SquareMatrix<double> A {6};
+    for (size_t i = 0; i < 6; i++) {
+        for (size_t j = 0; j < 6; j++) {
+            A(i, j) = 0.1 / (1.0 + i + j);
+        }
+    }
+    const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> A_eigensolver {A};
+    const GQCP::VectorX<GQCP::complex> phases = (GQCP::complex(0.0, 1.0) * A_eigensolver.eigenvalues().cast<GQCP::complex>()).array().exp();
+    const GQCP::SquareMatrix<GQCP::complex> U = A_eigensolver.eigenvectors().cast<GQCP::complex>() * phases.asDiagonal() * A_eigensolver.eigenvectors().transpose().cast<GQCP::complex>();
+    const GQCP::GTransformation<GQCP::complex> C_initial {GQCP::SquareMatrix<GQCP::complex>(C_real.cast<GQCP::complex>() * U)};
+
+    GQCP::GHFSCFEnvironment<GQCP::complex> environment {N, sq_hamiltonian, S, C_initial};
+    auto solver = GQCP::GHFSCFSolver<GQCP::complex>::DIIS(6, 6, 1.0e-08, 3000);
+    solver.perform(environment);
+
+    GQCP::GHFSCFEnvironment<GQCP::complex> direct_environment {N, direct_sq_hamiltonian, S, C_initial};
+    auto direct_solver = GQCP::GHFSCFSolver<GQCP::complex>::DirectDIIS(scalar_basis, 6, 6, 1.0e-08, 3000);
+    direct_solver.perform(direct_environment);
+
+
+    BOOST_CHECK(std::abs(direct_environment.electronic_energies.back() - environment.electronic_energies.back()) < 1.0e-08);
+    BOOST_CHECK(direct_environment.orbital_energies.back().isApprox(environment.orbital_energies.back(), 1.0e-06));
+}
+
+
+/**
+ *  Check if the spin-blocked DIIS GHF SCF solver, which only stores the two-electron integrals over the spatial scalar basis, finds the same solution as the regular DIIS GHF SCF solver for the H3-triangle of `H3_test_1`.
+ */
+BOOST_AUTO_TEST_CASE(H3_test_spin_blocked) {
+
+    const auto molecule = GQCP::Molecule::HRingFromDistance(3, 1.0);  // H3-triangle, 1 bohr apart
+    const auto N = molecule.numberOfElectrons();
+
+    const GQCP::GSpinorBasis<double, GQCP::GTOShell> g_spinor_basis {molecule, "STO-3G"};
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto S = g_spinor_basis.overlap();
+
+    const auto sq_hamiltonian = GQCP::GSQHamiltonian<double>::Molecular(g_spinor_basis, molecule);
+    const auto spin_blocked_sq_hamiltonian = GQCP::GSQHamiltonian<double>::FromCore(sq_hamiltonian.core());  // The two-electron integrals are only kept over the spatial scalar basis.
+    auto g = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis);
+
+
+    // Let both solvers start from the same initial guess.
+    GQCP::SquareMatrix<double> C_initial_matrix {6};
+    // clang-format off
+    C_initial_matrix << -0.3585282,  0.0,        0.89935394,  0.0,         0.0,        1.57117404,
+                        -0.3585282,  0.0,       -1.81035361,  0.0,         0.0,        0.00672366,
+                        -0.3585282,  0.0,        0.91099966,  0.0,         0.0,        1.56445038,
+                         0.0,       -0.3585282,  0.0,         0.89935394, -1.57117404, 0.0,
+                         0.0,       -0.3585282,  0.0,        -1.81035361,  0.00672366, 0.0,
+                         0.0,       -0.3585282,  0.0,         0.91099966,  1.56445038, 0.0;
+    // clang-format on
+    const GQCP::GTransformation<double> C_initial {C_initial_matrix};
+
+    GQCP::GHFSCFEnvironment<double> environment {N, sq_hamiltonian, S, C_initial};
+    auto solver = GQCP::GHFSCFSolver<double>::DIIS(6, 6, 1.0e-08, 3000);
+    solver.perform(environment);
+
+    GQCP::GHFSCFEnvironment<double> spin_blocked_environment {N, spin_blocked_sq_hamiltonian, S, C_initial};
+    auto spin_blocked_solver = GQCP::GHFSCFSolver<double>::SpinBlockedDIIS(std::move(g), 6, 6, 1.0e-08, 3000);
+    spin_blocked_solver.perform(spin_blocked_environment);
+
+
+    BOOST_CHECK(std::abs(spin_blocked_environment.electronic_energies.back() - environment.electronic_energies.back()) < 1.0e-08);
+    BOOST_CHECK(spin_blocked_environment.orbital_energies.back().isApprox(environment.orbital_energies.back(), 1.0e-06));
+
+    // The environment only contains the core Hamiltonian, so the solver should have gotten past the iterations without acceleration by only using the spin-blocked Fock matrices.
+    BOOST_CHECK(spin_blocked_solver.numberOfIterations() > 6);
+}
@@ -352,3 +352,144 @@ BOOST_AUTO_TEST_CASE(h2_631gdp_diis) {
     // Check the electronic energy.
     BOOST_CHECK(std::abs(rhf_environment.electronic_energies.back() - ref_electronic_energy) < 1.0e-06);
 }
+
+
+/**
+ *  Check if the integral-direct DIIS RHF SCF solver, which never stores the two-electron integrals, finds the same energy as HORTON for H2O//STO-3G.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_direct_diis) {
+
+    const double ref_total_energy = -74.942080055631;
+
+    // Only the core Hamiltonian is quantized, the two-electron integrals are recalculated in every iteration.
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {water, "STO-3G"};
+    const auto H_core = spin_orbital_basis.quantize(GQCP::Operator::Kinetic()) + spin_orbital_basis.quantize(GQCP::Operator::NuclearAttraction(water));
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromCore(H_core);  // In an AO basis.
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(water.numberOfElectrons(), sq_hamiltonian, spin_orbital_basis.overlap());
+    auto direct_diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::DirectDIIS(spin_orbital_basis.scalarBasis());
+    direct_diis_rhf_scf_solver.perform(rhf_environment);
+
+
+    // Check the total energy.
+    const double total_energy = rhf_environment.electronic_energies.back() + GQCP::Operator::NuclearRepulsion(water).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-06);
+
+
+    // Without screening and without incremental Fock matrix builds, the same energy should be found.
+    auto unscreened_rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(water.numberOfElectrons(), sq_hamiltonian, spin_orbital_basis.overlap());
+    auto unscreened_direct_diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::DirectDIIS(spin_orbital_basis.scalarBasis(), 6, 6, 1.0e-08, 128, 1, 0.0, 0);
+    unscreened_direct_diis_rhf_scf_solver.perform(unscreened_rhf_environment);
+
+    BOOST_CHECK(std::abs(unscreened_rhf_environment.electronic_energies.back() - rhf_environment.electronic_energies.back()) < 1.0e-08);
+}
+
+
+/**
+ *  Check if the DIIS RHF SCF solver that builds the Fock matrix from Cholesky-decomposed two-electron integrals finds the same energy as HORTON for H2O//STO-3G.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_factorized_diis) {
+
+    const double ref_total_energy = -74.942080055631;
+
+    // Only the core Hamiltonian is quantized as a dense operator, the two-electron integrals are Cholesky-decomposed.
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {water, "STO-3G"};
+    const auto H_core = spin_orbital_basis.quantize(GQCP::Operator::Kinetic()) + spin_orbital_basis.quantize(GQCP::Operator::NuclearAttraction(water));
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromCore(H_core);             // In an AO basis.
+    const auto g = spin_orbital_basis.quantizeCholesky(GQCP::Operator::Coulomb(), 1.0e-10);  // In an AO basis.
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(water.numberOfElectrons(), sq_hamiltonian, spin_orbital_basis.overlap());
+    auto factorized_diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::FactorizedDIIS(g);
+    factorized_diis_rhf_scf_solver.perform(rhf_environment);
+
+
+    // Check the total energy.
+    const double total_energy = rhf_environment.electronic_energies.back() + GQCP::Operator::NuclearRepulsion(water).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-06);
+
+    // The environment only contains the core Hamiltonian, so the solver should have gotten past the iterations without acceleration without ever using dense two-electron integrals.
+    BOOST_CHECK(factorized_diis_rhf_scf_solver.numberOfIterations() > 6);
+}
+
+
+/**
+ *  Check if the DIIS RHF SCF solver finds the same energy as HORTON for H2O//STO-3G when the direct and exchange matrices are calculated by multiple worker threads.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_diis_threaded) {
+
+    const double ref_total_energy = -74.942080055631;
+
+    // Do our own RHF calculation.
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {water, "STO-3G"};
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::Molecular(spin_orbital_basis, water);  // In an AO basis.
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(water.numberOfElectrons(), sq_hamiltonian, spin_orbital_basis.overlap());
+    auto diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::DIIS(6, 6, 1.0e-08, 128, 3);
+    diis_rhf_scf_solver.perform(rhf_environment);
+
+
+    // Check the total energy.
+    const double total_energy = rhf_environment.electronic_energies.back() + GQCP::Operator::NuclearRepulsion(water).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-06);
+}
+
+
+/**
+ *  Check if the DIIS RHF SCF solver converges for H2O//aug-cc-pVDZ when the (diffuse) near-linear dependencies of the basis are removed through canonical orthogonalization.
+ *
+ *  The linear dependency threshold is placed above the two smallest eigenvalues of the overlap matrix, so that two functions are discarded. Since the resulting orbitals span a subspace of the full basis, the energy may not lie below the one of the full basis, but it should stay close to it.
+ */
+BOOST_AUTO_TEST_CASE(h2o_augccpvdz_diis_linear_dependencies) {
+
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {water, "aug-cc-pVDZ"};
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::Molecular(spin_orbital_basis, water);  // In an AO basis.
+    const auto S = spin_orbital_basis.overlap();
+    const auto K = spin_orbital_basis.numberOfSpatialOrbitals();
+
+
+    // Do a reference calculation in the full basis.
+    auto full_rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(water.numberOfElectrons(), sq_hamiltonian, S);
+    BOOST_REQUIRE(full_rhf_environment.orthogonalizer.numberOfDiscardedFunctions() == 0);
+
+    auto full_diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::DIIS();
+    full_diis_rhf_scf_solver.perform(full_rhf_environment);
+    const double full_electronic_energy = full_rhf_environment.electronic_energies.back();
+
+
+    // Discard the two functions that are closest to being linearly dependent.
+    const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {S.parameters()};
+    const auto& s = eigensolver.eigenvalues();  // In ascending order.
+    const double linear_dependency_threshold = 0.5 * (s(1) + s(2));
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(water.numberOfElectrons(), sq_hamiltonian, S, linear_dependency_threshold);
+    BOOST_REQUIRE(rhf_environment.orthogonalizer.numberOfDiscardedFunctions() == 2);
+
+    auto diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::DIIS();
+    BOOST_REQUIRE_NO_THROW(diis_rhf_scf_solver.perform(rhf_environment));
+
+
+    // The coefficient matrix stays square, but only its leading orbitals span the linearly independent part of the basis. These orbitals are orthonormal.
+    const auto& C = rhf_environment.coefficient_matrices.back().matrix();
+    BOOST_CHECK(static_cast<size_t>(C.rows()) == K);
+    BOOST_CHECK(static_cast<size_t>(C.cols()) == K);
+
+    const GQCP::MatrixX<double> C_independent = C.leftCols(K - 2);
+    BOOST_CHECK((C_independent.transpose() * S.parameters() * C_independent).isApprox(GQCP::MatrixX<double>::Identity(K - 2, K - 2), 1.0e-08));
+    BOOST_CHECK(static_cast<size_t>(rhf_environment.orbital_energies.back().size()) == K - 2);
+
+    const double electronic_energy = rhf_environment.electronic_energies.back();
+    BOOST_CHECK(electronic_energy > full_electronic_energy - 1.0e-08);
+    BOOST_CHECK(electronic_energy - full_electronic_energy < 1.0e-02);
+
+
+    // The RHF model requires a full set of orbitals, so the QCMethod should reject the environment before running the solver.
+    const GQCP::DiagonalRHFFockMatrixObjective<double> objective {sq_hamiltonian};
+    auto plain_rhf_scf_solver = GQCP::RHFSCFSolver<double>::Plain();
+    const auto number_of_electronic_energies = rhf_environment.electronic_energies.size();
+    BOOST_CHECK_THROW(GQCP::QCMethod::RHF<double>().optimize(objective, plain_rhf_scf_solver, rhf_environment), std::invalid_argument);
+    BOOST_CHECK(rhf_environment.electronic_energies.size() == number_of_electronic_energies);
+}
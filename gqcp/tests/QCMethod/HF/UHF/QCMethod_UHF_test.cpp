@@ -122,3 +122,30 @@ BOOST_AUTO_TEST_CASE(h2o_sto3g_diis) {
     BOOST_CHECK(ref_C.matrix().hasEqualSetsOfEigenvectorsAs(uhf_environment.coefficient_matrices.back().alpha().matrix(), 1.0e-05));
     BOOST_CHECK(ref_C.matrix().hasEqualSetsOfEigenvectorsAs(uhf_environment.coefficient_matrices.back().beta().matrix(), 1.0e-05));
 }
+
+
+/**
+ *  Check if the integral-direct plain UHF SCF solver, which never stores the two-electron integrals, finds the same energy as HORTON's RHF calculation for H2O//STO-3G.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_direct_plain) {
+
+    const double ref_total_energy = -74.942080055631;
+
+    // Only the core Hamiltonian is quantized, the two-electron integrals are recalculated in every iteration.
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const auto N_alpha = water.numberOfElectronPairs();
+    const auto N_beta = water.numberOfElectronPairs();
+
+    const GQCP::USpinOrbitalBasis<double, GQCP::GTOShell> spinor_basis {water, "STO-3G"};
+    const auto H_core = spinor_basis.quantize(GQCP::Operator::Kinetic()) + spinor_basis.quantize(GQCP::Operator::NuclearAttraction(water));
+    const auto sq_hamiltonian = GQCP::USQHamiltonian<double>::FromCore(H_core);  // In an AO basis.
+
+    auto uhf_environment = GQCP::UHFSCFEnvironment<double>::WithCoreGuess(N_alpha, N_beta, sq_hamiltonian, spinor_basis.overlap());
+    auto direct_plain_uhf_scf_solver = GQCP::UHFSCFSolver<double>::DirectPlain(spinor_basis.alpha().scalarBasis());
+    direct_plain_uhf_scf_solver.perform(uhf_environment);
+
+
+    // Check the total energy.
+    const double total_energy = uhf_environment.electronic_energies.back() + GQCP::Operator::NuclearRepulsion(water).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-06);
+}
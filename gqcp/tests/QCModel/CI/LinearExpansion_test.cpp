@@ -433,6 +433,25 @@ BOOST_AUTO_TEST_CASE(spin_resolved_vs_spin_resolved_selected_DMs) {
 }
 
 
+/**
+ *  Check if the 1-DMs for a random linear expansion in a full spin-resolved ONV basis, which are calculated from the single-excitation string tables, are equal to the 'selected' case.
+ */
+BOOST_AUTO_TEST_CASE(spin_resolved_vs_spin_resolved_selected_1DM_random) {
+
+    const GQCP::SpinResolvedONVBasis onv_basis {7, 3, 2};
+    const auto linear_expansion_specialized = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::Random(onv_basis);
+
+    const GQCP::SpinResolvedSelectedONVBasis onv_basis_selected {onv_basis};
+    const auto linear_expansion_selected = GQCP::LinearExpansion<GQCP::SpinResolvedSelectedONVBasis>(onv_basis_selected, linear_expansion_specialized.coefficients());
+
+    const auto D_specialized = linear_expansion_specialized.calculateSpinResolved1DM();
+    const auto D_selected = linear_expansion_selected.calculateSpinResolved1DM();
+
+    BOOST_CHECK(D_specialized.alpha().matrix().isApprox(D_selected.alpha().matrix(), 1.0e-12));
+    BOOST_CHECK(D_specialized.beta().matrix().isApprox(D_selected.beta().matrix(), 1.0e-12));
+}
+
+
 /**
  *  Check if the 1- and 2-DMs for a seniority-zero ONV basis are equal to the 'selected' case.
  *
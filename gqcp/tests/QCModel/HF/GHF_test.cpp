@@ -50,3 +50,46 @@ BOOST_AUTO_TEST_CASE(GHF_DMs) {
 
     BOOST_CHECK(std::abs(ghf_energy - expectation_value) < 1.0e-12);
 }
+
+
+/**
+ *  Check if the GHF Fock matrix from the spatial two-electron integrals, and the one from the spin-blocked two-electron integrals, are equal to the one from the separate direct and exchange contributions, for complex integrals and density matrices.
+ */
+BOOST_AUTO_TEST_CASE(calculateScalarBasisFockMatrix_spin_blocked) {
+
+    const size_t K = 3;
+    const size_t M = 2 * K;
+
+    // Set up random spatial integrals, and construct the corresponding spin-blocked integrals.
+    GQCP::Tensor<GQCP::complex, 4> g {K, K, K, K};
+    g.setRandom();
+
+    GQCP::SquareRankFourTensor<GQCP::complex> g_spin_blocked = GQCP::SquareRankFourTensor<GQCP::complex>::Zero(M);
+    for (size_t i = 0; i < M; i++) {
+        for (size_t j = 0; j < M; j++) {
+            for (size_t k = 0; k < M; k++) {
+                for (size_t l = 0; l < M; l++) {
+                    if (((i < K) == (j < K)) && ((k < K) == (l < K))) {
+                        g_spin_blocked(i, j, k, l) = g(i % K, j % K, k % K, l % K);
+                    }
+                }
+            }
+        }
+    }
+
+    const GQCP::ScalarGSQOneElectronOperator<GQCP::complex> H_core {GQCP::SquareMatrix<GQCP::complex>::Random(M)};
+    const GQCP::GSQHamiltonian<GQCP::complex> sq_hamiltonian {H_core, GQCP::ScalarGSQTwoElectronOperator<GQCP::complex> {g_spin_blocked}};
+    const GQCP::G1DM<GQCP::complex> P {GQCP::SquareMatrix<GQCP::complex>::Random(M)};
+
+
+    // Calculate the reference Fock matrix and check the results.
+    const auto J_ref = GQCP::QCModel::GHF<GQCP::complex>::calculateScalarBasisDirectMatrix(P, sq_hamiltonian).parameters();
+    const auto K_ref = GQCP::QCModel::GHF<GQCP::complex>::calculateScalarBasisExchangeMatrix(P, sq_hamiltonian).parameters();
+    const GQCP::SquareMatrix<GQCP::complex> F_ref = H_core.parameters() + J_ref - K_ref;
+
+    const auto F = GQCP::QCModel::GHF<GQCP::complex>::calculateScalarBasisFockMatrix(P, sq_hamiltonian);
+    BOOST_CHECK(F.parameters().isApprox(F_ref, 1.0e-12));
+
+    const auto F_spin_blocked = GQCP::QCModel::GHF<GQCP::complex>::calculateScalarBasisFockMatrix(P, H_core, g);
+    BOOST_CHECK(F_spin_blocked.parameters().isApprox(F_ref, 1.0e-12));
+}
@@ -126,3 +126,64 @@ BOOST_AUTO_TEST_CASE(RHF_DMs) {
 
     BOOST_CHECK(std::abs(rhf_energy - expectation_value) < 1.0e-12);
 }
+
+
+/**
+ *  Check if the RHF Fock matrix that is built from packed two-electron integrals is equal to the one that is built from the full two-electron integrals.
+ */
+BOOST_AUTO_TEST_CASE(packed_Fock_matrix) {
+
+    const size_t K = 7;
+
+    // Set up a random real Hamiltonian with the permutational symmetries of real integrals, and a random symmetric density matrix.
+    const auto g = GQCP::PackedRankFourTensor<double>::Random(K);
+
+    const GQCP::SquareMatrix<double> H_random = GQCP::SquareMatrix<double>::Random(K);
+    const GQCP::SquareMatrix<double> H = H_random + H_random.transpose();
+    const GQCP::ScalarRSQOneElectronOperator<double> h {H};
+    const GQCP::RSQHamiltonian<double> hamiltonian {h, GQCP::ScalarRSQTwoElectronOperator<double> {g}};
+
+    const GQCP::SquareMatrix<double> D_random = GQCP::SquareMatrix<double>::Random(K);
+    const GQCP::SquareMatrix<double> D_symmetric = D_random + D_random.transpose();
+    const GQCP::Orbital1DM<double> D {D_symmetric};
+
+
+    const auto F_ref = GQCP::QCModel::RHF<double>::calculateScalarBasisFockMatrix(D, hamiltonian);
+    const auto F = GQCP::QCModel::RHF<double>::calculateScalarBasisFockMatrix(D, h, g);
+
+    BOOST_CHECK(F.parameters().isApprox(F_ref.parameters(), 1.0e-12));
+}
+
+
+/**
+ *  Check if the RHF Fock matrix that is built from density-fitted two-electron integrals is equal to the one that is built from the reconstructed two-electron integrals.
+ */
+BOOST_AUTO_TEST_CASE(density_fitted_Fock_matrix) {
+
+    const size_t K = 6;
+    const size_t N_aux = 10;
+
+    // Set up random three-index factors that are symmetric in their orbital indices, and a random symmetric density matrix.
+    GQCP::MatrixX<double> B(K * K, N_aux);
+    for (size_t P = 0; P < N_aux; P++) {
+        const GQCP::SquareMatrix<double> M = GQCP::SquareMatrix<double>::Random(K);
+        const GQCP::SquareMatrix<double> M_symmetric = M + M.transpose();
+        B.col(P) = Eigen::Map<const Eigen::VectorXd>(M_symmetric.data(), K * K);
+    }
+    const GQCP::FactorizedRSQTwoElectronOperator<double> g {K, B};
+
+    const GQCP::SquareMatrix<double> H_random = GQCP::SquareMatrix<double>::Random(K);
+    const GQCP::SquareMatrix<double> H = H_random + H_random.transpose();
+    const GQCP::ScalarRSQOneElectronOperator<double> h {H};
+    const GQCP::RSQHamiltonian<double> hamiltonian {h, g.reconstructed()};
+
+    const GQCP::SquareMatrix<double> D_random = GQCP::SquareMatrix<double>::Random(K);
+    const GQCP::SquareMatrix<double> D_symmetric = D_random + D_random.transpose();
+    const GQCP::Orbital1DM<double> D {D_symmetric};
+
+
+    const auto F_ref = GQCP::QCModel::RHF<double>::calculateScalarBasisFockMatrix(D, hamiltonian);
+    const auto F = GQCP::QCModel::RHF<double>::calculateScalarBasisFockMatrix(D, h, g);
+
+    BOOST_CHECK(F.parameters().isApprox(F_ref.parameters(), 1.0e-10));
+}
@@ -844,7 +844,20 @@ void bindQCMethodHartreeFockSCFEnvironmentInterface(Class& py_class) {
 
         .def_readonly(
             "error_vectors",
-            &Type::error_vectors);
+            &Type::error_vectors)
+
+        /*
+         *  MARK: Histories
+         */
+
+        .def("set_history_capacity",
+             &Type::setHistoryCapacity,
+             py::arg("capacity"),
+             "Change the number of most recent iterates that are kept in the histories of this environment. By default, only the two most recent coefficient matrices, density matrices, Fock matrices, error vectors and orbital energies are kept. The electronic energies are always kept in full.")
+
+        .def("keep_full_history",
+             &Type::keepFullHistory,
+             "Keep every iterate that is added to the histories of this environment from now on, instead of only the most recent ones.");
 }
 
 
@@ -871,6 +884,7 @@ void bindHartreeFockSCFSolverInterface(Class& py_class) {
             py::arg("maximum_subspace_dimension") = 6,
             py::arg("threshold") = 1.0e-08,
             py::arg("maximum_number_of_iterations") = 128,
+            py::arg("number_of_threads") = 1,
             "Return a DIIS HF SCF solver that uses the combination of norm of the difference of two consecutive density matrices as a convergence criterion.")
 
         .def_static(
@@ -878,6 +892,7 @@ void bindHartreeFockSCFSolverInterface(Class& py_class) {
             &Type::Plain,
             py::arg("threshold") = 1.0e-08,
             py::arg("maximum_number_of_iterations") = 128,
+            py::arg("number_of_threads") = 1,
             "Return a plain GHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion.");
 }
 
@@ -17,10 +17,28 @@
 
 #pragma once
 
+#include "Mathematical/Algorithm/History.hpp"
+
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include <pybind11/eigen.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+
+namespace pybind11 {
+namespace detail {
+
+
+/**
+ *  Convert the history of an iterate in an algorithm environment to and from a Python list, just like an `std::deque`.
+ */
+template <typename Iterate>
+struct type_caster<GQCP::History<Iterate>>: list_caster<GQCP::History<Iterate>, Iterate> {};
+
+
+}  // namespace detail
+}  // namespace pybind11
 
 
 namespace gqcpy {
@@ -38,6 +38,10 @@ void bindEigenproblemEnvironment(py::module& module) {
             "dimension",
             &EigenproblemEnvironment::dimension)
 
+        .def_readwrite(
+            "number_of_matrix_vector_products",
+            &EigenproblemEnvironment::number_of_matrix_vector_products)
+
 
         // Bind properties with a custom setter (to allow for non-native Eigen types).
         .def_property(
@@ -106,19 +110,23 @@ void bindEigenproblemEnvironment(py::module& module) {
         .def_property(
             "V",
             [](const EigenproblemEnvironment& environment) {
-                return environment.V;
+                return MatrixX<double>(environment.activeV());
             },
             [](EigenproblemEnvironment& environment, const Eigen::MatrixXd& new_V) {
-                environment.V = MatrixX<double>(new_V);
+                environment.reserveSubspace(new_V.cols());
+                environment.subspaceStorage().leftCols(new_V.cols()) = new_V;
+                environment.subspace_dimension = new_V.cols();
             })
 
         .def_property(
             "VA",
             [](const EigenproblemEnvironment& environment) {
-                return environment.VA;
+                return MatrixX<double>(environment.activeVA());
             },
             [](EigenproblemEnvironment& environment, const Eigen::MatrixXd& new_VA) {
-                environment.VA = MatrixX<double>(new_VA);
+                environment.reserveSubspace(new_VA.cols());
+                environment.subspaceProductStorage().leftCols(new_VA.cols()) = new_VA;
+                environment.number_of_subspace_products = new_VA.cols();
             })
 
         .def_property(
@@ -146,7 +154,15 @@ void bindEigenproblemEnvironment(py::module& module) {
             },
             [](EigenproblemEnvironment& environment, const Eigen::MatrixXd& new_Delta) {
                 environment.Delta = MatrixX<double>(new_Delta);
-            });
+            })
+
+
+        // Bind methods.
+        .def(
+            "storeSubspaceOutOfCore",
+            &EigenproblemEnvironment::storeSubspaceOutOfCore,
+            py::arg("scratch_directory"),
+            "Move the subspace (V and VA) to out-of-core storage, i.e. to memory-mapped files in the given scratch directory.");
 }
 
 
@@ -31,6 +31,13 @@ using namespace GQCP;
 
 void bindEigenproblemSolver(py::module& module) {
 
+    py::enum_<DavidsonCorrection>(module, "DavidsonCorrection")
+
+        .value("diagonal", DavidsonCorrection::k_diagonal)
+        .value("olsen", DavidsonCorrection::k_olsen)
+        .export_values();
+
+
     auto module_eigenproblem_solver = module.def_submodule("EigenproblemSolver");
 
     module_eigenproblem_solver.def("Dense",
@@ -44,7 +51,10 @@ void bindEigenproblemSolver(py::module& module) {
                                    py::arg("convergence_threshold") = 1.0e-08,
                                    py::arg("correction_threshold") = 1.0e-12,
                                    py::arg("maximum_number_of_iterations") = 128,
-                                   py::arg("inclusion_threshold") = 1.0e-03);
+                                   py::arg("inclusion_threshold") = 1.0e-03,
+                                   py::arg("correction") = DavidsonCorrection::k_diagonal,
+                                   py::arg("preconditioner_block_dimension") = 0,
+                                   py::arg("thick_restart") = false);
 }
 
 
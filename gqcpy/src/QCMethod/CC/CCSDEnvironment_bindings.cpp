@@ -16,6 +16,7 @@
 // along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "QCMethod/CC/CCSDEnvironment.hpp"
+#include "gqcpy/include/utilities.hpp"
 
 #include <pybind11/eigen.h>
 #include <pybind11/pybind11.h>
@@ -73,7 +74,18 @@ void bindCCSDEnvironment(py::module& module) {
              [](CCSDEnvironment<double>& environment, const T2Amplitudes<double>& new_t2_amplitudes) {
                  environment.t2_amplitudes.pop_back();
                  environment.t2_amplitudes.push_back(new_t2_amplitudes);
-             });
+             })
+
+
+        // Bind methods that control how many iterates are kept.
+        .def("set_history_capacity",
+             &CCSDEnvironment<double>::setHistoryCapacity,
+             py::arg("capacity"),
+             "Change the number of most recent iterates that are kept in the histories of this environment. By default, only the two most recent T1- and T2-amplitudes and their error vectors are kept. The correlation energies are always kept in full.")
+
+        .def("keep_full_history",
+             &CCSDEnvironment<double>::keepFullHistory,
+             "Keep every iterate that is added to the histories of this environment from now on, instead of only the most recent ones.");
 }
 
 
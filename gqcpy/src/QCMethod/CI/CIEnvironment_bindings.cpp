@@ -23,6 +23,8 @@
 #include <pybind11/eigen.h>
 #include <pybind11/pybind11.h>
 
+#include <type_traits>
+
 
 namespace gqcpy {
 
@@ -53,15 +55,29 @@ void bindCIEnvironment(py::module& submodule, const std::string& documentation)
         py::arg("onv_basis"),
         documentation.c_str());
 
-    submodule.def(
-        "Iterative",
-        [](const Hamiltonian& hamiltonian, const ONVBasis& onv_basis, const MatrixX<double>& V) {
-            return CIEnvironment::Iterative(hamiltonian, onv_basis, V);
-        },
-        py::arg("hamiltonian"),
-        py::arg("onv_basis"),
-        py::arg("V"),
-        documentation.c_str());
+    // The restricted and unrestricted Hamiltonians in a full spin-resolved ONV basis evaluate their matrix-vector products through a `SpinResolvedSigmaEngine`, which can use several threads.
+    if constexpr (std::is_same<ONVBasis, SpinResolvedONVBasis>::value && (std::is_same<Hamiltonian, RSQHamiltonian<double>>::value || std::is_same<Hamiltonian, USQHamiltonian<double>>::value)) {
+        submodule.def(
+            "Iterative",
+            [](const Hamiltonian& hamiltonian, const ONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads) {
+                return CIEnvironment::Iterative(hamiltonian, onv_basis, V, number_of_threads);
+            },
+            py::arg("hamiltonian"),
+            py::arg("onv_basis"),
+            py::arg("V"),
+            py::arg("number_of_threads") = 1,
+            documentation.c_str());
+    } else {
+        submodule.def(
+            "Iterative",
+            [](const Hamiltonian& hamiltonian, const ONVBasis& onv_basis, const MatrixX<double>& V) {
+                return CIEnvironment::Iterative(hamiltonian, onv_basis, V);
+            },
+            py::arg("hamiltonian"),
+            py::arg("onv_basis"),
+            py::arg("V"),
+            documentation.c_str());
+    }
 }
 
 
@@ -72,6 +88,17 @@ void bindCIEnvironments(py::module& module) {
     bindCIEnvironment<RSQHamiltonian<double>, SpinResolvedONVBasis>(submodule, "Return an environment suitable for solving spin-resolved FCI eigenvalue problems.");
     bindCIEnvironment<USQHamiltonian<double>, SpinResolvedONVBasis>(submodule, "Return an environment suitable for solving spin-resolved FCI eigenvalue problems.");
     bindCIEnvironment<HubbardHamiltonian<double>, SpinResolvedONVBasis>(submodule, "Return an environment suitable for solving Hubbard problems.");
+
+    submodule.def(
+        "SingletIterative",
+        [](const RSQHamiltonian<double>& hamiltonian, const SpinResolvedONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads) {
+            return CIEnvironment::SingletIterative(hamiltonian, onv_basis, V, number_of_threads);
+        },
+        py::arg("hamiltonian"),
+        py::arg("onv_basis"),
+        py::arg("V"),
+        py::arg("number_of_threads") = 1,
+        "Return an environment suitable for solving spin-resolved FCI eigenvalue problems for singlet states, whose matrix-vector products only calculate the upper triangle of the (symmetric) coefficient matrix.");
 }
 
 
@@ -48,12 +48,13 @@ void bindRHFSCFSolverInterface(Class& py_class) {
     py_class
         .def_static(
             "DensityDamped",
-            [](const double alpha, const double threshold, const size_t maximum_number_of_iterations) {
-                return RHFSCFSolver<double>::DensityDamped(alpha, threshold, maximum_number_of_iterations);
+            [](const double alpha, const double threshold, const size_t maximum_number_of_iterations, const size_t number_of_threads) {
+                return RHFSCFSolver<double>::DensityDamped(alpha, threshold, maximum_number_of_iterations, number_of_threads);
             },
             py::arg("alpha"),
             py::arg("threshold") = 1.0e-08,
             py::arg("maximum_number_of_iterations") = 128,
+            py::arg("number_of_threads") = 1,
             "Return a density-damped RHF SCF solver that uses the norm of the difference of two consecutive density matrices as a convergence criterion.");
 }
 